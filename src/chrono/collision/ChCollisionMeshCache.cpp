@@ -0,0 +1,290 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
+#if defined(_WIN32)
+    #include <process.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "chrono/collision/ChCollisionMeshCache.h"
+#include "chrono/core/ChTimer.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+namespace chrono {
+
+// Cache file layout: fixed-size header, followed by the data block (aligned to 16 bytes).
+static const char cache_magic[8] = {'C', 'H', 'M', 'C', 'A', 'C', 'H', 'E'};
+static const uint32_t cache_version = 1;
+
+struct CacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t key;
+    uint64_t size;
+    double build_time;
+    char padding[24];
+};
+static_assert(sizeof(CacheHeader) % 16 == 0, "Cache header size must be a multiple of 16");
+
+static std::mutex cache_mutex;
+static std::string cache_dir;
+static bool cache_enabled = false;
+static bool cache_memory_map = false;
+static ChCollisionMeshCache::Statistics cache_stats = {0, 0, 0, 0, 0, 0};
+static std::atomic<unsigned int> cache_tmp_counter(0);
+
+static std::string CacheFilename(const std::string& kind, uint64_t key) {
+    std::stringstream ss;
+    ss << cache_dir << "/" << kind << "_" << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+    return ss.str();
+}
+
+static bool ValidHeader(const CacheHeader& header, uint64_t key, size_t file_size) {
+    return std::memcmp(header.magic, cache_magic, sizeof(cache_magic)) == 0 && header.version == cache_version &&
+           header.header_size == sizeof(CacheHeader) && header.key == key &&
+           header.size == file_size - sizeof(CacheHeader);
+}
+
+// -----------------------------------------------------------------------------
+
+ChCollisionMeshCache::Entry::~Entry() {
+#if !defined(_WIN32)
+    if (m_map)
+        munmap(m_map, m_map_size);
+#endif
+}
+
+ChCollisionMeshCache::Hasher& ChCollisionMeshCache::Hasher::Add(const void* data, size_t size) {
+    auto bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        m_hash ^= bytes[i];
+        m_hash *= 1099511628211ULL;
+    }
+    return *this;
+}
+
+char* ChCollisionMeshCache::Writer::Reserve(size_t size, size_t n) {
+    // Array header: number of elements and size in bytes, padded to 16 bytes
+    size_t pos = m_buffer.size();
+    uint64_t array_header[2] = {(uint64_t)n, (uint64_t)size};
+    size_t padded = (size + 15) & ~size_t(15);
+    m_buffer.resize(pos + sizeof(array_header) + padded, 0);
+    std::memcpy(&m_buffer[pos], array_header, sizeof(array_header));
+    return &m_buffer[pos + sizeof(array_header)];
+}
+
+char* ChCollisionMeshCache::Reader::Next(size_t& n, size_t& size) {
+    uint64_t array_header[2];
+    if (m_pos + sizeof(array_header) > m_size)
+        return nullptr;
+    std::memcpy(array_header, m_data + m_pos, sizeof(array_header));
+    n = (size_t)array_header[0];
+    size = (size_t)array_header[1];
+    size_t padded = (size + 15) & ~size_t(15);
+    if (m_pos + sizeof(array_header) + padded > m_size)
+        return nullptr;
+    char* data = m_data + m_pos + sizeof(array_header);
+    m_pos += sizeof(array_header) + padded;
+    return data;
+}
+
+// -----------------------------------------------------------------------------
+
+bool ChCollisionMeshCache::Enable(const std::string& dir, bool memory_map) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto path = filesystem::path(dir);
+    if (!path.exists() && !filesystem::create_subdirectory(path))
+        return false;
+    cache_dir = dir;
+    cache_enabled = true;
+#if defined(_WIN32)
+    cache_memory_map = false;
+#else
+    cache_memory_map = memory_map;
+#endif
+    return true;
+}
+
+void ChCollisionMeshCache::Disable() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache_enabled = false;
+}
+
+bool ChCollisionMeshCache::IsEnabled() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return cache_enabled;
+}
+
+std::shared_ptr<ChCollisionMeshCache::Entry> ChCollisionMeshCache::Load(const std::string& kind, uint64_t key) {
+    std::string filename;
+    bool memory_map;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if (!cache_enabled)
+            return nullptr;
+        filename = CacheFilename(kind, key);
+        memory_map = cache_memory_map;
+    }
+
+    ChTimer timer;
+    timer.start();
+
+    std::shared_ptr<Entry> entry(new Entry);
+    CacheHeader header;
+
+#if !defined(_WIN32)
+    if (memory_map) {
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            struct stat st;
+            if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(CacheHeader)) {
+                // Private mapping: pages are copied on write and changes are not written back to the file
+                void* map = mmap(nullptr, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+                if (map != MAP_FAILED) {
+                    entry->m_map = map;
+                    entry->m_map_size = (size_t)st.st_size;
+                    std::memcpy(&header, map, sizeof(CacheHeader));
+                    if (ValidHeader(header, key, entry->m_map_size)) {
+                        entry->m_data = static_cast<char*>(map) + sizeof(CacheHeader);
+                        entry->m_size = (size_t)header.size;
+                    }
+                }
+            }
+            close(fd);
+        }
+    }
+#endif
+
+    if (!entry->m_data && !entry->m_map) {
+        std::ifstream ifs(filename, std::ios::binary | std::ios::ate);
+        if (ifs.good()) {
+            size_t file_size = (size_t)ifs.tellg();
+            ifs.seekg(0);
+            if (file_size >= sizeof(CacheHeader) && ifs.read(reinterpret_cast<char*>(&header), sizeof(CacheHeader)) &&
+                ValidHeader(header, key, file_size)) {
+                // Allocate with some slack so that the data block can be aligned to 16 bytes
+                entry->m_buffer.resize((size_t)header.size + 16);
+                size_t offset = (16 - reinterpret_cast<uintptr_t>(entry->m_buffer.data()) % 16) % 16;
+                if (ifs.read(entry->m_buffer.data() + offset, (std::streamsize)header.size)) {
+                    entry->m_data = entry->m_buffer.data() + offset;
+                    entry->m_size = (size_t)header.size;
+                }
+            }
+        }
+    }
+
+    timer.stop();
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (!entry->m_data) {
+        cache_stats.num_misses++;
+        return nullptr;
+    }
+    cache_stats.num_hits++;
+    cache_stats.load_time += timer.GetTimeSeconds();
+    cache_stats.saved_time += header.build_time - timer.GetTimeSeconds();
+    return entry;
+}
+
+bool ChCollisionMeshCache::Store(const std::string& kind,
+                                 uint64_t key,
+                                 const std::vector<char>& data,
+                                 double build_time) {
+    std::string filename;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if (!cache_enabled)
+            return false;
+        filename = CacheFilename(kind, key);
+        cache_stats.build_time += build_time;
+    }
+
+    CacheHeader header;
+    std::memset(&header, 0, sizeof(CacheHeader));
+    std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+    header.version = cache_version;
+    header.header_size = sizeof(CacheHeader);
+    header.key = key;
+    header.size = data.size();
+    header.build_time = build_time;
+
+    // Write to a temporary file, then rename it, so that concurrent runs never read a partial entry.
+    // The temporary file name is unique across processes (process id) and threads (counter).
+#if defined(_WIN32)
+    int pid = _getpid();
+#else
+    int pid = (int)getpid();
+#endif
+    std::stringstream tmp_name;
+    tmp_name << filename << ".tmp" << pid << "_" << cache_tmp_counter++;
+    {
+        std::ofstream ofs(tmp_name.str(), std::ios::binary);
+        if (!ofs.good())
+            return false;
+        ofs.write(reinterpret_cast<const char*>(&header), sizeof(CacheHeader));
+        ofs.write(data.data(), (std::streamsize)data.size());
+        if (!ofs.good()) {
+            ofs.close();
+            std::remove(tmp_name.str().c_str());
+            return false;
+        }
+    }
+#if defined(_WIN32)
+    // std::rename does not replace an existing file on Windows
+    std::remove(filename.c_str());
+#endif
+    if (std::rename(tmp_name.str().c_str(), filename.c_str()) != 0) {
+        std::remove(tmp_name.str().c_str());
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache_stats.num_stores++;
+    return true;
+}
+
+ChCollisionMeshCache::Statistics ChCollisionMeshCache::GetStatistics() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return cache_stats;
+}
+
+void ChCollisionMeshCache::ResetStatistics() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache_stats = {0, 0, 0, 0, 0, 0};
+}
+
+void ChCollisionMeshCache::PrintStatistics(std::ostream& os) {
+    auto stats = GetStatistics();
+    os << "Collision mesh cache" << std::endl;
+    os << "  Hits / misses / stores:  " << stats.num_hits << " / " << stats.num_misses << " / " << stats.num_stores
+       << std::endl;
+    os << "  Load time (s):           " << stats.load_time << std::endl;
+    os << "  Build time (s):          " << stats.build_time << std::endl;
+    os << "  Startup time saved (s):  " << stats.saved_time << std::endl;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,203 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CH_COLLISION_MESH_CACHE_H
+#define CH_COLLISION_MESH_CACHE_H
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_collision
+/// @{
+
+/// On-disk cache of preprocessed collision mesh data.
+/// Collision systems can store data that is expensive to compute from a collision mesh (e.g., BVHs, mesh connectivity,
+/// convex hulls and convex decompositions) and retrieve it in later runs, instead of recomputing it. Cache entries are
+/// binary files, identified by a data kind and by a 64-bit key obtained by hashing the content used to generate them
+/// (see Hasher). Entries can be read in memory or memory-mapped (where supported).
+/// The cache is disabled by default. It is shared by all collision models and should be configured before creating
+/// them. Cache files are specific to a given platform and Chrono build.
+class ChApi ChCollisionMeshCache {
+  public:
+    /// Data block retrieved from the cache.
+    /// The data stays valid (and, if memory-mapped, the file stays mapped) as long as the entry is alive.
+    /// The data can be modified in memory; changes are never written back to the cache file.
+    class ChApi Entry {
+      public:
+        ~Entry();
+
+        char* GetData() { return m_data; }
+        const char* GetData() const { return m_data; }
+        size_t GetSize() const { return m_size; }
+
+      private:
+        Entry() : m_data(nullptr), m_size(0), m_map(nullptr), m_map_size(0) {}
+
+        char* m_data;                ///< start of the data block
+        size_t m_size;               ///< size of the data block
+        std::vector<char> m_buffer;  ///< data read in memory
+        void* m_map;                 ///< start of the memory-mapped file (if any)
+        size_t m_map_size;           ///< size of the memory-mapped file
+
+        friend class ChCollisionMeshCache;
+    };
+
+    /// Utility class for computing content keys (64-bit FNV-1a hash).
+    class ChApi Hasher {
+      public:
+        Hasher() : m_hash(14695981039346656037ULL) {}
+
+        /// Include the given bytes in the hash.
+        Hasher& Add(const void* data, size_t size);
+
+        /// Include a value of a trivially copyable type in the hash.
+        template <typename T>
+        Hasher& Add(const T& value) {
+            return Add(&value, sizeof(T));
+        }
+
+        /// Include the contents of a vector of trivially copyable elements in the hash.
+        template <typename T>
+        Hasher& Add(const std::vector<T>& values) {
+            Add(values.size());
+            return Add(values.data(), values.size() * sizeof(T));
+        }
+
+        /// Include a string in the hash.
+        Hasher& Add(const std::string& str) {
+            Add(str.size());
+            return Add(str.data(), str.size());
+        }
+
+        /// Return the current hash value.
+        uint64_t GetKey() const { return m_hash; }
+
+      private:
+        uint64_t m_hash;
+    };
+
+    /// Utility class for packing arrays of trivially copyable elements in a data block.
+    /// Each array is stored with its size and starts at an offset aligned to 16 bytes.
+    class ChApi Writer {
+      public:
+        /// Append an array of n elements.
+        template <typename T>
+        void Write(const T* values, size_t n) {
+            char* dst = Reserve(n * sizeof(T), n);
+            if (n)
+                std::memcpy(dst, values, n * sizeof(T));
+        }
+
+        /// Append the contents of a vector.
+        template <typename T>
+        void Write(const std::vector<T>& values) {
+            Write(values.data(), values.size());
+        }
+
+        /// Reserve space for an array of given size (in bytes) with n elements and return its start address.
+        /// The address is only valid until the next call to a Write or Reserve function.
+        char* Reserve(size_t size, size_t n);
+
+        const std::vector<char>& GetBuffer() const { return m_buffer; }
+
+      private:
+        std::vector<char> m_buffer;
+    };
+
+    /// Utility class for reading arrays packed with a Writer.
+    /// Read functions return nullptr if the data block is corrupt.
+    class ChApi Reader {
+      public:
+        Reader(char* data, size_t size) : m_data(data), m_size(size), m_pos(0) {}
+
+        /// Access in place the next array, with elements of given type, and return its number of elements.
+        template <typename T>
+        T* Read(size_t& n) {
+            size_t size;
+            char* data = Next(n, size);
+            if (!data || size != n * sizeof(T))
+                return nullptr;
+            return reinterpret_cast<T*>(data);
+        }
+
+        /// Copy the next array in the given vector. Return false if the data block is corrupt.
+        template <typename T>
+        bool Read(std::vector<T>& values) {
+            size_t n;
+            T* data = Read<T>(n);
+            if (!data)
+                return false;
+            values.assign(data, data + n);
+            return true;
+        }
+
+      private:
+        char* Next(size_t& n, size_t& size);
+
+        char* m_data;
+        size_t m_size;
+        size_t m_pos;
+    };
+
+    /// Cache statistics.
+    struct Statistics {
+        int num_hits;       ///< number of entries found in the cache
+        int num_misses;     ///< number of entries not found in the cache
+        int num_stores;     ///< number of entries written to the cache
+        double load_time;   ///< time spent loading entries from the cache (s)
+        double saved_time;  ///< build time of the loaded entries, minus the time to load them (s)
+        double build_time;  ///< time spent building data not found in the cache (s)
+    };
+
+    /// Enable the cache, using the specified directory (created if it does not exist).
+    /// If memory_map is true, cache entries are memory-mapped instead of read in memory (POSIX platforms only).
+    static bool Enable(const std::string& dir, bool memory_map = false);
+
+    /// Disable the cache.
+    static void Disable();
+
+    /// Return true if the cache is enabled.
+    static bool IsEnabled();
+
+    /// Load the entry of given kind and key. Return nullptr if the cache is disabled or the entry is not found.
+    static std::shared_ptr<Entry> Load(const std::string& kind, uint64_t key);
+
+    /// Store an entry of given kind and key.
+    /// The time (in seconds) spent building the data is stored with the entry and used to report saved time.
+    /// No-op if the cache is disabled.
+    static bool Store(const std::string& kind, uint64_t key, const std::vector<char>& data, double build_time);
+
+    /// Return the cache statistics.
+    static Statistics GetStatistics();
+
+    /// Reset the cache statistics.
+    static void ResetStatistics();
+
+    /// Print the cache statistics (hits, misses, and startup time saved).
+    static void PrintStatistics(std::ostream& os);
+};
+
+/// @} chrono_collision
+
+}  // end namespace chrono
+
+#endif
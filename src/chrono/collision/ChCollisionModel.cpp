@@ -168,6 +168,13 @@ void ChCollisionModel::AddShapes(std::shared_ptr<ChCollisionModel> model, const
     }
 }
 
+void ChCollisionModel::SetShapeTemplate(std::shared_ptr<ChCollisionModel> model) {
+    m_shape_template = model;
+    m_shape_instances = model->m_shape_instances;
+    model_envelope = model->model_envelope;
+    model_safe_margin = model->model_safe_margin;
+}
+
 void ChCollisionModel::AddCylinder(std::shared_ptr<ChContactMaterial> material,
                                    double radius,
                                    const ChVector3d& p1,
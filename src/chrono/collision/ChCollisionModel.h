@@ -68,6 +68,15 @@ class ChApi ChCollisionModel {
                    const ChFrame<>& frame = ChFrame<>()      ///< model frame in model
     );
 
+    /// Use the collision shapes of the provided model (the shape "template").
+    /// This replaces all shapes in this model with those of the template and copies the template envelope and safe
+    /// margin. Collision systems that support it (e.g., Bullet) create the underlying collision geometry only once and
+    /// share it among all models using the same template. The template shapes must not be modified afterwards.
+    void SetShapeTemplate(std::shared_ptr<ChCollisionModel> model);
+
+    /// Return the shape template of this model, if any (see SetShapeTemplate).
+    std::shared_ptr<ChCollisionModel> GetShapeTemplate() const { return m_shape_template; }
+
     /// Set the pointer to the contactable object.
     void SetContactable(ChContactable* contactable);
 
@@ -192,7 +201,8 @@ class ChApi ChCollisionModel {
     short int family_group;  ///< Collision family group
     short int family_mask;   ///< Collision family mask
 
-    std::vector<ShapeInstance> m_shape_instances;  ///< list of collision shapes and positions in model
+    std::vector<ShapeInstance> m_shape_instances;        ///< list of collision shapes and positions in model
+    std::shared_ptr<ChCollisionModel> m_shape_template;  ///< model providing the collision shapes (if any)
 
     ChCollisionModelImpl* impl;  ///< concrete implementation of the collision model
 
@@ -51,6 +51,16 @@ void ChCollisionSystem::UnbindItem(std::shared_ptr<ChPhysicsItem> item) {
     item->RemoveCollisionModelsFromSystem(this);
 }
 
+int ChCollisionSystem::RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const {
+    results.resize(rays.size());
+    int num_hits = 0;
+    for (size_t i = 0; i < rays.size(); i++) {
+        if (RayHit(rays[i].from, rays[i].to, results[i]))
+            num_hits++;
+    }
+    return num_hits;
+}
+
 void ChCollisionSystem::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChCollisionSystem>();
@@ -186,6 +186,18 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Ray definition for batched ray-hit tests.
+    struct ChRay {
+        ChVector3d from;  ///< ray start point
+        ChVector3d to;    ///< ray end point
+    };
+
+    /// Perform ray-hit tests with the collision models for a batch of rays.
+    /// On return, 'results' has the same size as 'rays' and results[i] is the outcome of the test for rays[i]. The
+    /// return value is the number of rays that hit a collision model. The default implementation invokes RayHit for
+    /// each ray in sequence; derived classes may process the rays concurrently.
+    virtual int RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const;
+
     /// Class to be used as a callback interface for user-defined visualization of collision shapes.
     class ChApi VisualizationCallback {
       public:
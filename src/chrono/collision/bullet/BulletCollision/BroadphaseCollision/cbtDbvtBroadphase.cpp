@@ -123,6 +123,76 @@ struct cbtDbvtTreeCollider : cbtDbvt::ICollide
 	}
 };
 
+/* ***CHRONO*** Buffering tree collider, used for parallel tree-tree collisions	*/
+struct cbtDbvtBufferedCollider : cbtDbvt::ICollide
+{
+	cbtAlignedObjectArray<cbtDbvtProxy*> proxies;  // Pairs of overlapping proxies, stored consecutively
+	void Process(const cbtDbvtNode* na, const cbtDbvtNode* nb)
+	{
+		if (na != nb)
+		{
+			proxies.push_back((cbtDbvtProxy*)na->data);
+			proxies.push_back((cbtDbvtProxy*)nb->data);
+		}
+	}
+};
+
+/* ***CHRONO*** Split a set of tree-tree collision tasks until there are at least 'count' of them.
+Uses the same traversal rules as cbtDbvt::collideTT, so that running collideTT on all resulting tasks
+finds the same overlapping leaves as running it on the initial tasks. */
+static void splitCollideTasks(cbtAlignedObjectArray<cbtDbvt::sStkNN>& tasks, int count)
+{
+	cbtAlignedObjectArray<cbtDbvt::sStkNN> split;
+	bool refined = true;
+	while (refined && tasks.size() > 0 && tasks.size() < count)
+	{
+		refined = false;
+		split.resize(0);
+		for (int i = 0; i < tasks.size(); ++i)
+		{
+			const cbtDbvt::sStkNN& p = tasks[i];
+			if (p.a == p.b)
+			{
+				if (p.a->isinternal())
+				{
+					split.push_back(cbtDbvt::sStkNN(p.a->childs[0], p.a->childs[0]));
+					split.push_back(cbtDbvt::sStkNN(p.a->childs[1], p.a->childs[1]));
+					split.push_back(cbtDbvt::sStkNN(p.a->childs[0], p.a->childs[1]));
+					refined = true;
+				}
+			}
+			else if (Intersect(p.a->volume, p.b->volume))
+			{
+				if (p.a->isinternal() && p.b->isinternal())
+				{
+					split.push_back(cbtDbvt::sStkNN(p.a->childs[0], p.b->childs[0]));
+					split.push_back(cbtDbvt::sStkNN(p.a->childs[1], p.b->childs[0]));
+					split.push_back(cbtDbvt::sStkNN(p.a->childs[0], p.b->childs[1]));
+					split.push_back(cbtDbvt::sStkNN(p.a->childs[1], p.b->childs[1]));
+					refined = true;
+				}
+				else if (p.a->isinternal())
+				{
+					split.push_back(cbtDbvt::sStkNN(p.a->childs[0], p.b));
+					split.push_back(cbtDbvt::sStkNN(p.a->childs[1], p.b));
+					refined = true;
+				}
+				else if (p.b->isinternal())
+				{
+					split.push_back(cbtDbvt::sStkNN(p.a, p.b->childs[0]));
+					split.push_back(cbtDbvt::sStkNN(p.a, p.b->childs[1]));
+					refined = true;
+				}
+				else
+				{
+					split.push_back(p);
+				}
+			}
+		}
+		tasks.copyFromArray(split);
+	}
+}
+
 //
 // cbtDbvtBroadphase
 //
@@ -132,6 +202,7 @@ cbtDbvtBroadphase::cbtDbvtBroadphase(cbtOverlappingPairCache* paircache)
 {
 	m_deferedcollide = false;
 	m_needcleanup = true;
+	m_numThreads = 1;
 	m_releasepaircache = (paircache != 0) ? false : true;
 	m_prediction = 0;
 	m_stageCurrent = 0;
@@ -565,6 +636,45 @@ void cbtDbvtBroadphase::collide(cbtDispatcher* dispatcher)
 		m_needcleanup = true;
 	}
 	/* collide dynamics		*/
+	if (m_deferedcollide && m_numThreads > 1)
+	{
+		/* ***CHRONO*** Parallel tree-tree collisions.
+		The traversal is split in independent tasks, each processed by one thread into its own buffer.
+		Buffers are then merged serially, in task order, into the pair cache. */
+		SPC(m_profiling.m_ddcollide);
+		cbtAlignedObjectArray<cbtDbvt::sStkNN> tasks;
+		if (m_sets[0].m_root && m_sets[1].m_root)
+			tasks.push_back(cbtDbvt::sStkNN(m_sets[0].m_root, m_sets[1].m_root));
+		if (m_sets[0].m_root)
+			tasks.push_back(cbtDbvt::sStkNN(m_sets[0].m_root, m_sets[0].m_root));
+		splitCollideTasks(tasks, 64);
+		cbtAlignedObjectArray<cbtDbvtBufferedCollider> buffers;
+		buffers.resize(tasks.size());
+		const int numTasks = tasks.size();
+#if BT_USE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(m_numThreads)
+#endif
+		for (int i = 0; i < numTasks; ++i)
+		{
+			m_sets[0].collideTT(tasks[i].a, tasks[i].b, buffers[i]);
+		}
+		for (int i = 0; i < numTasks; ++i)
+		{
+			const cbtAlignedObjectArray<cbtDbvtProxy*>& proxies = buffers[i].proxies;
+			for (int k = 0; k < proxies.size(); k += 2)
+			{
+				cbtDbvtProxy* pa = proxies[k];
+				cbtDbvtProxy* pb = proxies[k + 1];
+#if DBVT_BP_SORTPAIRS
+				if (pa->m_uniqueId > pb->m_uniqueId)
+					cbtSwap(pa, pb);
+#endif
+				m_paircache->addOverlappingPair(pa, pb);
+				++m_newpairs;
+			}
+		}
+	}
+	else
 	{
 		cbtDbvtTreeCollider collider(this);
 		if (m_deferedcollide)
@@ -623,6 +733,13 @@ void cbtDbvtBroadphase::collide(cbtDispatcher* dispatcher)
 	m_updates_call /= 2;
 }
 
+//
+void cbtDbvtBroadphase::setNumThreads(int numThreads)
+{
+	m_numThreads = cbtMax(numThreads, 1);
+	m_deferedcollide = (m_numThreads > 1);
+}
+
 //
 void cbtDbvtBroadphase::optimize()
 {
@@ -671,7 +788,7 @@ void cbtDbvtBroadphase::resetPool(cbtDispatcher* dispatcher)
 		m_sets[0].clear();
 		m_sets[1].clear();
 
-		m_deferedcollide = false;
+		m_deferedcollide = (m_numThreads > 1);  // ***CHRONO***
 		m_needcleanup = true;
 		m_stageCurrent = 0;
 		m_fixedleft = 0;
@@ -88,6 +88,7 @@ struct cbtDbvtBroadphase : cbtBroadphaseInterface
 	bool m_releasepaircache;                    // Release pair cache on delete
 	bool m_deferedcollide;                      // Defere dynamic/static collision to collide call
 	bool m_needcleanup;                         // Need to run cleanup?
+	int m_numThreads;                           // ***CHRONO*** Number of OpenMP threads for tree collision
 	cbtAlignedObjectArray<cbtAlignedObjectArray<const cbtDbvtNode*> > m_rayTestStacks;
 #if DBVT_BP_PROFILE
 	cbtClock m_clock;
@@ -106,6 +107,13 @@ struct cbtDbvtBroadphase : cbtBroadphaseInterface
 	void collide(cbtDispatcher* dispatcher);
 	void optimize();
 
+	/* ***CHRONO*** Parallel pair update */
+	///set the number of OpenMP threads used to find new overlapping pairs.
+	///with more than one thread, tree-tree collisions are deferred to collide() and the two trees are traversed
+	///concurrently; pairs found by each thread are buffered and added to the pair cache in a deterministic order.
+	void setNumThreads(int numThreads);
+	int getNumThreads() const { return m_numThreads; }
+
 	/* cbtBroadphaseInterface Implementation	*/
 	cbtBroadphaseProxy* createProxy(const cbtVector3& aabbMin, const cbtVector3& aabbMax, int shapeType, void* userPtr, int collisionFilterGroup, int collisionFilterMask, cbtDispatcher* dispatcher);
 	virtual void destroyProxy(cbtBroadphaseProxy* proxy, cbtDispatcher* dispatcher);
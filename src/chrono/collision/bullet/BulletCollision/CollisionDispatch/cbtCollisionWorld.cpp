@@ -69,7 +69,8 @@ cbtCollisionWorld::cbtCollisionWorld(cbtDispatcher* dispatcher, cbtBroadphaseInt
 	: m_dispatcher1(dispatcher),
 	  m_broadphasePairCache(pairCache),
 	  m_debugDrawer(0),
-	  m_forceUpdateAllAabbs(true)
+	  m_forceUpdateAllAabbs(true),
+	  m_numThreads(1)
 {
 }
 
@@ -154,6 +155,12 @@ void cbtCollisionWorld::addCollisionObject(cbtCollisionObject* collisionObject,
 void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 {
 	cbtVector3 minAabb, maxAabb;
+	computeSingleAabb(colObj, minAabb, maxAabb);
+	setSingleAabb(colObj, minAabb, maxAabb);
+}
+
+void cbtCollisionWorld::computeSingleAabb(const cbtCollisionObject* colObj, cbtVector3& minAabb, cbtVector3& maxAabb)
+{
 	colObj->getCollisionShape()->getAabb(colObj->getWorldTransform(), minAabb, maxAabb);
 	//need to increase the aabb for contact thresholds
 	cbtVector3 contactThreshold(gContactBreakingThreshold, gContactBreakingThreshold, gContactBreakingThreshold);
@@ -170,7 +177,10 @@ void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 		minAabb.setMin(minAabb2);
 		maxAabb.setMax(maxAabb2);
 	}
+}
 
+void cbtCollisionWorld::setSingleAabb(cbtCollisionObject* colObj, const cbtVector3& minAabb, const cbtVector3& maxAabb)
+{
 	cbtBroadphaseInterface* bp = (cbtBroadphaseInterface*)m_broadphasePairCache;
 
 	//moving objects should be moderately sized, probably something wrong if not
@@ -200,6 +210,29 @@ void cbtCollisionWorld::updateAabbs()
 {
 	BT_PROFILE("updateAabbs");
 
+	/* ***CHRONO*** With multiple threads, compute all AABBs concurrently, then update the broadphase serially */
+	if (m_numThreads > 1)
+	{
+		const int numObjects = m_collisionObjects.size();
+		m_aabbBuffer.resize(2 * numObjects);
+#if BT_USE_OPENMP
+#pragma omp parallel for schedule(static) num_threads(m_numThreads)
+#endif
+		for (int i = 0; i < numObjects; i++)
+		{
+			const cbtCollisionObject* colObj = m_collisionObjects[i];
+			if (m_forceUpdateAllAabbs || colObj->isActive())
+				computeSingleAabb(colObj, m_aabbBuffer[2 * i], m_aabbBuffer[2 * i + 1]);
+		}
+		for (int i = 0; i < numObjects; i++)
+		{
+			cbtCollisionObject* colObj = m_collisionObjects[i];
+			if (m_forceUpdateAllAabbs || colObj->isActive())
+				setSingleAabb(colObj, m_aabbBuffer[2 * i], m_aabbBuffer[2 * i + 1]);
+		}
+		return;
+	}
+
 	cbtTransform predictedTrans;
 	for (int i = 0; i < m_collisionObjects.size(); i++)
 	{
@@ -385,6 +418,15 @@ void cbtCollisionWorld::rayTestSingleInternal(const cbtTransform& rayFromTrans,
 					shapeInfo.m_shapePart = partId;
 					shapeInfo.m_triangleIndex = triangleIndex;
 
+					/* ***CHRONO*** Representative triangles are hit on their margin (as for cbtCEtriangleShape), so that
+					the hit point is consistent with the margin-based correction done by the Chrono collision system. */
+					if (m_triangleMesh->isCEtriangleMesh())
+					{
+						cbtScalar proj = cbtFabs((m_to - m_from).dot(hitNormalLocal));
+						if (proj > SIMD_EPSILON)
+							hitFraction = cbtMax(cbtScalar(0), hitFraction - m_triangleMesh->getMargin() / proj);
+					}
+
 					cbtVector3 hitNormalWorld = m_colObjWorldTransform.getBasis() * hitNormalLocal;
 
 					cbtCollisionWorld::LocalRayResult rayResult(m_collisionObject,
@@ -144,6 +144,10 @@ public:
 
 	void updateSingleAabb(cbtCollisionObject* colObj);
 
+	// ***CHRONO*** AABB update split in computation (thread-safe) and broadphase update
+	void computeSingleAabb(const cbtCollisionObject* colObj, cbtVector3& minAabb, cbtVector3& maxAabb);
+	void setSingleAabb(cbtCollisionObject* colObj, const cbtVector3& minAabb, const cbtVector3& maxAabb);
+
 	virtual void updateAabbs();
 
 	///the computeOverlappingPairs is usually already called by performDiscreteCollisionDetection (or stepSimulation)
@@ -515,6 +519,14 @@ public:
 	// ***CHRONO***
     chrono::ChTimer timer_collision_broad;
     chrono::ChTimer timer_collision_narrow;
+
+	// ***CHRONO*** Number of OpenMP threads used to compute the AABBs of collision objects
+	void setNumThreads(int numThreads) { m_numThreads = numThreads > 1 ? numThreads : 1; }
+	int getNumThreads() const { return m_numThreads; }
+
+protected:
+	int m_numThreads;
+	cbtAlignedObjectArray<cbtVector3> m_aabbBuffer;  // computed AABBs (min/max pairs)
 };
 
 #endif  //BT_COLLISION_WORLD_H
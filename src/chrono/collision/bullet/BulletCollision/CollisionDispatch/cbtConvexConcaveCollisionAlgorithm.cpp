@@ -27,6 +27,7 @@ subject to the following restrictions:
 #include "BulletCollision/NarrowPhaseCollision/cbtSubSimplexConvexCast.h"
 #include "BulletCollision/CollisionDispatch/cbtCollisionObjectWrapper.h"
 #include "BulletCollision/CollisionShapes/cbtSdfCollisionShape.h"
+#include "BulletCollision/CollisionShapes/cbtCEtriangleMeshShape.h"  // ***CHRONO***
 
 cbtConvexConcaveCollisionAlgorithm::cbtConvexConcaveCollisionAlgorithm(const cbtCollisionAlgorithmConstructionInfo& ci, const cbtCollisionObjectWrapper* body0Wrap, const cbtCollisionObjectWrapper* body1Wrap, bool isSwapped)
 	: cbtActivatingCollisionAlgorithm(ci, body0Wrap, body1Wrap),
@@ -101,6 +102,47 @@ void cbtConvexTriangleCallback::processTriangle(cbtVector3* triangle, int partId
 	}
 #endif
 
+	/* ***CHRONO*** For a mesh of representative triangles, collide with a cbtCEtriangleShape built on the fly.
+	The shape identifiers of the result are not changed, so that they still refer to the mesh shape. */
+	if (m_convexBodyWrap->getCollisionShape()->isConvex() &&
+		static_cast<const cbtConcaveShape*>(m_triBodyWrap->getCollisionShape())->isCEtriangleMesh())
+	{
+		const cbtCEtriangleMeshShape* mesh = static_cast<const cbtCEtriangleMeshShape*>(m_triBodyWrap->getCollisionShape());
+		cbtCEtriangleShape tm = mesh->getTriangle(triangleIndex);
+		tm.setMargin(m_collisionMarginTriangle);
+
+		cbtCollisionObjectWrapper triObWrap(m_triBodyWrap, &tm, m_triBodyWrap->getCollisionObject(), m_triBodyWrap->getWorldTransform(), partId, triangleIndex);
+		cbtCollisionAlgorithm* colAlgo = 0;
+		if (m_resultOut->m_closestPointDistanceThreshold > 0)
+			colAlgo = ci.m_dispatcher1->findAlgorithm(m_convexBodyWrap, &triObWrap, 0, BT_CLOSEST_POINT_ALGORITHMS);
+		else
+			colAlgo = ci.m_dispatcher1->findAlgorithm(m_convexBodyWrap, &triObWrap, m_manifoldPtr, BT_CONTACT_POINT_ALGORITHMS);
+
+		const cbtCollisionObjectWrapper* tmpWrap = 0;
+		bool isBody0 = (m_resultOut->getBody0Internal() == m_triBodyWrap->getCollisionObject());
+		if (isBody0)
+		{
+			tmpWrap = m_resultOut->getBody0Wrap();
+			m_resultOut->setBody0Wrap(&triObWrap);
+		}
+		else
+		{
+			tmpWrap = m_resultOut->getBody1Wrap();
+			m_resultOut->setBody1Wrap(&triObWrap);
+		}
+
+		colAlgo->processCollision(m_convexBodyWrap, &triObWrap, *m_dispatchInfoPtr, m_resultOut);
+
+		if (isBody0)
+			m_resultOut->setBody0Wrap(tmpWrap);
+		else
+			m_resultOut->setBody1Wrap(tmpWrap);
+
+		colAlgo->~cbtCollisionAlgorithm();
+		ci.m_dispatcher1->freeCollisionAlgorithm(colAlgo);
+		return;
+	}
+
 	if (m_convexBodyWrap->getCollisionShape()->isConvex())
 	{
 		cbtTriangleShape tm(triangle[0], triangle[1], triangle[2]);
@@ -259,6 +301,11 @@ void cbtConvexConcaveCollisionAlgorithm::processCollision(const cbtCollisionObje
 
 				m_cbtConvexTriangleCallback.m_manifoldPtr->setBodies(convexBodyWrap->getCollisionObject(), triBodyWrap->getCollisionObject());
 
+				/* ***CHRONO*** Contacts with representative triangles are not persistent. Since all mesh triangles
+				share the same manifold, clear it once here rather than in each triangle collision. */
+				if (concaveShape->isCEtriangleMesh())
+					m_cbtConvexTriangleCallback.m_manifoldPtr->clearManifold();
+
 				concaveShape->processAllTriangles(&m_cbtConvexTriangleCallback, m_cbtConvexTriangleCallback.getAabbMin(), m_cbtConvexTriangleCallback.getAabbMax());
 
 				resultOut->refreshContactPoints();
@@ -287,8 +287,9 @@ void cbtConvexConvexAlgorithm ::processCollision(const cbtCollisionObjectWrapper
 	const cbtConvexShape* min1 = static_cast<const cbtConvexShape*>(body1Wrap->getCollisionShape());
 
 	/* ***CHRONO*** disable contact persistence for deformable triangle meshes vs convexes, 
-	because these do not simply move/rotate with affine transformation as other primitives. */
-	if((min0->getShapeType() == CE_TRIANGLE_SHAPE_PROXYTYPE) ||  (min1->getShapeType() == CE_TRIANGLE_SHAPE_PROXYTYPE)) 
+	because these do not simply move/rotate with affine transformation as other primitives. 
+	A manifold shared by all triangles of a cbtCEtriangleMeshShape is cleared by its owner. */
+	if (m_ownManifold && ((min0->getShapeType() == CE_TRIANGLE_SHAPE_PROXYTYPE) || (min1->getShapeType() == CE_TRIANGLE_SHAPE_PROXYTYPE)))
 		resultOut->getPersistentManifold()->clearManifold();
 
 	cbtVector3 normalOnB;
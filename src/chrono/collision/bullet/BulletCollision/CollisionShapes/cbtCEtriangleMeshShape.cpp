@@ -0,0 +1,164 @@
+/*
+***CHRONO***
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2006 Erwin Coumans  http://continuousphysics.com/Bullet/
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If
+you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not
+required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original
+software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+
+#include <algorithm>
+#include <vector>
+
+#include "cbtCEtriangleMeshShape.h"
+#include "cbtTriangleIndexVertexArray.h"
+
+using namespace chrono;
+
+cbtCEtriangleMeshShape::cbtCEtriangleMeshShape(const ChVector3d* vertices,
+                                               int num_vertices,
+                                               const ChVector3i* faces,
+                                               int num_faces,
+                                               double sphereswept_rad,
+                                               bool build)
+    : cbtBvhTriangleMeshShape(createMeshInterface(vertices, num_vertices, faces, num_faces), true, build),
+      m_vertices(vertices),
+      m_faces(faces),
+      m_num_vertices(num_vertices),
+      m_num_faces(num_faces),
+      m_sphereswept_rad(sphereswept_rad) {
+    if (build)
+        computeConnectivity();
+}
+
+cbtCEtriangleMeshShape::~cbtCEtriangleMeshShape() {
+    delete m_meshInterface;
+}
+
+void cbtCEtriangleMeshShape::setConnectivity(const int* wings, const unsigned char* flags) {
+    m_wings.resize(3 * m_num_faces);
+    m_flags.resize(m_num_faces);
+    for (int i = 0; i < 3 * m_num_faces; i++)
+        m_wings[i] = wings[i];
+    for (int i = 0; i < m_num_faces; i++)
+        m_flags[i] = flags[i];
+}
+
+cbtStridingMeshInterface* cbtCEtriangleMeshShape::createMeshInterface(const ChVector3d* vertices,
+                                                                      int num_vertices,
+                                                                      const ChVector3i* faces,
+                                                                      int num_faces) {
+    // Reference the vertex and index buffers in place (no copy)
+    cbtIndexedMesh mesh;
+    mesh.m_numTriangles = num_faces;
+    mesh.m_triangleIndexBase = reinterpret_cast<const unsigned char*>(faces);
+    mesh.m_triangleIndexStride = sizeof(ChVector3i);
+    mesh.m_numVertices = num_vertices;
+    mesh.m_vertexBase = reinterpret_cast<const unsigned char*>(vertices);
+    mesh.m_vertexStride = sizeof(ChVector3d);
+    mesh.m_vertexType = PHY_DOUBLE;
+
+    auto mesh_interface = new cbtTriangleIndexVertexArray();
+    mesh_interface->addIndexedMesh(mesh, PHY_INTEGER);
+    return mesh_interface;
+}
+
+// Mesh edge, with vertex indices in increasing order, used to find neighbouring triangles.
+struct cbtCEmeshEdge {
+    int v0;
+    int v1;
+    int face;  // index of the triangle
+    int edge;  // index of the edge in the triangle
+    bool operator<(const cbtCEmeshEdge& other) const {
+        if (v0 != other.v0)
+            return v0 < other.v0;
+        if (v1 != other.v1)
+            return v1 < other.v1;
+        return face < other.face;
+    }
+};
+
+void cbtCEtriangleMeshShape::computeConnectivity() {
+    m_wings.resize(3 * m_num_faces);
+    m_flags.resize(m_num_faces);
+    if (m_num_faces > 0)
+        computeConnectivity(m_faces, m_num_faces, m_num_vertices, &m_wings[0], &m_flags[0]);
+}
+
+void cbtCEtriangleMeshShape::computeConnectivity(const ChVector3i* faces,
+                                                 int num_faces,
+                                                 int num_vertices,
+                                                 int* wings,
+                                                 unsigned char* flags) {
+    // Sort all triangle edges, so that edges shared by neighbouring triangles are consecutive.
+    // Within a group of identical edges, triangles are sorted by index.
+    std::vector<cbtCEmeshEdge> edges(3 * num_faces);
+    for (int it = 0; it < num_faces; it++) {
+        for (int ie = 0; ie < 3; ie++) {
+            int va = faces[it][ie];
+            int vb = faces[it][(ie + 1) % 3];
+            edges[3 * it + ie] = {std::min(va, vb), std::max(va, vb), it, ie};
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    // Vertex ownership: a vertex is owned by the first triangle (in index order) that references it.
+    std::vector<bool> added_vertexes(num_vertices, false);
+    for (int it = 0; it < num_faces; it++) {
+        unsigned char flag = 0;
+        for (int iv = 0; iv < 3; iv++) {
+            int v = faces[it][iv];
+            if (!added_vertexes[v])
+                flag |= (1 << iv);
+            added_vertexes[v] = true;
+        }
+        flags[it] = flag;
+    }
+
+    // Edge ownership and wing vertices: an edge is owned by the first triangle (in index order) sharing it.
+    // For an edge shared with a neighbour, the wing vertex is the neighbour vertex not on the edge; for a free edge,
+    // it is the vertex of the triangle opposite to the edge.
+    size_t first = 0;
+    while (first < edges.size()) {
+        size_t last = first + 1;
+        while (last < edges.size() && edges[last].v0 == edges[first].v0 && edges[last].v1 == edges[first].v1)
+            last++;
+        for (size_t k = first; k < last; k++) {
+            const auto& e = edges[k];
+            if (k == first)
+                flags[e.face] |= (8 << e.edge);
+            int wing = faces[e.face][(e.edge + 2) % 3];
+            if (last - first > 1) {
+                const auto& n = edges[k == first ? first + 1 : first];
+                const auto& nf = faces[n.face];
+                wing = nf[(n.edge + 2) % 3];
+            }
+            wings[3 * e.face + e.edge] = wing;
+        }
+        first = last;
+    }
+}
+
+cbtCEtriangleShape cbtCEtriangleMeshShape::getTriangle(int index) const {
+    const ChVector3i& f = m_faces[index];
+    cbtCEtriangleShape triangle(&m_vertices[f[0]], &m_vertices[f[1]], &m_vertices[f[2]],  //
+                                &m_vertices[m_wings[3 * index + 0]],                      //
+                                &m_vertices[m_wings[3 * index + 1]],                      //
+                                &m_vertices[m_wings[3 * index + 2]],                      //
+                                ownsVertex(index, 0), ownsVertex(index, 1), ownsVertex(index, 2),
+                                ownsEdge(index, 0), ownsEdge(index, 1), ownsEdge(index, 2), m_sphereswept_rad);
+    triangle.setMargin(getMargin());
+    triangle.setUserPointer(getUserPointer());
+    return triangle;
+}
@@ -0,0 +1,109 @@
+/*
+***CHRONO***
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2006 Erwin Coumans  http://continuousphysics.com/Bullet/
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If
+you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not
+required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original
+software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+
+#ifndef BT_CE_TRIANGLE_MESH_SHAPE_H
+#define BT_CE_TRIANGLE_MESH_SHAPE_H
+
+#include "cbtBvhTriangleMeshShape.h"
+#include "cbtCEtriangleShape.h"
+#include "chrono/core/ChVector3.h"
+
+/// cbtCEtriangleMeshShape is a static triangle mesh made of 'representative triangles' (see cbtCEtriangleShape).
+/// Unlike a compound of cbtCEtriangleShape objects, this shape references a single vertex buffer and a single index
+/// buffer (which are not copied and must be kept alive by the caller) and uses a quantized BVH for queries.
+/// The connectivity information (vertex and edge ownership, neighbouring vertices across edges) is precomputed for
+/// all triangles; for each triangle overlapping another shape, a temporary cbtCEtriangleShape is built, so that
+/// contacts have the same edge/vertex semantics as with individual triangle shapes.
+ATTRIBUTE_ALIGNED16(class)
+cbtCEtriangleMeshShape : public cbtBvhTriangleMeshShape {
+  public:
+    BT_DECLARE_ALIGNED_ALLOCATOR();
+
+    /// Construct the mesh shape.
+    /// If build is false, neither the BVH nor the connectivity information are computed; these must then be provided
+    /// with setOptimizedBvh and setConnectivity (e.g., from data precomputed in a previous run).
+    cbtCEtriangleMeshShape(const chrono::ChVector3d* vertices,
+                           int num_vertices,
+                           const chrono::ChVector3i* faces,
+                           int num_faces,
+                           double sphereswept_rad = 0,
+                           bool build = true);
+
+    virtual ~cbtCEtriangleMeshShape();
+
+    virtual bool isCEtriangleMesh() const override { return true; }
+
+    virtual const char* getName() const override { return "CEtriangleMeshShape"; }
+
+    /// Number of triangles in the mesh.
+    int getNumTriangles() const { return m_num_faces; }
+
+    /// Construct the representative triangle with given index.
+    /// The returned shape references the shared vertex buffer and has the same margin and user pointer as this mesh.
+    cbtCEtriangleShape getTriangle(int index) const;
+
+    /// Tell if the given triangle owns its i-th vertex (i = 0,1,2).
+    bool ownsVertex(int index, int i) const { return (m_flags[index] & (1 << i)) != 0; }
+
+    /// Tell if the given triangle owns its i-th edge (i = 0,1,2; edge i connects vertices i and i+1).
+    bool ownsEdge(int index, int i) const { return (m_flags[index] & (8 << i)) != 0; }
+
+    /// Return the index of the vertex opposite to the i-th edge of the given triangle, in the neighbouring triangle.
+    /// For a free edge, this is the vertex of the given triangle not belonging to the edge.
+    int getWingVertex(int index, int i) const { return m_wings[3 * index + i]; }
+
+    /// Wing vertex indices (3 per triangle).
+    const int* getWings() const { return &m_wings[0]; }
+
+    /// Ownership flags (1 per triangle; bits 0-2: vertices, bits 3-5: edges).
+    const unsigned char* getFlags() const { return &m_flags[0]; }
+
+    /// Set the connectivity information (wing vertex indices and ownership flags) instead of computing it.
+    void setConnectivity(const int* wings, const unsigned char* flags);
+
+    /// Compute the connectivity information of a triangle mesh: 3 wing vertex indices and 1 set of ownership flags per
+    /// triangle (see getWingVertex, ownsVertex and ownsEdge). Vertices and edges are owned by the first triangle using
+    /// them. The output arrays must have room for 3*num_faces and num_faces elements, respectively.
+    static void computeConnectivity(const chrono::ChVector3i* faces,
+                                    int num_faces,
+                                    int num_vertices,
+                                    int* wings,
+                                    unsigned char* flags);
+
+    /// Thickness, for sphere-swept triangles.
+    double sphereswept_r() const { return m_sphereswept_rad; }
+
+  private:
+    static cbtStridingMeshInterface* createMeshInterface(const chrono::ChVector3d* vertices,
+                                                         int num_vertices,
+                                                         const chrono::ChVector3i* faces,
+                                                         int num_faces);
+    void computeConnectivity();
+
+    const chrono::ChVector3d* m_vertices;
+    const chrono::ChVector3i* m_faces;
+    int m_num_vertices;
+    int m_num_faces;
+    double m_sphereswept_rad;
+    cbtAlignedObjectArray<int> m_wings;            // wing vertex indices (3 per triangle)
+    cbtAlignedObjectArray<unsigned char> m_flags;  // ownership flags (bits 0-2: vertices, bits 3-5: edges)
+};
+
+#endif
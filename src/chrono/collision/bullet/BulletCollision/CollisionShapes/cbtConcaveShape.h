@@ -57,6 +57,9 @@ public:
 	{
 		m_collisionMargin = collisionMargin;
 	}
+
+	/* ***CHRONO*** true for meshes of representative triangles (see cbtCEtriangleMeshShape) */
+	virtual bool isCEtriangleMesh() const { return false; }
 };
 
 #endif  //BT_CONCAVE_SHAPE_H
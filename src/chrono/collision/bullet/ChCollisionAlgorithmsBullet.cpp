@@ -1063,8 +1063,9 @@ void cbtCEtriangleShapeCollisionAlgorithm::processCollision(const cbtCollisionOb
 
     resultOut->setPersistentManifold(m_manifoldPtr);
 
-    // avoid persistence of contacts in manifold:
-    resultOut->getPersistentManifold()->clearManifold();
+    // avoid persistence of contacts in manifold (a shared manifold is cleared by its owner):
+    if (m_ownManifold)
+        resultOut->getPersistentManifold()->clearManifold();
 
     const cbtCEtriangleShape* triA = (cbtCEtriangleShape*)triObj1Wrap->getCollisionShape();
     const cbtCEtriangleShape* triB = (cbtCEtriangleShape*)triObj2Wrap->getCollisionShape();
@@ -1097,8 +1098,8 @@ void cbtCEtriangleShapeCollisionAlgorithm::processCollision(const cbtCollisionOb
     double offset_A = triA->sphereswept_r() + triModelA->GetEnvelope();
     double offset_B = triB->sphereswept_r() + triModelB->GetEnvelope();
 
-    const cbtTransform& m44Ta = triObj1Wrap->getCollisionObject()->getWorldTransform();
-    const cbtTransform& m44Tb = triObj2Wrap->getCollisionObject()->getWorldTransform();
+    const cbtTransform& m44Ta = triObj1Wrap->getWorldTransform();
+    const cbtTransform& m44Tb = triObj2Wrap->getWorldTransform();
     const cbtMatrix3x3& mcbtRa = m44Ta.getBasis();
     const cbtMatrix3x3& mcbtRb = m44Tb.getBasis();
     ChMatrix33<> mRa;
@@ -1556,11 +1557,12 @@ cbtCollisionAlgorithm* cbtCEtriangleShapeCollisionAlgorithm::CreateFunc::CreateC
     cbtCollisionAlgorithmConstructionInfo& ci,
     const cbtCollisionObjectWrapper* body0Wrap,
     const cbtCollisionObjectWrapper* body1Wrap) {
+    // Use the shared manifold, if any (e.g., when colliding with the triangles of a cbtCEtriangleMeshShape)
     void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(cbtCEtriangleShapeCollisionAlgorithm));
     if (!m_swapped) {
-        return new (mem) cbtCEtriangleShapeCollisionAlgorithm(0, ci, body0Wrap, body1Wrap, false);
+        return new (mem) cbtCEtriangleShapeCollisionAlgorithm(ci.m_manifold, ci, body0Wrap, body1Wrap, false);
     } else {
-        return new (mem) cbtCEtriangleShapeCollisionAlgorithm(0, ci, body0Wrap, body1Wrap, true);
+        return new (mem) cbtCEtriangleShapeCollisionAlgorithm(ci.m_manifold, ci, body0Wrap, body1Wrap, true);
     }
 }
 
@@ -22,10 +22,13 @@
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbt2DShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtBarrelShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtCEtriangleShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtCEtriangleMeshShape.h"
 #include "chrono/collision/bullet/cbtBulletCollisionCommon.h"
 #include "chrono/collision/gimpact/GIMPACT/Bullet/cbtGImpactCollisionAlgorithm.h"
 #include "chrono/collision/gimpact/GIMPACTUtils/cbtGImpactConvexDecompositionShape.h"
+#include "chrono/collision/ChCollisionMeshCache.h"
 #include "chrono/collision/ChConvexDecomposition.h"
+#include "chrono/core/ChTimer.h"
 #include "chrono/geometry/ChLineArc.h"
 #include "chrono/geometry/ChLineSegment.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
@@ -40,6 +43,9 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChCollisionModelBullet)
 CH_UPCASTING(ChCollisionModelBullet, ChCollisionModelImpl)
 
+// Version of the data stored in the collision mesh cache (included in the cache keys)
+static const int cache_version = 1;
+
 // -----------------------------------------------------------------------------
 
 ChCollisionModelBullet::ChCollisionModelBullet(ChCollisionModel* collision_model)
@@ -225,6 +231,16 @@ void ChCollisionModelBullet::Populate() {
     assert(m_shapes.size() == m_bt_shapes.size());
 }
 
+void ChCollisionModelBullet::Populate(const ChCollisionModelBullet& source) {
+    // Shape-dependent adjustments of the safe margin were made when populating the source model
+    model->SetSafeMargin(source.model->GetSafeMargin());
+
+    m_shapes = source.m_shapes;
+    m_bt_shapes = source.m_bt_shapes;
+    bt_compound_shape = source.bt_compound_shape;
+    bt_collision_object->setCollisionShape(source.bt_collision_object->getCollisionShape());
+}
+
 void ChCollisionModelBullet::injectShape(std::shared_ptr<ChCollisionShape> shape,
                                          std::shared_ptr<cbtCollisionShape> bt_shape,
                                          const ChFrame<>& frame) {
@@ -371,16 +387,36 @@ void ChCollisionModelBullet::injectConvexHull(std::shared_ptr<ChCollisionShapeCo
     // override the inward margin if larger than 0.2 chord:
     model->SetSafeMargin((cbtScalar)std::min((double)safe_margin, approx_chord * 0.2));
 
-    // shrink the convex hull by GetSafeMargin()
-    bt_utils::ChConvexHullLibraryWrapper lh;
-    ChTriangleMeshConnected mmesh;
-    lh.ComputeHull(points, mmesh);
-    mmesh.MakeOffset(-safe_margin);
+    // shrink the convex hull by GetSafeMargin() (reuse the hull vertices from the mesh cache, if available)
+    std::vector<ChVector3d> vertices;
+    uint64_t key = 0;
+    bool cached = false;
+    if (ChCollisionMeshCache::IsEnabled()) {
+        key = ChCollisionMeshCache::Hasher().Add(cache_version).Add(points).Add((double)safe_margin).GetKey();
+        if (auto entry = ChCollisionMeshCache::Load("bullet_hull", key)) {
+            ChCollisionMeshCache::Reader reader(entry->GetData(), entry->GetSize());
+            cached = reader.Read(vertices);
+        }
+    }
+    if (!cached) {
+        ChTimer timer;
+        timer.start();
+        bt_utils::ChConvexHullLibraryWrapper lh;
+        ChTriangleMeshConnected mmesh;
+        lh.ComputeHull(points, mmesh);
+        mmesh.MakeOffset(-safe_margin);
+        vertices = mmesh.m_vertices;
+        timer.stop();
+        if (ChCollisionMeshCache::IsEnabled()) {
+            ChCollisionMeshCache::Writer writer;
+            writer.Write(vertices);
+            ChCollisionMeshCache::Store("bullet_hull", key, writer.GetBuffer(), timer.GetTimeSeconds());
+        }
+    }
 
     auto bt_shape = chrono_types::make_shared<cbtConvexHullShape>();
-    for (unsigned int i = 0; i < mmesh.m_vertices.size(); i++) {
-        bt_shape->addPoint(cbtVector3((cbtScalar)mmesh.m_vertices[i].x(), (cbtScalar)mmesh.m_vertices[i].y(),
-                                      (cbtScalar)mmesh.m_vertices[i].z()));
+    for (const auto& v : vertices) {
+        bt_shape->addPoint(cbtVector3((cbtScalar)v.x(), (cbtScalar)v.y(), (cbtScalar)v.z()));
     }
     bt_shape->setMargin((cbtScalar)full_margin);
     bt_shape->recalcLocalAabb();
@@ -440,6 +476,69 @@ class cbtGImpactMeshShape_handlemesh : public cbtGImpactMeshShape {
     }
 };
 
+// Static mesh of representative triangles which also keeps alive the mesh cache entry holding its BVH (if any).
+class cbtCEtriangleMeshShape_cached : public cbtCEtriangleMeshShape {
+  public:
+    cbtCEtriangleMeshShape_cached(const ChTriangleMeshConnected& mesh, double radius, bool build)
+        : cbtCEtriangleMeshShape(mesh.m_vertices.data(),
+                                 (int)mesh.m_vertices.size(),
+                                 mesh.m_face_v_indices.data(),
+                                 (int)mesh.m_face_v_indices.size(),
+                                 radius,
+                                 build) {}
+
+    std::shared_ptr<ChCollisionMeshCache::Entry> entry;
+};
+
+// Create a static mesh shape of representative triangles.
+// If the mesh cache is enabled, the BVH and the connectivity information are loaded from the cache (in place) if
+// available, or stored in the cache otherwise.
+static std::shared_ptr<cbtCEtriangleMeshShape> CreateCEtriangleMeshShape(const ChTriangleMeshConnected& mesh,
+                                                                        double radius) {
+    if (!ChCollisionMeshCache::IsEnabled())
+        return chrono_types::make_shared<cbtCEtriangleMeshShape_cached>(mesh, radius, true);
+
+    size_t num_faces = mesh.m_face_v_indices.size();
+    auto key = ChCollisionMeshCache::Hasher()
+                   .Add(cache_version)
+                   .Add(mesh.m_vertices)
+                   .Add(mesh.m_face_v_indices)
+                   .GetKey();
+
+    if (auto entry = ChCollisionMeshCache::Load("bullet_cemesh", key)) {
+        ChCollisionMeshCache::Reader reader(entry->GetData(), entry->GetSize());
+        size_t num_wings, num_flags, bvh_size;
+        auto wings = reader.Read<int>(num_wings);
+        auto flags = reader.Read<unsigned char>(num_flags);
+        auto bvh_data = reader.Read<char>(bvh_size);
+        if (wings && flags && bvh_data && num_wings == 3 * num_faces && num_flags == num_faces) {
+            auto bvh = cbtOptimizedBvh::deSerializeInPlace(bvh_data, (unsigned int)bvh_size, false);
+            if (bvh) {
+                auto bt_shape = chrono_types::make_shared<cbtCEtriangleMeshShape_cached>(mesh, radius, false);
+                bt_shape->setConnectivity(wings, flags);
+                bt_shape->setOptimizedBvh(bvh);
+                bt_shape->entry = entry;
+                return bt_shape;
+            }
+        }
+    }
+
+    ChTimer timer;
+    timer.start();
+    auto bt_shape = chrono_types::make_shared<cbtCEtriangleMeshShape_cached>(mesh, radius, true);
+    timer.stop();
+
+    ChCollisionMeshCache::Writer writer;
+    writer.Write(bt_shape->getWings(), 3 * num_faces);
+    writer.Write(bt_shape->getFlags(), num_faces);
+    auto bvh = bt_shape->getOptimizedBvh();
+    auto bvh_size = bvh->calculateSerializeBufferSize();
+    if (bvh->serializeInPlace(writer.Reserve(bvh_size, bvh_size), bvh_size, false))
+        ChCollisionMeshCache::Store("bullet_cemesh", key, writer.GetBuffer(), timer.GetTimeSeconds());
+
+    return bt_shape;
+}
+
 void ChCollisionModelBullet::injectTriangleMesh(std::shared_ptr<ChCollisionShapeTriangleMesh> shape_trimesh,
                                                 const ChFrame<>& frame) {
     auto envelope = GetEnvelope();
@@ -454,99 +553,76 @@ void ChCollisionModelBullet::injectTriangleMesh(std::shared_ptr<ChCollisionShape
         return;
 
     if (auto mesh = std::dynamic_pointer_cast<ChTriangleMeshConnected>(trimesh)) {
-        std::vector<std::array<int, 4>> trimap;
-        mesh->ComputeNeighbouringTriangleMap(trimap);
-
-        std::map<std::pair<int, int>, std::pair<int, int>> winged_edges;
-        mesh->ComputeWingedEdges(winged_edges, true);
-
-        std::vector<bool> added_vertexes(mesh->m_vertices.size());
+        // Static mesh: use a single BVH-backed shape of representative triangles, referencing the mesh vertex and
+        // index buffers (connectivity information is precomputed by the shape).
+        if (is_static) {
+            model->SetSafeMargin(radius);
+            auto bt_shape = CreateCEtriangleMeshShape(*mesh, radius);
+            bt_shape->setMargin((cbtScalar)GetSuggestedFullMargin());
+            injectShape(shape_trimesh, bt_shape, frame);
+            return;
+        }
 
-        // iterate on triangles
-        for (int it = 0; it < mesh->m_face_v_indices.size(); ++it) {
-            // edges = pairs of vertexes indexes
-            std::pair<int, int> medgeA(mesh->m_face_v_indices[it].x(), mesh->m_face_v_indices[it].y());
-            std::pair<int, int> medgeB(mesh->m_face_v_indices[it].y(), mesh->m_face_v_indices[it].z());
-            std::pair<int, int> medgeC(mesh->m_face_v_indices[it].z(), mesh->m_face_v_indices[it].x());
-            // vertex indexes in edges: always in increasing order to avoid ambiguous duplicated edges
-            if (medgeA.first > medgeA.second)
-                medgeA = std::pair<int, int>(medgeA.second, medgeA.first);
-            if (medgeB.first > medgeB.second)
-                medgeB = std::pair<int, int>(medgeB.second, medgeB.first);
-            if (medgeC.first > medgeC.second)
-                medgeC = std::pair<int, int>(medgeC.second, medgeC.first);
-            auto wingedgeA = winged_edges.find(medgeA);
-            auto wingedgeB = winged_edges.find(medgeB);
-            auto wingedgeC = winged_edges.find(medgeC);
-
-            int i_wingvertex_A = -1;
-            int i_wingvertex_B = -1;
-            int i_wingvertex_C = -1;
-
-            if (trimap[it][1] != -1) {
-                i_wingvertex_A = mesh->m_face_v_indices[trimap[it][1]].x();
-                if (mesh->m_face_v_indices[trimap[it][1]].y() != wingedgeA->first.first &&
-                    mesh->m_face_v_indices[trimap[it][1]].y() != wingedgeA->first.second)
-                    i_wingvertex_A = mesh->m_face_v_indices[trimap[it][1]].y();
-                if (mesh->m_face_v_indices[trimap[it][1]].z() != wingedgeA->first.first &&
-                    mesh->m_face_v_indices[trimap[it][1]].z() != wingedgeA->first.second)
-                    i_wingvertex_A = mesh->m_face_v_indices[trimap[it][1]].z();
+        // Connectivity information (reused from the mesh cache, if available)
+        std::vector<int> wings;
+        std::vector<unsigned char> flags;
+        uint64_t key = 0;
+        bool cached = false;
+        if (ChCollisionMeshCache::IsEnabled()) {
+            key = ChCollisionMeshCache::Hasher()
+                      .Add(cache_version)
+                      .Add(mesh->m_vertices)
+                      .Add(mesh->m_face_v_indices)
+                      .GetKey();
+            if (auto entry = ChCollisionMeshCache::Load("bullet_meshtri", key)) {
+                ChCollisionMeshCache::Reader reader(entry->GetData(), entry->GetSize());
+                cached = reader.Read(wings) && reader.Read(flags) &&
+                         wings.size() == 3 * mesh->m_face_v_indices.size() &&
+                         flags.size() == mesh->m_face_v_indices.size();
             }
-
-            if (trimap[it][2] != -1) {
-                i_wingvertex_B = mesh->m_face_v_indices[trimap[it][2]].x();
-                if (mesh->m_face_v_indices[trimap[it][2]].y() != wingedgeB->first.first &&
-                    mesh->m_face_v_indices[trimap[it][2]].y() != wingedgeB->first.second)
-                    i_wingvertex_B = mesh->m_face_v_indices[trimap[it][2]].y();
-                if (mesh->m_face_v_indices[trimap[it][2]].z() != wingedgeB->first.first &&
-                    mesh->m_face_v_indices[trimap[it][2]].z() != wingedgeB->first.second)
-                    i_wingvertex_B = mesh->m_face_v_indices[trimap[it][2]].z();
+        }
+        if (!cached) {
+            ChTimer timer;
+            timer.start();
+            int num_faces = (int)mesh->m_face_v_indices.size();
+            wings.resize(3 * num_faces);
+            flags.resize(num_faces);
+            if (num_faces > 0)
+                cbtCEtriangleMeshShape::computeConnectivity(mesh->m_face_v_indices.data(), num_faces,
+                                                            (int)mesh->m_vertices.size(), wings.data(), flags.data());
+            timer.stop();
+            if (ChCollisionMeshCache::IsEnabled()) {
+                ChCollisionMeshCache::Writer writer;
+                writer.Write(wings);
+                writer.Write(flags);
+                ChCollisionMeshCache::Store("bullet_meshtri", key, writer.GetBuffer(), timer.GetTimeSeconds());
             }
+        }
 
-            if (trimap[it][3] != -1) {
-                i_wingvertex_C = mesh->m_face_v_indices[trimap[it][3]].x();
-                if (mesh->m_face_v_indices[trimap[it][3]].y() != wingedgeC->first.first &&
-                    mesh->m_face_v_indices[trimap[it][3]].y() != wingedgeC->first.second)
-                    i_wingvertex_C = mesh->m_face_v_indices[trimap[it][3]].y();
-                if (mesh->m_face_v_indices[trimap[it][3]].z() != wingedgeC->first.first &&
-                    mesh->m_face_v_indices[trimap[it][3]].z() != wingedgeC->first.second)
-                    i_wingvertex_C = mesh->m_face_v_indices[trimap[it][3]].z();
-            }
+        // iterate on triangles
+        for (int it = 0; it < mesh->m_face_v_indices.size(); ++it) {
+            const auto& face = mesh->m_face_v_indices[it];
+            auto flag = flags[it];
 
             // Add a mesh triangle collision shape (triangle with connectivity information).
-            // For a non-wing vertex (i.e. 'free' edge), point to opposite vertex, that is the vertex in triangle not
-            // belonging to edge. Indicate is an edge is owned by this triangle. Otherwise, they belong to a neighboring
-            // triangle.
             auto shape_triangle = chrono_types::make_shared<ChCollisionShapeMeshTriangle>(
-                shape_trimesh->GetMaterial(),                                                        // contact material
-                &mesh->m_vertices[mesh->m_face_v_indices[it].x()],                                   // face nodes
-                &mesh->m_vertices[mesh->m_face_v_indices[it].y()],                                   //
-                &mesh->m_vertices[mesh->m_face_v_indices[it].z()],                                   //
-                wingedgeA->second.second != -1 ? &mesh->m_vertices[i_wingvertex_A]                   // edge node 1
-                                               : &mesh->m_vertices[mesh->m_face_v_indices[it].z()],  //
-                wingedgeB->second.second != -1 ? &mesh->m_vertices[i_wingvertex_B]                   // edge node 2
-                                               : &mesh->m_vertices[mesh->m_face_v_indices[it].x()],  //
-                wingedgeC->second.second != -1 ? &mesh->m_vertices[i_wingvertex_C]                   // edge node 3
-                                               : &mesh->m_vertices[mesh->m_face_v_indices[it].y()],  //
-                !added_vertexes[mesh->m_face_v_indices[it].x()],                                     // face owns nodes?
-                !added_vertexes[mesh->m_face_v_indices[it].y()],                                     //
-                !added_vertexes[mesh->m_face_v_indices[it].z()],                                     //
-                wingedgeA->second.first != -1,                                                       // face owns edges?
-                wingedgeB->second.first != -1,                                                       //
-                wingedgeC->second.first != -1,                                                       //
-                radius                                                                               // thickness
+                shape_trimesh->GetMaterial(),          // contact material
+                &mesh->m_vertices[face.x()],           // face nodes
+                &mesh->m_vertices[face.y()],           //
+                &mesh->m_vertices[face.z()],           //
+                &mesh->m_vertices[wings[3 * it + 0]],  // edge node 1
+                &mesh->m_vertices[wings[3 * it + 1]],  // edge node 2
+                &mesh->m_vertices[wings[3 * it + 2]],  // edge node 3
+                (flag & 1) != 0,                       // face owns nodes?
+                (flag & 2) != 0,                       //
+                (flag & 4) != 0,                       //
+                (flag & 8) != 0,                       // face owns edges?
+                (flag & 16) != 0,                      //
+                (flag & 32) != 0,                      //
+                radius                                 // thickness
             );
 
             injectTriangleProxy(shape_triangle);
-
-            // Mark added vertexes
-            added_vertexes[mesh->m_face_v_indices[it].x()] = true;
-            added_vertexes[mesh->m_face_v_indices[it].y()] = true;
-            added_vertexes[mesh->m_face_v_indices[it].z()] = true;
-            // Mark added edges, setting to -1 the 'ti' id of 1st triangle in winged edge {{vi,vj}{ti,tj}}
-            wingedgeA->second.first = -1;
-            wingedgeB->second.first = -1;
-            wingedgeC->second.first = -1;
         }
         return;
     }
@@ -592,29 +668,65 @@ void ChCollisionModelBullet::injectTriangleMesh(std::shared_ptr<ChCollisionShape
         );
         */
 
-        // using HACDv2 convex decomposition
-        auto decomposition = chrono_types::make_shared<ChConvexDecompositionHACDv2>();
-        decomposition->Reset();
-        decomposition->AddTriangleMesh(*trimesh);
-        decomposition->SetParameters(512,   // max hull count
-                                     256,   // max hull merge
-                                     64,    // max hull vettices
-                                     0.2f,  // concavity
-                                     0.0f,  // small cluster threshold
-                                     1e-9f  // fuse tolerance
-        );
+        // using HACDv2 convex decomposition (hulls reused from the mesh cache, if available)
+        std::vector<int> hull_sizes;
+        std::vector<ChVector3d> hull_points;
+        uint64_t key = 0;
+        bool cached = false;
+        if (ChCollisionMeshCache::IsEnabled()) {
+            ChCollisionMeshCache::Hasher hasher;
+            hasher.Add(cache_version).Add(trimesh->GetNumTriangles());
+            for (int i = 0; i < trimesh->GetNumTriangles(); i++) {
+                auto triangle = trimesh->GetTriangle(i);
+                hasher.Add(triangle.p1).Add(triangle.p2).Add(triangle.p3);
+            }
+            key = hasher.GetKey();
+            if (auto entry = ChCollisionMeshCache::Load("bullet_hacd", key)) {
+                ChCollisionMeshCache::Reader reader(entry->GetData(), entry->GetSize());
+                cached = reader.Read(hull_sizes) && reader.Read(hull_points);
+            }
+        }
+        if (!cached) {
+            ChTimer timer;
+            timer.start();
+            auto decomposition = chrono_types::make_shared<ChConvexDecompositionHACDv2>();
+            decomposition->Reset();
+            decomposition->AddTriangleMesh(*trimesh);
+            decomposition->SetParameters(512,   // max hull count
+                                         256,   // max hull merge
+                                         64,    // max hull vettices
+                                         0.2f,  // concavity
+                                         0.0f,  // small cluster threshold
+                                         1e-9f  // fuse tolerance
+            );
+
+            decomposition->ComputeConvexDecomposition();
 
-        decomposition->ComputeConvexDecomposition();
+            for (unsigned int j = 0; j < decomposition->GetHullCount(); j++) {
+                std::vector<ChVector3d> ptlist;
+                decomposition->GetConvexHullResult(j, ptlist);
+                hull_sizes.push_back((int)ptlist.size());
+                hull_points.insert(hull_points.end(), ptlist.begin(), ptlist.end());
+            }
+            timer.stop();
+            if (ChCollisionMeshCache::IsEnabled()) {
+                ChCollisionMeshCache::Writer writer;
+                writer.Write(hull_sizes);
+                writer.Write(hull_points);
+                ChCollisionMeshCache::Store("bullet_hacd", key, writer.GetBuffer(), timer.GetTimeSeconds());
+            }
+        }
 
         model->SetSafeMargin(0);
-        for (unsigned int j = 0; j < decomposition->GetHullCount(); j++) {
-            std::vector<ChVector3d> ptlist;
-            decomposition->GetConvexHullResult(j, ptlist);
-            if (ptlist.size() > 0) {
+        size_t offset = 0;
+        for (auto size : hull_sizes) {
+            if (size > 0 && offset + size <= hull_points.size()) {
+                std::vector<ChVector3d> ptlist(hull_points.begin() + offset, hull_points.begin() + offset + size);
                 auto shape_hull =
                     chrono_types::make_shared<ChCollisionShapeConvexHull>(shape_trimesh->GetMaterial(), ptlist);
                 injectConvexHull(shape_hull, frame);
             }
+            offset += size;
         }
     }
 }
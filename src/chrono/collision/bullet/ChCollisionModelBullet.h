@@ -66,6 +66,10 @@ class ChApi ChCollisionModelBullet : public ChCollisionModelImpl {
     /// Populate the collision system with the collision shapes defined in this model.
     void Populate();
 
+    /// Populate the collision system with the collision shapes of the given model (already populated), sharing its
+    /// Bullet collision geometry. The two models must have the same collision shapes.
+    void Populate(const ChCollisionModelBullet& source);
+
     /// Additional operations to be performed on a change in collision family.
     virtual void OnFamilyChange(short int family_group, short int family_mask) override;
 
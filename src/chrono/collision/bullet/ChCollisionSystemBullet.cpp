@@ -27,6 +27,7 @@
 #include "chrono/collision/gimpact/GIMPACT/Bullet/cbtGImpactCollisionAlgorithm.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionDispatch/cbtCollisionDispatcherMt.h"
 #include "chrono/collision/bullet/LinearMath/cbtIDebugDraw.h"
+#include "chrono/utils/ChTracer.h"
 
 extern cbtScalar gContactBreakingThreshold;
 
@@ -37,7 +38,7 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChCollisionSystemBullet)
 CH_UPCASTING(ChCollisionSystemBullet, ChCollisionSystem)
 
-ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
+ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr), m_num_threads(1) {
     bt_collision_configuration = new cbtDefaultCollisionConfiguration();
 
 #ifdef BT_USE_OPENMP
@@ -125,6 +126,9 @@ ChCollisionSystemBullet::~ChCollisionSystemBullet() {
 }
 
 void ChCollisionSystemBullet::SetNumThreads(int nthreads) {
+    m_num_threads = std::max(nthreads, 1);
+    bt_collision_world->setNumThreads(m_num_threads);
+    static_cast<cbtDbvtBroadphase*>(bt_broadphase)->setNumThreads(m_num_threads);
 #ifdef BT_USE_OPENMP
     cbtGetOpenMPTaskScheduler()->setNumThreads(nthreads);
 #endif
@@ -135,7 +139,11 @@ void ChCollisionSystemBullet::Add(std::shared_ptr<ChCollisionModel> model) {
         return;
 
     auto bt_model = chrono_types::make_shared<ChCollisionModelBullet>(model.get());
-    bt_model->Populate();
+    auto model_template = model->GetShapeTemplate();
+    if (model_template && model->GetShapeInstances() == model_template->GetShapeInstances())
+        bt_model->Populate(*GetTemplateModel(model_template));
+    else
+        bt_model->Populate();
     if (bt_model->GetBulletObject()->getCollisionShape()) {
         model->SyncPosition();
         bt_collision_world->addCollisionObject(bt_model->bt_collision_object.get(),  //
@@ -145,6 +153,18 @@ void ChCollisionSystemBullet::Add(std::shared_ptr<ChCollisionModel> model) {
     bt_models.push_back(bt_model);
 }
 
+ChCollisionModelBullet* ChCollisionSystemBullet::GetTemplateModel(std::shared_ptr<ChCollisionModel> model_template) {
+    auto& entry = bt_templates[model_template.get()];
+    if (!entry.second) {
+        // The template model is not added to the collision world; it only owns the shared Bullet shapes
+        entry.first = model_template;
+        entry.second = chrono_types::make_shared<ChCollisionModelBullet>(model_template.get());
+        entry.second->Populate();
+        model_template->RemoveImplementation();
+    }
+    return entry.second.get();
+}
+
 void ChCollisionSystemBullet::Clear() {
     int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
     for (int i = 0; i < numManifolds; i++) {
@@ -152,6 +172,7 @@ void ChCollisionSystemBullet::Clear() {
         contactManifold->clearManifold();
     }
     bt_models.clear();
+    bt_templates.clear();
 }
 
 void ChCollisionSystemBullet::Remove(std::shared_ptr<ChCollisionModel> model) {
@@ -181,6 +202,8 @@ void ChCollisionSystemBullet::Remove(ChCollisionModelBullet* bt_model, bool eras
 }
 
 void ChCollisionSystemBullet::Run() {
+    CH_TRACE_ZONE("ChCollisionSystemBullet::Run", "collision");
+
     if (bt_collision_world) {
         bt_collision_world->performDiscreteCollisionDetection();
     }
@@ -209,91 +232,121 @@ double ChCollisionSystemBullet::GetTimerCollisionNarrow() const {
 }
 
 void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontainer) {
+    CH_TRACE_ZONE("ChCollisionSystemBullet::ReportContacts", "collision");
+
     // This should remove all old contacts (or at least rewind the index)
     mcontactcontainer->BeginAddContact();
 
     // NOTE: Bullet does not provide information on radius of curvature at a contact point.
     // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
-    ChCollisionInfo icontact;
 
-    int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
+    // Contact points are refreshed and converted concurrently (one manifold per task) into a flat array of collision
+    // info structures. User callbacks and insertion in the contact container are then executed serially, in manifold
+    // order, so that contacts are reported in the same order regardless of the number of threads.
+    auto dispatcher = bt_collision_world->getDispatcher();
+    int numManifolds = dispatcher->getNumManifolds();
+
+    m_contact_offsets.resize(numManifolds + 1);
+    m_contact_offsets[0] = 0;
+
+#pragma omp parallel for schedule(static) num_threads(m_num_threads)
     for (int i = 0; i < numManifolds; i++) {
-        cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
+        cbtPersistentManifold* contactManifold = dispatcher->getManifoldByIndexInternal(i);
         const cbtCollisionObject* obA = contactManifold->getBody0();
         const cbtCollisionObject* obB = contactManifold->getBody1();
         contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
+        m_contact_offsets[i + 1] = contactManifold->getNumContacts();
+    }
+    for (int i = 0; i < numManifolds; i++)
+        m_contact_offsets[i + 1] += m_contact_offsets[i];
+
+    m_contact_info.resize(m_contact_offsets[numManifolds]);
+    m_contact_valid.resize(m_contact_offsets[numManifolds]);
+
+#pragma omp parallel for schedule(dynamic, 16) num_threads(m_num_threads)
+    for (int i = 0; i < numManifolds; i++) {
+        cbtPersistentManifold* contactManifold = dispatcher->getManifoldByIndexInternal(i);
+        const cbtCollisionObject* obA = contactManifold->getBody0();
+        const cbtCollisionObject* obB = contactManifold->getBody1();
 
         auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
         auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
 
-        icontact.modelA = bt_modelA->model;
-        icontact.modelB = bt_modelB->model;
+        double envelopeA = bt_modelA->model->GetEnvelope();
+        double envelopeB = bt_modelB->model->GetEnvelope();
 
-        double envelopeA = icontact.modelA->GetEnvelope();
-        double envelopeB = icontact.modelB->GetEnvelope();
+        double marginA = bt_modelA->model->GetSafeMargin();
+        double marginB = bt_modelB->model->GetSafeMargin();
 
-        double marginA = icontact.modelA->GetSafeMargin();
-        double marginB = icontact.modelB->GetSafeMargin();
+        bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+        bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
 
-        // Execute custom broadphase callback, if any
-        bool do_narrow_contactgeneration = true;
-        if (broad_callback)
-            do_narrow_contactgeneration = broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
+        int numContacts = contactManifold->getNumContacts();
+        for (int j = 0; j < numContacts; j++) {
+            int k = m_contact_offsets[i] + j;
+            cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
 
-        if (do_narrow_contactgeneration) {
-            int numContacts = contactManifold->getNumContacts();
-            // std::cout << "numContacts=" << numContacts << std::endl;
-            for (int j = 0; j < numContacts; j++) {
-                cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
+            // Discard "too far" constraints (the Bullet engine also has its threshold)
+            m_contact_valid[k] = (pt.getDistance() < marginA + marginB);
+            if (!m_contact_valid[k])
+                continue;
 
-                // Discard "too far" constraints (the Bullet engine also has its threshold)
-                if (pt.getDistance() < marginA + marginB) {
-                    cbtVector3 ptA = pt.getPositionWorldOnA();
-                    cbtVector3 ptB = pt.getPositionWorldOnB();
+            ChCollisionInfo& icontact = m_contact_info[k];
 
-                    icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
-                    icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
+            icontact.modelA = bt_modelA->model;
+            icontact.modelB = bt_modelB->model;
 
-                    icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(),
-                                    -pt.m_normalWorldOnB.getZ());
-                    icontact.vN.Normalize();
+            cbtVector3 ptA = pt.getPositionWorldOnA();
+            cbtVector3 ptB = pt.getPositionWorldOnB();
 
-                    double ptdist = pt.getDistance();
+            icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
+            icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
 
-                    icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
-                    icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
-                    icontact.distance = ptdist + envelopeA + envelopeB;
+            icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(), -pt.m_normalWorldOnB.getZ());
+            icontact.vN.Normalize();
 
-                    icontact.reaction_cache = pt.reactions_cache;
+            double ptdist = pt.getDistance();
 
-                    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
-                    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+            icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
+            icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
+            icontact.distance = ptdist + envelopeA + envelopeB;
 
-                    int indexA = compoundA ? pt.m_index0 : 0;
-                    int indexB = compoundB ? pt.m_index1 : 0;
+            icontact.reaction_cache = pt.reactions_cache;
 
-                    icontact.shapeA = bt_modelA->m_shapes[indexA].get();
-                    icontact.shapeB = bt_modelB->m_shapes[indexB].get();
+            int indexA = compoundA ? pt.m_index0 : 0;
+            int indexB = compoundB ? pt.m_index1 : 0;
 
-                    // Execute some user custom callback, if any
-                    bool add_contact = true;
-                    if (this->narrow_callback)
-                        add_contact = this->narrow_callback->OnNarrowphase(icontact);
+            icontact.shapeA = bt_modelA->m_shapes[indexA].get();
+            icontact.shapeB = bt_modelB->m_shapes[indexB].get();
+        }
+    }
 
-                    // Add to contact container
-                    if (add_contact) {
-                        ////std::cout << " add indexA=" << indexA << " indexB=" << indexB << std::endl;
-                        ////std::cout << "     typeA=" << icontact.shapeA->m_type << " typeB=" <<
-                        /// icontact.shapeB->m_type << std::endl;
+    for (int i = 0; i < numManifolds; i++) {
+        cbtPersistentManifold* contactManifold = dispatcher->getManifoldByIndexInternal(i);
+        auto bt_modelA = (ChCollisionModelBullet*)contactManifold->getBody0()->getUserPointer();
+        auto bt_modelB = (ChCollisionModelBullet*)contactManifold->getBody1()->getUserPointer();
 
-                        mcontactcontainer->AddContact(icontact);
-                    }
-                }
-            }
-        }
+        // Execute custom broadphase callback, if any
+        bool do_narrow_contactgeneration = true;
+        if (broad_callback)
+            do_narrow_contactgeneration = broad_callback->OnBroadphase(bt_modelA->model, bt_modelB->model);
 
-        // Uncomment this line to remove all points
-        ////contactManifold->clearManifold();
+        if (!do_narrow_contactgeneration)
+            continue;
+
+        for (int k = m_contact_offsets[i]; k < m_contact_offsets[i + 1]; k++) {
+            if (!m_contact_valid[k])
+                continue;
+
+            // Execute some user custom callback, if any
+            bool add_contact = true;
+            if (this->narrow_callback)
+                add_contact = this->narrow_callback->OnNarrowphase(m_contact_info[k]);
+
+            // Add to contact container
+            if (add_contact)
+                mcontactcontainer->AddContact(m_contact_info[k]);
+        }
     }
     mcontactcontainer->EndAddContact();
 }
@@ -411,6 +464,22 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
     return true;
 }
 
+int ChCollisionSystemBullet::RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const {
+    // Note: ray tests on the Bullet collision world are thread-safe (Chrono builds Bullet with BT_THREADSAFE)
+    results.resize(rays.size());
+    int num_rays = (int)rays.size();
+    int num_hits = 0;
+
+#pragma omp parallel for schedule(static) num_threads(m_num_threads) reduction(+ : num_hits)
+    for (int i = 0; i < num_rays; i++) {
+        if (RayHit(rays[i].from, rays[i].to, results[i], cbtBroadphaseProxy::DefaultFilter,
+                   cbtBroadphaseProxy::AllFilter))
+            num_hits++;
+    }
+
+    return num_hits;
+}
+
 void ChCollisionSystemBullet::SetContactBreakingThreshold(double threshold) {
     gContactBreakingThreshold = (cbtScalar)threshold;
 }
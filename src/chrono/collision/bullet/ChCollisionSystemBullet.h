@@ -15,6 +15,8 @@
 #ifndef CH_COLLISION_SYSTEM_BULLET_H
 #define CH_COLLISION_SYSTEM_BULLET_H
 
+#include <unordered_map>
+
 #include "chrono/collision/ChCollisionSystem.h"
 #include "chrono/collision/bullet/ChCollisionModelBullet.h"
 #include "chrono/collision/bullet/cbtBulletCollisionCommon.h"
@@ -50,6 +52,8 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     // virtual void RemoveAll();
 
     /// Set the number of OpenMP threads for collision detection.
+    /// With more than one thread, the AABB update and the broadphase pair search are executed concurrently, in
+    /// addition to the narrowphase. Contact points are also converted concurrently in ReportContacts.
     virtual void SetNumThreads(int nthreads) override;
 
     /// Run the algorithm and finds all the contacts.
@@ -95,6 +99,11 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models for a batch of rays.
+    /// The rays are distributed over the OpenMP threads for collision detection (see SetNumThreads), each thread
+    /// traversing the broadphase BVH independently.
+    virtual int RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const override;
+
     /// Specify a callback object to be used for debug rendering of collision shapes.
     virtual void RegisterVisualizationCallback(std::shared_ptr<VisualizationCallback> callback) override;
 
@@ -140,8 +149,17 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// If erase=true, also remove from the bt_models list.
     void Remove(ChCollisionModelBullet* bt_model, bool erase);
 
+    /// Return the Bullet model holding the collision geometry shared by all models with the given shape template.
+    /// The geometry is created the first time the template is encountered.
+    ChCollisionModelBullet* GetTemplateModel(std::shared_ptr<ChCollisionModel> model_template);
+
     std::vector<std::shared_ptr<ChCollisionModelBullet>> bt_models;
 
+    /// Bullet models with the collision geometry of shape templates (the templates are kept alive with their models).
+    std::unordered_map<ChCollisionModel*,
+                       std::pair<std::shared_ptr<ChCollisionModel>, std::shared_ptr<ChCollisionModelBullet>>>
+        bt_templates;
+
     cbtCollisionConfiguration* bt_collision_configuration;
     cbtCollisionDispatcher* bt_dispatcher;
     cbtBroadphaseInterface* bt_broadphase;
@@ -160,6 +178,12 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
 
     cbtIDebugDraw* m_debug_drawer;
 
+    int m_num_threads;  ///< number of OpenMP threads for collision detection
+
+    std::vector<int> m_contact_offsets;           ///< offsets of manifold contacts in the contact buffer
+    std::vector<ChCollisionInfo> m_contact_info;  ///< buffer of converted contact points
+    std::vector<char> m_contact_valid;            ///< flags for contact points within the collision margins
+
     friend class ChCollisionModelBullet;
 };
 
@@ -17,6 +17,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/physics/ChSystem.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChParticleCloud.h"
@@ -24,13 +26,14 @@
 
 #include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
 #include "chrono/collision/multicore/ChRayTest.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
 CH_FACTORY_REGISTER(ChCollisionSystemMulticore)
 CH_UPCASTING(ChCollisionSystemMulticore, ChCollisionSystem)
 
-ChCollisionSystemMulticore::ChCollisionSystemMulticore() : use_aabb_active(false) {
+ChCollisionSystemMulticore::ChCollisionSystemMulticore() : use_aabb_active(false), m_num_threads(1) {
     // Create the shared data structure with own state data
     cd_data = chrono_types::make_shared<ChCollisionData>(true);
     cd_data->collision_envelope = ChCollisionModel::GetDefaultSuggestedEnvelope();
@@ -74,6 +77,7 @@ void ChCollisionSystemMulticore::EnableActiveBoundingBox(const ChVector3d& aabb_
 }
 
 void ChCollisionSystemMulticore::SetNumThreads(int nthreads) {
+    m_num_threads = std::max(1, nthreads);
 #ifdef _OPENMP
     omp_set_num_threads(nthreads);
 #endif
@@ -235,6 +239,8 @@ double ChCollisionSystemMulticore::GetTimerCollisionNarrow() const {
 // -----------------------------------------------------------------------------
 
 void ChCollisionSystemMulticore::PreProcess() {
+    CH_TRACE_ZONE("ChCollisionSystemMulticore::PreProcess", "collision");
+
     assert(cd_data->owns_state_data);
 
     std::vector<real3>& position = *cd_data->state_data.pos_rigid;
@@ -282,6 +288,8 @@ void ChCollisionSystemMulticore::PostProcess() {
 }
 
 void ChCollisionSystemMulticore::Run() {
+    CH_TRACE_ZONE("ChCollisionSystemMulticore::Run", "collision");
+
     ResetTimers();
 
     if (use_aabb_active) {
@@ -322,6 +330,8 @@ void ChCollisionSystemMulticore::Run() {
 // -----------------------------------------------------------------------------
 
 void ChCollisionSystemMulticore::ReportContacts(ChContactContainer* container) {
+    CH_TRACE_ZONE("ChCollisionSystemMulticore::ReportContacts", "collision");
+
     const auto& blist = m_system->GetBodies();
 
     // Resize global arrays with composite material properties.
@@ -577,6 +587,13 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
     }
 
     ChRayTest tester(cd_data);
+    return RayHit(tester, from, to, result);
+}
+
+bool ChCollisionSystemMulticore::RayHit(ChRayTest& tester,
+                                        const ChVector3d& from,
+                                        const ChVector3d& to,
+                                        ChRayhitResult& result) const {
     ChRayTest::RayHitInfo info;
     if (tester.Check(FromChVector(from), FromChVector(to), info)) {
         // Hit point
@@ -598,6 +615,34 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
     return false;
 }
 
+int ChCollisionSystemMulticore::RayHitBatch(const std::vector<ChRay>& rays,
+                                            std::vector<ChRayhitResult>& results) const {
+    results.resize(rays.size());
+    int num_rays = (int)rays.size();
+
+    if (cd_data->num_active_bins == 0) {
+        for (auto& result : results)
+            result.hit = false;
+        return 0;
+    }
+
+    int num_hits = 0;
+
+#pragma omp parallel num_threads(m_num_threads) reduction(+ : num_hits)
+    {
+        // Ray tester for the current thread
+        ChRayTest tester(cd_data);
+
+#pragma omp for schedule(static)
+        for (int i = 0; i < num_rays; i++) {
+            if (RayHit(tester, rays[i].from, rays[i].to, results[i]))
+                num_hits++;
+        }
+    }
+
+    return num_hits;
+}
+
 bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from,
                                         const ChVector3d& to,
                                         ChCollisionModel* model,
@@ -35,6 +35,7 @@ namespace chrono {
 // forward references
 class ChAssembly;
 class ChParticleCloud;
+class ChRayTest;
 
 /// @addtogroup collision_mc
 /// @{
@@ -136,6 +137,11 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models for a batch of rays.
+    /// The rays are processed concurrently, in contiguous chunks (one per OpenMP thread), each thread traversing the
+    /// broadphase grid with its own ray tester.
+    virtual int RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const override;
+
     /// Method to trigger debug visualization of collision shapes.
     /// The 'flags' argument can be any of the VisualizationModes enums, or a combination thereof (using bit-wise
     /// operators). The calling program must invoke this function from within the simulation loop. No-op if a
@@ -158,6 +164,9 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// Generate the current axis-aligned bounding boxes of collision shapes.
     void GenerateAABB();
 
+    /// Perform a ray-hit test with all collision models, using the provided ray tester.
+    bool RayHit(ChRayTest& tester, const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const;
+
     /// Visualize collision shapes (wireframe).
     void VisualizeShapes();
 
@@ -180,6 +189,8 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     real3 active_aabb_min;  ///< lower corner of active bounding box
     real3 active_aabb_max;  ///< upper corner of active bounding box
 
+    int m_num_threads;  ///< number of OpenMP threads for collision detection
+
     ChTimer m_timer_broad;
     ChTimer m_timer_narrow;
 };
@@ -53,6 +53,7 @@ const size_t ChBezierCurve::m_maxNumIters = 50;
 const double ChBezierCurve::m_sqrDistTol = 1e-6;
 const double ChBezierCurve::m_cosAngleTol = 1e-4;
 const double ChBezierCurve::m_paramTol = 1e-5;
+const size_t ChBezierCurve::m_bvhLeafSize = 2;
 
 // -----------------------------------------------------------------------------
 // ChBezierCurve::ChBezierCurve()
@@ -82,6 +83,8 @@ ChBezierCurve::ChBezierCurve(const std::vector<ChVector3d>& points,
             m_outCV.push_back(m_outCV.front());
         }
     }
+
+    BuildIndex();
 }
 
 ChBezierCurve::ChBezierCurve(const std::vector<ChVector3d>& points, bool closed) : m_points(points), m_closed(closed) {
@@ -112,6 +115,7 @@ ChBezierCurve::ChBezierCurve(const std::vector<ChVector3d>& points, bool closed)
         m_outCV[0] = (2.0 * m_points[0] + m_points[1]) / 3;
         m_inCV[1] = (2.0 * m_points[1] + m_points[0]) / 3;
         m_closed = false;
+        BuildIndex();
         return;
     }
 
@@ -228,6 +232,8 @@ ChBezierCurve::ChBezierCurve(const std::vector<ChVector3d>& points, bool closed)
         delete[] y;
         delete[] z;
     }
+
+    BuildIndex();
 }
 
 void ChBezierCurve::setPoints(const std::vector<ChVector3d>& points,
@@ -239,6 +245,7 @@ void ChBezierCurve::setPoints(const std::vector<ChVector3d>& points,
     m_points = points;
     m_inCV = inCV;
     m_outCV = outCV;
+    BuildIndex();
 }
 
 // Utility function for solving the tridiagonal system for one of the
@@ -553,6 +560,168 @@ ChVector3d ChBezierCurve::CalcClosestPoint(const ChVector3d& loc, size_t i, doub
     */
 }
 
+// -----------------------------------------------------------------------------
+// ChBezierCurve::BuildIndex()
+//
+// Build a bounding volume hierarchy (BVH) over the curve intervals. Each interval
+// is bounded by the axis-aligned box of its control polygon which, by the convex
+// hull property of Bezier curves, contains the curve segment. Nodes are split at
+// the median of the interval box centers, along the longest axis.
+// -----------------------------------------------------------------------------
+void ChBezierCurve::BuildIndex() {
+    m_bvh_nodes.clear();
+    m_bvh_intervals.clear();
+
+    if (m_points.size() < 2)
+        return;
+
+    size_t n = GetNumSegments();
+    std::vector<ChVector3d> box_min(n);
+    std::vector<ChVector3d> box_max(n);
+    for (size_t i = 0; i < n; i++) {
+        box_min[i] = Vmin(Vmin(m_points[i], m_outCV[i]), Vmin(m_inCV[i + 1], m_points[i + 1]));
+        box_max[i] = Vmax(Vmax(m_points[i], m_outCV[i]), Vmax(m_inCV[i + 1], m_points[i + 1]));
+    }
+
+    m_bvh_intervals.resize(n);
+    for (size_t i = 0; i < n; i++)
+        m_bvh_intervals[i] = i;
+
+    m_bvh_nodes.reserve(2 * n);
+    m_bvh_nodes.push_back(BVHNode());
+    BuildIndexNode(0, 0, n, box_min, box_max);
+}
+
+void ChBezierCurve::BuildIndexNode(size_t node,
+                                   size_t begin,
+                                   size_t end,
+                                   const std::vector<ChVector3d>& box_min,
+                                   const std::vector<ChVector3d>& box_max) {
+    // Node bounding box and bounding box of interval box centers
+    ChVector3d nmin = box_min[m_bvh_intervals[begin]];
+    ChVector3d nmax = box_max[m_bvh_intervals[begin]];
+    ChVector3d cmin = 0.5 * (nmin + nmax);
+    ChVector3d cmax = cmin;
+    for (size_t k = begin + 1; k < end; k++) {
+        size_t i = m_bvh_intervals[k];
+        nmin = Vmin(nmin, box_min[i]);
+        nmax = Vmax(nmax, box_max[i]);
+        ChVector3d c = 0.5 * (box_min[i] + box_max[i]);
+        cmin = Vmin(cmin, c);
+        cmax = Vmax(cmax, c);
+    }
+    m_bvh_nodes[node].min = nmin;
+    m_bvh_nodes[node].max = nmax;
+
+    if (end - begin <= m_bvhLeafSize) {
+        m_bvh_nodes[node].first = begin;
+        m_bvh_nodes[node].count = end - begin;
+        return;
+    }
+
+    // Split at the median along the longest axis of the box centers
+    ChVector3d extent = cmax - cmin;
+    unsigned int axis = 0;
+    if (extent.y() > extent[axis])
+        axis = 1;
+    if (extent.z() > extent[axis])
+        axis = 2;
+
+    size_t mid = (begin + end) / 2;
+    auto center_less = [&](size_t a, size_t b) {
+        return box_min[a][axis] + box_max[a][axis] < box_min[b][axis] + box_max[b][axis];
+    };
+    std::nth_element(m_bvh_intervals.begin() + begin, m_bvh_intervals.begin() + mid, m_bvh_intervals.begin() + end,
+                     center_less);
+
+    size_t child = m_bvh_nodes.size();
+    m_bvh_nodes.push_back(BVHNode());
+    m_bvh_nodes.push_back(BVHNode());
+    m_bvh_nodes[node].first = child;
+    m_bvh_nodes[node].count = 0;
+
+    BuildIndexNode(child, begin, mid, box_min, box_max);
+    BuildIndexNode(child + 1, mid, end, box_min, box_max);
+}
+
+double ChBezierCurve::CalcNodeDist2(const BVHNode& node, const ChVector3d& loc) {
+    ChVector3d d = Vmax(Vmax(node.min - loc, loc - node.max), VNULL);
+    return d.Length2();
+}
+
+// -----------------------------------------------------------------------------
+// ChBezierCurve::FindClosestPoint()
+//
+// This function calculates and returns the closest point on the entire curve to
+// the specified location, using a depth-first traversal of the BVH (nearer child
+// first). Subtrees with a bounding box farther than the current closest point are
+// pruned, and the closest point in a candidate interval is obtained with
+// CalcClosestPoint.
+// -----------------------------------------------------------------------------
+ChVector3d ChBezierCurve::FindClosestPoint(const ChVector3d& loc, size_t& i, double& t) const {
+    assert(!m_bvh_nodes.empty());
+
+    ChVector3d point = m_points[0];
+    double d2_min = std::numeric_limits<double>::max();
+    i = 0;
+    t = 0;
+
+    // Traversal stack (the BVH depth is logarithmic in the number of intervals)
+    size_t stack[64];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const auto& node = m_bvh_nodes[stack[--top]];
+        if (CalcNodeDist2(node, loc) >= d2_min)
+            continue;
+
+        if (node.count > 0) {
+            for (size_t k = node.first; k < node.first + node.count; k++) {
+                size_t ik = m_bvh_intervals[k];
+                double tk;
+                auto pk = CalcClosestPoint(loc, ik, tk);
+                double d2 = (pk - loc).Length2();
+                if (d2 < d2_min) {
+                    d2_min = d2;
+                    point = pk;
+                    i = ik;
+                    t = tk;
+                }
+            }
+            continue;
+        }
+
+        // Push the farther child first, so that the nearer child is processed next
+        size_t c0 = node.first;
+        size_t c1 = node.first + 1;
+        double d2_0 = CalcNodeDist2(m_bvh_nodes[c0], loc);
+        double d2_1 = CalcNodeDist2(m_bvh_nodes[c1], loc);
+        if (d2_0 > d2_1) {
+            std::swap(c0, c1);
+            std::swap(d2_0, d2_1);
+        }
+        if (d2_1 < d2_min)
+            stack[top++] = c1;
+        if (d2_0 < d2_min)
+            stack[top++] = c0;
+    }
+
+    return point;
+}
+
+void ChBezierCurve::FindClosestPoints(const std::vector<ChVector3d>& locs,
+                                      std::vector<ChVector3d>& points,
+                                      std::vector<size_t>& intervals,
+                                      std::vector<double>& params) const {
+    size_t n = locs.size();
+    points.resize(n);
+    intervals.resize(n);
+    params.resize(n);
+    for (size_t k = 0; k < n; k++)
+        points[k] = FindClosestPoint(locs[k], intervals[k], params[k]);
+}
+
 // -----------------------------------------------------------------------------
 
 void ChBezierCurve::ArchiveOut(ChArchiveOut& archive_out) {
@@ -581,6 +750,8 @@ void ChBezierCurve::ArchiveIn(ChArchiveIn& archive_in) {
     archive_in >> CHNVP(m_sqrDistTol);
     archive_in >> CHNVP(m_cosAngleTol);
     archive_in >> CHNVP(m_paramTol);
+
+    BuildIndex();
 }
 
 // -----------------------------------------------------------------------------
@@ -591,51 +762,11 @@ ChBezierCurveTracker::ChBezierCurveTracker(std::shared_ptr<ChBezierCurve> path)
 // -----------------------------------------------------------------------------
 // ChBezierCurveTracker::Reset()
 //
-// This function reinitializes the pathTracker at the specified location. It
-// calculates an appropriate initial guess for the curve segment and sets the
-// curve parameter to 0.5.
+// This function reinitializes the pathTracker at the specified location, using a
+// global search (through the curve BVH) for the closest point on the curve.
 // -----------------------------------------------------------------------------
-class PointSpec {
-  public:
-    PointSpec() {}
-    PointSpec(size_t index, double dist2) : m_index(index), m_dist2(dist2) {}
-
-    size_t m_index;
-    double m_dist2;
-};
-
-static bool comparePoints(const PointSpec& p1, const PointSpec& p2) {
-    return p1.m_dist2 < p2.m_dist2;
-}
-
 void ChBezierCurveTracker::Reset(const ChVector3d& loc) {
-    // Walk all curve points and calculate the distance to the specified reset
-    // location, then sort them in increasing order.
-    std::vector<PointSpec> points;
-
-    for (size_t i = 0; i < m_path->GetNumPoints(); i++)
-        points.push_back(PointSpec(i, (loc - m_path->m_points[i]).Length2()));
-
-    std::sort(points.begin(), points.end(), comparePoints);
-
-    // Set the initial guess to be at t=0.5 in either the interval starting at
-    // the point with minimum distance or in the previous interval.
-    m_curParam = 0.5f;
-    m_curInterval = points[0].m_index;
-
-    if (m_curInterval == 0)
-        return;
-
-    if (m_curInterval == m_path->GetNumPoints() - 1) {
-        m_curInterval--;
-        return;
-    }
-
-    ChVector3d loc2cur = m_path->m_points[m_curInterval] - loc;
-    ChVector3d loc2prev = m_path->m_points[m_curInterval - 1] - loc;
-
-    if (Vdot(loc2cur, loc2prev) < 0)
-        m_curInterval--;
+    m_path->FindClosestPoint(loc, m_curInterval, m_curParam);
 }
 
 // -----------------------------------------------------------------------------
@@ -653,65 +784,66 @@ void ChBezierCurveTracker::Reset(const ChVector3d& loc) {
 //  - find the closest point in the current interval of the Bezier curve to the
 //    specified location;
 //  - stop if the curve parameter is in (0, 1);
-//  - if the curve parameter is close to 0, check the previous interval, unless
-//    at the previous iteration the parameter was close to 1;
-//  - if the curve parameter is close to 1, check the next interval, unless at
-//    the previous iteration the parameter was close to 0.
+//  - if the curve parameter is close to 0, check the previous interval and move
+//    to it if it contains a closer point;
+//  - if the curve parameter is close to 1, check the next interval and move to
+//    it if it contains a closer point;
+//  - repeat for at most a few intervals; if the closest point is still not
+//    bracketed, re-acquire the path with a global search.
 // -----------------------------------------------------------------------------
+static const int max_walk_intervals = 8;
+
 int ChBezierCurveTracker::CalcClosestPoint(const ChVector3d& loc, ChVector3d& point) {
+    size_t last_interval = m_path->GetNumPoints() - 2;
+
     // Evaluate in current interval
     point = m_path->CalcClosestPoint(loc, m_curInterval, m_curParam);
 
-    if (m_curParam < ChBezierCurve::m_paramTol) {
-        // Close to lower limit. Consider previous interval
-        size_t prevInterval = m_curInterval - 1;
-        if (m_curInterval == 0) {
-            if (m_path->IsClosed())
-                prevInterval = m_path->GetNumPoints() - 2;
-            else
-                return -1;
-        }
-
-        // Check previous interval
-        double p_m;
-        auto pt_m = m_path->CalcClosestPoint(loc, prevInterval, p_m);
-
-        if ((pt_m - loc).Length2() < (point - loc).Length2()) {
-            ////std::cout << "loc = " << loc << "  DECREASE to " << m_curInterval - 1 << "  p = " << p_m
-            ////          << "    point: " << point << "  point minus: " << pt_m << std::endl;
-            m_curInterval = prevInterval;
-            m_curParam = p_m;
-            point = pt_m;
-        }
-
-        return 0;
-    } else if (m_curParam > 1 - ChBezierCurve::m_paramTol) {
-        // Close to upper limit. Consider next interval
-        size_t nextInterval = m_curInterval + 1;
-        if (m_curInterval == m_path->GetNumPoints() - 2) {
-            if (m_path->IsClosed())
-                nextInterval = 0;
-            else
-                return +1;
+    for (int k = 0; k < max_walk_intervals; k++) {
+        size_t interval;
+        if (m_curParam < ChBezierCurve::m_paramTol) {
+            // Close to lower limit. Consider previous interval
+            if (m_curInterval == 0) {
+                if (!m_path->IsClosed())
+                    return -1;
+                interval = last_interval;
+            } else {
+                interval = m_curInterval - 1;
+            }
+        } else if (m_curParam > 1 - ChBezierCurve::m_paramTol) {
+            // Close to upper limit. Consider next interval
+            if (m_curInterval == last_interval) {
+                if (!m_path->IsClosed())
+                    return +1;
+                interval = 0;
+            } else {
+                interval = m_curInterval + 1;
+            }
+        } else {
+            // Not close to interval bounds. Done
+            return 0;
         }
 
-        // Check next interval
-        double p_p;
-        auto pt_p = m_path->CalcClosestPoint(loc, m_curInterval + 1, p_p);
+        // Move to the neighbor interval only if it contains a closer point
+        double param;
+        auto pt = m_path->CalcClosestPoint(loc, interval, param);
+        if ((pt - loc).Length2() >= (point - loc).Length2())
+            return 0;
 
-        if ((pt_p - loc).Length2() < (point - loc).Length2()) {
-            ////std::cout << "loc = " << loc << "  INCREASE to " << m_curInterval + 1 << "  p = " << p_p
-            ////          << "    point: " << point << "  point plus: " << pt_p << std::endl;
-            m_curInterval = nextInterval;
-            m_curParam = p_p;
-            point = pt_p;
-        }
+        m_curInterval = interval;
+        m_curParam = param;
+        point = pt;
+    }
 
-        return 0;
-    } else {
-        // Not close to interval bounds. Done
-        return 0;
+    // Closest point moved by too many intervals since the last query. Re-acquire with a global search.
+    point = m_path->FindClosestPoint(loc, m_curInterval, m_curParam);
+    if (!m_path->IsClosed()) {
+        if (m_curInterval == 0 && m_curParam < ChBezierCurve::m_paramTol)
+            return -1;
+        if (m_curInterval == last_interval && m_curParam > 1 - ChBezierCurve::m_paramTol)
+            return +1;
     }
+    return 0;
 
     /*
     bool lastAtMin = false;
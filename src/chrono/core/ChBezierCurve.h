@@ -138,6 +138,22 @@ class ChApi ChBezierCurve {
     /// to the closest point.
     ChVector3d CalcClosestPoint(const ChVector3d& loc, size_t i, double& t) const;
 
+    /// Calculate the closest point on the entire curve to the given location.
+    /// This function performs a global search using a bounding volume hierarchy over the curve intervals (built when
+    /// the curve nodes are set), so that only intervals near the specified location are examined. On return, 'i' and
+    /// 't' contain the interval and the curve parameter (within that interval) corresponding to the closest point.
+    /// This function does not modify the curve and can be called concurrently from multiple threads.
+    ChVector3d FindClosestPoint(const ChVector3d& loc, size_t& i, double& t) const;
+
+    /// Calculate the closest points on the entire curve to the given locations.
+    /// This is the batch version of FindClosestPoint, for multiple queries (e.g., multiple vehicles) on the same curve.
+    /// The output vectors are resized to the number of query locations.
+    void FindClosestPoints(const std::vector<ChVector3d>& locs,  ///< [in] query locations
+                           std::vector<ChVector3d>& points,      ///< [out] closest points
+                           std::vector<size_t>& intervals,       ///< [out] intervals of closest points
+                           std::vector<double>& params           ///< [out] curve parameters of closest points
+    ) const;
+
     /// Write the knots and control points to the specified file.
     void Write(const std::string& filename);
 
@@ -165,16 +181,44 @@ class ChApi ChBezierCurve {
     /// resulting Bezier curve is a spline interpolant of the knots.
     static void SolveTriDiag(size_t n, double* rhs, double* x);
 
+    /// Node in the bounding volume hierarchy over curve intervals.
+    /// A leaf node references 'count' consecutive entries in m_bvh_intervals, starting at 'first'. An internal node
+    /// has count = 0 and its two children are stored at 'first' and 'first + 1' in m_bvh_nodes.
+    struct BVHNode {
+        ChVector3d min;  ///< lower corner of node bounding box
+        ChVector3d max;  ///< upper corner of node bounding box
+        size_t first;    ///< index of first interval (leaf) or of first child (internal node)
+        size_t count;    ///< number of intervals (leaf) or 0 (internal node)
+    };
+
+    /// Build the bounding volume hierarchy over the curve intervals.
+    /// Each interval is bounded by the box of its control polygon (which contains the Bezier curve segment).
+    void BuildIndex();
+
+    /// Recursively build the subtree of the specified node over the intervals in [begin, end).
+    void BuildIndexNode(size_t node,
+                        size_t begin,
+                        size_t end,
+                        const std::vector<ChVector3d>& box_min,
+                        const std::vector<ChVector3d>& box_max);
+
+    /// Return the squared distance from the specified location to the bounding box of the given node.
+    static double CalcNodeDist2(const BVHNode& node, const ChVector3d& loc);
+
     std::vector<ChVector3d> m_points;  ///< set of knot points
     std::vector<ChVector3d> m_inCV;    ///< set on "incident" control points
     std::vector<ChVector3d> m_outCV;   ///< set of "outgoing" control points
 
     bool m_closed;  ///< treat the path as a closed loop curve
 
+    std::vector<BVHNode> m_bvh_nodes;     ///< bounding volume hierarchy over curve intervals
+    std::vector<size_t> m_bvh_intervals;  ///< curve intervals, ordered by BVH leaf
+
     static const size_t m_maxNumIters;  ///< maximum number of Newton iterations
     static const double m_sqrDistTol;   ///< tolerance on squared distance
     static const double m_cosAngleTol;  ///< tolerance for orthogonality test
     static const double m_paramTol;     ///< tolerance for change in parameter value
+    static const size_t m_bvhLeafSize;  ///< maximum number of intervals in a BVH leaf
 
     friend class ChBezierCurveTracker;
 };
@@ -195,9 +239,8 @@ class ChApi ChBezierCurveTracker {
     ~ChBezierCurveTracker() {}
 
     /// Reset the tracker at the specified location.
-    /// This function reinitializes the pathTracker at the specified location. It
-    /// calculates an appropriate initial guess for the curve segment and sets the
-    /// curve parameter to 0.5.
+    /// This function reinitializes the pathTracker at the specified location, using
+    /// a global search for the closest point on the curve.
     void Reset(const ChVector3d& loc);
 
     /// Calculate the closest point on the underlying curve to the specified location.
@@ -208,6 +251,8 @@ class ChApi ChBezierCurveTracker {
     /// for the Newton iteration, we use time coherence (by keeping track of the path
     /// interval and curve parameter within that interval from the last query). As
     /// such, this function should be called with a continuous sequence of locations.
+    /// If the closest point moved by more than a few intervals since the last query,
+    /// the tracker is re-acquired with a global search.
     int CalcClosestPoint(const ChVector3d& loc, ChVector3d& point);
 
     /// Calculate the closest point on the underlying curve to the specified location.
@@ -0,0 +1,289 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CH_DUAL_H
+#define CH_DUAL_H
+
+#include <cmath>
+
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+/// Namespace for automatic differentiation.
+/// ChDual and the overloads of the arithmetic operators and elementary functions live in this namespace, where they
+/// are found by argument-dependent lookup for unqualified calls with dual-number arguments.
+namespace ad {
+
+/// @addtogroup chrono_linalg
+/// @{
+
+/// Dual number for forward-mode automatic differentiation.
+/// A dual number carries a value and its derivatives with respect to N independent variables (directions). All
+/// arithmetic operations and the elementary functions below propagate derivatives exactly, so that a function written
+/// in terms of ChDual<N> evaluates both its value and its gradient in a single pass.
+template <int N>
+class ChDual {
+  public:
+    typedef ChVectorN<double, N> Gradient;
+
+    /// Construct a constant (zero derivatives).
+    ChDual(double value = 0) : m_value(value) { m_grad.setZero(); }
+
+    /// Construct a dual number with given value and derivatives.
+    ChDual(double value, const Gradient& grad) : m_value(value), m_grad(grad) {}
+
+    /// Construct the independent variable with given index (unit derivative in direction i).
+    static ChDual Variable(double value, int i) {
+        ChDual x(value);
+        x.m_grad(i) = 1;
+        return x;
+    }
+
+    /// Return the value.
+    double value() const { return m_value; }
+
+    /// Return the derivatives.
+    const Gradient& grad() const { return m_grad; }
+    Gradient& grad() { return m_grad; }
+
+    /// Return the derivative in direction i.
+    double grad(int i) const { return m_grad(i); }
+
+    ChDual operator-() const { return ChDual(-m_value, -m_grad); }
+
+    ChDual& operator+=(const ChDual& b) {
+        m_value += b.m_value;
+        m_grad += b.m_grad;
+        return *this;
+    }
+    ChDual& operator-=(const ChDual& b) {
+        m_value -= b.m_value;
+        m_grad -= b.m_grad;
+        return *this;
+    }
+    ChDual& operator*=(const ChDual& b) {
+        m_grad = m_grad * b.m_value + b.m_grad * m_value;
+        m_value *= b.m_value;
+        return *this;
+    }
+    ChDual& operator/=(const ChDual& b) {
+        m_grad = (m_grad * b.m_value - b.m_grad * m_value) / (b.m_value * b.m_value);
+        m_value /= b.m_value;
+        return *this;
+    }
+
+  private:
+    double m_value;
+    Gradient m_grad;
+
+  public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+// Arithmetic operators
+
+template <int N>
+inline ChDual<N> operator+(ChDual<N> a, const ChDual<N>& b) {
+    return a += b;
+}
+template <int N>
+inline ChDual<N> operator+(ChDual<N> a, double b) {
+    return a += ChDual<N>(b);
+}
+template <int N>
+inline ChDual<N> operator+(double a, ChDual<N> b) {
+    return b += ChDual<N>(a);
+}
+
+template <int N>
+inline ChDual<N> operator-(ChDual<N> a, const ChDual<N>& b) {
+    return a -= b;
+}
+template <int N>
+inline ChDual<N> operator-(ChDual<N> a, double b) {
+    return a -= ChDual<N>(b);
+}
+template <int N>
+inline ChDual<N> operator-(double a, const ChDual<N>& b) {
+    return ChDual<N>(a) -= b;
+}
+
+template <int N>
+inline ChDual<N> operator*(ChDual<N> a, const ChDual<N>& b) {
+    return a *= b;
+}
+template <int N>
+inline ChDual<N> operator*(const ChDual<N>& a, double b) {
+    return ChDual<N>(a.value() * b, a.grad() * b);
+}
+template <int N>
+inline ChDual<N> operator*(double a, const ChDual<N>& b) {
+    return ChDual<N>(a * b.value(), a * b.grad());
+}
+
+template <int N>
+inline ChDual<N> operator/(ChDual<N> a, const ChDual<N>& b) {
+    return a /= b;
+}
+template <int N>
+inline ChDual<N> operator/(const ChDual<N>& a, double b) {
+    return ChDual<N>(a.value() / b, a.grad() / b);
+}
+template <int N>
+inline ChDual<N> operator/(double a, const ChDual<N>& b) {
+    return ChDual<N>(a) /= b;
+}
+
+// Comparison operators (on values)
+
+template <int N>
+inline bool operator<(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() < b.value();
+}
+template <int N>
+inline bool operator<(const ChDual<N>& a, double b) {
+    return a.value() < b;
+}
+template <int N>
+inline bool operator<(double a, const ChDual<N>& b) {
+    return a < b.value();
+}
+template <int N>
+inline bool operator>(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() > b.value();
+}
+template <int N>
+inline bool operator>(const ChDual<N>& a, double b) {
+    return a.value() > b;
+}
+template <int N>
+inline bool operator>(double a, const ChDual<N>& b) {
+    return a > b.value();
+}
+template <int N>
+inline bool operator<=(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() <= b.value();
+}
+template <int N>
+inline bool operator<=(const ChDual<N>& a, double b) {
+    return a.value() <= b;
+}
+template <int N>
+inline bool operator<=(double a, const ChDual<N>& b) {
+    return a <= b.value();
+}
+template <int N>
+inline bool operator>=(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() >= b.value();
+}
+template <int N>
+inline bool operator>=(const ChDual<N>& a, double b) {
+    return a.value() >= b;
+}
+template <int N>
+inline bool operator>=(double a, const ChDual<N>& b) {
+    return a >= b.value();
+}
+template <int N>
+inline bool operator==(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() == b.value();
+}
+template <int N>
+inline bool operator==(const ChDual<N>& a, double b) {
+    return a.value() == b;
+}
+template <int N>
+inline bool operator==(double a, const ChDual<N>& b) {
+    return a == b.value();
+}
+template <int N>
+inline bool operator!=(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() != b.value();
+}
+template <int N>
+inline bool operator!=(const ChDual<N>& a, double b) {
+    return a.value() != b;
+}
+template <int N>
+inline bool operator!=(double a, const ChDual<N>& b) {
+    return a != b.value();
+}
+
+// Elementary functions (found by argument-dependent lookup)
+
+template <int N>
+inline ChDual<N> sqrt(const ChDual<N>& a) {
+    double s = std::sqrt(a.value());
+    return ChDual<N>(s, a.grad() * (0.5 / s));
+}
+template <int N>
+inline ChDual<N> exp(const ChDual<N>& a) {
+    double e = std::exp(a.value());
+    return ChDual<N>(e, a.grad() * e);
+}
+template <int N>
+inline ChDual<N> log(const ChDual<N>& a) {
+    return ChDual<N>(std::log(a.value()), a.grad() / a.value());
+}
+template <int N>
+inline ChDual<N> pow(const ChDual<N>& a, double p) {
+    return ChDual<N>(std::pow(a.value(), p), a.grad() * (p * std::pow(a.value(), p - 1)));
+}
+template <int N>
+inline ChDual<N> abs(const ChDual<N>& a) {
+    return a.value() < 0 ? -a : a;
+}
+template <int N>
+inline ChDual<N> sin(const ChDual<N>& a) {
+    return ChDual<N>(std::sin(a.value()), a.grad() * std::cos(a.value()));
+}
+template <int N>
+inline ChDual<N> cos(const ChDual<N>& a) {
+    return ChDual<N>(std::cos(a.value()), a.grad() * (-std::sin(a.value())));
+}
+template <int N>
+inline ChDual<N> tan(const ChDual<N>& a) {
+    double t = std::tan(a.value());
+    return ChDual<N>(t, a.grad() * (1 + t * t));
+}
+template <int N>
+inline ChDual<N> asin(const ChDual<N>& a) {
+    return ChDual<N>(std::asin(a.value()), a.grad() / std::sqrt(1 - a.value() * a.value()));
+}
+template <int N>
+inline ChDual<N> acos(const ChDual<N>& a) {
+    return ChDual<N>(std::acos(a.value()), a.grad() * (-1 / std::sqrt(1 - a.value() * a.value())));
+}
+template <int N>
+inline ChDual<N> atan(const ChDual<N>& a) {
+    return ChDual<N>(std::atan(a.value()), a.grad() / (1 + a.value() * a.value()));
+}
+template <int N>
+inline ChDual<N> atan2(const ChDual<N>& y, const ChDual<N>& x) {
+    double r2 = x.value() * x.value() + y.value() * y.value();
+    return ChDual<N>(std::atan2(y.value(), x.value()), (y.grad() * x.value() - x.grad() * y.value()) / r2);
+}
+template <int N>
+inline ChDual<N> tanh(const ChDual<N>& a) {
+    double t = std::tanh(a.value());
+    return ChDual<N>(t, a.grad() * (1 - t * t));
+}
+
+/// @} chrono_linalg
+
+}  // end namespace ad
+}  // end namespace chrono
+
+#endif
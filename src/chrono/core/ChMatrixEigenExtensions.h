@@ -91,19 +91,32 @@ void ArchiveOut(chrono::ChArchiveOut& archive_out) {
         archive_out << chrono::make_ChNameValue("rows", m_row);
         archive_out << chrono::make_ChNameValue("columns", m_col);
 
-        // NORMAL array-based serialization:
+        // NORMAL array-based serialization (matrix coefficients in storage order, as one contiguous block):
         size_t tot_elements = derived().rows() * derived().cols();
         double* foo = 0;
         chrono::ChValueSpecific<double*> specVal(foo, "data", 0);
+        const auto& plain = derived().eval();
         archive_out.out_array_pre(specVal, tot_elements);
-        for (size_t i = 0; i < tot_elements; i++) {
-            archive_out << chrono::CHNVP(derived()((Eigen::Index)i), std::to_string(i).c_str());
-            archive_out.out_array_between(specVal, tot_elements);
-        }
+        if (tot_elements > 0)
+            ArchiveOutData(archive_out, specVal, plain.data(), tot_elements);
         archive_out.out_array_end(specVal, tot_elements);
     }
 }
 
+// Write matrix coefficients one at a time (scalar types other than double).
+template <typename T>
+void ArchiveOutData(chrono::ChArchiveOut& archive_out, chrono::ChValue& specVal, const T* data, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        archive_out << chrono::CHNVP(derived()((Eigen::Index)i), std::to_string(i).c_str());
+        archive_out.out_array_between(specVal, n);
+    }
+}
+
+// Write matrix coefficients as one contiguous block.
+void ArchiveOutData(chrono::ChArchiveOut& archive_out, chrono::ChValue& specVal, const double* data, size_t n) {
+    archive_out.out_array_bulk(specVal, data, n);
+}
+
 void ArchiveIn(chrono::ChArchiveIn& archive_in) {
     // suggested: use versioning
     /*int version =*/archive_in
@@ -121,11 +134,23 @@ void ArchiveIn(chrono::ChArchiveIn& archive_in) {
     // custom input of matrix data as array
     size_t tot_elements = derived().rows() * derived().cols();
     archive_in.in_array_pre("data", tot_elements);
-    for (size_t i = 0; i < tot_elements; i++) {
+    if (tot_elements > 0)
+        ArchiveInData(archive_in, derived().data(), tot_elements);
+    archive_in.in_array_end("data");
+}
+
+// Read matrix coefficients one at a time (scalar types other than double).
+template <typename T>
+void ArchiveInData(chrono::ChArchiveIn& archive_in, T* data, size_t n) {
+    for (size_t i = 0; i < n; i++) {
         archive_in >> chrono::CHNVP(derived()((Eigen::Index)i), std::to_string(i).c_str());
         archive_in.in_array_between("data");
     }
-    archive_in.in_array_end("data");
+}
+
+// Read matrix coefficients as one contiguous block.
+void ArchiveInData(chrono::ChArchiveIn& archive_in, double* data, size_t n) {
+    archive_in.in_array_bulk("data", data, n);
 }
 
 #endif
@@ -15,7 +15,10 @@
 #ifndef CH_ELEMENT_ANCF_H
 #define CH_ELEMENT_ANCF_H
 
+#include <vector>
+
 #include "chrono/core/ChQuadrature.h"
+#include "chrono/core/ChMatrix.h"
 
 namespace chrono {
 namespace fea {
@@ -23,6 +26,18 @@ namespace fea {
 /// @addtogroup fea_elements
 /// @{
 
+/// Data used for the batched evaluation of the internal forces of ANCF elements (see ChElementANCFBatch).
+/// Quadrature points are grouped in integration blocks sharing the same material stiffness matrix (e.g., one block per
+/// layer). The columns of SD are ordered by block and, within a block, by component (all points for the first
+/// component, then all points for the second component, etc.).
+struct ChElementANCFBatchData {
+    int num_shape_functions;      ///< number of shape functions (NSF)
+    std::vector<int> num_points;  ///< number of quadrature points in each block
+    ChMatrixDynamic<> SD;         ///< corrected normalized shape function derivatives (NSF x 3*NIP)
+    ChVectorDynamic<> kGQ;        ///< minus Gauss quadrature weights times element Jacobians (NIP)
+    std::vector<ChMatrix66d, Eigen::aligned_allocator<ChMatrix66d>> D;  ///< stiffness matrix for each block (Voigt)
+};
+
 /// Base class for ANCF elements.
 class ChApi ChElementANCF {
   public:
@@ -30,9 +45,45 @@ class ChApi ChElementANCF {
     virtual ~ChElementANCF() {}
 
   protected:
+    /// Return true if the internal forces can currently be evaluated in batched mode.
+    /// This is the case for elements using the "Continuous Integration" method.
+    virtual bool IsBatchSupported() const { return false; }
+
+    /// Return the structural damping coefficient (linear Kelvin-Voigt model) used in the batched evaluation.
+    /// Return 0 if damping is disabled.
+    virtual double GetBatchDamping() const { return 0; }
+
+    /// Get the constant data used for the batched evaluation of the internal forces.
+    virtual void GetBatchData(ChElementANCFBatchData& data) {}
+
+    /// Load the current 3xN matrices of nodal coordinates and, if ebardot is not null, of their time derivatives, in
+    /// row-major order, in the given arrays.
+    virtual void GetBatchCoordinates(double* ebar, double* ebardot) {}
+
+    /// Utility for implementing GetBatchCoordinates: load the 3xN coordinate matrices calculated by the given element
+    /// functions (for nodal coordinates and their time derivatives, respectively) in the given arrays.
+    template <class Element, typename Matrix3xN>
+    static void LoadBatchCoordinates(Element& element,
+                                     void (Element::*calc_coord)(Matrix3xN&),
+                                     void (Element::*calc_coord_dt)(Matrix3xN&),
+                                     double* ebar,
+                                     double* ebardot) {
+        Matrix3xN e;
+        (element.*calc_coord)(e);
+        Eigen::Map<Matrix3xN> ebar_map(ebar);
+        ebar_map = e;
+        if (ebardot) {
+            (element.*calc_coord_dt)(e);
+            Eigen::Map<Matrix3xN> ebardot_map(ebardot);
+            ebardot_map = e;
+        }
+    }
+
     int m_element_dof;           ///< actual number of degrees of freedom for the element
     bool m_full_dof;             ///< true if all node variables are active (not fixed)
     ChArray<int> m_mapping_dof;  ///< indices of active DOFs (set only is some are fixed)
+
+    friend class ChElementANCFBatch;
 };
 
 /// @} fea_elements
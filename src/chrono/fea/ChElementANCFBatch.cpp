@@ -0,0 +1,250 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Batched evaluation of the internal forces of ANCF elements ("Continuous
+// Integration" method, with or without linear Kelvin-Voigt damping).
+//
+// All per-element arrays are stored interleaved: entry i of element b is at
+// index i * SIZE + b. The innermost loops run over the elements in the batch,
+// with a compile-time trip count, and are vectorized by the compiler.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+
+#include "chrono/fea/ChElementANCFBatch.h"
+
+namespace chrono {
+namespace fea {
+
+static const int W = ChElementANCFBatch::SIZE;
+
+ChElementANCFBatch::ChElementANCFBatch(const std::vector<std::shared_ptr<ChElementBase>>& elements)
+    : m_elements(elements), m_compatible(true), m_nsf(0), m_nip(0) {
+    assert(!elements.empty() && elements.size() <= W);
+
+    for (const auto& element : m_elements)
+        m_ancf.push_back(dynamic_cast<ChElementANCF*>(element.get()));
+
+    // Collect the constant data of all elements and check that it has the same layout
+    std::vector<ChElementANCFBatchData> data(m_elements.size());
+    for (size_t b = 0; b < m_elements.size(); b++) {
+        if (!m_ancf[b]) {
+            m_compatible = false;
+            return;
+        }
+        m_ancf[b]->GetBatchData(data[b]);
+        if (data[b].num_shape_functions == 0 || data[b].num_points != data[0].num_points ||
+            data[b].num_shape_functions != data[0].num_shape_functions) {
+            m_compatible = false;
+            return;
+        }
+    }
+
+    m_nsf = data[0].num_shape_functions;
+    m_num_points = data[0].num_points;
+    for (auto n : m_num_points)
+        m_nip += n;
+    int nblocks = (int)m_num_points.size();
+    int ncols = 3 * m_nip;
+
+    // Interleave the element data. Unused lanes are left zero and produce zero internal forces.
+    m_SD.assign((size_t)m_nsf * ncols * W, 0.0);
+    m_kGQ.assign((size_t)m_nip * W, 0.0);
+    m_D.assign((size_t)nblocks * 36 * W, 0.0);
+
+    for (size_t b = 0; b < m_elements.size(); b++) {
+        assert(data[b].SD.rows() == m_nsf && data[b].SD.cols() == ncols);
+        assert(data[b].kGQ.size() == m_nip);
+        for (int k = 0; k < m_nsf; k++)
+            for (int col = 0; col < ncols; col++)
+                m_SD[((size_t)k * ncols + col) * W + b] = data[b].SD(k, col);
+        for (int ip = 0; ip < m_nip; ip++)
+            m_kGQ[ip * W + b] = data[b].kGQ(ip);
+        for (int blk = 0; blk < nblocks; blk++)
+            for (int i = 0; i < 36; i++)
+                m_D[(blk * 36 + i) * W + b] = data[b].D[blk](i / 6, i % 6);
+    }
+
+    m_alpha.assign(W, 0.0);
+    m_e.assign((size_t)6 * m_nsf * W, 0.0);
+    m_FC.assign((size_t)ncols * 6 * W, 0.0);
+    m_Q.assign((size_t)m_nsf * 3 * W, 0.0);
+    m_ebar.resize(3 * m_nsf);
+    m_ebardot.resize(3 * m_nsf);
+    m_Fi.resize(3 * m_nsf);
+}
+
+// Calculate the scaled transpose of the 1st Piola-Kirchoff stresses at one quadrature point, for all elements in the
+// batch, overwriting the deformation gradient (and its time derivative, if DAMPING) in F0, F1, and F2:
+//   - Green-Lagrange strains in Voigt notation, scaled by kGQ (combined with their scaled time derivatives, if DAMPING)
+//   - 2nd Piola-Kirchoff stresses: kGQ*SPK2 = D * E_Combined
+//   - P_Block = kGQ*P_transpose = kGQ*SPK2*F_transpose
+template <bool DAMPING>
+static void ComputeStresses(double* F0,
+                            double* F1,
+                            double* F2,
+                            const double* kGQ,
+                            const double* D,
+                            const double* alpha) {
+    for (int b = 0; b < W; b++) {
+        const double f00 = F0[b], f01 = F0[W + b], f02 = F0[2 * W + b];
+        const double f10 = F1[b], f11 = F1[W + b], f12 = F1[2 * W + b];
+        const double f20 = F2[b], f21 = F2[W + b], f22 = F2[2 * W + b];
+
+        double E[6] = {0.5 * (f00 * f00 + f01 * f01 + f02 * f02 - 1), 0.5 * (f10 * f10 + f11 * f11 + f12 * f12 - 1),
+                       0.5 * (f20 * f20 + f21 * f21 + f22 * f22 - 1), f10 * f20 + f11 * f21 + f12 * f22,
+                       f00 * f20 + f01 * f21 + f02 * f22,             f00 * f10 + f01 * f11 + f02 * f12};
+
+        if (DAMPING) {
+            const double d00 = F0[3 * W + b], d01 = F0[4 * W + b], d02 = F0[5 * W + b];
+            const double d10 = F1[3 * W + b], d11 = F1[4 * W + b], d12 = F1[5 * W + b];
+            const double d20 = F2[3 * W + b], d21 = F2[4 * W + b], d22 = F2[5 * W + b];
+            E[0] += alpha[b] * (f00 * d00 + f01 * d01 + f02 * d02);
+            E[1] += alpha[b] * (f10 * d10 + f11 * d11 + f12 * d12);
+            E[2] += alpha[b] * (f20 * d20 + f21 * d21 + f22 * d22);
+            E[3] += alpha[b] * (f10 * d20 + f11 * d21 + f12 * d22 + f20 * d10 + f21 * d11 + f22 * d12);
+            E[4] += alpha[b] * (f00 * d20 + f01 * d21 + f02 * d22 + f20 * d00 + f21 * d01 + f22 * d02);
+            E[5] += alpha[b] * (f00 * d10 + f01 * d11 + f02 * d12 + f10 * d00 + f11 * d01 + f12 * d02);
+        }
+
+        for (int r = 0; r < 6; r++)
+            E[r] *= kGQ[b];
+
+        double S[6];
+        for (int r = 0; r < 6; r++) {
+            S[r] = D[(6 * r + 0) * W + b] * E[0] + D[(6 * r + 1) * W + b] * E[1] + D[(6 * r + 2) * W + b] * E[2] +
+                   D[(6 * r + 3) * W + b] * E[3] + D[(6 * r + 4) * W + b] * E[4] + D[(6 * r + 5) * W + b] * E[5];
+        }
+
+        F0[b] = f00 * S[0] + f10 * S[5] + f20 * S[4];
+        F0[W + b] = f01 * S[0] + f11 * S[5] + f21 * S[4];
+        F0[2 * W + b] = f02 * S[0] + f12 * S[5] + f22 * S[4];
+
+        F1[b] = f00 * S[5] + f10 * S[1] + f20 * S[3];
+        F1[W + b] = f01 * S[5] + f11 * S[1] + f21 * S[3];
+        F1[2 * W + b] = f02 * S[5] + f12 * S[1] + f22 * S[3];
+
+        F2[b] = f00 * S[4] + f10 * S[3] + f20 * S[2];
+        F2[W + b] = f01 * S[4] + f11 * S[3] + f21 * S[2];
+        F2[2 * W + b] = f02 * S[4] + f12 * S[3] + f22 * S[2];
+    }
+}
+
+void ChElementANCFBatch::IntLoadResidual_F(ChVectorDynamic<>& R, const double c) {
+    // Fall back to element-by-element evaluation if the batched evaluation is not supported by all elements
+    bool batched = m_compatible;
+    for (auto ancf : m_ancf)
+        batched = batched && ancf->IsBatchSupported();
+    if (!batched) {
+        for (auto& element : m_elements)
+            element->EleIntLoadResidual_F(R, c);
+        return;
+    }
+
+    const int nsf = m_nsf;
+    const int ncols = 3 * m_nip;
+    const int nb = (int)m_elements.size();
+
+    // Damping coefficients (if damping is enabled for any element, the time derivatives of the deformation gradients
+    // are also needed)
+    bool damping = false;
+    for (int b = 0; b < nb; b++) {
+        m_alpha[b] = m_ancf[b]->GetBatchDamping();
+        damping = damping || (m_alpha[b] != 0);
+    }
+    const int nfc = damping ? 6 : 3;
+
+    // Load the nodal coordinates (and their time derivatives) of all elements
+    for (int b = 0; b < nb; b++) {
+        m_ancf[b]->GetBatchCoordinates(m_ebar.data(), damping ? m_ebardot.data() : nullptr);
+        for (int i = 0; i < 3 * nsf; i++)
+            m_e[i * W + b] = m_ebar[i];
+        if (damping) {
+            for (int i = 0; i < 3 * nsf; i++)
+                m_e[(3 * nsf + i) * W + b] = m_ebardot[i];
+        }
+    }
+
+    // Calculate the deformation gradient (and its time derivative) at all quadrature points, as in the element-wise
+    // calculation: FC(col, j) = sum_k SD(k, col) * ebar(j, k)
+    double* FC = m_FC.data();
+    std::fill(m_FC.begin(), m_FC.end(), 0.0);
+    for (int k = 0; k < nsf; k++) {
+        const double* sd = &m_SD[(size_t)k * ncols * W];
+        for (int j = 0; j < nfc; j++) {
+            const double* e = &m_e[(j * nsf + k) * W];
+            for (int col = 0; col < ncols; col++) {
+                double* fc = &FC[(col * nfc + j) * W];
+                for (int b = 0; b < W; b++)
+                    fc[b] += sd[col * W + b] * e[b];
+            }
+        }
+    }
+
+    // Calculate the scaled transpose of the 1st Piola-Kirchoff stresses at each quadrature point
+    int start = 0;
+    for (int blk = 0; blk < (int)m_num_points.size(); blk++) {
+        const int n = m_num_points[blk];
+        const double* D = &m_D[blk * 36 * W];
+        for (int i = 0; i < n; i++) {
+            double* F0 = &FC[(3 * start + 0 * n + i) * nfc * W];
+            double* F1 = &FC[(3 * start + 1 * n + i) * nfc * W];
+            double* F2 = &FC[(3 * start + 2 * n + i) * nfc * W];
+            const double* kGQ = &m_kGQ[(start + i) * W];
+            if (damping)
+                ComputeStresses<true>(F0, F1, F2, kGQ, D, m_alpha.data());
+            else
+                ComputeStresses<false>(F0, F1, F2, kGQ, D, m_alpha.data());
+        }
+        start += n;
+    }
+
+    // Multiply the scaled 1st Piola-Kirchoff stresses by the shape function derivatives to get the generalized internal
+    // forces in compact (NSF x 3) form: Q(k, j) = sum_col SD(k, col) * P(col, j)
+    for (int k = 0; k < nsf; k++) {
+        double q[3][W] = {};
+        const double* sd = &m_SD[(size_t)k * ncols * W];
+        for (int col = 0; col < ncols; col++) {
+            const double* p = &FC[col * nfc * W];
+            for (int b = 0; b < W; b++) {
+                q[0][b] += sd[col * W + b] * p[b];
+                q[1][b] += sd[col * W + b] * p[W + b];
+                q[2][b] += sd[col * W + b] * p[2 * W + b];
+            }
+        }
+        for (int j = 0; j < 3; j++)
+            for (int b = 0; b < W; b++)
+                m_Q[(3 * k + j) * W + b] = q[j][b];
+    }
+
+    // Scatter the internal forces of each element in the residual (as in ChElementGeneric::EleIntLoadResidual_F)
+    for (int b = 0; b < nb; b++) {
+        for (int i = 0; i < 3 * nsf; i++)
+            m_Fi(i) = c * m_Q[i * W + b];
+
+        auto element = m_elements[b].get();
+        unsigned int stride = 0;
+        for (unsigned int in = 0; in < element->GetNumNodes(); in++) {
+            unsigned int node_dofs = element->GetNodeNumCoordsPosLevelActive(in);
+            if (!element->GetNode(in)->IsFixed())
+                R.segment(element->GetNode(in)->NodeGetOffsetVelLevel(), node_dofs) += m_Fi.segment(stride, node_dofs);
+            stride += element->GetNodeNumCoordsPosLevel(in);
+        }
+    }
+}
+
+}  // end namespace fea
+}  // end namespace chrono
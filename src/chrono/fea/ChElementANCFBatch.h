@@ -0,0 +1,80 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CH_ELEMENT_ANCF_BATCH_H
+#define CH_ELEMENT_ANCF_BATCH_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/fea/ChElementANCF.h"
+#include "chrono/fea/ChElementBase.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_elements
+/// @{
+
+/// Batched evaluation of the internal forces of ANCF elements of the same type.
+/// Up to SIZE elements are processed together, using a structure-of-arrays layout in which the data of the different
+/// elements is interleaved. The loops over the quadrature points then operate on SIZE elements at a time and are
+/// vectorized by the compiler across elements (e.g., with AVX2 or AVX-512 instructions, if enabled).
+/// The constant element data (shape function derivatives, quadrature weights, material stiffness) is copied in the
+/// batch at construction; a batch must therefore be recreated if the elements are re-initialized.
+/// If any element does not currently support batched evaluation (e.g., if it uses the "Pre-Integration" method), all
+/// elements in the batch are evaluated one at a time, through their EleIntLoadResidual_F function.
+class ChApi ChElementANCFBatch {
+  public:
+    /// Maximum number of elements in a batch (number of SIMD lanes).
+    static const int SIZE = 8;
+
+    /// Create a batch with the given elements (at most SIZE), which must all be ANCF elements of the same type.
+    ChElementANCFBatch(const std::vector<std::shared_ptr<ChElementBase>>& elements);
+
+    /// Return the number of elements in this batch.
+    int GetNumElements() const { return (int)m_elements.size(); }
+
+    /// Add the internal forces of all elements in the batch, scaled by c, to the residual R (R += c * F).
+    /// The elements in a batch must not share nodes if batches are evaluated concurrently.
+    void IntLoadResidual_F(ChVectorDynamic<>& R, const double c);
+
+  private:
+    std::vector<std::shared_ptr<ChElementBase>> m_elements;  ///< elements in the batch
+    std::vector<ChElementANCF*> m_ancf;                      ///< elements in the batch, as ANCF elements
+    bool m_compatible;                                       ///< true if all elements have the same data layout
+
+    int m_nsf;                      ///< number of shape functions
+    int m_nip;                      ///< total number of quadrature points
+    std::vector<int> m_num_points;  ///< number of quadrature points in each integration block
+
+    std::vector<double> m_SD;   ///< shape function derivatives (NSF x 3*NIP x SIZE)
+    std::vector<double> m_kGQ;  ///< scaled quadrature weights (NIP x SIZE)
+    std::vector<double> m_D;    ///< stiffness matrices (blocks x 36 x SIZE)
+
+    std::vector<double> m_alpha;    ///< workspace: damping coefficients (SIZE)
+    std::vector<double> m_e;        ///< workspace: nodal coordinates and their time derivatives (6 x NSF x SIZE)
+    std::vector<double> m_FC;       ///< workspace: deformation gradients, then scaled 1st Piola-Kirchoff stresses
+    std::vector<double> m_Q;        ///< workspace: generalized internal forces (NSF x 3 x SIZE)
+    std::vector<double> m_ebar;     ///< workspace: nodal coordinates of a single element
+    std::vector<double> m_ebardot;  ///< workspace: nodal coordinate time derivatives of a single element
+    ChVectorDynamic<> m_Fi;         ///< workspace: internal forces of a single element
+};
+
+/// @} fea_elements
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
@@ -445,6 +445,41 @@ void ChElementBeamANCF_3243::ComputeGravityForces(ChVectorDynamic<>& Fg, const C
     GravForceCompact = m_GravForceScale * G_acc.eigen().transpose();
 }
 
+// -----------------------------------------------------------------------------
+// Interface to ChElementANCF base class
+// -----------------------------------------------------------------------------
+
+bool ChElementBeamANCF_3243::IsBatchSupported() const {
+    return m_method == IntFrcMethod::ContInt;
+}
+
+double ChElementBeamANCF_3243::GetBatchDamping() const {
+    return m_damping_enabled ? m_Alpha : 0;
+}
+
+void ChElementBeamANCF_3243::GetBatchData(ChElementANCFBatchData& data) {
+    // The batched evaluation requires the "Continuous Integration" style precomputed matrices
+    data.num_shape_functions = (m_SD.size() > 0) ? NSF : 0;
+    if (data.num_shape_functions == 0)
+        return;
+    data.num_points = {NIP_D0, NIP_Dv};
+    data.SD = m_SD;
+    data.kGQ.resize(NIP);
+    data.kGQ << m_kGQ_D0, m_kGQ_Dv;
+
+    // Stiffness matrices for the terms excluding and including the Poisson effect (see the element-wise calculation)
+    data.D.resize(2);
+    data.D[0].setZero();
+    data.D[0].diagonal() = GetMaterial()->Get_D0();
+    data.D[1].setZero();
+    data.D[1].block<3, 3>(0, 0) = GetMaterial()->Get_Dv();
+}
+
+void ChElementBeamANCF_3243::GetBatchCoordinates(double* ebar, double* ebardot) {
+    LoadBatchCoordinates(*this, &ChElementBeamANCF_3243::CalcCoordMatrix, &ChElementBeamANCF_3243::CalcCoordDtMatrix,
+                         ebar, ebardot);
+}
+
 // -----------------------------------------------------------------------------
 // Interface to ChElementBeam base class (and similar methods)
 // -----------------------------------------------------------------------------
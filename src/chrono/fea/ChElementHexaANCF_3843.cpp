@@ -523,6 +523,34 @@ void ChElementHexaANCF_3843::ComputeGravityForces(ChVectorDynamic<>& Fg, const C
     GravForceCompact = m_GravForceScale * G_acc.eigen().transpose();
 }
 
+// -----------------------------------------------------------------------------
+// Interface to ChElementANCF base class
+// -----------------------------------------------------------------------------
+
+bool ChElementHexaANCF_3843::IsBatchSupported() const {
+    return m_method == IntFrcMethod::ContInt;
+}
+
+double ChElementHexaANCF_3843::GetBatchDamping() const {
+    return m_damping_enabled ? m_Alpha : 0;
+}
+
+void ChElementHexaANCF_3843::GetBatchData(ChElementANCFBatchData& data) {
+    // The batched evaluation requires the "Continuous Integration" style precomputed matrices
+    data.num_shape_functions = (m_SD.size() > 0) ? NSF : 0;
+    if (data.num_shape_functions == 0)
+        return;
+    data.num_points = {NIP};
+    data.SD = m_SD;
+    data.kGQ = m_kGQ;
+    data.D.assign(1, GetMaterial()->Get_D());
+}
+
+void ChElementHexaANCF_3843::GetBatchCoordinates(double* ebar, double* ebardot) {
+    LoadBatchCoordinates(*this, &ChElementHexaANCF_3843::CalcCoordMatrix, &ChElementHexaANCF_3843::CalcCoordDtMatrix,
+                         ebar, ebardot);
+}
+
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 
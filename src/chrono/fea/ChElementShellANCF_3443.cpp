@@ -521,6 +521,40 @@ void ChElementShellANCF_3443::ComputeGravityForces(ChVectorDynamic<>& Fg, const
     GravForceCompact = m_GravForceScale * G_acc.eigen().transpose();
 }
 
+// -----------------------------------------------------------------------------
+// Interface to ChElementANCF base class
+// -----------------------------------------------------------------------------
+
+bool ChElementShellANCF_3443::IsBatchSupported() const {
+    return m_method == IntFrcMethod::ContInt;
+}
+
+double ChElementShellANCF_3443::GetBatchDamping() const {
+    return m_damping_enabled ? m_Alpha : 0;
+}
+
+void ChElementShellANCF_3443::GetBatchData(ChElementANCFBatchData& data) {
+    // The batched evaluation requires the "Continuous Integration" style precomputed matrices
+    data.num_shape_functions = (m_SD.size() > 0) ? NSF : 0;
+    if (data.num_shape_functions == 0)
+        return;
+    data.num_points.assign(m_numLayers, static_cast<int>(NIP));  // pass by value (NIP is not defined out of class)
+    data.SD = m_SD;
+    data.kGQ = m_kGQ;
+
+    // Stiffness matrix of each layer, rotated in the midsurface and reordered as in the element-wise calculation
+    data.D.resize(m_numLayers);
+    for (size_t kl = 0; kl < m_numLayers; kl++) {
+        data.D[kl] = m_layers[kl].GetMaterial()->Get_E_eps();
+        RotateReorderStiffnessMatrix(data.D[kl], m_layers[kl].GetFiberAngle());
+    }
+}
+
+void ChElementShellANCF_3443::GetBatchCoordinates(double* ebar, double* ebardot) {
+    LoadBatchCoordinates(*this, &ChElementShellANCF_3443::CalcCoordMatrix, &ChElementShellANCF_3443::CalcCoordDtMatrix,
+                         ebar, ebardot);
+}
+
 // -----------------------------------------------------------------------------
 // Interface to ChElementShell base class
 // -----------------------------------------------------------------------------
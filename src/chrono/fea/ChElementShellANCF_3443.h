@@ -363,6 +363,23 @@ class ChApi ChElementShellANCF_3443 : public ChElementANCF,
     /// stiffness of each element (if any), the mass, etc.
     virtual void SetupInitial(ChSystem* system) override;
 
+    // Interface to ChElementANCF base class
+    // -------------------------------------
+
+    /// Return true if the internal forces can currently be evaluated in batched mode ("Continuous Integration" style
+    /// method).
+    virtual bool IsBatchSupported() const override;
+
+    /// Return the structural damping coefficient used in the batched evaluation (0 if damping is disabled).
+    virtual double GetBatchDamping() const override;
+
+    /// Get the constant data used for the batched evaluation of the internal forces.
+    virtual void GetBatchData(ChElementANCFBatchData& data) override;
+
+    /// Load the current 3xN matrices of nodal coordinates and, if requested, of their time derivatives, in row-major
+    /// order, in the given arrays.
+    virtual void GetBatchCoordinates(double* ebar, double* ebardot) override;
+
     // Internal computations
     // ---------------------
 
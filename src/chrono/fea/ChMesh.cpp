@@ -18,16 +18,20 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <typeinfo>
+#include <unordered_map>
 
 #include "chrono/core/ChFrame.h"
 #include "chrono/physics/ChLoad.h"
 #include "chrono/physics/ChObject.h"
 #include "chrono/physics/ChSystem.h"
 
+#include "chrono/fea/ChElementANCFBatch.h"
 #include "chrono/fea/ChElementTetraCorot_4.h"
 #include "chrono/fea/ChMesh.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
 #include "chrono/fea/ChNodeFEAxyzrot.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 namespace fea {
@@ -45,6 +49,9 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
     automatic_gravity_load = other.automatic_gravity_load;
     num_points_gravity = other.num_points_gravity;
 
+    num_colored_elements = 0;
+    batched_evaluation = other.batched_evaluation;
+
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
 }
@@ -67,6 +74,84 @@ void ChMesh::SetupInitial() {
         // precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    ComputeElementColoring();
+}
+
+void ChMesh::ComputeElementColoring() {
+    // Node indices (nodes not in this mesh, if any, are also indexed)
+    std::unordered_map<ChNodeFEAbase*, int> node_index;
+    for (unsigned int i = 0; i < vnodes.size(); i++)
+        node_index[vnodes[i].get()] = i;
+
+    // Colors of the elements connected to each node
+    std::vector<std::vector<int>> node_colors(vnodes.size());
+    std::vector<int> nodes;
+    std::vector<bool> used;
+
+    element_colors.clear();
+    for (int ie = 0; ie < velements.size(); ie++) {
+        nodes.clear();
+        for (unsigned int in = 0; in < velements[ie]->GetNumNodes(); in++) {
+            auto res = node_index.insert({velements[ie]->GetNode(in).get(), (int)node_colors.size()});
+            if (res.second)
+                node_colors.push_back({});
+            nodes.push_back(res.first->second);
+        }
+
+        // Assign the first color not used by any element sharing a node with this one
+        used.assign(element_colors.size() + 1, false);
+        for (auto n : nodes)
+            for (auto color : node_colors[n])
+                used[color] = true;
+        int color = 0;
+        while (used[color])
+            color++;
+
+        if (color == element_colors.size())
+            element_colors.push_back({});
+        element_colors[color].push_back(ie);
+        for (auto n : nodes)
+            node_colors[n].push_back(color);
+    }
+
+    num_colored_elements = velements.size();
+
+    ComputeElementBatches();
+}
+
+void ChMesh::ComputeElementBatches() {
+    element_batches.clear();
+    if (velements.empty())
+        return;
+
+    // Batched evaluation is only used for homogeneous meshes of ANCF elements
+    const auto& type = typeid(*velements[0]);
+    if (!dynamic_cast<ChElementANCF*>(velements[0].get()))
+        return;
+    for (const auto& element : velements) {
+        if (typeid(*element) != type)
+            return;
+    }
+
+    // Group consecutive elements of the same color, so that the elements in a batch do not share nodes
+    for (const auto& elements : element_colors) {
+        std::vector<std::shared_ptr<ChElementANCFBatch>> batches;
+        for (size_t i = 0; i < elements.size(); i += ChElementANCFBatch::SIZE) {
+            std::vector<std::shared_ptr<ChElementBase>> batch_elements;
+            for (size_t j = i; j < std::min(i + ChElementANCFBatch::SIZE, elements.size()); j++)
+                batch_elements.push_back(velements[elements[j]]);
+            batches.push_back(chrono_types::make_shared<ChElementANCFBatch>(batch_elements));
+        }
+        element_batches.push_back(batches);
+    }
+}
+
+unsigned int ChMesh::GetNumElementBatches() const {
+    unsigned int num_batches = 0;
+    for (const auto& batches : element_batches)
+        num_batches += (unsigned int)batches.size();
+    return num_batches;
 }
 
 void ChMesh::Relax() {
@@ -107,6 +192,9 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
 void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
+    element_colors.clear();
+    element_batches.clear();
+    num_colored_elements = 0;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -118,6 +206,9 @@ void ChMesh::ClearNodes() {
     velements.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
+    element_colors.clear();
+    element_batches.clear();
+    num_colored_elements = 0;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -141,6 +232,8 @@ void ChMesh::AddMeshSurface(std::shared_ptr<ChMeshSurface> m_surf) {
 
 /// This recomputes the number of DOFs, constraints, as well as state offsets of contained items
 void ChMesh::Setup() {
+    CH_TRACE_ZONE("ChMesh::Setup", "fea");
+
     n_dofs = 0;
     n_dofs_w = 0;
 
@@ -160,6 +253,8 @@ void ChMesh::Setup() {
 // Updates all time-dependant variables, if any...
 // Ex: maybe the elasticity can increase in time, etc.
 void ChMesh::Update(double m_time, bool update_assets) {
+    CH_TRACE_ZONE("ChMesh::Update", "fea");
+
     // Parent class update
     ChIndexedNodes::Update(m_time, update_assets);
 
@@ -279,43 +374,60 @@ void ChMesh::IntStateGetIncrement(const unsigned int off_x,
 }
 
 void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    CH_TRACE_ZONE("ChMesh::IntLoadResidual_F", "fea");
+
+    int nthreads = GetSystem()->nthreads_chrono;
+
     // nodes applied forces
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntLoadResidual_F(off + local_off_v, R, c);
-            local_off_v += vnodes[j]->GetNumCoordsVelLevelActive();
-        }
+    //// PARALLEL FOR, (no need here to use omp atomic to avoid race condition in writing to R)
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int j = 0; j < vnodes.size(); j++) {
+        if (!vnodes[j]->IsFixed())
+            vnodes[j]->NodeIntLoadResidual_F(off + vnodes[j]->NodeGetOffsetVelLevel() - GetOffset_w(), R, c);
     }
 
-    int nthreads = GetSystem()->nthreads_chrono;
+    if (!HasElementColoring())
+        ComputeElementColoring();
 
     // elements internal forces
+    // Elements of the same color do not share nodes, so there is no race condition in writing to R.
     timer_internal_forces.start();
-    //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+    if (batched_evaluation && !element_batches.empty()) {
+        for (const auto& batches : element_batches) {
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+            for (int i = 0; i < batches.size(); i++) {
+                batches[i]->IntLoadResidual_F(R, c);
+            }
+        }
+    } else {
+        for (const auto& elements : element_colors) {
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+            for (int i = 0; i < elements.size(); i++) {
+                velements[elements[i]]->EleIntLoadResidual_F(R, c);
+            }
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+        for (const auto& elements : element_colors) {
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->GetGravitationalAcceleration(), c);
+            for (int i = 0; i < elements.size(); i++) {
+                velements[elements[i]]->EleIntLoadResidual_F_gravity(R, GetSystem()->GetGravitationalAcceleration(),
+                                                                     c);
+            }
         }
     }
 
     // nodes gravity forces
-    local_off_v = 0;
     if (automatic_gravity_load && system) {
-        // #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
         //// PARALLEL FOR, (no need here to use omp atomic to avoid race condition in writing to R)
+#pragma omp parallel for schedule(static) num_threads(nthreads)
         for (int in = 0; in < vnodes.size(); in++) {
             if (!vnodes[in]->IsFixed()) {
+                unsigned int local_off_v = vnodes[in]->NodeGetOffsetVelLevel() - GetOffset_w();
                 if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyz>(vnodes[in])) {
                     ChVector3d fg = c * mnode->GetMass() * system->GetGravitationalAcceleration();
                     R.segment(off + local_off_v, 3) += fg.eigen();
@@ -325,7 +437,6 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
                     ChVector3d fg = c * mnode->GetMass() * system->GetGravitationalAcceleration();
                     R.segment(off + local_off_v, 3) += fg.eigen();
                 }
-                local_off_v += vnodes[in]->GetNumCoordsVelLevelActive();
             }
         }
     }
@@ -406,18 +517,26 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
                                 const ChVectorDynamic<>& w,  ///< the w vector
                                 const double c               ///< a scaling factor
 ) {
+    CH_TRACE_ZONE("ChMesh::IntLoadResidual_Mv", "fea");
+
+    int nthreads = GetSystem()->nthreads_chrono;
+
     // nodal masses
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntLoadResidual_Mv(off + local_off_v, R, w, c);
-            local_off_v += vnodes[j]->GetNumCoordsVelLevelActive();
-        }
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int j = 0; j < vnodes.size(); j++) {
+        if (!vnodes[j]->IsFixed())
+            vnodes[j]->NodeIntLoadResidual_Mv(off + vnodes[j]->NodeGetOffsetVelLevel() - GetOffset_w(), R, w, c);
     }
 
-    // internal masses
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_Mv(R, w, c);
+    if (!HasElementColoring())
+        ComputeElementColoring();
+
+    // internal masses (elements of the same color do not share nodes)
+    for (const auto& elements : element_colors) {
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+        for (int i = 0; i < elements.size(); i++) {
+            velements[elements[i]]->EleIntLoadResidual_Mv(R, w, c);
+        }
     }
 }
 
@@ -473,6 +592,8 @@ void ChMesh::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 }
 
 void ChMesh::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
+    CH_TRACE_ZONE("ChMesh::LoadKRMMatrices", "fea");
+
     int nthreads = GetSystem()->nthreads_chrono;
 
     timer_KRMload.start();
@@ -32,6 +32,8 @@ class ChAssembly;
 
 namespace fea {
 
+class ChElementANCFBatch;
+
 /// @addtogroup chrono_fea
 /// @{
 
@@ -43,6 +45,8 @@ class ChApi ChMesh : public ChIndexedNodes {
           n_dofs_w(0),
           automatic_gravity_load(true),
           num_points_gravity(1),
+          num_colored_elements(0),
+          batched_evaluation(true),
           ncalls_internal_forces(0),
           ncalls_KRMload(0) {}
     ChMesh(const ChMesh& other);
@@ -104,6 +108,21 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Get the number of colors of the element coloring.
+    /// Elements with the same color do not share any node, so that their contributions to the global residual vectors
+    /// are assembled in parallel without synchronization (one color at a time). The coloring is computed at the
+    /// initial setup of the mesh.
+    unsigned int GetNumElementColors() const { return (unsigned int)element_colors.size(); }
+
+    /// Enable/disable the batched evaluation of element internal forces (default: true).
+    /// If enabled and the mesh is homogeneous (all elements of the same type) and made of ANCF elements, the internal
+    /// forces of groups of elements of the same color are evaluated together, vectorized across elements (see
+    /// ChElementANCFBatch). Otherwise, the internal forces are evaluated one element at a time.
+    void EnableBatchedEvaluation(bool val) { batched_evaluation = val; }
+
+    /// Get the number of element batches used for the batched evaluation of internal forces (0 if not used).
+    unsigned int GetNumElementBatches() const;
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
@@ -276,6 +295,15 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Partition the elements in groups (colors) of elements without common nodes (greedy coloring).
+    void ComputeElementColoring();
+
+    /// Group the elements of each color in batches, if the mesh is homogeneous and supports batched evaluation.
+    void ComputeElementBatches();
+
+    /// Return true if the element coloring is consistent with the current list of elements.
+    bool HasElementColoring() const { return num_colored_elements == velements.size(); }
+
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
     std::vector<std::shared_ptr<ChElementBase>> velements;  ///<  elements
 
@@ -288,6 +316,12 @@ class ChApi ChMesh : public ChIndexedNodes {
     bool automatic_gravity_load;
     int num_points_gravity;
 
+    std::vector<std::vector<int>> element_colors;  ///< element indices, grouped by color
+    size_t num_colored_elements;                   ///< number of elements when the coloring was computed
+
+    bool batched_evaluation;  ///< enable batched evaluation of internal forces
+    std::vector<std::vector<std::shared_ptr<ChElementANCFBatch>>> element_batches;  ///< element batches, by color
+
     ChTimer timer_internal_forces;
     ChTimer timer_KRMload;
     unsigned int ncalls_internal_forces;
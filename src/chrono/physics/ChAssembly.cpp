@@ -13,7 +13,9 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <unordered_map>
 
 #include "chrono/core/ChGlobal.h"
 #include "chrono/physics/ChAssembly.h"
@@ -40,7 +42,8 @@ ChAssembly::ChAssembly()
       m_num_coords_vel(0),
       m_num_constr(0),
       m_num_constr_bil(0),
-      m_num_constr_uni(0) {}
+      m_num_constr_uni(0),
+      m_links_colored(false) {}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     m_num_bodies_active = other.m_num_bodies_active;
@@ -57,6 +60,7 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     m_num_constr = other.m_num_constr;
     m_num_constr_bil = other.m_num_constr_bil;
     m_num_constr_uni = other.m_num_constr_uni;
+    m_links_colored = false;
 
     //// RADU
     //// TODO:  deep copy of the object lists (bodylist, shaftlist, linklist, meshlist,  otherphysicslist)
@@ -94,6 +98,9 @@ void swap(ChAssembly& first, ChAssembly& second) {
     swap(first.m_num_constr, second.m_num_constr);
     swap(first.m_num_constr_bil, second.m_num_constr_bil);
     swap(first.m_num_constr_uni, second.m_num_constr_uni);
+    swap(first.m_link_groups, second.m_link_groups);
+    swap(first.m_link_serial, second.m_link_serial);
+    swap(first.m_links_colored, second.m_links_colored);
 
     //// RADU
     //// TODO: deal with all other member variables...
@@ -174,6 +181,7 @@ void ChAssembly::AddLink(std::shared_ptr<ChLinkBase> link) {
 
     link->SetSystem(system);
     linklist.push_back(link);
+    m_links_colored = false;
 
     ////system->is_initialized = false;  // Not needed, unless/until ChLink::SetupInitial does something
     system->is_updated = false;
@@ -185,6 +193,7 @@ void ChAssembly::RemoveLink(std::shared_ptr<ChLinkBase> link) {
 
     linklist.erase(itr);
     link->SetSystem(nullptr);
+    m_links_colored = false;
 
     system->is_updated = false;
 }
@@ -322,6 +331,7 @@ void ChAssembly::RemoveAllLinks() {
         link->SetSystem(nullptr);
     }
     linklist.clear();
+    m_links_colored = false;
 
     if (system)
         system->is_updated = false;
@@ -496,6 +506,94 @@ void ChAssembly::SyncCollisionModels() {
     }
 }
 
+// -----------------------------------------------------------------------------
+// PARALLEL PROCESSING OF BODIES, SHAFTS, AND LINKS
+//
+// Bodies and shafts only access their own entries in the state and residual vectors, so they can be processed
+// concurrently. Links may write into the residual entries of the bodies they connect; they are therefore processed
+// in groups (colors) such that no two links in the same group act on the same body. Meshes and other physics items
+// are processed serially (meshes handle their own parallelism internally).
+
+// Minimum number of items in a list for which multithreading is used.
+static const int MIN_PARALLEL_ITEMS = 64;
+
+template <class T, class Op>
+void ChAssembly::ApplyToItems(const std::vector<std::shared_ptr<T>>& list, Op op, bool parallel) {
+    int nthreads = system ? system->GetNumThreadsChrono() : 1;
+    int n = (int)list.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (parallel && nthreads > 1 && n >= MIN_PARALLEL_ITEMS)
+    for (int i = 0; i < n; i++) {
+        op(list[i]);
+    }
+}
+
+template <class Op>
+void ChAssembly::ApplyToLinks(Op op, bool parallel) {
+    int nthreads = system ? system->GetNumThreadsChrono() : 1;
+
+    if (!parallel || nthreads <= 1 || !m_links_colored || (int)linklist.size() < MIN_PARALLEL_ITEMS) {
+        for (auto& link : linklist)
+            op(link.get());
+        return;
+    }
+
+    for (const auto& group : m_link_groups) {
+        int n = (int)group.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (n >= MIN_PARALLEL_ITEMS)
+        for (int i = 0; i < n; i++) {
+            op(group[i]);
+        }
+    }
+    for (auto link : m_link_serial)
+        op(link);
+}
+
+void ChAssembly::ColorLinks() {
+    m_link_groups.clear();
+    m_link_serial.clear();
+
+    // Bit mask of the colors already used by the links acting on each body.
+    // Fixed bodies are not considered, as links do not write into their (non-existent) state entries.
+    std::unordered_map<const ChBodyFrame*, uint64_t> body_colors;
+
+    for (auto& linkptr : linklist) {
+        auto link = dynamic_cast<ChLink*>(linkptr.get());
+        if (!link) {
+            m_link_serial.push_back(linkptr.get());
+            continue;
+        }
+
+        ChBodyFrame* bodies[2] = {link->GetBody1(), link->GetBody2()};
+        uint64_t used = 0;
+        for (auto b : bodies) {
+            auto body = dynamic_cast<ChBody*>(b);
+            if (b && !(body && body->IsFixed()))
+                used |= body_colors[b];
+        }
+
+        if (~used == 0) {
+            m_link_serial.push_back(linkptr.get());
+            continue;
+        }
+
+        unsigned int color = 0;
+        while (used & (uint64_t(1) << color))
+            color++;
+        for (auto b : bodies) {
+            auto body = dynamic_cast<ChBody*>(b);
+            if (b && !(body && body->IsFixed()))
+                body_colors[b] |= uint64_t(1) << color;
+        }
+
+        if (color >= m_link_groups.size())
+            m_link_groups.resize(color + 1);
+        m_link_groups[color].push_back(linkptr.get());
+    }
+
+    m_links_colored = true;
+}
+
 // -----------------------------------------------------------------------------
 // UPDATING ROUTINES
 
@@ -635,6 +733,10 @@ void ChAssembly::Setup() {
             m_num_constr_uni += item->GetNumConstraintsUnilateral();
         }
     }
+
+    // Regroup the links at each setup, since bodies may have been fixed or released.
+    if (system && system->GetNumThreadsChrono() > 1)
+        ColorLinks();
 }
 
 // Update assembly's own properties first (ChTime and assets, if any).
@@ -648,13 +750,12 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
-    for (auto& body : bodylist) {
-        body->Update(ChTime, update_assets);
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->Update(ChTime, update_assets);
-    }
+    // Asset updates are not thread-safe (visual shapes may be shared), so process all items in order in that case.
+    ApplyToItems(
+        bodylist, [&](const std::shared_ptr<ChBody>& body) { body->Update(ChTime, update_assets); }, !update_assets);
+    ApplyToItems(
+        shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) { shaft->Update(ChTime, update_assets); },
+        !update_assets);
     for (auto& mesh : meshlist) {
         mesh->Update(ChTime, update_assets);
     }
@@ -663,9 +764,7 @@ void ChAssembly::Update(bool update_assets) {
     }
     // The state of links depends on the bodylist,shaftlist,meshlist,otherphysicslist,
     // thus the update of linklist must be at the end.
-    for (auto& link : linklist) {
-        link->Update(ChTime, update_assets);
-    }
+    ApplyToLinks([&](ChLinkBase* link) { link->Update(ChTime, update_assets); }, !update_assets);
 }
 
 void ChAssembly::ForceToRest() {
@@ -694,18 +793,18 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T);
-    }
-    for (auto& link : linklist) {
+    });
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntStateGather(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T);
     }
@@ -733,19 +832,26 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
-        if (body->IsActive())
-            body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
-        else
-            body->Update(T, full_update);
-    }
-    for (auto& shaft : shaftlist) {
-        if (shaft->IsActive())
-            shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T,
-                                   full_update);
-        else
-            shaft->Update(T, full_update);
-    }
+    ApplyToItems(
+        bodylist,
+        [&](const std::shared_ptr<ChBody>& body) {
+            if (body->IsActive())
+                body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T,
+                                      full_update);
+            else
+                body->Update(T, full_update);
+        },
+        !full_update);
+    ApplyToItems(
+        shaftlist,
+        [&](const std::shared_ptr<ChShaft>& shaft) {
+            if (shaft->IsActive())
+                shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T,
+                                       full_update);
+            else
+                shaft->Update(T, full_update);
+        },
+        !full_update);
     for (auto& mesh : meshlist) {
         mesh->IntStateScatter(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T, full_update);
     }
@@ -759,12 +865,15 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     // must be behind of bodylist,shaftlist,meshlist,otherphysicslist; otherwise, the Update() of ChLink() would
     // use the old (un-updated) status of bodylist,shaftlist,meshlist, resulting in a delay of Update() of ChLink()
     // for one time step, then the simulation might diverge!
-    for (auto& link : linklist) {
-        if (link->IsActive())
-            link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
-        else
-            link->Update(T, full_update);
-    }
+    ApplyToLinks(
+        [&](ChLinkBase* link) {
+            if (link->IsActive())
+                link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T,
+                                      full_update);
+            else
+                link->Update(T, full_update);
+        },
+        !full_update);
 
     SetChTime(T);
 }
@@ -772,18 +881,18 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
 void ChAssembly::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
     unsigned int displ_a = off_a - this->offset_w;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntStateGatherAcceleration(displ_a + body->GetOffset_w(), a);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntStateGatherAcceleration(displ_a + shaft->GetOffset_w(), a);
-    }
-    for (auto& link : linklist) {
+    });
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntStateGatherAcceleration(displ_a + link->GetOffset_w(), a);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntStateGatherAcceleration(displ_a + mesh->GetOffset_w(), a);
     }
@@ -797,14 +906,14 @@ void ChAssembly::IntStateGatherAcceleration(const unsigned int off_a, ChStateDel
 void ChAssembly::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
     unsigned int displ_a = off_a - this->offset_w;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntStateScatterAcceleration(displ_a + body->GetOffset_w(), a);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntStateScatterAcceleration(displ_a + shaft->GetOffset_w(), a);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntStateScatterAcceleration(displ_a + mesh->GetOffset_w(), a);
     }
@@ -812,28 +921,28 @@ void ChAssembly::IntStateScatterAcceleration(const unsigned int off_a, const ChS
         if (item->IsActive())
             item->IntStateScatterAcceleration(displ_a + item->GetOffset_w(), a);
     }
-    for (auto& link : linklist) {
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntStateScatterAcceleration(displ_a + link->GetOffset_w(), a);
-    }
+    });
 }
 
 // From system to reaction forces (last computed) - some timestepper might need this
 void ChAssembly::IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) {
     unsigned int displ_L = off_L - this->offset_L;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntStateGatherReactions(displ_L + body->GetOffset_L(), L);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntStateGatherReactions(displ_L + shaft->GetOffset_L(), L);
-    }
-    for (auto& link : linklist) {
+    });
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntStateGatherReactions(displ_L + link->GetOffset_L(), L);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntStateGatherReactions(displ_L + mesh->GetOffset_L(), L);
     }
@@ -847,14 +956,14 @@ void ChAssembly::IntStateGatherReactions(const unsigned int off_L, ChVectorDynam
 void ChAssembly::IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) {
     unsigned int displ_L = off_L - this->offset_L;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntStateScatterReactions(displ_L + body->GetOffset_L(), L);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntStateScatterReactions(displ_L + shaft->GetOffset_L(), L);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntStateScatterReactions(displ_L + mesh->GetOffset_L(), L);
     }
@@ -863,10 +972,10 @@ void ChAssembly::IntStateScatterReactions(const unsigned int off_L, const ChVect
             item->IntStateScatterReactions(displ_L + item->GetOffset_L(), L);
     }
     // The state scatter of reactions of link depends on Body1 and Body2, thus it must be at the end.
-    for (auto& link : linklist) {
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntStateScatterReactions(displ_L + link->GetOffset_L(), L);
-    }
+    });
 }
 
 void ChAssembly::IntStateIncrement(const unsigned int off_x,
@@ -877,20 +986,20 @@ void ChAssembly::IntStateIncrement(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntStateIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
-    }
+    });
 
-    for (auto& shaft : shaftlist) {
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntStateIncrement(displ_x + shaft->GetOffset_x(), x_new, x, displ_v + shaft->GetOffset_w(), Dv);
-    }
+    });
 
-    for (auto& link : linklist) {
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntStateIncrement(displ_x + link->GetOffset_x(), x_new, x, displ_v + link->GetOffset_w(), Dv);
-    }
+    });
 
     for (auto& mesh : meshlist) {
         mesh->IntStateIncrement(displ_x + mesh->GetOffset_x(), x_new, x, displ_v + mesh->GetOffset_w(), Dv);
@@ -910,20 +1019,20 @@ void ChAssembly::IntStateGetIncrement(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntStateGetIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
-    }
+    });
 
-    for (auto& shaft : shaftlist) {
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntStateGetIncrement(displ_x + shaft->GetOffset_x(), x_new, x, displ_v + shaft->GetOffset_w(), Dv);
-    }
+    });
 
-    for (auto& link : linklist) {
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntStateGetIncrement(displ_x + link->GetOffset_x(), x_new, x, displ_v + link->GetOffset_w(), Dv);
-    }
+    });
 
     for (auto& mesh : meshlist) {
         mesh->IntStateGetIncrement(displ_x + mesh->GetOffset_x(), x_new, x, displ_v + mesh->GetOffset_w(), Dv);
@@ -941,18 +1050,18 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
 {
     unsigned int displ_v = off - this->offset_w;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
-    }
-    for (auto& link : linklist) {
+    });
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntLoadResidual_F(displ_v + mesh->GetOffset_w(), R, c);
     }
@@ -969,18 +1078,18 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
 ) {
     unsigned int displ_v = off - this->offset_w;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntLoadResidual_Mv(displ_v + body->GetOffset_w(), R, w, c);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntLoadResidual_Mv(displ_v + shaft->GetOffset_w(), R, w, c);
-    }
-    for (auto& link : linklist) {
+    });
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntLoadResidual_Mv(displ_v + link->GetOffset_w(), R, w, c);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntLoadResidual_Mv(displ_v + mesh->GetOffset_w(), R, w, c);
     }
@@ -1021,18 +1130,18 @@ void ChAssembly::IntLoadResidual_CqL(const unsigned int off_L,    ///< offset in
 ) {
     unsigned int displ_L = off_L - this->offset_L;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntLoadResidual_CqL(displ_L + body->GetOffset_L(), R, L, c);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntLoadResidual_CqL(displ_L + shaft->GetOffset_L(), R, L, c);
-    }
-    for (auto& link : linklist) {
+    });
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntLoadResidual_CqL(displ_L + link->GetOffset_L(), R, L, c);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntLoadResidual_CqL(displ_L + mesh->GetOffset_L(), R, L, c);
     }
@@ -1050,18 +1159,18 @@ void ChAssembly::IntLoadConstraint_C(const unsigned int off_L,  ///< offset in Q
 ) {
     unsigned int displ_L = off_L - this->offset_L;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntLoadConstraint_C(displ_L + body->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntLoadConstraint_C(displ_L + shaft->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
-    }
-    for (auto& link : linklist) {
+    });
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntLoadConstraint_C(displ_L + link->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntLoadConstraint_C(displ_L + mesh->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
@@ -1077,18 +1186,18 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
 ) {
     unsigned int displ_L = off_L - this->offset_L;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntLoadConstraint_Ct(displ_L + body->GetOffset_L(), Qc, c);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntLoadConstraint_Ct(displ_L + shaft->GetOffset_L(), Qc, c);
-    }
-    for (auto& link : linklist) {
+    });
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntLoadConstraint_Ct(displ_L + link->GetOffset_L(), Qc, c);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntLoadConstraint_Ct(displ_L + mesh->GetOffset_L(), Qc, c);
     }
@@ -1107,20 +1216,20 @@ void ChAssembly::IntToDescriptor(const unsigned int off_v,
     unsigned int displ_L = off_L - this->offset_L;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntToDescriptor(displ_v + body->GetOffset_w(), v, R, displ_L + body->GetOffset_L(), L, Qc);
-    }
+    });
 
-    for (auto& shaft : shaftlist) {
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntToDescriptor(displ_v + shaft->GetOffset_w(), v, R, displ_L + shaft->GetOffset_L(), L, Qc);
-    }
+    });
 
-    for (auto& link : linklist) {
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntToDescriptor(displ_v + link->GetOffset_w(), v, R, displ_L + link->GetOffset_L(), L, Qc);
-    }
+    });
 
     for (auto& mesh : meshlist) {
         mesh->IntToDescriptor(displ_v + mesh->GetOffset_w(), v, R, displ_L + mesh->GetOffset_L(), L, Qc);
@@ -1139,20 +1248,20 @@ void ChAssembly::IntFromDescriptor(const unsigned int off_v,
     unsigned int displ_L = off_L - this->offset_L;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         if (body->IsActive())
             body->IntFromDescriptor(displ_v + body->GetOffset_w(), v, displ_L + body->GetOffset_L(), L);
-    }
+    });
 
-    for (auto& shaft : shaftlist) {
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         if (shaft->IsActive())
             shaft->IntFromDescriptor(displ_v + shaft->GetOffset_w(), v, displ_L + shaft->GetOffset_L(), L);
-    }
+    });
 
-    for (auto& link : linklist) {
+    ApplyToLinks([&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntFromDescriptor(displ_v + link->GetOffset_w(), v, displ_L + link->GetOffset_L(), L);
-    }
+    });
 
     for (auto& mesh : meshlist) {
         mesh->IntFromDescriptor(displ_v + mesh->GetOffset_w(), v, displ_L + mesh->GetOffset_L(), L);
@@ -1185,15 +1294,9 @@ void ChAssembly::InjectVariables(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::VariablesFbReset() {
-    for (auto& body : bodylist) {
-        body->VariablesFbReset();
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->VariablesFbReset();
-    }
-    for (auto& link : linklist) {
-        link->VariablesFbReset();
-    }
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) { body->VariablesFbReset(); });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) { shaft->VariablesFbReset(); });
+    ApplyToLinks([&](ChLinkBase* link) { link->VariablesFbReset(); });
     for (auto& mesh : meshlist) {
         mesh->VariablesFbReset();
     }
@@ -1203,15 +1306,9 @@ void ChAssembly::VariablesFbReset() {
 }
 
 void ChAssembly::VariablesFbLoadForces(double factor) {
-    for (auto& body : bodylist) {
-        body->VariablesFbLoadForces(factor);
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->VariablesFbLoadForces(factor);
-    }
-    for (auto& link : linklist) {
-        link->VariablesFbLoadForces(factor);
-    }
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) { body->VariablesFbLoadForces(factor); });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) { shaft->VariablesFbLoadForces(factor); });
+    ApplyToLinks([&](ChLinkBase* link) { link->VariablesFbLoadForces(factor); });
     for (auto& mesh : meshlist) {
         mesh->VariablesFbLoadForces(factor);
     }
@@ -1221,15 +1318,9 @@ void ChAssembly::VariablesFbLoadForces(double factor) {
 }
 
 void ChAssembly::VariablesFbIncrementMq() {
-    for (auto& body : bodylist) {
-        body->VariablesFbIncrementMq();
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->VariablesFbIncrementMq();
-    }
-    for (auto& link : linklist) {
-        link->VariablesFbIncrementMq();
-    }
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) { body->VariablesFbIncrementMq(); });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) { shaft->VariablesFbIncrementMq(); });
+    ApplyToLinks([&](ChLinkBase* link) { link->VariablesFbIncrementMq(); });
     for (auto& mesh : meshlist) {
         mesh->VariablesFbIncrementMq();
     }
@@ -1239,15 +1330,9 @@ void ChAssembly::VariablesFbIncrementMq() {
 }
 
 void ChAssembly::VariablesQbLoadSpeed() {
-    for (auto& body : bodylist) {
-        body->VariablesQbLoadSpeed();
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->VariablesQbLoadSpeed();
-    }
-    for (auto& link : linklist) {
-        link->VariablesQbLoadSpeed();
-    }
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) { body->VariablesQbLoadSpeed(); });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) { shaft->VariablesQbLoadSpeed(); });
+    ApplyToLinks([&](ChLinkBase* link) { link->VariablesQbLoadSpeed(); });
     for (auto& mesh : meshlist) {
         mesh->VariablesQbLoadSpeed();
     }
@@ -1257,15 +1342,9 @@ void ChAssembly::VariablesQbLoadSpeed() {
 }
 
 void ChAssembly::VariablesQbSetSpeed(double step) {
-    for (auto& body : bodylist) {
-        body->VariablesQbSetSpeed(step);
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->VariablesQbSetSpeed(step);
-    }
-    for (auto& link : linklist) {
-        link->VariablesQbSetSpeed(step);
-    }
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) { body->VariablesQbSetSpeed(step); });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) { shaft->VariablesQbSetSpeed(step); });
+    ApplyToLinks([&](ChLinkBase* link) { link->VariablesQbSetSpeed(step); });
     for (auto& mesh : meshlist) {
         mesh->VariablesQbSetSpeed(step);
     }
@@ -1275,15 +1354,11 @@ void ChAssembly::VariablesQbSetSpeed(double step) {
 }
 
 void ChAssembly::VariablesQbIncrementPosition(double dt_step) {
-    for (auto& body : bodylist) {
-        body->VariablesQbIncrementPosition(dt_step);
-    }
-    for (auto& shaft : shaftlist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) { body->VariablesQbIncrementPosition(dt_step); });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         shaft->VariablesQbIncrementPosition(dt_step);
-    }
-    for (auto& link : linklist) {
-        link->VariablesQbIncrementPosition(dt_step);
-    }
+    });
+    ApplyToLinks([&](ChLinkBase* link) { link->VariablesQbIncrementPosition(dt_step); });
     for (auto& mesh : meshlist) {
         mesh->VariablesQbIncrementPosition(dt_step);
     }
@@ -1311,15 +1386,9 @@ void ChAssembly::InjectConstraints(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::ConstraintsBiReset() {
-    for (auto& body : bodylist) {
-        body->ConstraintsBiReset();
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->ConstraintsBiReset();
-    }
-    for (auto& link : linklist) {
-        link->ConstraintsBiReset();
-    }
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) { body->ConstraintsBiReset(); });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) { shaft->ConstraintsBiReset(); });
+    ApplyToLinks([&](ChLinkBase* link) { link->ConstraintsBiReset(); });
     for (auto& mesh : meshlist) {
         mesh->ConstraintsBiReset();
     }
@@ -1329,15 +1398,13 @@ void ChAssembly::ConstraintsBiReset() {
 }
 
 void ChAssembly::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool do_clamp) {
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         body->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         shaft->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
-    }
-    for (auto& link : linklist) {
-        link->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
-    }
+    });
+    ApplyToLinks([&](ChLinkBase* link) { link->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp); });
     for (auto& mesh : meshlist) {
         mesh->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
     }
@@ -1347,15 +1414,9 @@ void ChAssembly::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool
 }
 
 void ChAssembly::ConstraintsBiLoad_Ct(double factor) {
-    for (auto& body : bodylist) {
-        body->ConstraintsBiLoad_Ct(factor);
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->ConstraintsBiLoad_Ct(factor);
-    }
-    for (auto& link : linklist) {
-        link->ConstraintsBiLoad_Ct(factor);
-    }
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) { body->ConstraintsBiLoad_Ct(factor); });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) { shaft->ConstraintsBiLoad_Ct(factor); });
+    ApplyToLinks([&](ChLinkBase* link) { link->ConstraintsBiLoad_Ct(factor); });
     for (auto& mesh : meshlist) {
         mesh->ConstraintsBiLoad_Ct(factor);
     }
@@ -1365,15 +1426,9 @@ void ChAssembly::ConstraintsBiLoad_Ct(double factor) {
 }
 
 void ChAssembly::ConstraintsBiLoad_Qc(double factor) {
-    for (auto& body : bodylist) {
-        body->ConstraintsBiLoad_Qc(factor);
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->ConstraintsBiLoad_Qc(factor);
-    }
-    for (auto& link : linklist) {
-        link->ConstraintsBiLoad_Qc(factor);
-    }
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) { body->ConstraintsBiLoad_Qc(factor); });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) { shaft->ConstraintsBiLoad_Qc(factor); });
+    ApplyToLinks([&](ChLinkBase* link) { link->ConstraintsBiLoad_Qc(factor); });
     for (auto& mesh : meshlist) {
         mesh->ConstraintsBiLoad_Qc(factor);
     }
@@ -1383,15 +1438,9 @@ void ChAssembly::ConstraintsBiLoad_Qc(double factor) {
 }
 
 void ChAssembly::ConstraintsFbLoadForces(double factor) {
-    for (auto& body : bodylist) {
-        body->ConstraintsFbLoadForces(factor);
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->ConstraintsFbLoadForces(factor);
-    }
-    for (auto& link : linklist) {
-        link->ConstraintsFbLoadForces(factor);
-    }
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) { body->ConstraintsFbLoadForces(factor); });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) { shaft->ConstraintsFbLoadForces(factor); });
+    ApplyToLinks([&](ChLinkBase* link) { link->ConstraintsFbLoadForces(factor); });
     for (auto& mesh : meshlist) {
         mesh->ConstraintsFbLoadForces(factor);
     }
@@ -1401,15 +1450,9 @@ void ChAssembly::ConstraintsFbLoadForces(double factor) {
 }
 
 void ChAssembly::LoadConstraintJacobians() {
-    for (auto& body : bodylist) {
-        body->LoadConstraintJacobians();
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->LoadConstraintJacobians();
-    }
-    for (auto& link : linklist) {
-        link->LoadConstraintJacobians();
-    }
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) { body->LoadConstraintJacobians(); });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) { shaft->LoadConstraintJacobians(); });
+    ApplyToLinks([&](ChLinkBase* link) { link->LoadConstraintJacobians(); });
     for (auto& mesh : meshlist) {
         mesh->LoadConstraintJacobians();
     }
@@ -1419,15 +1462,9 @@ void ChAssembly::LoadConstraintJacobians() {
 }
 
 void ChAssembly::ConstraintsFetch_react(double factor) {
-    for (auto& body : bodylist) {
-        body->ConstraintsFetch_react(factor);
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->ConstraintsFetch_react(factor);
-    }
-    for (auto& link : linklist) {
-        link->ConstraintsFetch_react(factor);
-    }
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) { body->ConstraintsFetch_react(factor); });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) { shaft->ConstraintsFetch_react(factor); });
+    ApplyToLinks([&](ChLinkBase* link) { link->ConstraintsFetch_react(factor); });
     for (auto& mesh : meshlist) {
         mesh->ConstraintsFetch_react(factor);
     }
@@ -1455,15 +1492,13 @@ void ChAssembly::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    for (auto& body : bodylist) {
+    ApplyToItems(bodylist, [&](const std::shared_ptr<ChBody>& body) {
         body->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ApplyToItems(shaftlist, [&](const std::shared_ptr<ChShaft>& shaft) {
         shaft->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
-    }
-    for (auto& link : linklist) {
-        link->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
-    }
+    });
+    ApplyToLinks([&](ChLinkBase* link) { link->LoadKRMMatrices(Kfactor, Rfactor, Mfactor); });
     for (auto& mesh : meshlist) {
         mesh->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
@@ -16,6 +16,8 @@
 #define CHASSEMBLY_H
 
 #include <cmath>
+#include <vector>
+
 #include "chrono/fea/ChMesh.h"
 #include "chrono/physics/ChBodyAuxRef.h"
 #include "chrono/physics/ChShaft.h"
@@ -323,6 +325,21 @@ class ChApi ChAssembly : public ChPhysicsItem {
   protected:
     virtual void SetupInitial() override;
 
+    /// Partition the list of links into groups such that no two links in the same group act on the same body.
+    /// Links in a group can then be processed concurrently. Links that cannot be assigned to a group are processed
+    /// serially, after all groups.
+    void ColorLinks();
+
+    /// Apply the given operation to all items in the list, using the number of threads set in the containing system.
+    /// If parallel=false, process all items in order.
+    template <class T, class Op>
+    void ApplyToItems(const std::vector<std::shared_ptr<T>>& list, Op op, bool parallel = true);
+
+    /// Apply the given operation to all links, processing the link groups in sequence and the links of each group
+    /// concurrently. If parallel=false, or if the links were not yet colored, process all links in order.
+    template <class Op>
+    void ApplyToLinks(Op op, bool parallel = true);
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChShaft>> shaftlist;               ///< list of 1-D shafts
     std::vector<std::shared_ptr<ChLinkBase>> linklist;             ///< list of joints (links)
@@ -330,6 +347,10 @@ class ChApi ChAssembly : public ChPhysicsItem {
     std::vector<std::shared_ptr<ChPhysicsItem>> otherphysicslist;  ///< list of other physics objects
     std::vector<std::shared_ptr<ChPhysicsItem>> batch_to_insert;   ///< list of items to insert at once
 
+    std::vector<std::vector<ChLinkBase*>> m_link_groups;  ///< links that do not share bodies, grouped by color
+    std::vector<ChLinkBase*> m_link_serial;               ///< links processed serially, after all groups
+    bool m_links_colored;                                 ///< true if the link groups are up to date
+
     // Statistics:
     unsigned int m_num_bodies_active;             ///< number of active bodies
     unsigned int m_num_bodies_sleep;              ///< number of sleeping bodies
@@ -12,15 +12,23 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
 #include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChContactContainerNSC)
 
+// Minimum number of contacts of a given type for which multithreading is used.
+static const int MIN_PARALLEL_CONTACTS = 256;
+
 ChContactContainerNSC::ChContactContainerNSC()
     : n_added_6_6(0),
       n_added_6_3(0),
@@ -32,7 +40,11 @@ ChContactContainerNSC::ChContactContainerNSC()
       n_added_666_6(0),
       n_added_666_333(0),
       n_added_666_666(0),
-      n_added_6_6_rolling(0) {}
+      n_added_6_6_rolling(0),
+      m_cache_enabled(false),
+      m_cache_tol(0.01),
+      m_cache_current(0),
+      m_cache_hits(0) {}
 
 ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other) : ChContactContainer(other) {
     n_added_6_6 = 0;
@@ -46,6 +58,11 @@ ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other)
     n_added_666_333 = 0;
     n_added_666_666 = 0;
     n_added_6_6_rolling = 0;
+
+    m_cache_enabled = other.m_cache_enabled;
+    m_cache_tol = other.m_cache_tol;
+    m_cache_current = 0;
+    m_cache_hits = 0;
 }
 
 ChContactContainerNSC::~ChContactContainerNSC() {
@@ -57,120 +74,101 @@ void ChContactContainerNSC::Update(double mytime, bool update_assets) {
     ChContactContainer::Update(mytime, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
+template <class Tcont>
+void _RemoveAllContacts(ChContactPool<Tcont>& contactlist, int& n_added) {
+    contactlist.Clear();
     n_added = 0;
 }
 
 void ChContactContainerNSC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
-    _RemoveAllContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
+    _RemoveAllContacts(contactlist_6_6, n_added_6_6);
+    _RemoveAllContacts(contactlist_6_3, n_added_6_3);
+    _RemoveAllContacts(contactlist_3_3, n_added_3_3);
+    _RemoveAllContacts(contactlist_333_3, n_added_333_3);
+    _RemoveAllContacts(contactlist_333_6, n_added_333_6);
+    _RemoveAllContacts(contactlist_333_333, n_added_333_333);
+    _RemoveAllContacts(contactlist_666_3, n_added_666_3);
+    _RemoveAllContacts(contactlist_666_6, n_added_666_6);
+    _RemoveAllContacts(contactlist_666_333, n_added_666_333);
+    _RemoveAllContacts(contactlist_666_666, n_added_666_666);
+    _RemoveAllContacts(contactlist_6_6_rolling, n_added_6_6_rolling);
+
+    for (auto& cache : m_cache) {
+        cache.entries.clear();
+        cache.pairs.clear();
+    }
+    m_cache_hits = 0;
 }
 
 void ChContactContainerNSC::BeginAddContact() {
-    lastcontact_6_6 = contactlist_6_6.begin();
+    contactlist_6_6.Rewind();
     n_added_6_6 = 0;
 
-    lastcontact_6_3 = contactlist_6_3.begin();
+    contactlist_6_3.Rewind();
     n_added_6_3 = 0;
 
-    lastcontact_3_3 = contactlist_3_3.begin();
+    contactlist_3_3.Rewind();
     n_added_3_3 = 0;
 
-    lastcontact_333_3 = contactlist_333_3.begin();
+    contactlist_333_3.Rewind();
     n_added_333_3 = 0;
 
-    lastcontact_333_6 = contactlist_333_6.begin();
+    contactlist_333_6.Rewind();
     n_added_333_6 = 0;
 
-    lastcontact_333_333 = contactlist_333_333.begin();
+    contactlist_333_333.Rewind();
     n_added_333_333 = 0;
 
-    lastcontact_666_3 = contactlist_666_3.begin();
+    contactlist_666_3.Rewind();
     n_added_666_3 = 0;
 
-    lastcontact_666_6 = contactlist_666_6.begin();
+    contactlist_666_6.Rewind();
     n_added_666_6 = 0;
 
-    lastcontact_666_333 = contactlist_666_333.begin();
+    contactlist_666_333.Rewind();
     n_added_666_333 = 0;
 
-    lastcontact_666_666 = contactlist_666_666.begin();
+    contactlist_666_666.Rewind();
     n_added_666_666 = 0;
 
-    lastcontact_6_6_rolling = contactlist_6_6_rolling.begin();
+    contactlist_6_6_rolling.Rewind();
     n_added_6_6_rolling = 0;
+
+    // The reaction cache of the current step becomes the cache of the previous step. The cache of the step before
+    // is no longer referenced by any contact and can be reused.
+    if (m_cache_enabled) {
+        m_cache_current = 1 - m_cache_current;
+        m_cache[m_cache_current].entries.clear();
+        m_cache[m_cache_current].pairs.clear();
+    } else {
+        for (auto& cache : m_cache) {
+            cache.entries.clear();
+            cache.pairs.clear();
+        }
+    }
+    m_cache_hits = 0;
 }
 
 void ChContactContainerNSC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
-    }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
-    }
+    CH_TRACE_ZONE("ChContactContainerNSC::EndAddContact", "contact");
 
-    while (lastcontact_6_6_rolling != contactlist_6_6_rolling.end()) {
-        delete (*lastcontact_6_6_rolling);
-        lastcontact_6_6_rolling = contactlist_6_6_rolling.erase(lastcontact_6_6_rolling);
-    }
+    // release contact objects that were not reused (if too many)
+    contactlist_6_6.Trim();
+    contactlist_6_3.Trim();
+    contactlist_3_3.Trim();
+    contactlist_333_3.Trim();
+    contactlist_333_6.Trim();
+    contactlist_333_333.Trim();
+    contactlist_666_3.Trim();
+    contactlist_666_6.Trim();
+    contactlist_666_333.Trim();
+    contactlist_666_666.Trim();
+
+    contactlist_6_6_rolling.Trim();
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact list
-                           Titer& lastcontact,                        // last contact acquired
+template <class Tcont, class Ta, class Tb>
+void _OptimalContactInsert(ChContactPool<Tcont>& contactlist,         // contact pool
                            int& n_added,                              // number of contacts inserted
                            ChContactContainerNSC* container,          // contact container
                            Ta* objA,                                  // collidable object A
@@ -178,15 +176,12 @@ void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact
                            const ChCollisionInfo& cinfo,              // collision information
                            const ChContactMaterialCompositeNSC& cmat  // composite material
 ) {
-    if (lastcontact != contactlist.end()) {
+    if (Tcont* mc = contactlist.Reuse()) {
         // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
-        lastcontact++;
+        mc->Reset(objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
     } else {
         // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
+        contactlist.Emplace(container, objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
     }
     n_added++;
 }
@@ -247,7 +242,105 @@ void ChContactContainerNSC::AddContact(const ChCollisionInfo& cinfo) {
     InsertContact(cinfo, cmat);
 }
 
+size_t ChContactContainerNSC::ReactionCacheKeyHash::operator()(const ReactionCacheKey& key) const {
+    std::hash<const void*> hasher;
+    size_t seed = hasher(key.modelA);
+    for (auto ptr : {key.modelB, key.shapeA, key.shapeB})
+        seed ^= hasher(ptr) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+float* ChContactContainerNSC::CacheReactions(const ChCollisionInfo& cinfo) {
+    auto& current = m_cache[m_cache_current];
+    auto& previous = m_cache[1 - m_cache_current];
+
+    ReactionCacheKey key{cinfo.modelA, cinfo.modelB, cinfo.shapeA, cinfo.shapeB};
+    auto frame = cinfo.modelA->GetContactable()->GetCollisionModelFrame();
+
+    // Create the cache entry for the new contact (with zero reactions)
+    current.entries.push_back(ReactionCacheEntry());
+    auto& entry = current.entries.back();
+    entry.point = frame.TransformPointParentToLocal(cinfo.vpA);
+    std::fill(std::begin(entry.reactions), std::end(entry.reactions), 0.0f);
+    entry.matched = false;
+    current.pairs[key].push_back(current.entries.size() - 1);
+
+    // Find the closest contact point between the same shapes at the previous step, not yet matched
+    auto pair = previous.pairs.find(key);
+    if (pair == previous.pairs.end())
+        return entry.reactions;
+
+    ReactionCacheEntry* match = nullptr;
+    double min_dist2 = m_cache_tol * m_cache_tol;
+    for (auto i : pair->second) {
+        auto& candidate = previous.entries[i];
+        if (candidate.matched)
+            continue;
+        double dist2 = (candidate.point - entry.point).Length2();
+        if (dist2 <= min_dist2) {
+            match = &candidate;
+            min_dist2 = dist2;
+        }
+    }
+
+    if (match) {
+        match->matched = true;
+        std::copy(std::begin(match->reactions), std::end(match->reactions), std::begin(entry.reactions));
+        m_cache_hits++;
+    }
+
+    return entry.reactions;
+}
+
+std::vector<ChContactContainerNSC::CachedReactions> ChContactContainerNSC::GetReactionCache() const {
+    const auto& current = m_cache[m_cache_current];
+
+    std::vector<CachedReactions> cache;
+    cache.reserve(current.entries.size());
+    for (const auto& pair : current.pairs) {
+        for (auto i : pair.second) {
+            const auto& entry = current.entries[i];
+            CachedReactions cr;
+            cr.modelA = static_cast<const ChCollisionModel*>(pair.first.modelA);
+            cr.modelB = static_cast<const ChCollisionModel*>(pair.first.modelB);
+            cr.shapeA = static_cast<const ChCollisionShape*>(pair.first.shapeA);
+            cr.shapeB = static_cast<const ChCollisionShape*>(pair.first.shapeB);
+            cr.point = entry.point;
+            std::copy(std::begin(entry.reactions), std::end(entry.reactions), std::begin(cr.reactions));
+            cache.push_back(cr);
+        }
+    }
+
+    return cache;
+}
+
+void ChContactContainerNSC::SetReactionCache(const std::vector<CachedReactions>& cache) {
+    // Remove all contacts (and their references to cache entries) and clear both caches
+    RemoveAllContacts();
+
+    // Load the given reactions in the cache of the current step. This becomes the cache of the previous step at the
+    // next collision detection pass.
+    auto& current = m_cache[m_cache_current];
+    for (const auto& cr : cache) {
+        ReactionCacheKey key{cr.modelA, cr.modelB, cr.shapeA, cr.shapeB};
+        current.entries.push_back(ReactionCacheEntry());
+        auto& entry = current.entries.back();
+        entry.point = cr.point;
+        std::copy(std::begin(cr.reactions), std::end(cr.reactions), std::begin(entry.reactions));
+        entry.matched = false;
+        current.pairs[key].push_back(current.entries.size() - 1);
+    }
+}
+
 void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat) {
+    // Attach a persistent reaction cache, unless one is already provided by the collision system
+    if (m_cache_enabled && !cinfo.reaction_cache) {
+        ChCollisionInfo cinfo_cached(cinfo);
+        cinfo_cached.reaction_cache = CacheReactions(cinfo);
+        InsertContact(cinfo_cached, cmat);
+        return;
+    }
+
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
 
@@ -268,25 +361,22 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_6_3, n_added_6_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, n_added_333_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, n_added_666_3, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -295,28 +385,25 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6    ***NOTE: for body-body one could have rolling friction: ***
                 if (cmat.rolling_friction || cmat.spinning_friction) {
-                    _OptimalContactInsert(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this,
-                                          objA, objB, cinfo, cmat);
+                    _OptimalContactInsert(contactlist_6_6_rolling, n_added_6_6_rolling, this, objA, objB, cinfo, cmat);
                 } else {
-                    _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                    _OptimalContactInsert(contactlist_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
                 }
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, n_added_333_6, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, n_added_666_6, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -325,24 +412,20 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_3, n_added_333_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_6, n_added_333_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_333, n_added_333_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, n_added_666_333, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -351,23 +434,19 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_3, n_added_666_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_6, n_added_666_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, n_added_666_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_666, n_added_666_666, this, objA, objB, cinfo, cmat);
             }
         } break;
 
@@ -410,8 +489,8 @@ ChVector3d ChContactContainerNSC::GetContactableTorque(ChContactable* contactabl
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContacts(ChContactPool<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -424,8 +503,9 @@ void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::Repo
 }
 
 template <class Tcont>
-void _ReportAllContactsRolling(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContactsRolling(ChContactPool<Tcont>& contactlist,
+                               ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -453,8 +533,9 @@ void ChContactContainerNSC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 }
 
 template <class Tcont>
-void _ReportAllContactsNSC(std::list<Tcont*>& contactlist, ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContactsNSC(ChContactPool<Tcont>& contactlist,
+                           ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -468,9 +549,9 @@ void _ReportAllContactsNSC(std::list<Tcont*>& contactlist, ChContactContainerNSC
 }
 
 template <class Tcont>
-void _ReportAllContactsRollingNSC(std::list<Tcont*>& contactlist,
+void _ReportAllContactsRollingNSC(ChContactPool<Tcont>& contactlist,
                                   ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -499,74 +580,83 @@ void ChContactContainerNSC::ReportAllContactsNSC(std::shared_ptr<ReportContactCa
 
 ////////// STATE INTERFACE ////
 
+// Note: the loops over contacts which only access the contact's own entries in the state, constraint, and descriptor
+// vectors are executed in parallel. Loops which write into the entries of the contactable objects are kept serial.
+
 template <class Tcont>
 void _IntStateGatherReactions(unsigned int& coffset,
-                              std::list<Tcont*>& contactlist,
+                              ChContactPool<Tcont>& contactlist,
                               const unsigned int off_L,
                               ChVectorDynamic<>& L,
-                              const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntStateGatherReactions(off_L + coffset, L);
-        coffset += stride;
-        ++itercontact;
+                              const int stride,
+                              int nthreads) {
+    int n = (int)contactlist.size();
+    unsigned int off_start = off_L + coffset;
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_CONTACTS)
+    for (int i = 0; i < n; i++) {
+        contactlist[i]->ContIntStateGatherReactions(off_start + stride * i, L);
     }
+    coffset += stride * n;
 }
 
 void ChContactContainerNSC::IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) {
+    int nthreads = GetSystem()->GetNumThreadsChrono();
     unsigned int coffset = 0;
-    _IntStateGatherReactions(coffset, contactlist_6_6, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_6_3, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_3_3, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_333_3, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_333_6, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_333_333, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_666_3, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_666_6, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_666_333, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_666_666, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_6_6_rolling, off_L, L, 6);
+    _IntStateGatherReactions(coffset, contactlist_6_6, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_6_3, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_3_3, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_333_3, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_333_6, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_333_333, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_666_3, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_666_6, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_666_333, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_666_666, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_6_6_rolling, off_L, L, 6, nthreads);
 }
 
 template <class Tcont>
 void _IntStateScatterReactions(unsigned int& coffset,
-                               std::list<Tcont*>& contactlist,
+                               ChContactPool<Tcont>& contactlist,
                                const unsigned int off_L,
                                const ChVectorDynamic<>& L,
-                               const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntStateScatterReactions(off_L + coffset, L);
-        coffset += stride;
-        ++itercontact;
+                               const int stride,
+                               int nthreads) {
+    int n = (int)contactlist.size();
+    unsigned int off_start = off_L + coffset;
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_CONTACTS)
+    for (int i = 0; i < n; i++) {
+        contactlist[i]->ContIntStateScatterReactions(off_start + stride * i, L);
     }
+    coffset += stride * n;
 }
 
 void ChContactContainerNSC::IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) {
+    int nthreads = GetSystem()->GetNumThreadsChrono();
     unsigned int coffset = 0;
-    _IntStateScatterReactions(coffset, contactlist_6_6, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_6_3, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_3_3, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_333_3, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_333_6, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_333_333, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_666_3, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_666_6, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_666_333, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_666_666, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_6_6_rolling, off_L, L, 6);
+    _IntStateScatterReactions(coffset, contactlist_6_6, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_6_3, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_3_3, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_333_3, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_333_6, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_333_333, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_666_3, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_666_6, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_666_333, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_666_666, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_6_6_rolling, off_L, L, 6, nthreads);
 }
 
 template <class Tcont>
-void _IntLoadResidual_CqL(unsigned int& coffset,           // offset of the contacts
-                          std::list<Tcont*>& contactlist,  // list of contacts
-                          const unsigned int off_L,        // offset in L multipliers
-                          ChVectorDynamic<>& R,            // result: the R residual, R += c*Cq'*L
-                          const ChVectorDynamic<>& L,      // the L vector
-                          const double c,                  // a scaling factor
-                          const int stride                 // stride
+void _IntLoadResidual_CqL(unsigned int& coffset,              // offset of the contacts
+                          ChContactPool<Tcont>& contactlist,  // list of contacts
+                          const unsigned int off_L,           // offset in L multipliers
+                          ChVectorDynamic<>& R,               // result: the R residual, R += c*Cq'*L
+                          const ChVectorDynamic<>& L,         // the L vector
+                          const double c,                     // a scaling factor
+                          const int stride                    // stride
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadResidual_CqL(off_L + coffset, R, L, c);
         coffset += stride;
@@ -593,21 +683,23 @@ void ChContactContainerNSC::IntLoadResidual_CqL(const unsigned int off_L,
 }
 
 template <class Tcont>
-void _IntLoadConstraint_C(unsigned int& coffset,           // contact offset
-                          std::list<Tcont*>& contactlist,  // contact list
-                          const unsigned int off,          // offset in Qc residual
-                          ChVectorDynamic<>& Qc,           // result: the Qc residual, Qc += c*C
-                          const double c,                  // a scaling factor
-                          bool do_clamp,                   // apply clamping to c*C?
-                          double recovery_clamp,           // value for min/max clamping of c*C
-                          const int stride                 // stride
+void _IntLoadConstraint_C(unsigned int& coffset,              // contact offset
+                          ChContactPool<Tcont>& contactlist,  // contact list
+                          const unsigned int off,             // offset in Qc residual
+                          ChVectorDynamic<>& Qc,              // result: the Qc residual, Qc += c*C
+                          const double c,                     // a scaling factor
+                          bool do_clamp,                      // apply clamping to c*C?
+                          double recovery_clamp,              // value for min/max clamping of c*C
+                          const int stride,                   // stride
+                          int nthreads                        // number of OpenMP threads
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntLoadConstraint_C(off + coffset, Qc, c, do_clamp, recovery_clamp);
-        coffset += stride;
-        ++itercontact;
+    int n = (int)contactlist.size();
+    unsigned int off_start = off + coffset;
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_CONTACTS)
+    for (int i = 0; i < n; i++) {
+        contactlist[i]->ContIntLoadConstraint_C(off_start + stride * i, Qc, c, do_clamp, recovery_clamp);
     }
+    coffset += stride * n;
 }
 
 void ChContactContainerNSC::IntLoadConstraint_C(const unsigned int off,
@@ -615,36 +707,39 @@ void ChContactContainerNSC::IntLoadConstraint_C(const unsigned int off,
                                                 const double c,
                                                 bool do_clamp,
                                                 double recovery_clamp) {
+    int nthreads = GetSystem()->GetNumThreadsChrono();
     unsigned int coffset = 0;
-    _IntLoadConstraint_C(coffset, contactlist_6_6, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_6_3, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_3_3, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_333_3, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_333_6, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_333_333, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_666_3, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_666_6, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_666_333, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_666_666, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_6_6_rolling, off, Qc, c, do_clamp, recovery_clamp, 6);
+    _IntLoadConstraint_C(coffset, contactlist_6_6, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_6_3, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_3_3, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_333_3, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_333_6, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_333_333, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_666_3, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_666_6, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_666_333, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_666_666, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_6_6_rolling, off, Qc, c, do_clamp, recovery_clamp, 6, nthreads);
 }
 
 template <class Tcont>
 void _IntToDescriptor(unsigned int& coffset,
-                      std::list<Tcont*>& contactlist,
+                      ChContactPool<Tcont>& contactlist,
                       const unsigned int off_v,
                       const ChStateDelta& v,
                       const ChVectorDynamic<>& R,
                       const unsigned int off_L,
                       const ChVectorDynamic<>& L,
                       const ChVectorDynamic<>& Qc,
-                      const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntToDescriptor(off_L + coffset, L, Qc);
-        coffset += stride;
-        ++itercontact;
+                      const int stride,
+                      int nthreads) {
+    int n = (int)contactlist.size();
+    unsigned int off_start = off_L + coffset;
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_CONTACTS)
+    for (int i = 0; i < n; i++) {
+        contactlist[i]->ContIntToDescriptor(off_start + stride * i, L, Qc);
     }
+    coffset += stride * n;
 }
 
 void ChContactContainerNSC::IntToDescriptor(const unsigned int off_v,
@@ -653,59 +748,63 @@ void ChContactContainerNSC::IntToDescriptor(const unsigned int off_v,
                                             const unsigned int off_L,
                                             const ChVectorDynamic<>& L,
                                             const ChVectorDynamic<>& Qc) {
+    int nthreads = GetSystem()->GetNumThreadsChrono();
     unsigned int coffset = 0;
-    _IntToDescriptor(coffset, contactlist_6_6, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_6_3, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_3_3, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_333_3, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_333_6, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_333_333, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_666_3, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_666_6, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_666_333, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_666_666, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_6_6_rolling, off_v, v, R, off_L, L, Qc, 6);
+    _IntToDescriptor(coffset, contactlist_6_6, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_6_3, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_3_3, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_333_3, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_333_6, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_333_333, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_666_3, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_666_6, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_666_333, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_666_666, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_6_6_rolling, off_v, v, R, off_L, L, Qc, 6, nthreads);
 }
 
 template <class Tcont>
 void _IntFromDescriptor(unsigned int& coffset,
-                        std::list<Tcont*>& contactlist,
+                        ChContactPool<Tcont>& contactlist,
                         const unsigned int off_v,
                         ChStateDelta& v,
                         const unsigned int off_L,
                         ChVectorDynamic<>& L,
-                        const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntFromDescriptor(off_L + coffset, L);
-        coffset += stride;
-        ++itercontact;
+                        const int stride,
+                        int nthreads) {
+    int n = (int)contactlist.size();
+    unsigned int off_start = off_L + coffset;
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_CONTACTS)
+    for (int i = 0; i < n; i++) {
+        contactlist[i]->ContIntFromDescriptor(off_start + stride * i, L);
     }
+    coffset += stride * n;
 }
 
 void ChContactContainerNSC::IntFromDescriptor(const unsigned int off_v,
                                               ChStateDelta& v,
                                               const unsigned int off_L,
                                               ChVectorDynamic<>& L) {
+    int nthreads = GetSystem()->GetNumThreadsChrono();
     unsigned int coffset = 0;
-    _IntFromDescriptor(coffset, contactlist_6_6, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_6_3, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_3_3, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_333_3, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_333_6, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_333_333, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_666_3, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_666_6, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_666_333, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_666_666, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_6_6_rolling, off_v, v, off_L, L, 6);
+    _IntFromDescriptor(coffset, contactlist_6_6, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_6_3, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_3_3, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_333_3, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_333_6, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_333_333, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_666_3, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_666_6, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_666_333, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_666_666, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_6_6_rolling, off_v, v, off_L, L, 6, nthreads);
 }
 
 // SOLVER INTERFACES
 
 template <class Tcont>
-void _InjectConstraints(std::list<Tcont*>& contactlist, ChSystemDescriptor& descriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectConstraints(ChContactPool<Tcont>& contactlist, ChSystemDescriptor& descriptor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->InjectConstraints(descriptor);
         ++itercontact;
@@ -727,49 +826,55 @@ void ChContactContainerNSC::InjectConstraints(ChSystemDescriptor& descriptor) {
 }
 
 template <class Tcont>
-void _ConstraintsBiReset(std::list<Tcont*>& contactlist) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ConstraintsBiReset();
-        ++itercontact;
+void _ConstraintsBiReset(ChContactPool<Tcont>& contactlist, int nthreads) {
+    int n = (int)contactlist.size();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_CONTACTS)
+    for (int i = 0; i < n; i++) {
+        contactlist[i]->ConstraintsBiReset();
     }
 }
 
 void ChContactContainerNSC::ConstraintsBiReset() {
-    _ConstraintsBiReset(contactlist_6_6);
-    _ConstraintsBiReset(contactlist_6_3);
-    _ConstraintsBiReset(contactlist_3_3);
-    _ConstraintsBiReset(contactlist_333_3);
-    _ConstraintsBiReset(contactlist_333_6);
-    _ConstraintsBiReset(contactlist_333_333);
-    _ConstraintsBiReset(contactlist_666_3);
-    _ConstraintsBiReset(contactlist_666_6);
-    _ConstraintsBiReset(contactlist_666_333);
-    _ConstraintsBiReset(contactlist_666_666);
-    _ConstraintsBiReset(contactlist_6_6_rolling);
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+    _ConstraintsBiReset(contactlist_6_6, nthreads);
+    _ConstraintsBiReset(contactlist_6_3, nthreads);
+    _ConstraintsBiReset(contactlist_3_3, nthreads);
+    _ConstraintsBiReset(contactlist_333_3, nthreads);
+    _ConstraintsBiReset(contactlist_333_6, nthreads);
+    _ConstraintsBiReset(contactlist_333_333, nthreads);
+    _ConstraintsBiReset(contactlist_666_3, nthreads);
+    _ConstraintsBiReset(contactlist_666_6, nthreads);
+    _ConstraintsBiReset(contactlist_666_333, nthreads);
+    _ConstraintsBiReset(contactlist_666_666, nthreads);
+    _ConstraintsBiReset(contactlist_6_6_rolling, nthreads);
 }
 
 template <class Tcont>
-void _ConstraintsBiLoad_C(std::list<Tcont*>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
-        ++itercontact;
+void _ConstraintsBiLoad_C(ChContactPool<Tcont>& contactlist,
+                          double factor,
+                          double recovery_clamp,
+                          bool do_clamp,
+                          int nthreads) {
+    int n = (int)contactlist.size();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_CONTACTS)
+    for (int i = 0; i < n; i++) {
+        contactlist[i]->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
     }
 }
 
 void ChContactContainerNSC::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool do_clamp) {
-    _ConstraintsBiLoad_C(contactlist_6_6, factor, recovery_clamp, do_clamp);
-    _ConstraintsBiLoad_C(contactlist_6_3, factor, recovery_clamp, do_clamp);
-    _ConstraintsBiLoad_C(contactlist_3_3, factor, recovery_clamp, do_clamp);
-    _ConstraintsBiLoad_C(contactlist_333_3, factor, recovery_clamp, do_clamp);
-    _ConstraintsBiLoad_C(contactlist_333_6, factor, recovery_clamp, do_clamp);
-    _ConstraintsBiLoad_C(contactlist_333_333, factor, recovery_clamp, do_clamp);
-    _ConstraintsBiLoad_C(contactlist_666_3, factor, recovery_clamp, do_clamp);
-    _ConstraintsBiLoad_C(contactlist_666_6, factor, recovery_clamp, do_clamp);
-    _ConstraintsBiLoad_C(contactlist_666_333, factor, recovery_clamp, do_clamp);
-    _ConstraintsBiLoad_C(contactlist_666_666, factor, recovery_clamp, do_clamp);
-    _ConstraintsBiLoad_C(contactlist_6_6_rolling, factor, recovery_clamp, do_clamp);
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+    _ConstraintsBiLoad_C(contactlist_6_6, factor, recovery_clamp, do_clamp, nthreads);
+    _ConstraintsBiLoad_C(contactlist_6_3, factor, recovery_clamp, do_clamp, nthreads);
+    _ConstraintsBiLoad_C(contactlist_3_3, factor, recovery_clamp, do_clamp, nthreads);
+    _ConstraintsBiLoad_C(contactlist_333_3, factor, recovery_clamp, do_clamp, nthreads);
+    _ConstraintsBiLoad_C(contactlist_333_6, factor, recovery_clamp, do_clamp, nthreads);
+    _ConstraintsBiLoad_C(contactlist_333_333, factor, recovery_clamp, do_clamp, nthreads);
+    _ConstraintsBiLoad_C(contactlist_666_3, factor, recovery_clamp, do_clamp, nthreads);
+    _ConstraintsBiLoad_C(contactlist_666_6, factor, recovery_clamp, do_clamp, nthreads);
+    _ConstraintsBiLoad_C(contactlist_666_333, factor, recovery_clamp, do_clamp, nthreads);
+    _ConstraintsBiLoad_C(contactlist_666_666, factor, recovery_clamp, do_clamp, nthreads);
+    _ConstraintsBiLoad_C(contactlist_6_6_rolling, factor, recovery_clamp, do_clamp, nthreads);
 }
 
 void ChContactContainerNSC::LoadConstraintJacobians() {
@@ -777,27 +882,28 @@ void ChContactContainerNSC::LoadConstraintJacobians() {
 }
 
 template <class Tcont>
-void _ConstraintsFetch_react(std::list<Tcont*>& contactlist, double factor) {
+void _ConstraintsFetch_react(ChContactPool<Tcont>& contactlist, double factor, int nthreads) {
     // From constraints to react vector:
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ConstraintsFetch_react(factor);
-        ++itercontact;
+    int n = (int)contactlist.size();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_CONTACTS)
+    for (int i = 0; i < n; i++) {
+        contactlist[i]->ConstraintsFetch_react(factor);
     }
 }
 
 void ChContactContainerNSC::ConstraintsFetch_react(double factor) {
-    _ConstraintsFetch_react(contactlist_6_6, factor);
-    _ConstraintsFetch_react(contactlist_6_3, factor);
-    _ConstraintsFetch_react(contactlist_3_3, factor);
-    _ConstraintsFetch_react(contactlist_333_3, factor);
-    _ConstraintsFetch_react(contactlist_333_6, factor);
-    _ConstraintsFetch_react(contactlist_333_333, factor);
-    _ConstraintsFetch_react(contactlist_666_3, factor);
-    _ConstraintsFetch_react(contactlist_666_6, factor);
-    _ConstraintsFetch_react(contactlist_666_333, factor);
-    _ConstraintsFetch_react(contactlist_666_666, factor);
-    _ConstraintsFetch_react(contactlist_6_6_rolling, factor);
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+    _ConstraintsFetch_react(contactlist_6_6, factor, nthreads);
+    _ConstraintsFetch_react(contactlist_6_3, factor, nthreads);
+    _ConstraintsFetch_react(contactlist_3_3, factor, nthreads);
+    _ConstraintsFetch_react(contactlist_333_3, factor, nthreads);
+    _ConstraintsFetch_react(contactlist_333_6, factor, nthreads);
+    _ConstraintsFetch_react(contactlist_333_333, factor, nthreads);
+    _ConstraintsFetch_react(contactlist_666_3, factor, nthreads);
+    _ConstraintsFetch_react(contactlist_666_6, factor, nthreads);
+    _ConstraintsFetch_react(contactlist_666_333, factor, nthreads);
+    _ConstraintsFetch_react(contactlist_666_666, factor, nthreads);
+    _ConstraintsFetch_react(contactlist_6_6_rolling, factor, nthreads);
 }
 
 void ChContactContainerNSC::ArchiveOut(ChArchiveOut& archive_out) {
@@ -807,6 +913,8 @@ void ChContactContainerNSC::ArchiveOut(ChArchiveOut& archive_out) {
     ChContactContainer::ArchiveOut(archive_out);
     // serialize all member data:
     archive_out << CHNVP(min_bounce_speed);
+    archive_out << CHNVP(m_cache_enabled);
+    archive_out << CHNVP(m_cache_tol);
 
     // NO SERIALIZATION of contact list because assume it is volatile and generated when needed
 }
@@ -814,11 +922,15 @@ void ChContactContainerNSC::ArchiveOut(ChArchiveOut& archive_out) {
 /// Method to allow de serialization of transient data from archives.
 void ChContactContainerNSC::ArchiveIn(ChArchiveIn& archive_in) {
     // version number
-    /*int version =*/archive_in.VersionRead<ChContactContainerNSC>();
+    int version = archive_in.VersionRead<ChContactContainerNSC>();
     // deserialize parent class
     ChContactContainer::ArchiveIn(archive_in);
     // stream in all member data:
     archive_in >> CHNVP(min_bounce_speed);
+    if (version >= 1) {
+        archive_in >> CHNVP(m_cache_enabled);
+        archive_in >> CHNVP(m_cache_tol);
+    }
 
     RemoveAllContacts();
     // NO SERIALIZATION of contact list because assume it is volatile and generated when needed
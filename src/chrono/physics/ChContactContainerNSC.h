@@ -15,19 +15,23 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
-#include <list>
+#include <deque>
+#include <unordered_map>
+#include <vector>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactNSC.h"
 #include "chrono/physics/ChContactNSCrolling.h"
+#include "chrono/physics/ChContactPool.h"
 #include "chrono/physics/ChContactable.h"
 
 namespace chrono {
 
 /// Class representing a container of many non-smooth contacts.
-/// Implemented using linked lists of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
-/// reactions). It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions,
-/// that account also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
+/// Implemented using pools of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
+/// reactions), one for each combination of contactable types. It might also contain ChContactNSCrolling objects
+/// (extended versions of ChContactNSC, with 6 reactions, that account also for rolling and spinning resistance), but
+/// also for '6dof vs 6dof' contactables. See ChContactPool.
 class ChApi ChContactContainerNSC : public ChContactContainer {
   public:
     typedef ChContactNSC<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSC_6_6;
@@ -61,9 +65,8 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// similar). Instead of simply deleting all previous contacts, this optimized implementation rewinds the contact
+    /// pools and tries to reuse previous contact objects until possible, to avoid too much allocation/deallocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -79,7 +82,7 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). This optimized version releases the contact objects that were not reused, if they are too many.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -127,6 +130,45 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// Objects will rebounce only if their relative colliding speed is above this threshold.
     double GetMinBounceSpeed() const { return min_bounce_speed; }
 
+    /// Enable/disable the persistent cache of contact reactions (default: false).
+    /// If enabled, each new contact is matched to a contact of the previous step between the same pair of collision
+    /// shapes and with a nearby contact point (see SetReactionCacheTolerance). The reactions of the matched contact
+    /// are then used as initial guess for the solver, which is effective only if the solver has warm start enabled.
+    /// The cache is not used for contacts which already come with a persistent reaction cache from the collision
+    /// system (e.g., contacts generated by the Bullet collision system from persistent manifolds).
+    void EnableReactionCache(bool val) { m_cache_enabled = val; }
+
+    /// Return true if the persistent cache of contact reactions is enabled.
+    bool IsReactionCacheEnabled() const { return m_cache_enabled; }
+
+    /// Set the tolerance for matching contact points between consecutive steps (default: 0.01).
+    /// Contact points are compared in the frame of the collision model of the first contactable object.
+    void SetReactionCacheTolerance(double tol) { m_cache_tol = tol; }
+
+    /// Return the number of contacts which were matched to a contact of the previous step at the last collision
+    /// detection pass (see EnableReactionCache).
+    unsigned int GetNumCachedContacts() const { return m_cache_hits; }
+
+    /// Reactions of a contact between two collision shapes, as stored in the reaction cache.
+    struct CachedReactions {
+        const ChCollisionModel* modelA;  ///< collision model of the first contactable
+        const ChCollisionModel* modelB;  ///< collision model of the second contactable
+        const ChCollisionShape* shapeA;  ///< collision shape in model A
+        const ChCollisionShape* shapeB;  ///< collision shape in model B
+        ChVector3d point;                ///< contact point, expressed in the frame of collision model A
+        float reactions[6];              ///< cached reactions
+    };
+
+    /// Return the contents of the reaction cache, i.e., the reactions of the contacts created at the last collision
+    /// detection pass (see EnableReactionCache). Entries between the same pair of shapes are returned in the order in
+    /// which the contacts were created.
+    std::vector<CachedReactions> GetReactionCache() const;
+
+    /// Set the contents of the reaction cache (e.g., when restoring a checkpoint, see GetReactionCache).
+    /// All current contacts are removed. The given reactions are used to warm start the contacts created at the next
+    /// collision detection pass.
+    void SetReactionCache(const std::vector<CachedReactions>& cache);
+
     /// Update state of this contact container: compute jacobians, violations, etc.
     /// and store results in inner structures of contacts.
     virtual void Update(double mtime, bool update_assets = true) override;
@@ -182,18 +224,18 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   protected:
-    std::list<ChContactNSC_6_6*> contactlist_6_6;
-    std::list<ChContactNSC_6_3*> contactlist_6_3;
-    std::list<ChContactNSC_3_3*> contactlist_3_3;
-    std::list<ChContactNSC_333_3*> contactlist_333_3;
-    std::list<ChContactNSC_333_6*> contactlist_333_6;
-    std::list<ChContactNSC_333_333*> contactlist_333_333;
-    std::list<ChContactNSC_666_3*> contactlist_666_3;
-    std::list<ChContactNSC_666_6*> contactlist_666_6;
-    std::list<ChContactNSC_666_333*> contactlist_666_333;
-    std::list<ChContactNSC_666_666*> contactlist_666_666;
-
-    std::list<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
+    ChContactPool<ChContactNSC_6_6> contactlist_6_6;
+    ChContactPool<ChContactNSC_6_3> contactlist_6_3;
+    ChContactPool<ChContactNSC_3_3> contactlist_3_3;
+    ChContactPool<ChContactNSC_333_3> contactlist_333_3;
+    ChContactPool<ChContactNSC_333_6> contactlist_333_6;
+    ChContactPool<ChContactNSC_333_333> contactlist_333_333;
+    ChContactPool<ChContactNSC_666_3> contactlist_666_3;
+    ChContactPool<ChContactNSC_666_6> contactlist_666_6;
+    ChContactPool<ChContactNSC_666_333> contactlist_666_333;
+    ChContactPool<ChContactNSC_666_666> contactlist_666_666;
+
+    ChContactPool<ChContactNSCrolling_6_6> contactlist_6_6_rolling;
 
     int n_added_6_6;
     int n_added_6_3;
@@ -207,30 +249,56 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     int n_added_666_666;
     int n_added_6_6_rolling;
 
-    std::list<ChContactNSC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactNSC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactNSC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactNSC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactNSC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactNSC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactNSC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactNSC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactNSC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactNSC_666_666*>::iterator lastcontact_666_666;
-
-    std::list<ChContactNSCrolling_6_6*>::iterator lastcontact_6_6_rolling;
-
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
   private:
+    /// Identifier of a pair of collision shapes, used as key in the reaction cache.
+    struct ReactionCacheKey {
+        const void* modelA;
+        const void* modelB;
+        const void* shapeA;
+        const void* shapeB;
+        bool operator==(const ReactionCacheKey& other) const {
+            return modelA == other.modelA && modelB == other.modelB && shapeA == other.shapeA &&
+                   shapeB == other.shapeB;
+        }
+    };
+
+    struct ReactionCacheKeyHash {
+        size_t operator()(const ReactionCacheKey& key) const;
+    };
+
+    /// Cached reactions of a contact, with the contact point expressed in the frame of the first collision model.
+    struct ReactionCacheEntry {
+        ChVector3d point;
+        float reactions[6];
+        bool matched;
+    };
+
+    /// Reactions cached at one step, with the entries for each pair of collision shapes.
+    struct ReactionCache {
+        std::deque<ReactionCacheEntry> entries;
+        std::unordered_map<ReactionCacheKey, std::vector<size_t>, ReactionCacheKeyHash> pairs;
+    };
+
     void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat);
 
+    /// Create a cache entry for the given contact, initialized from the matching entry of the previous step (if any).
+    /// Return a pointer to the cached reactions, which remains valid until the next collision detection pass.
+    float* CacheReactions(const ChCollisionInfo& cinfo);
+
     double min_bounce_speed;  ///< minimum speed for rebounce after impacts. Lower speeds are clamped to 0
 
+    bool m_cache_enabled;       ///< if true, use the persistent reaction cache
+    double m_cache_tol;         ///< tolerance for matching contact points
+    ReactionCache m_cache[2];   ///< reaction caches for the current and previous steps
+    int m_cache_current;        ///< index of the reaction cache for the current step
+    unsigned int m_cache_hits;  ///< number of contacts matched at the last collision detection pass
+
     friend class ChSystemNSC;
 };
 
-CH_CLASS_VERSION(ChContactContainerNSC, 0)
+CH_CLASS_VERSION(ChContactContainerNSC, 1)
 
 }  // end namespace chrono
 
@@ -12,14 +12,21 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <typeinfo>
+#include <unordered_map>
+
 #include "chrono/physics/ChContactContainerSMC.h"
 #include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChContactContainerSMC)
 
+// Minimum number of contacts of a given type for which multithreading is used.
+static const int MIN_PARALLEL_CONTACTS = 256;
+
 ChContactContainerSMC::ChContactContainerSMC()
     : n_added_3_3(0),
       n_added_6_3(0),
@@ -30,7 +37,8 @@ ChContactContainerSMC::ChContactContainerSMC()
       n_added_666_3(0),
       n_added_666_6(0),
       n_added_666_333(0),
-      n_added_666_666(0) {}
+      n_added_666_666(0),
+      contact_colors_valid(false) {}
 
 ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other) : ChContactContainer(other) {
     n_added_3_3 = 0;
@@ -43,6 +51,7 @@ ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other)
     n_added_666_6 = 0;
     n_added_666_333 = 0;
     n_added_666_666 = 0;
+    contact_colors_valid = false;
 }
 
 ChContactContainerSMC::~ChContactContainerSMC() {
@@ -54,110 +63,121 @@ void ChContactContainerSMC::Update(double mytime, bool update_assets) {
     ChContactContainer::Update(mytime, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
+template <class Tcont>
+void _RemoveAllContacts(ChContactPool<Tcont>& contactlist, int& n_added) {
+    contactlist.Clear();
     n_added = 0;
 }
 
 void ChContactContainerSMC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
+    _RemoveAllContacts(contactlist_3_3, n_added_3_3);
+    _RemoveAllContacts(contactlist_6_3, n_added_6_3);
+    _RemoveAllContacts(contactlist_6_6, n_added_6_6);
+    _RemoveAllContacts(contactlist_333_3, n_added_333_3);
+    _RemoveAllContacts(contactlist_333_6, n_added_333_6);
+    _RemoveAllContacts(contactlist_333_333, n_added_333_333);
+    _RemoveAllContacts(contactlist_666_3, n_added_666_3);
+    _RemoveAllContacts(contactlist_666_6, n_added_666_6);
+    _RemoveAllContacts(contactlist_666_333, n_added_666_333);
+    _RemoveAllContacts(contactlist_666_666, n_added_666_666);
     //**TODO*** cont. roll.
+    contact_colors_valid = false;
 }
 
 void ChContactContainerSMC::BeginAddContact() {
-    lastcontact_3_3 = contactlist_3_3.begin();
+    contactlist_3_3.Rewind();
     n_added_3_3 = 0;
 
-    lastcontact_6_3 = contactlist_6_3.begin();
+    contactlist_6_3.Rewind();
     n_added_6_3 = 0;
 
-    lastcontact_6_6 = contactlist_6_6.begin();
+    contactlist_6_6.Rewind();
     n_added_6_6 = 0;
 
-    lastcontact_333_3 = contactlist_333_3.begin();
+    contactlist_333_3.Rewind();
     n_added_333_3 = 0;
 
-    lastcontact_333_6 = contactlist_333_6.begin();
+    contactlist_333_6.Rewind();
     n_added_333_6 = 0;
 
-    lastcontact_333_333 = contactlist_333_333.begin();
+    contactlist_333_333.Rewind();
     n_added_333_333 = 0;
 
-    lastcontact_666_3 = contactlist_666_3.begin();
+    contactlist_666_3.Rewind();
     n_added_666_3 = 0;
 
-    lastcontact_666_6 = contactlist_666_6.begin();
+    contactlist_666_6.Rewind();
     n_added_666_6 = 0;
 
-    lastcontact_666_333 = contactlist_666_333.begin();
+    contactlist_666_333.Rewind();
     n_added_666_333 = 0;
 
-    lastcontact_666_666 = contactlist_666_666.begin();
+    contactlist_666_666.Rewind();
     n_added_666_666 = 0;
 
+    contact_colors_valid = false;
+
     // lastcontact_roll = contactlist_roll.begin();
     // n_added_roll = 0;
 }
 
-void ChContactContainerSMC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
+template <class Tcont>
+void _CalculateForces(ChContactPool<Tcont>& contactlist, const ChSystemSMC& sys, int nthreads) {
+    int n = (int)contactlist.size();
+    const auto& algorithm = sys.GetContactForceTorqueAlgorithm();
+
+    // A user-provided force algorithm is not assumed to be thread-safe: process contacts one at a time.
+    if (typeid(algorithm) != typeid(ChDefaultContactForceTorqueSMC)) {
+        for (int i = 0; i < n; i++)
+            contactlist[i]->CalculateForces();
+        return;
     }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
+
+    // Default force algorithm: process batches of contacts in parallel.
+    const auto& default_algorithm = static_cast<const ChDefaultContactForceTorqueSMC&>(algorithm);
+    const int batch_size = ChDefaultContactForceTorqueSMC::BATCH_SIZE;
+    int num_batches = (n + batch_size - 1) / batch_size;
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_CONTACTS)
+    for (int b = 0; b < num_batches; b++) {
+        int start = b * batch_size;
+        ChDefaultContactForceTorqueSMC::ContactBatch batch;
+        batch.size = std::min(batch_size, n - start);
+        for (int i = 0; i < batch.size; i++)
+            contactlist[start + i]->BatchGather(batch, i);
+        default_algorithm.CalculateForces(sys, batch);
+        for (int i = 0; i < batch.size; i++)
+            contactlist[start + i]->BatchScatter(batch, i);
     }
+}
+
+void ChContactContainerSMC::EndAddContact() {
+    CH_TRACE_ZONE("ChContactContainerSMC::EndAddContact", "contact");
+
+    // calculate forces (and Jacobians, if needed) for all active contacts
+    const auto& sys = *static_cast<ChSystemSMC*>(GetSystem());
+    int nthreads = sys.GetNumThreadsChrono();
+    _CalculateForces(contactlist_3_3, sys, nthreads);
+    _CalculateForces(contactlist_6_3, sys, nthreads);
+    _CalculateForces(contactlist_6_6, sys, nthreads);
+    _CalculateForces(contactlist_333_3, sys, nthreads);
+    _CalculateForces(contactlist_333_6, sys, nthreads);
+    _CalculateForces(contactlist_333_333, sys, nthreads);
+    _CalculateForces(contactlist_666_3, sys, nthreads);
+    _CalculateForces(contactlist_666_6, sys, nthreads);
+    _CalculateForces(contactlist_666_333, sys, nthreads);
+    _CalculateForces(contactlist_666_666, sys, nthreads);
+
+    // release contact objects that were not reused (if too many)
+    contactlist_3_3.Trim();
+    contactlist_6_3.Trim();
+    contactlist_6_6.Trim();
+    contactlist_333_3.Trim();
+    contactlist_333_6.Trim();
+    contactlist_333_333.Trim();
+    contactlist_666_3.Trim();
+    contactlist_666_6.Trim();
+    contactlist_666_333.Trim();
+    contactlist_666_666.Trim();
 
     // while (lastcontact_roll != contactlist_roll.end()) {
     //    delete (*lastcontact_roll);
@@ -165,9 +185,8 @@ void ChContactContainerSMC::EndAddContact() {
     //}
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact list
-                           Titer& lastcontact,                        // last contact acquired
+template <class Tcont, class Ta, class Tb>
+void _OptimalContactInsert(ChContactPool<Tcont>& contactlist,        // contact pool
                            int& n_added,                              // number of contacts inserted
                            ChContactContainerSMC* container,          // contact container
                            Ta* objA,                                  // collidable object A
@@ -175,15 +194,12 @@ void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact
                            const ChCollisionInfo& cinfo,              // collision information
                            const ChContactMaterialCompositeSMC& cmat  // composite material
 ) {
-    if (lastcontact != contactlist.end()) {
+    if (Tcont* mc = contactlist.Reuse()) {
         // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat);
-        lastcontact++;
+        mc->Reset(objA, objB, cinfo, cmat);
     } else {
         // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
+        contactlist.Emplace(container, objA, objB, cinfo, cmat);
     }
     n_added++;
 }
@@ -273,25 +289,22 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_6_3, n_added_6_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, n_added_333_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, n_added_666_3, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -300,23 +313,21 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6
-                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, n_added_333_6, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, n_added_666_6, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -325,24 +336,20 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_3, n_added_333_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_6, n_added_333_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_333, n_added_333_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, n_added_666_333, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -351,23 +358,19 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_3, n_added_666_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_6, n_added_666_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, n_added_666_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_666, n_added_666_666, this, objA, objB, cinfo, cmat);
             }
         } break;
 
@@ -409,8 +412,8 @@ ChVector3d ChContactContainerSMC::GetContactableTorque(ChContactable* contactabl
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContacts(ChContactPool<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -439,52 +442,163 @@ void ChContactContainerSMC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 // STATE INTERFACE
 
 template <class Tcont>
-void _IntLoadResidual_F(std::list<Tcont*>& contactlist, ChVectorDynamic<>& R, const double c) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _IntLoadResidual_F(ChContactPool<Tcont>& contactlist, ChVectorDynamic<>& R, const double c) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadResidual_F(R, c);
         ++itercontact;
     }
 }
 
+// Collect the variables of an active contactable object (i.e., the blocks of the residual loaded by its contact forces).
+template <int N1>
+void _AddContactableVariables(ChVariableTupleCarrier_1vars<N1>* obj, std::vector<ChVariables*>& vars) {
+    vars.push_back(obj->GetVariables1());
+}
+
+template <int N1, int N2, int N3>
+void _AddContactableVariables(ChVariableTupleCarrier_3vars<N1, N2, N3>* obj, std::vector<ChVariables*>& vars) {
+    vars.push_back(obj->GetVariables1());
+    vars.push_back(obj->GetVariables2());
+    vars.push_back(obj->GetVariables3());
+}
+
+// Partition the contacts in groups (colors) of contacts not acting on common variables (greedy coloring).
+// Inactive contactable objects (e.g., fixed bodies) do not receive contact forces and are ignored.
+template <class Tcont>
+void _ColorContacts(ChContactPool<Tcont>& contactlist, std::vector<std::vector<int>>& colors) {
+    std::unordered_map<ChVariables*, int> var_index;
+    std::vector<std::vector<int>> var_colors;
+    std::vector<ChVariables*> vars;
+    std::vector<int> var_ids;
+    std::vector<bool> used;
+
+    colors.clear();
+    int n = (int)contactlist.size();
+    for (int i = 0; i < n; i++) {
+        auto contact = contactlist[i];
+        vars.clear();
+        if (contact->GetObjA()->IsContactActive())
+            _AddContactableVariables(contact->GetObjA(), vars);
+        if (contact->GetObjB()->IsContactActive())
+            _AddContactableVariables(contact->GetObjB(), vars);
+
+        var_ids.clear();
+        for (auto var : vars) {
+            auto res = var_index.insert({var, (int)var_colors.size()});
+            if (res.second)
+                var_colors.push_back({});
+            var_ids.push_back(res.first->second);
+        }
+
+        // Assign the first color not used by any contact acting on the same variables
+        used.assign(colors.size() + 1, false);
+        for (auto v : var_ids)
+            for (auto color : var_colors[v])
+                used[color] = true;
+        int color = 0;
+        while (used[color])
+            color++;
+
+        if (color == colors.size())
+            colors.push_back({});
+        colors[color].push_back(i);
+        for (auto v : var_ids)
+            var_colors[v].push_back(color);
+    }
+}
+
+// Load the contact forces in the residual, one color at a time.
+// Contacts with the same color do not act on common variables, so there is no race condition in writing to R.
+template <class Tcont>
+void _IntLoadResidual_F_colored(ChContactPool<Tcont>& contactlist,
+                                const std::vector<std::vector<int>>& colors,
+                                ChVectorDynamic<>& R,
+                                const double c,
+                                int nthreads) {
+    for (const auto& contacts : colors) {
+        int n = (int)contacts.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (n >= MIN_PARALLEL_CONTACTS)
+        for (int i = 0; i < n; i++) {
+            contactlist[contacts[i]]->ContIntLoadResidual_F(R, c);
+        }
+    }
+}
+
 void ChContactContainerSMC::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
-    _IntLoadResidual_F(contactlist_3_3, R, c);
-    _IntLoadResidual_F(contactlist_6_3, R, c);
-    _IntLoadResidual_F(contactlist_6_6, R, c);
-    _IntLoadResidual_F(contactlist_333_3, R, c);
-    _IntLoadResidual_F(contactlist_333_6, R, c);
-    _IntLoadResidual_F(contactlist_333_333, R, c);
-    _IntLoadResidual_F(contactlist_666_3, R, c);
-    _IntLoadResidual_F(contactlist_666_6, R, c);
-    _IntLoadResidual_F(contactlist_666_333, R, c);
-    _IntLoadResidual_F(contactlist_666_666, R, c);
+    CH_TRACE_ZONE("ChContactContainerSMC::IntLoadResidual_F", "contact");
+
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+
+    if (nthreads == 1 || GetNumContacts() < MIN_PARALLEL_CONTACTS) {
+        _IntLoadResidual_F(contactlist_3_3, R, c);
+        _IntLoadResidual_F(contactlist_6_3, R, c);
+        _IntLoadResidual_F(contactlist_6_6, R, c);
+        _IntLoadResidual_F(contactlist_333_3, R, c);
+        _IntLoadResidual_F(contactlist_333_6, R, c);
+        _IntLoadResidual_F(contactlist_333_333, R, c);
+        _IntLoadResidual_F(contactlist_666_3, R, c);
+        _IntLoadResidual_F(contactlist_666_6, R, c);
+        _IntLoadResidual_F(contactlist_666_333, R, c);
+        _IntLoadResidual_F(contactlist_666_666, R, c);
+        return;
+    }
+
+    // Different contacts may act on the same object. The contacts are colored once after each collision detection
+    // and the contact forces are then loaded directly in R, in parallel over the contacts of each color.
+    if (!contact_colors_valid) {
+        CH_TRACE_ZONE("ChContactContainerSMC::ColorContacts", "contact");
+        _ColorContacts(contactlist_3_3, contact_colors[0]);
+        _ColorContacts(contactlist_6_3, contact_colors[1]);
+        _ColorContacts(contactlist_6_6, contact_colors[2]);
+        _ColorContacts(contactlist_333_3, contact_colors[3]);
+        _ColorContacts(contactlist_333_6, contact_colors[4]);
+        _ColorContacts(contactlist_333_333, contact_colors[5]);
+        _ColorContacts(contactlist_666_3, contact_colors[6]);
+        _ColorContacts(contactlist_666_6, contact_colors[7]);
+        _ColorContacts(contactlist_666_333, contact_colors[8]);
+        _ColorContacts(contactlist_666_666, contact_colors[9]);
+        contact_colors_valid = true;
+    }
+
+    _IntLoadResidual_F_colored(contactlist_3_3, contact_colors[0], R, c, nthreads);
+    _IntLoadResidual_F_colored(contactlist_6_3, contact_colors[1], R, c, nthreads);
+    _IntLoadResidual_F_colored(contactlist_6_6, contact_colors[2], R, c, nthreads);
+    _IntLoadResidual_F_colored(contactlist_333_3, contact_colors[3], R, c, nthreads);
+    _IntLoadResidual_F_colored(contactlist_333_6, contact_colors[4], R, c, nthreads);
+    _IntLoadResidual_F_colored(contactlist_333_333, contact_colors[5], R, c, nthreads);
+    _IntLoadResidual_F_colored(contactlist_666_3, contact_colors[6], R, c, nthreads);
+    _IntLoadResidual_F_colored(contactlist_666_6, contact_colors[7], R, c, nthreads);
+    _IntLoadResidual_F_colored(contactlist_666_333, contact_colors[8], R, c, nthreads);
+    _IntLoadResidual_F_colored(contactlist_666_666, contact_colors[9], R, c, nthreads);
 }
 
 template <class Tcont>
-void _KRMmatricesLoad(std::list<Tcont*> contactlist, double Kfactor, double Rfactor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContKRMmatricesLoad(Kfactor, Rfactor);
-        ++itercontact;
+void _KRMmatricesLoad(ChContactPool<Tcont>& contactlist, double Kfactor, double Rfactor, int nthreads) {
+    int n = (int)contactlist.size();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_CONTACTS)
+    for (int i = 0; i < n; i++) {
+        contactlist[i]->ContKRMmatricesLoad(Kfactor, Rfactor);
     }
 }
 
 void ChContactContainerSMC::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    _KRMmatricesLoad(contactlist_3_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_6_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_6_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_333, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_333, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_666, Kfactor, Rfactor);
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+    _KRMmatricesLoad(contactlist_3_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_6_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_6_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_333, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_333, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_666, Kfactor, Rfactor, nthreads);
 }
 
 template <class Tcont>
-void _InjectKRMmatrices(std::list<Tcont*> contactlist, ChSystemDescriptor& descriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectKRMmatrices(ChContactPool<Tcont>& contactlist, ChSystemDescriptor& descriptor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContInjectKRMmatrices(descriptor);
         ++itercontact;
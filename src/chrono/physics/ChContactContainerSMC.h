@@ -17,16 +17,17 @@
 
 #include <algorithm>
 #include <cmath>
-#include <list>
 
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChContactPool.h"
 #include "chrono/physics/ChContactSMC.h"
 #include "chrono/physics/ChContactable.h"
 
 namespace chrono {
 
 /// Class representing a container of many smooth (penalty) contacts.
-/// Implemented using linked lists of ChContactSMC objects (that is, contacts between two ChContactable objects).
+/// Implemented using pools of ChContactSMC objects (that is, contacts between two ChContactable objects), one for each
+/// combination of contactable types. See ChContactPool.
 class ChApi ChContactContainerSMC : public ChContactContainer {
   public:
     typedef ChContactSMC<ChContactable_1vars<3>, ChContactable_1vars<3> > ChContactSMC_3_3;
@@ -41,16 +42,16 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     typedef ChContactSMC<ChContactable_3vars<6, 6, 6>, ChContactable_3vars<6, 6, 6> > ChContactSMC_666_666;
 
   protected:
-    std::list<ChContactSMC_3_3*> contactlist_3_3;
-    std::list<ChContactSMC_6_3*> contactlist_6_3;
-    std::list<ChContactSMC_6_6*> contactlist_6_6;
-    std::list<ChContactSMC_333_3*> contactlist_333_3;
-    std::list<ChContactSMC_333_6*> contactlist_333_6;
-    std::list<ChContactSMC_333_333*> contactlist_333_333;
-    std::list<ChContactSMC_666_3*> contactlist_666_3;
-    std::list<ChContactSMC_666_6*> contactlist_666_6;
-    std::list<ChContactSMC_666_333*> contactlist_666_333;
-    std::list<ChContactSMC_666_666*> contactlist_666_666;
+    ChContactPool<ChContactSMC_3_3> contactlist_3_3;
+    ChContactPool<ChContactSMC_6_3> contactlist_6_3;
+    ChContactPool<ChContactSMC_6_6> contactlist_6_6;
+    ChContactPool<ChContactSMC_333_3> contactlist_333_3;
+    ChContactPool<ChContactSMC_333_6> contactlist_333_6;
+    ChContactPool<ChContactSMC_333_333> contactlist_333_333;
+    ChContactPool<ChContactSMC_666_3> contactlist_666_3;
+    ChContactPool<ChContactSMC_666_6> contactlist_666_6;
+    ChContactPool<ChContactSMC_666_333> contactlist_666_333;
+    ChContactPool<ChContactSMC_666_666> contactlist_666_666;
 
     int n_added_3_3;
     int n_added_6_3;
@@ -63,19 +64,13 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     int n_added_666_333;
     int n_added_666_666;
 
-    std::list<ChContactSMC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactSMC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactSMC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactSMC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactSMC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactSMC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactSMC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactSMC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactSMC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactSMC_666_666*>::iterator lastcontact_666_666;
-
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
+    /// Indices of the contacts of each type (in the order of the contact pools above), grouped by color.
+    /// Contacts with the same color do not act on common variables, so that their forces are loaded in parallel.
+    std::vector<std::vector<int>> contact_colors[10];
+    bool contact_colors_valid;  ///< is the contact coloring consistent with the current contacts?
+
   public:
     ChContactContainerSMC();
     ChContactContainerSMC(const ChContactContainerSMC& other);
@@ -94,9 +89,8 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// similar). Instead of simply deleting all previous contacts, this optimized implementation rewinds the contact
+    /// pools and tries to reuse previous contact objects until possible, to avoid too much allocation/deallocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -112,7 +106,8 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). This function calculates the forces of all contacts, in parallel batches if the default SMC force
+    /// algorithm is used, then releases the contact objects that were not reused, if they are too many.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
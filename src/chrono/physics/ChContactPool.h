@@ -0,0 +1,149 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CH_CONTACT_POOL_H
+#define CH_CONTACT_POOL_H
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace chrono {
+
+/// @addtogroup chrono_physics
+/// @{
+
+/// Pool of contact objects of a given type, used by contact containers.
+/// Contacts are constructed in place in fixed-size blocks of contiguous memory, so that their addresses stay valid
+/// while the pool grows and iteration over the active contacts touches consecutive memory. Contacts are not destroyed
+/// when a new collision detection pass starts (see Rewind), but are reinitialized and reused; unused contacts are only
+/// released (see Trim) when their number significantly exceeds the number of active contacts.
+/// The active contacts can be accessed by index, so that loops over them can be executed in parallel.
+template <class Tcont>
+class ChContactPool {
+  public:
+    /// Number of contacts stored in a memory block.
+    static const size_t BLOCK_SIZE = 256;
+
+    class iterator {
+      public:
+        iterator(const ChContactPool* pool, size_t index) : m_pool(pool), m_index(index) {}
+        Tcont* operator*() const { return (*m_pool)[m_index]; }
+        iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+      private:
+        const ChContactPool* m_pool;
+        size_t m_index;
+    };
+
+    ChContactPool() : m_num_active(0), m_num_constructed(0) {}
+    ChContactPool(const ChContactPool&) = delete;
+    ChContactPool& operator=(const ChContactPool&) = delete;
+    ~ChContactPool() { Clear(); }
+
+    /// Return the number of active contacts.
+    size_t size() const { return m_num_active; }
+
+    /// Return true if there are no active contacts.
+    bool empty() const { return m_num_active == 0; }
+
+    /// Return the number of contact objects currently allocated (active or not).
+    size_t capacity() const { return m_num_constructed; }
+
+    /// Access the active contact with given index.
+    Tcont* operator[](size_t i) const {
+        assert(i < m_num_constructed);
+        return Slot(i);
+    }
+
+    /// Iterators over the active contacts.
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, m_num_active); }
+
+    /// Mark all contacts as inactive. The contact objects are kept for later reuse.
+    void Rewind() { m_num_active = 0; }
+
+    /// Activate and return the next available contact object, or nullptr if a new one must be created (see Emplace).
+    Tcont* Reuse() { return m_num_active < m_num_constructed ? (*this)[m_num_active++] : nullptr; }
+
+    /// Construct a new active contact at the end of the pool, with the given constructor arguments.
+    /// Can only be called when no inactive contact objects are available for reuse.
+    template <typename... Args>
+    Tcont* Emplace(Args&&... args) {
+        assert(m_num_active == m_num_constructed);
+        if (m_num_constructed == m_blocks.size() * BLOCK_SIZE)
+            m_blocks.push_back(std::unique_ptr<Block>(new Block));
+        Tcont* contact = new (Slot(m_num_constructed)) Tcont(std::forward<Args>(args)...);
+        m_num_constructed++;
+        m_num_active++;
+        return contact;
+    }
+
+    /// Release inactive contact objects and memory blocks if they are more than the active ones.
+    /// One block of inactive contact objects is always kept, to limit reallocations when the number of contacts
+    /// oscillates.
+    void Trim() {
+        if (m_num_constructed <= 2 * m_num_active + BLOCK_SIZE)
+            return;
+        size_t num_blocks = (m_num_active + BLOCK_SIZE - 1) / BLOCK_SIZE + 1;
+        if (num_blocks >= m_blocks.size())
+            return;
+        Release(num_blocks * BLOCK_SIZE);
+        m_blocks.resize(num_blocks);
+    }
+
+    /// Destroy all contact objects and release all memory.
+    void Clear() {
+        Release(0);
+        m_blocks.clear();
+        m_num_active = 0;
+    }
+
+  private:
+    struct Block {
+        alignas(Tcont) unsigned char data[BLOCK_SIZE * sizeof(Tcont)];
+    };
+
+    /// Return the address of the given slot in the memory blocks.
+    Tcont* Slot(size_t i) const { return reinterpret_cast<Tcont*>(m_blocks[i / BLOCK_SIZE]->data) + (i % BLOCK_SIZE); }
+
+    /// Destroy all contact objects with index larger than or equal to the given one.
+    void Release(size_t first) {
+        while (m_num_constructed > first) {
+            m_num_constructed--;
+            Slot(m_num_constructed)->~Tcont();
+        }
+    }
+
+    std::vector<std::unique_ptr<Block>> m_blocks;  ///< memory blocks
+    size_t m_num_active;                           ///< number of active contacts
+    size_t m_num_constructed;                      ///< number of constructed contact objects
+};
+
+template <class Tcont>
+const size_t ChContactPool<Tcont>::BLOCK_SIZE;
+
+/// @} chrono_physics
+
+}  // end namespace chrono
+
+#endif
@@ -37,8 +37,68 @@
 namespace chrono {
 
 /// Default implementation of the SMC normal and tangential force calculation.
+/// Forces are evaluated in batches of contacts, with the contact data stored as one array per quantity, so that the
+/// loops over the contacts in a batch can be vectorized by the compiler. The calculation for a single contact uses a
+/// batch of size one and therefore produces identical results.
 class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueSMC {
   public:
+    /// Maximum number of contacts in a batch.
+    static const int BATCH_SIZE = 64;
+
+    /// Data for a batch of contacts, one array per quantity.
+    struct ContactBatch {
+        int size;                                ///< number of contacts in the batch
+        double delta[BATCH_SIZE];                ///< overlap in normal direction
+        double eff_radius[BATCH_SIZE];           ///< effective radius of curvature at contact
+        double eff_mass[BATCH_SIZE];             ///< effective mass of the contact pair
+        double normal[3][BATCH_SIZE];            ///< normal contact direction (expressed in global frame)
+        double relvel[3][BATCH_SIZE];            ///< relative velocity of contact points, vel2 - vel1
+        float E_eff[BATCH_SIZE];                 ///< effective elasticity modulus
+        float G_eff[BATCH_SIZE];                 ///< effective shear modulus
+        float mu_eff[BATCH_SIZE];                ///< effective coefficient of friction
+        float cr_eff[BATCH_SIZE];                ///< effective coefficient of restitution
+        float adhesion_eff[BATCH_SIZE];          ///< effective cohesion force
+        float adhesionMultDMT_eff[BATCH_SIZE];   ///< effective adhesion multiplier (DMT model)
+        float kn[BATCH_SIZE];                    ///< normal stiffness coefficient
+        float kt[BATCH_SIZE];                    ///< tangential stiffness coefficient
+        float gn[BATCH_SIZE];                    ///< normal viscous damping coefficient
+        float gt[BATCH_SIZE];                    ///< tangential viscous damping coefficient
+        double force[3][BATCH_SIZE];             ///< output contact force on obj2 (expressed in global frame)
+
+        /// Set the data of the i-th contact in the batch.
+        void Set(int i,
+                 double delta_i,
+                 double eff_radius_i,
+                 double mass1,
+                 double mass2,
+                 const ChVector3d& normal_dir,
+                 const ChVector3d& vel1,
+                 const ChVector3d& vel2,
+                 const ChContactMaterialCompositeSMC& mat) {
+            ChVector3d rel_vel = vel2 - vel1;
+            delta[i] = delta_i;
+            eff_radius[i] = eff_radius_i;
+            eff_mass[i] = mass1 * mass2 / (mass1 + mass2);
+            for (int k = 0; k < 3; k++) {
+                normal[k][i] = normal_dir[k];
+                relvel[k][i] = rel_vel[k];
+            }
+            E_eff[i] = mat.E_eff;
+            G_eff[i] = mat.G_eff;
+            mu_eff[i] = mat.mu_eff;
+            cr_eff[i] = mat.cr_eff;
+            adhesion_eff[i] = mat.adhesion_eff;
+            adhesionMultDMT_eff[i] = mat.adhesionMultDMT_eff;
+            kn[i] = mat.kn;
+            kt[i] = mat.kt;
+            gn[i] = mat.gn;
+            gt[i] = mat.gt;
+        }
+
+        /// Get the contact force of the i-th contact in the batch.
+        ChVector3d GetForce(int i) const { return ChVector3d(force[0][i], force[1][i], force[2][i]); }
+    };
+
     /// Default SMC force calculation algorithm.
     /// This implementation depends on various settings specified at the ChSystemSMC level (such as normal force model,
     /// tangential force model, use of material physical properties, etc).
@@ -62,31 +122,49 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
             return {VNULL, VNULL};
         }
 
+        ContactBatch batch;
+        batch.size = 1;
+        batch.Set(0, delta, eff_radius, mass1, mass2, normal_dir, vel1, vel2, mat);
+        CalculateForces(sys, batch);
+
+        return {batch.GetForce(0), VNULL};  // zero torque anyway
+    }
+
+    /// Calculate the contact forces for a batch of contacts.
+    /// The force model is selected once for the entire batch; the loops over the contacts have no data dependencies.
+    void CalculateForces(const ChSystemSMC& sys, ContactBatch& batch) const {
+        const int n = batch.size;
+
         // Extract parameters from containing system
         double dT = sys.GetStep();
         bool use_mat_props = sys.UsingMaterialProperties();
         ChSystemSMC::ContactForceModel contact_model = sys.GetContactForceModel();
         ChSystemSMC::AdhesionForceModel adhesion_model = sys.GetAdhesionForceModel();
         ChSystemSMC::TangentialDisplacementModel tdispl_model = sys.GetTangentialDisplacementModel();
-
-        // Relative velocity at contact
-        ChVector3d relvel = vel2 - vel1;
-        double relvel_n_mag = relvel.Dot(normal_dir);
-        ChVector3d relvel_n = relvel_n_mag * normal_dir;
-        ChVector3d relvel_t = relvel - relvel_n;
-        double relvel_t_mag = relvel_t.Length();
-
-        // Calculate effective mass
-        double eff_mass = mass1 * mass2 / (mass1 + mass2);
+        double slip_threshold = sys.GetSlipVelocityThreshold();
+
+        // Normal and tangential components of the relative velocity at contact
+        double relvel_n_mag[BATCH_SIZE];
+        double relvel_t[3][BATCH_SIZE];
+        double relvel_t_mag[BATCH_SIZE];
+        for (int i = 0; i < n; i++) {
+            relvel_n_mag[i] = (batch.relvel[0][i] * batch.normal[0][i]) + (batch.relvel[1][i] * batch.normal[1][i]) +
+                              (batch.relvel[2][i] * batch.normal[2][i]);
+            relvel_t[0][i] = batch.relvel[0][i] - relvel_n_mag[i] * batch.normal[0][i];
+            relvel_t[1][i] = batch.relvel[1][i] - relvel_n_mag[i] * batch.normal[1][i];
+            relvel_t[2][i] = batch.relvel[2][i] - relvel_n_mag[i] * batch.normal[2][i];
+            relvel_t_mag[i] = std::sqrt((relvel_t[0][i] * relvel_t[0][i]) + (relvel_t[1][i] * relvel_t[1][i]) +
+                                        (relvel_t[2][i] * relvel_t[2][i]));
+        }
 
         // Calculate stiffness and viscous damping coefficients.
         // All models use the following formulas for normal and tangential forces:
         //     Fn = kn * delta_n - gn * v_n
         //     Ft = kt * delta_t - gt * v_t
-        double kn = 0;
-        double kt = 0;
-        double gn = 0;
-        double gt = 0;
+        double kn[BATCH_SIZE];
+        double kt[BATCH_SIZE];
+        double gn[BATCH_SIZE];
+        double gt[BATCH_SIZE];
 
         constexpr double eps = std::numeric_limits<double>::epsilon();
 
@@ -95,131 +173,149 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
                 // Currently not implemented.  Fall through to Hooke.
             case ChSystemSMC::Hooke:
                 if (use_mat_props) {
-                    double tmp_k = (16.0 / 15) * std::sqrt(eff_radius) * mat.E_eff;
                     double v2 = sys.GetCharacteristicImpactVelocity() * sys.GetCharacteristicImpactVelocity();
-                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
-                    loge = (mat.cr_eff > 1 - eps) ? std::log(1 - eps) : loge;
-                    double tmp_g = 1 + std::pow(CH_PI / loge, 2);
-                    kn = tmp_k * std::pow(eff_mass * v2 / tmp_k, 1.0 / 5);
-                    kt = kn;
-                    gn = std::sqrt(4 * eff_mass * kn / tmp_g);
-                    gt = gn;
+                    for (int i = 0; i < n; i++) {
+                        double tmp_k = (16.0 / 15) * std::sqrt(batch.eff_radius[i]) * batch.E_eff[i];
+                        double loge = (batch.cr_eff[i] < eps) ? std::log(eps) : std::log(batch.cr_eff[i]);
+                        loge = (batch.cr_eff[i] > 1 - eps) ? std::log(1 - eps) : loge;
+                        double tmp_g = 1 + std::pow(CH_PI / loge, 2);
+                        kn[i] = tmp_k * std::pow(batch.eff_mass[i] * v2 / tmp_k, 1.0 / 5);
+                        kt[i] = kn[i];
+                        gn[i] = std::sqrt(4 * batch.eff_mass[i] * kn[i] / tmp_g);
+                        gt[i] = gn[i];
+                    }
                 } else {
-                    kn = mat.kn;
-                    kt = mat.kt;
-                    gn = eff_mass * mat.gn;
-                    gt = eff_mass * mat.gt;
+                    for (int i = 0; i < n; i++) {
+                        kn[i] = batch.kn[i];
+                        kt[i] = batch.kt[i];
+                        gn[i] = batch.eff_mass[i] * batch.gn[i];
+                        gt[i] = batch.eff_mass[i] * batch.gt[i];
+                    }
                 }
 
                 break;
 
             case ChSystemSMC::Hertz:
                 if (use_mat_props) {
-                    double sqrt_Rd = std::sqrt(eff_radius * delta);
-                    double Sn = 2 * mat.E_eff * sqrt_Rd;
-                    double St = 8 * mat.G_eff * sqrt_Rd;
-                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
-                    double beta = loge / std::sqrt(loge * loge + CH_PI * CH_PI);
-                    kn = (2.0 / 3) * Sn;
-                    kt = St;
-                    gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
-                    gt = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(St * eff_mass);
+                    for (int i = 0; i < n; i++) {
+                        double sqrt_Rd = std::sqrt(batch.eff_radius[i] * batch.delta[i]);
+                        double Sn = 2 * batch.E_eff[i] * sqrt_Rd;
+                        double St = 8 * batch.G_eff[i] * sqrt_Rd;
+                        double loge = (batch.cr_eff[i] < eps) ? std::log(eps) : std::log(batch.cr_eff[i]);
+                        double beta = loge / std::sqrt(loge * loge + CH_PI * CH_PI);
+                        kn[i] = (2.0 / 3) * Sn;
+                        kt[i] = St;
+                        gn[i] = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * batch.eff_mass[i]);
+                        gt[i] = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(St * batch.eff_mass[i]);
+                    }
                 } else {
-                    double tmp = eff_radius * std::sqrt(delta);
-                    kn = tmp * mat.kn;
-                    kt = tmp * mat.kt;
-                    gn = tmp * eff_mass * mat.gn;
-                    gt = tmp * eff_mass * mat.gt;
+                    for (int i = 0; i < n; i++) {
+                        double tmp = batch.eff_radius[i] * std::sqrt(batch.delta[i]);
+                        kn[i] = tmp * batch.kn[i];
+                        kt[i] = tmp * batch.kt[i];
+                        gn[i] = tmp * batch.eff_mass[i] * batch.gn[i];
+                        gt[i] = tmp * batch.eff_mass[i] * batch.gt[i];
+                    }
                 }
 
                 break;
 
             case ChSystemSMC::PlainCoulomb:
                 if (use_mat_props) {
-                    double sqrt_Rd = std::sqrt(delta);
-                    double Sn = 2 * mat.E_eff * sqrt_Rd;
-                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
-                    double beta = loge / std::sqrt(loge * loge + CH_PI * CH_PI);
-                    kn = (2.0 / 3) * Sn;
-                    gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
+                    for (int i = 0; i < n; i++) {
+                        double sqrt_Rd = std::sqrt(batch.delta[i]);
+                        double Sn = 2 * batch.E_eff[i] * sqrt_Rd;
+                        double loge = (batch.cr_eff[i] < eps) ? std::log(eps) : std::log(batch.cr_eff[i]);
+                        double beta = loge / std::sqrt(loge * loge + CH_PI * CH_PI);
+                        kn[i] = (2.0 / 3) * Sn;
+                        gn[i] = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * batch.eff_mass[i]);
+                    }
                 } else {
-                    double tmp = std::sqrt(delta);
-                    kn = tmp * mat.kn;
-                    gn = tmp * mat.gn;
+                    for (int i = 0; i < n; i++) {
+                        double tmp = std::sqrt(batch.delta[i]);
+                        kn[i] = tmp * batch.kn[i];
+                        gn[i] = tmp * batch.gn[i];
+                    }
                 }
 
-                kt = 0;
-                gt = 0;
-
-                {
-                    double forceN = kn * delta - gn * relvel_n_mag;
+                for (int i = 0; i < n; i++) {
+                    double forceN = kn[i] * batch.delta[i] - gn[i] * relvel_n_mag[i];
                     if (forceN < 0)
                         forceN = 0;
-                    double forceT = mat.mu_eff * std::tanh(5.0 * relvel_t_mag) * forceN;
-                    switch (adhesion_model) {
-                        case ChSystemSMC::AdhesionForceModel::Perko:
-                            // Currently not implemented.  Fall through to Constant.
-                        case ChSystemSMC::AdhesionForceModel::Constant:
-                            forceN -= mat.adhesion_eff;
-                            break;
-                        case ChSystemSMC::AdhesionForceModel::DMT:
-                            forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
-                            break;
-                    }
-                    ChVector3d force = forceN * normal_dir;
-                    if (relvel_t_mag >= sys.GetSlipVelocityThreshold())
-                        force -= (forceT / relvel_t_mag) * relvel_t;
-
-                    return {force, VNULL};  // zero torque anyway
+                    double forceT = batch.mu_eff[i] * std::tanh(5.0 * relvel_t_mag[i]) * forceN;
+                    forceN -= AdhesionForce(adhesion_model, batch, i);
+                    StoreForce(batch, i, forceN, forceT, relvel_t, relvel_t_mag[i], slip_threshold);
                 }
-        }
 
-        // Tangential displacement (magnitude)
-        double delta_t = 0;
-        switch (tdispl_model) {
-            case ChSystemSMC::OneStep:
-                delta_t = relvel_t_mag * dT;
-                break;
-            case ChSystemSMC::MultiStep:
-                //// TODO: implement proper MultiStep mode
-                delta_t = relvel_t_mag * dT;
-                break;
-            default:
-                break;
+                return;
         }
 
-        // Calculate the magnitudes of the normal and tangential contact forces
-        double forceN = kn * delta - gn * relvel_n_mag;
-        double forceT = kt * delta_t + gt * relvel_t_mag;
-
-        // If the resulting normal contact force is negative, the two shapes are moving
-        // away from each other so fast that no contact force is generated.
-        if (forceN < 0) {
-            forceN = 0;
-            forceT = 0;
+        for (int i = 0; i < n; i++) {
+            // Tangential displacement (magnitude)
+            double delta_t = 0;
+            switch (tdispl_model) {
+                case ChSystemSMC::OneStep:
+                    delta_t = relvel_t_mag[i] * dT;
+                    break;
+                case ChSystemSMC::MultiStep:
+                    //// TODO: implement proper MultiStep mode
+                    delta_t = relvel_t_mag[i] * dT;
+                    break;
+                default:
+                    break;
+            }
+
+            // Calculate the magnitudes of the normal and tangential contact forces
+            double forceN = kn[i] * batch.delta[i] - gn[i] * relvel_n_mag[i];
+            double forceT = kt[i] * delta_t + gt[i] * relvel_t_mag[i];
+
+            // If the resulting normal contact force is negative, the two shapes are moving
+            // away from each other so fast that no contact force is generated.
+            if (forceN < 0) {
+                forceN = 0;
+                forceT = 0;
+            }
+
+            // Include adhesion force
+            forceN -= AdhesionForce(adhesion_model, batch, i);
+
+            // Coulomb law
+            forceT = std::min<double>(forceT, batch.mu_eff[i] * std::abs(forceN));
+
+            // Accumulate normal and tangential forces
+            StoreForce(batch, i, forceN, forceT, relvel_t, relvel_t_mag[i], slip_threshold);
         }
+    }
 
-        // Include adhesion force
+  private:
+    /// Magnitude of the adhesion force for the i-th contact in the batch.
+    static double AdhesionForce(ChSystemSMC::AdhesionForceModel adhesion_model, const ContactBatch& batch, int i) {
         switch (adhesion_model) {
             case ChSystemSMC::AdhesionForceModel::Perko:
                 // Currently not implemented.  Fall through to Constant.
             case ChSystemSMC::AdhesionForceModel::Constant:
-                forceN -= mat.adhesion_eff;
-                break;
+                return batch.adhesion_eff[i];
             case ChSystemSMC::AdhesionForceModel::DMT:
-                forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
-                break;
+                return batch.adhesionMultDMT_eff[i] * std::sqrt(batch.eff_radius[i]);
         }
+        return 0;
+    }
 
-        // Coulomb law
-        forceT = std::min<double>(forceT, mat.mu_eff * std::abs(forceN));
-
-        // Accumulate normal and tangential forces
-        ChVector3d force = forceN * normal_dir;
-        if (relvel_t_mag >= sys.GetSlipVelocityThreshold())
-            force -= (forceT / relvel_t_mag) * relvel_t;
-
-        return {force, VNULL};  // zero torque anyway
+    /// Store the resultant of the normal and tangential forces for the i-th contact in the batch.
+    static void StoreForce(ContactBatch& batch,
+                           int i,
+                           double forceN,
+                           double forceT,
+                           const double relvel_t[3][BATCH_SIZE],
+                           double relvel_t_mag,
+                           double slip_threshold) {
+        bool slip = relvel_t_mag >= slip_threshold;
+        for (int k = 0; k < 3; k++) {
+            double f = forceN * batch.normal[k][i];
+            if (slip)
+                f -= (forceT / relvel_t_mag) * relvel_t[k][i];
+            batch.force[k][i] = batch.delta[i] > 0 ? f : 0.0;
+        }
     }
 };
 
@@ -238,9 +334,10 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         ChMatrixDynamic<double> m_R;  ///< R = dQ/dv
     };
 
-    ChVector3d m_force;        ///< contact force on objB
-    ChVector3d m_torque;       ///< contact torque on objB
-    ChContactJacobian* m_Jac;  ///< contact Jacobian data
+    ChVector3d m_force;                   ///< contact force on objB
+    ChVector3d m_torque;                  ///< contact torque on objB
+    ChContactMaterialCompositeSMC m_mat;  ///< composite material for contact pair
+    ChContactJacobian* m_Jac;             ///< contact Jacobian data
 
   public:
     ChContactSMC() : m_Jac(NULL) {}
@@ -278,6 +375,8 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     const ChMatrixDynamic<double>* GetJacobianR() const { return m_Jac ? &(m_Jac->m_R) : NULL; }
 
     /// Reinitialize this contact for reuse.
+    /// The contact force is not calculated here, but in a subsequent call to CalculateForces (or to BatchGather and
+    /// BatchScatter); see ChContactContainerSMC::EndAddContact.
     void Reset(Ta* obj_A,                                ///< contactable object A
                Tb* obj_B,                                ///< contactable object B
                const ChCollisionInfo& cinfo,             ///< data for the collision pair
@@ -289,22 +388,34 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Note: cinfo.distance is the same as this->norm_dist.
         assert(cinfo.distance < 0);
 
-        // Calculate contact force.
+        m_mat = mat;
+        m_force = VNULL;
+        m_torque = VNULL;
+    }
+
+    /// Calculate the contact force and, if requested by the system, the contact Jacobians.
+    void CalculateForces() {
         auto wrench =
             CalculateForceTorque(-this->norm_dist,                            // overlap (here, always positive)
                                  this->normal,                                // normal contact direction
                                  this->objA->GetContactPointSpeed(this->p1),  // velocity of contact point on objA
                                  this->objB->GetContactPointSpeed(this->p2),  // velocity of contact point on objB
-                                 mat                                          // composite material for contact pair
+                                 m_mat                                        // composite material for contact pair
             );
-        m_force = wrench.force;
-        m_torque = wrench.torque;
+        SetForceTorque(wrench);
+    }
 
-        // Set up and compute Jacobian matrices.
-        if (static_cast<ChSystemSMC*>(this->container->GetSystem())->IsContactStiff()) {
-            CreateJacobians();
-            CalculateJacobians(mat);
-        }
+    /// Load the data of this contact in the i-th entry of a batch for the default SMC force calculation.
+    void BatchGather(ChDefaultContactForceTorqueSMC::ContactBatch& batch, int i) const {
+        batch.Set(i, -this->norm_dist, this->eff_radius, this->objA->GetContactableMass(),
+                  this->objB->GetContactableMass(), this->normal, this->objA->GetContactPointSpeed(this->p1),
+                  this->objB->GetContactPointSpeed(this->p2), m_mat);
+    }
+
+    /// Set the contact force from the i-th entry of a batch processed with the default SMC force calculation and, if
+    /// requested by the system, calculate the contact Jacobians.
+    void BatchScatter(const ChDefaultContactForceTorqueSMC::ContactBatch& batch, int i) {
+        SetForceTorque({batch.GetForce(i), VNULL});
     }
 
     /// Calculate contact force, and maybe torque too, expressed in absolute coordinates.
@@ -327,6 +438,18 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
             this->objA->GetContactableMass(), this->objB->GetContactableMass(), this->objA, this->objB);
     }
 
+    /// Set the contact force and torque and, if requested by the system, calculate the contact Jacobians.
+    void SetForceTorque(const ChWrenchd& wrench) {
+        m_force = wrench.force;
+        m_torque = wrench.torque;
+
+        // Set up and compute Jacobian matrices.
+        if (static_cast<ChSystemSMC*>(this->container->GetSystem())->IsContactStiff()) {
+            CreateJacobians();
+            CalculateJacobians(m_mat);
+        }
+    }
+
     /// Compute all forces in a contiguous array.
     /// Used in finite-difference Jacobian approximation.
     void CalculateQ(const ChState& stateA_x,                   ///< state positions for objA
@@ -23,6 +23,8 @@
 #include "chrono/physics/ChLoaderUVW.h"
 #include "chrono/physics/ChObject.h"
 
+#include "chrono/core/ChDual.h"
+
 #include "chrono/solver/ChKRMBlock.h"
 #include "chrono/solver/ChSystemDescriptor.h"
 
@@ -238,7 +240,9 @@ class ChApi ChLoadCustom : public ChLoadBase {
 
     /// Compute Jacobian matrices K=-dQ/dx, R=-dQ/dv, and M=-dQ/da.
     /// This default implementation uses finite differences for computing the K, R, M matrices if the load is stiff.
-    /// If possible, a derived class should provide analytical Jacobians.
+    /// If possible, a derived class should provide analytical Jacobians, by overriding this function and loading the
+    /// matrices in GetJacobians(); alternatively, see ChLoadCustomAD for Jacobians computed by automatic
+    /// differentiation.
     virtual void ComputeJacobian(ChState* state_x,      ///< state position to evaluate Jacobians
                                  ChStateDelta* state_w  ///< state speed to evaluate Jacobians
                                  ) override;
@@ -306,7 +310,9 @@ class ChApi ChLoadCustomMultiple : public ChLoadBase {
 
     /// Compute Jacobian matrices K=-dQ/dx, R=-dQ/dv, and M=-dQ/da.
     /// This default implementation uses finite differences for computing the K, R, M matrices if the load is stiff.
-    /// If possible, a derived class should provide analytical Jacobians.
+    /// If possible, a derived class should provide analytical Jacobians, by overriding this function and loading the
+    /// matrices in GetJacobians(); alternatively, see ChLoadCustomAD for Jacobians computed by automatic
+    /// differentiation.
     /// Note: Given that multiple ChLoadable objects are referenced here, sub-matrices of K and R are pasted in (i,j)
     /// block positions that reflect the order in which loadable objects were specified.
     virtual void ComputeJacobian(ChState* state_x,      ///< state position to evaluate Jacobians
@@ -347,6 +353,93 @@ class ChApi ChLoadCustomMultiple : public ChLoadBase {
     virtual ChVectorDynamic<>& GetQ() { return load_Q; }
 };
 
+// -----------------------------------------------------------------------------
+
+/// Custom load with Jacobians computed by forward-mode automatic differentiation.
+/// The base class BASE must be ChLoadCustom or ChLoadCustomMultiple. Instead of ComputeQ, a derived class implements
+/// ComputeDualQ, which evaluates the generalized forces for states given as dual numbers (see ad::ChDual). The Jacobians
+/// K=-dQ/dx and R=-dQ/dv are then obtained exactly from a single evaluation, instead of the 2*n evaluations of ComputeQ
+/// required by finite differences.
+/// The number of differentiation directions N must be at least twice the number of velocity-level coordinates of the
+/// load (e.g., N=24 for a load acting on two bodies); otherwise, Jacobians are computed with finite differences.
+template <class BASE, int N>
+class ChLoadCustomAD : public BASE {
+  public:
+    typedef ad::ChDual<N> Dual;
+
+    using BASE::BASE;
+    virtual ~ChLoadCustomAD() {}
+
+    /// Compute the generalized load Q(x, v), for dual-number states.
+    /// Derivatives with respect to position-level coordinates are relative to increments of the position-level state
+    /// (see LoadStateIncrement), consistent with the definition of K.
+    virtual void ComputeDualQ(const std::vector<Dual>& state_x,  ///< state position to evaluate Q
+                              const std::vector<Dual>& state_w,  ///< state speed to evaluate Q
+                              std::vector<Dual>& Q               ///< resulting generalized load
+                              ) = 0;
+
+    /// Compute the generalized load, by evaluating ComputeDualQ with constant states.
+    /// A derived class may override this function if a cheaper evaluation of Q is available.
+    virtual void ComputeQ(ChState* state_x, ChStateDelta* state_w) override {
+        std::vector<Dual> x(state_x->size());
+        std::vector<Dual> w(state_w->size());
+        std::vector<Dual> Q(this->load_Q.size());
+        for (int i = 0; i < state_x->size(); i++)
+            x[i] = Dual((*state_x)(i));
+        for (int i = 0; i < state_w->size(); i++)
+            w[i] = Dual((*state_w)(i));
+        ComputeDualQ(x, w, Q);
+        for (int i = 0; i < this->load_Q.size(); i++)
+            this->load_Q(i) = Q[i].value();
+    }
+
+    /// Compute the Jacobian matrices K=-dQ/dx and R=-dQ/dv (and Q) with a single evaluation of ComputeDualQ.
+    virtual void ComputeJacobian(ChState* state_x, ChStateDelta* state_w) override {
+        int nx = this->LoadGetNumCoordsPosLevel();
+        int nw = this->LoadGetNumCoordsVelLevel();
+        if (2 * nw > N) {
+            BASE::ComputeJacobian(state_x, state_w);
+            return;
+        }
+
+        // Tangent of the state increment map x_new(dw) at dw=0 (e.g., identity for plain coordinates).
+        // Computed with central differences of LoadStateIncrement, which do not require evaluations of Q.
+        const double h = 1e-6;
+        ChMatrixDynamic<> T(nx, nw);
+        ChState x_plus(nx, nullptr);
+        ChState x_minus(nx, nullptr);
+        ChStateDelta dw(nw, nullptr);
+        dw.setZero(nw, nullptr);
+        for (int j = 0; j < nw; j++) {
+            dw(j) = h;
+            this->LoadStateIncrement(*state_x, dw, x_plus);
+            dw(j) = -h;
+            this->LoadStateIncrement(*state_x, dw, x_minus);
+            dw(j) = 0;
+            T.col(j) = (x_plus - x_minus) / (2 * h);
+        }
+
+        // Seed the dual states: directions 0..nw-1 for position increments, nw..2*nw-1 for speeds
+        std::vector<Dual> x(nx);
+        std::vector<Dual> w(nw);
+        std::vector<Dual> Q(nw);
+        for (int i = 0; i < nx; i++) {
+            x[i] = Dual((*state_x)(i));
+            x[i].grad().head(nw) = T.row(i).transpose();
+        }
+        for (int i = 0; i < nw; i++)
+            w[i] = Dual::Variable((*state_w)(i), nw + i);
+
+        ComputeDualQ(x, w, Q);
+
+        for (int i = 0; i < nw; i++) {
+            this->load_Q(i) = Q[i].value();
+            this->m_jacobians->K.row(i) = -Q[i].grad().head(nw).transpose();
+            this->m_jacobians->R.row(i) = -Q[i].grad().segment(nw, nw).transpose();
+        }
+    }
+};
+
 }  // end namespace chrono
 
 #endif
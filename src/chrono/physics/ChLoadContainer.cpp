@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChSystem.h"
 
 namespace chrono {
 
@@ -21,6 +22,7 @@ CH_FACTORY_REGISTER(ChLoadContainer)
 
 ChLoadContainer::ChLoadContainer(const ChLoadContainer& other) : ChPhysicsItem(other) {
     loadlist = other.loadlist;
+    m_parallel_update = other.m_parallel_update;
 }
 
 void ChLoadContainer::Add(std::shared_ptr<ChLoadBase> newload) {
@@ -34,7 +36,10 @@ void ChLoadContainer::Add(std::shared_ptr<ChLoadBase> newload) {
 }
 
 void ChLoadContainer::Update(double mytime, bool update_assets) {
-    for (size_t i = 0; i < loadlist.size(); ++i) {
+    int nthreads = (m_parallel_update && system) ? system->GetNumThreadsChrono() : 1;
+
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+    for (int i = 0; i < (int)loadlist.size(); ++i) {
         loadlist[i]->Update(mytime);
     }
     // Overloading of base class:
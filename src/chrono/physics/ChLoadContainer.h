@@ -25,7 +25,7 @@ namespace chrono {
 /// container, then  the container is added to a ChSystem.
 class ChApi ChLoadContainer : public ChPhysicsItem {
   public:
-    ChLoadContainer() {}
+    ChLoadContainer() : m_parallel_update(false) {}
     ChLoadContainer(const ChLoadContainer& other);
     ~ChLoadContainer() {}
 
@@ -41,6 +41,12 @@ class ChApi ChLoadContainer : public ChPhysicsItem {
     /// Return the number of loads in this container.
     size_t GetNumLoads() const { return loadlist.size(); }
 
+    /// Enable parallel update of the loads in this container (default: false).
+    /// If enabled, the generalized forces and Jacobians (e.g., with finite differences) of different loads are
+    /// computed concurrently, using the number of Chrono threads set for the containing system. Only enable if the
+    /// ComputeQ implementations of all loads in this container are thread-safe.
+    void EnableParallelUpdate(bool val) { m_parallel_update = val; }
+
     virtual void Setup() override {}
 
     virtual void Update(double mytime, bool update_assets = true) override;
@@ -78,6 +84,7 @@ class ChApi ChLoadContainer : public ChPhysicsItem {
 
   private:
     std::vector<std::shared_ptr<ChLoadBase> > loadlist;
+    bool m_parallel_update;
 };
 
 CH_CLASS_VERSION(ChLoadContainer, 0)
@@ -0,0 +1,704 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include "chrono/physics/ChParticleCloudSoA.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/collision/ChCollisionSystem.h"
+
+namespace chrono {
+
+// Minimum number of particles for multithreaded loops
+static const int MIN_PARALLEL_PARTICLES = 1024;
+
+// -----------------------------------------------------------------------------
+// Particle contactable
+// -----------------------------------------------------------------------------
+
+ChParticleCloudSoA::Particle::Particle(ChParticleCloudSoA* cloud, unsigned int index)
+    : m_cloud(cloud), m_index(index) {
+    m_variables.SetSharedMass(&cloud->m_mass);
+}
+
+ChFrame<> ChParticleCloudSoA::Particle::GetFrame() const {
+    return ChFrame<>(m_cloud->GetParticlePos(m_index), m_cloud->GetParticleRot(m_index));
+}
+
+void ChParticleCloudSoA::Particle::ContactableGetStateBlockPosLevel(ChState& x) {
+    x.segment(0, 3) = m_cloud->GetParticlePos(m_index).eigen();
+    x.segment(3, 4) = m_cloud->GetParticleRot(m_index).eigen();
+}
+
+void ChParticleCloudSoA::Particle::ContactableGetStateBlockVelLevel(ChStateDelta& w) {
+    w.segment(0, 3) = m_cloud->GetParticleVel(m_index).eigen();
+    w.segment(3, 3) = m_cloud->GetParticleAngVelLocal(m_index).eigen();
+}
+
+void ChParticleCloudSoA::Particle::ContactableIncrementState(const ChState& x, const ChStateDelta& dw, ChState& x_new) {
+    // Increment position
+    x_new(0) = x(0) + dw(0);
+    x_new(1) = x(1) + dw(1);
+    x_new(2) = x(2) + dw(2);
+
+    // Increment rotation: rot' = delta*rot  (use quaternion for delta rotation)
+    ChQuaternion<> mdeltarot;
+    ChQuaternion<> moldrot(x.segment(3, 4));
+    ChVector3d newwel_abs = GetFrame().GetRotMat() * ChVector3d(dw.segment(3, 3));
+    double mangle = newwel_abs.Length();
+    newwel_abs.Normalize();
+    mdeltarot.SetFromAngleAxis(mangle, newwel_abs);
+    ChQuaternion<> mnewrot = mdeltarot * moldrot;
+    x_new.segment(3, 4) = mnewrot.eigen();
+}
+
+ChVector3d ChParticleCloudSoA::Particle::GetContactPoint(const ChVector3d& loc_point, const ChState& state_x) {
+    ChCoordsys<> csys(state_x.segment(0, 7));
+    return csys.TransformPointLocalToParent(loc_point);
+}
+
+ChVector3d ChParticleCloudSoA::Particle::GetContactPointSpeed(const ChVector3d& loc_point,
+                                                              const ChState& state_x,
+                                                              const ChStateDelta& state_w) {
+    ChCoordsys<> csys(state_x.segment(0, 7));
+    ChVector3d abs_vel(state_w.segment(0, 3));
+    ChVector3d loc_omg(state_w.segment(3, 3));
+    ChVector3d abs_omg = csys.TransformDirectionLocalToParent(loc_omg);
+
+    return abs_vel + Vcross(abs_omg, loc_point);
+}
+
+ChVector3d ChParticleCloudSoA::Particle::GetContactPointSpeed(const ChVector3d& abs_point) {
+    ChFrame<> frame = GetFrame();
+    ChVector3d loc_point = frame.TransformPointParentToLocal(abs_point);
+    ChVector3d loc_omg = m_cloud->GetParticleAngVelLocal(m_index);
+    return m_cloud->GetParticleVel(m_index) + frame.TransformDirectionLocalToParent(Vcross(loc_omg, loc_point));
+}
+
+void ChParticleCloudSoA::Particle::ContactForceLoadResidual_F(const ChVector3d& F,
+                                                              const ChVector3d& T,
+                                                              const ChVector3d& abs_point,
+                                                              ChVectorDynamic<>& R) {
+    ChFrame<> frame = GetFrame();
+    ChVector3d point_loc = frame.TransformPointParentToLocal(abs_point);
+    ChVector3d force_loc = frame.TransformDirectionParentToLocal(F);
+    ChVector3d torque_loc = Vcross(point_loc, force_loc);
+    if (!T.IsNull())
+        torque_loc += frame.TransformDirectionParentToLocal(T);
+    R.segment(m_variables.GetOffset() + 0, 3) += F.eigen();
+    R.segment(m_variables.GetOffset() + 3, 3) += torque_loc.eigen();
+}
+
+void ChParticleCloudSoA::Particle::ContactComputeQ(const ChVector3d& F,
+                                                   const ChVector3d& T,
+                                                   const ChVector3d& point,
+                                                   const ChState& state_x,
+                                                   ChVectorDynamic<>& Q,
+                                                   int offset) {
+    ChCoordsys<> csys(state_x.segment(0, 7));
+    ChVector3d point_loc = csys.TransformPointParentToLocal(point);
+    ChVector3d force_loc = csys.TransformDirectionParentToLocal(F);
+    ChVector3d torque_loc = Vcross(point_loc, force_loc);
+    if (!T.IsNull())
+        torque_loc += csys.TransformDirectionParentToLocal(T);
+    Q.segment(offset + 0, 3) = F.eigen();
+    Q.segment(offset + 3, 3) = torque_loc.eigen();
+}
+
+void ChParticleCloudSoA::Particle::ComputeJacobianForContactPart(
+    const ChVector3d& abs_point,
+    ChMatrix33<>& contact_plane,
+    ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_N,
+    ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_U,
+    ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_V,
+    bool second) {
+    ChFrame<> frame = GetFrame();
+    ChVector3d point_loc = frame.TransformPointParentToLocal(abs_point);
+
+    ChMatrix33<> Jx1 = contact_plane.transpose();
+    if (!second)
+        Jx1 *= -1;
+
+    ChStarMatrix33<> Ps1(point_loc);
+    ChMatrix33<> Jr1 = contact_plane.transpose() * frame.GetRotMat() * Ps1;
+    if (second)
+        Jr1 *= -1;
+
+    jacobian_tuple_N.Get_Cq().segment(0, 3) = Jx1.row(0);
+    jacobian_tuple_U.Get_Cq().segment(0, 3) = Jx1.row(1);
+    jacobian_tuple_V.Get_Cq().segment(0, 3) = Jx1.row(2);
+
+    jacobian_tuple_N.Get_Cq().segment(3, 3) = Jr1.row(0);
+    jacobian_tuple_U.Get_Cq().segment(3, 3) = Jr1.row(1);
+    jacobian_tuple_V.Get_Cq().segment(3, 3) = Jr1.row(2);
+}
+
+void ChParticleCloudSoA::Particle::ComputeJacobianForRollingContactPart(
+    const ChVector3d& abs_point,
+    ChMatrix33<>& contact_plane,
+    ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_N,
+    ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_U,
+    ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_V,
+    bool second) {
+    ChMatrix33<> Jr1 = contact_plane.transpose() * GetFrame().GetRotMat();
+    if (!second)
+        Jr1 *= -1;
+
+    jacobian_tuple_N.Get_Cq().segment(0, 3).setZero();
+    jacobian_tuple_U.Get_Cq().segment(0, 3).setZero();
+    jacobian_tuple_V.Get_Cq().segment(0, 3).setZero();
+    jacobian_tuple_N.Get_Cq().segment(3, 3) = Jr1.row(0);
+    jacobian_tuple_U.Get_Cq().segment(3, 3) = Jr1.row(1);
+    jacobian_tuple_V.Get_Cq().segment(3, 3) = Jr1.row(2);
+}
+
+// -----------------------------------------------------------------------------
+// Particle cloud
+// -----------------------------------------------------------------------------
+
+ChParticleCloudSoA::ChParticleCloudSoA() : m_collision_model(nullptr), m_collide(false), m_fixed(false) {}
+
+ChParticleCloudSoA::ChParticleCloudSoA(const ChParticleCloudSoA& other) : ChPhysicsItem(other) {
+    m_mass = other.m_mass;
+    m_collide = other.m_collide;
+    m_fixed = other.m_fixed;
+
+    if (other.m_collision_model)
+        m_collision_model = chrono_types::make_shared<ChCollisionModel>(*other.m_collision_model);
+
+    Reserve(other.GetNumParticles());
+    for (unsigned int j = 0; j < other.GetNumParticles(); j++) {
+        AddParticle(other.GetParticlePos(j), other.GetParticleRot(j), other.GetParticleVel(j));
+        SetParticleAngVelLocal(j, other.GetParticleAngVelLocal(j));
+        SetParticleForce(j, ChVector3d(other.m_force[0][j], other.m_force[1][j], other.m_force[2][j]));
+        SetParticleTorque(j, ChVector3d(other.m_torque[0][j], other.m_torque[1][j], other.m_torque[2][j]));
+    }
+}
+
+ChParticleCloudSoA::~ChParticleCloudSoA() {}
+
+void ChParticleCloudSoA::SetMass(double mass) {
+    if (mass > 0)
+        m_mass.SetBodyMass(mass);
+}
+
+void ChParticleCloudSoA::SetInertia(const ChMatrix33<>& inertia) {
+    m_mass.SetBodyInertia(inertia);
+}
+
+void ChParticleCloudSoA::SetInertiaXX(const ChVector3d& iner) {
+    ChMatrix33<> inertia = m_mass.GetBodyInertia();
+    inertia(0, 0) = iner.x();
+    inertia(1, 1) = iner.y();
+    inertia(2, 2) = iner.z();
+    m_mass.SetBodyInertia(inertia);
+}
+
+void ChParticleCloudSoA::AddCollisionShape(std::shared_ptr<ChCollisionShape> shape, const ChFrame<>& frame) {
+    if (!m_collision_model)
+        m_collision_model = chrono_types::make_shared<ChCollisionModel>();
+    m_collision_model->AddShape(shape, frame);
+}
+
+void ChParticleCloudSoA::Reserve(size_t num_particles) {
+    for (int i = 0; i < 3; i++) {
+        m_pos[i].reserve(num_particles);
+        m_vel[i].reserve(num_particles);
+        m_omg[i].reserve(num_particles);
+        m_acc[i].reserve(num_particles);
+        m_alpha[i].reserve(num_particles);
+        m_force[i].reserve(num_particles);
+        m_torque[i].reserve(num_particles);
+    }
+    for (int i = 0; i < 4; i++)
+        m_rot[i].reserve(num_particles);
+}
+
+unsigned int ChParticleCloudSoA::AddParticle(const ChVector3d& pos, const ChQuaterniond& rot, const ChVector3d& vel) {
+    auto index = (unsigned int)m_particles.size();
+
+    for (int i = 0; i < 3; i++) {
+        m_pos[i].push_back(pos[i]);
+        m_vel[i].push_back(vel[i]);
+        m_omg[i].push_back(0);
+        m_acc[i].push_back(0);
+        m_alpha[i].push_back(0);
+        m_force[i].push_back(0);
+        m_torque[i].push_back(0);
+    }
+    for (int i = 0; i < 4; i++)
+        m_rot[i].push_back(rot[i]);
+
+    m_particles.emplace_back(this, index);
+
+    if (m_collision_model) {
+        auto model = chrono_types::make_shared<ChCollisionModel>();
+        model->SetShapeTemplate(m_collision_model);
+        model->SetFamilyGroup(m_collision_model->GetFamilyGroup());
+        model->SetFamilyMask(m_collision_model->GetFamilyMask());
+        m_particles.back().AddCollisionModel(model);
+
+        // If collision was already processed for this cloud, add the new model to the collision system
+        if (m_collide && GetSystem()) {
+            auto coll_sys = GetSystem()->GetCollisionSystem();
+            if (coll_sys && coll_sys->IsInitialized())
+                coll_sys->Add(model);
+        }
+    }
+
+    return index;
+}
+
+void ChParticleCloudSoA::SetParticlePos(unsigned int n, const ChVector3d& pos) {
+    for (int i = 0; i < 3; i++)
+        m_pos[i][n] = pos[i];
+}
+
+void ChParticleCloudSoA::SetParticleRot(unsigned int n, const ChQuaterniond& rot) {
+    for (int i = 0; i < 4; i++)
+        m_rot[i][n] = rot[i];
+}
+
+void ChParticleCloudSoA::SetParticleVel(unsigned int n, const ChVector3d& vel) {
+    for (int i = 0; i < 3; i++)
+        m_vel[i][n] = vel[i];
+}
+
+void ChParticleCloudSoA::SetParticleAngVelLocal(unsigned int n, const ChVector3d& omg) {
+    for (int i = 0; i < 3; i++)
+        m_omg[i][n] = omg[i];
+}
+
+void ChParticleCloudSoA::SetParticleForce(unsigned int n, const ChVector3d& force) {
+    for (int i = 0; i < 3; i++)
+        m_force[i][n] = force[i];
+}
+
+void ChParticleCloudSoA::SetParticleTorque(unsigned int n, const ChVector3d& torque) {
+    for (int i = 0; i < 3; i++)
+        m_torque[i][n] = torque[i];
+}
+
+void ChParticleCloudSoA::ForceToRest() {
+    for (int i = 0; i < 3; i++) {
+        std::fill(m_vel[i].begin(), m_vel[i].end(), 0.0);
+        std::fill(m_omg[i].begin(), m_omg[i].end(), 0.0);
+        std::fill(m_acc[i].begin(), m_acc[i].end(), 0.0);
+        std::fill(m_alpha[i].begin(), m_alpha[i].end(), 0.0);
+    }
+}
+
+ChFrame<> ChParticleCloudSoA::GetVisualModelFrame(unsigned int nclone) const {
+    return ChFrame<>(GetParticlePos(nclone), GetParticleRot(nclone));
+}
+
+int ChParticleCloudSoA::GetNumThreads() const {
+    return GetSystem() ? GetSystem()->GetNumThreadsChrono() : 1;
+}
+
+void ChParticleCloudSoA::AddParticleForces(size_t j, const ChVector3d& gravity_force, double c, double* f) const {
+    const auto& I = m_mass.GetBodyInertia();
+    double wx = m_omg[0][j];
+    double wy = m_omg[1][j];
+    double wz = m_omg[2][j];
+
+    // gyroscopic torque: w x (I w)
+    double Iwx = I(0, 0) * wx + I(0, 1) * wy + I(0, 2) * wz;
+    double Iwy = I(1, 0) * wx + I(1, 1) * wy + I(1, 2) * wz;
+    double Iwz = I(2, 0) * wx + I(2, 1) * wy + I(2, 2) * wz;
+
+    f[0] += c * (m_force[0][j] + gravity_force.x());
+    f[1] += c * (m_force[1][j] + gravity_force.y());
+    f[2] += c * (m_force[2][j] + gravity_force.z());
+    f[3] += c * (m_torque[0][j] - (wy * Iwz - wz * Iwy));
+    f[4] += c * (m_torque[1][j] - (wz * Iwx - wx * Iwz));
+    f[5] += c * (m_torque[2][j] - (wx * Iwy - wy * Iwx));
+}
+
+// -----------------------------------------------------------------------------
+// State functions
+// -----------------------------------------------------------------------------
+
+// Note: all loops over particles access only the entries of each particle in the cloud arrays and in the state,
+// residual, and solver vectors, and are therefore executed in parallel.
+
+void ChParticleCloudSoA::IntStateGather(const unsigned int off_x,
+                                        ChState& x,
+                                        const unsigned int off_v,
+                                        ChStateDelta& v,
+                                        double& T) {
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+    double* xp = x.data() + off_x;
+    double* vp = v.data() + off_v;
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        xp[7 * j + 0] = m_pos[0][j];
+        xp[7 * j + 1] = m_pos[1][j];
+        xp[7 * j + 2] = m_pos[2][j];
+        xp[7 * j + 3] = m_rot[0][j];
+        xp[7 * j + 4] = m_rot[1][j];
+        xp[7 * j + 5] = m_rot[2][j];
+        xp[7 * j + 6] = m_rot[3][j];
+        vp[6 * j + 0] = m_vel[0][j];
+        vp[6 * j + 1] = m_vel[1][j];
+        vp[6 * j + 2] = m_vel[2][j];
+        vp[6 * j + 3] = m_omg[0][j];
+        vp[6 * j + 4] = m_omg[1][j];
+        vp[6 * j + 5] = m_omg[2][j];
+    }
+    T = GetChTime();
+}
+
+void ChParticleCloudSoA::IntStateScatter(const unsigned int off_x,
+                                         const ChState& x,
+                                         const unsigned int off_v,
+                                         const ChStateDelta& v,
+                                         const double T,
+                                         bool full_update) {
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+    const double* xp = x.data() + off_x;
+    const double* vp = v.data() + off_v;
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        m_pos[0][j] = xp[7 * j + 0];
+        m_pos[1][j] = xp[7 * j + 1];
+        m_pos[2][j] = xp[7 * j + 2];
+        m_rot[0][j] = xp[7 * j + 3];
+        m_rot[1][j] = xp[7 * j + 4];
+        m_rot[2][j] = xp[7 * j + 5];
+        m_rot[3][j] = xp[7 * j + 6];
+        m_vel[0][j] = vp[6 * j + 0];
+        m_vel[1][j] = vp[6 * j + 1];
+        m_vel[2][j] = vp[6 * j + 2];
+        m_omg[0][j] = vp[6 * j + 3];
+        m_omg[1][j] = vp[6 * j + 4];
+        m_omg[2][j] = vp[6 * j + 5];
+    }
+    Update(T, full_update);
+}
+
+void ChParticleCloudSoA::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+    double* ap = a.data() + off_a;
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        ap[6 * j + 0] = m_acc[0][j];
+        ap[6 * j + 1] = m_acc[1][j];
+        ap[6 * j + 2] = m_acc[2][j];
+        ap[6 * j + 3] = m_alpha[0][j];
+        ap[6 * j + 4] = m_alpha[1][j];
+        ap[6 * j + 5] = m_alpha[2][j];
+    }
+}
+
+void ChParticleCloudSoA::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+    const double* ap = a.data() + off_a;
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        m_acc[0][j] = ap[6 * j + 0];
+        m_acc[1][j] = ap[6 * j + 1];
+        m_acc[2][j] = ap[6 * j + 2];
+        m_alpha[0][j] = ap[6 * j + 3];
+        m_alpha[1][j] = ap[6 * j + 4];
+        m_alpha[2][j] = ap[6 * j + 5];
+    }
+}
+
+void ChParticleCloudSoA::IntStateIncrement(const unsigned int off_x,
+                                           ChState& x_new,
+                                           const ChState& x,
+                                           const unsigned int off_v,
+                                           const ChStateDelta& Dv) {
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        // position
+        x_new(off_x + 7 * j + 0) = x(off_x + 7 * j + 0) + Dv(off_v + 6 * j + 0);
+        x_new(off_x + 7 * j + 1) = x(off_x + 7 * j + 1) + Dv(off_v + 6 * j + 1);
+        x_new(off_x + 7 * j + 2) = x(off_x + 7 * j + 2) + Dv(off_v + 6 * j + 2);
+
+        // rotation: q_new = q_old * Dq_loc
+        ChQuaternion<> q_old(x.segment(off_x + 7 * j + 3, 4));
+        ChQuaternion<> rel_q;
+        rel_q.SetFromRotVec(Dv.segment(off_v + 6 * j + 3, 3));
+        x_new.segment(off_x + 7 * j + 3, 4) = (q_old * rel_q).eigen();
+    }
+}
+
+void ChParticleCloudSoA::IntStateGetIncrement(const unsigned int off_x,
+                                              const ChState& x_new,
+                                              const ChState& x,
+                                              const unsigned int off_v,
+                                              ChStateDelta& Dv) {
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        // position
+        Dv(off_v + 6 * j + 0) = x_new(off_x + 7 * j + 0) - x(off_x + 7 * j + 0);
+        Dv(off_v + 6 * j + 1) = x_new(off_x + 7 * j + 1) - x(off_x + 7 * j + 1);
+        Dv(off_v + 6 * j + 2) = x_new(off_x + 7 * j + 2) - x(off_x + 7 * j + 2);
+
+        // rotation: Dq_loc = q_old^-1 * q_new
+        ChQuaternion<> q_old(x.segment(off_x + 7 * j + 3, 4));
+        ChQuaternion<> q_new(x_new.segment(off_x + 7 * j + 3, 4));
+        ChQuaternion<> rel_q = q_old.GetConjugate() * q_new;
+        Dv.segment(off_v + 6 * j + 3, 3) = rel_q.GetRotVec().eigen();
+    }
+}
+
+void ChParticleCloudSoA::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    ChVector3d Gforce;
+    if (GetSystem())
+        Gforce = GetSystem()->GetGravitationalAcceleration() * m_mass.GetBodyMass();
+
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+    double* Rp = R.data() + off;
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        AddParticleForces(j, Gforce, c, Rp + 6 * j);
+    }
+}
+
+void ChParticleCloudSoA::IntLoadResidual_Mv(const unsigned int off,
+                                            ChVectorDynamic<>& R,
+                                            const ChVectorDynamic<>& w,
+                                            const double c) {
+    const double cm = c * m_mass.GetBodyMass();
+    const ChMatrix33<> cI = c * m_mass.GetBodyInertia();
+
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+    double* Rp = R.data() + off;
+    const double* wp = w.data() + off;
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        const double* wj = wp + 6 * j;
+        double* Rj = Rp + 6 * j;
+        Rj[0] += cm * wj[0];
+        Rj[1] += cm * wj[1];
+        Rj[2] += cm * wj[2];
+        Rj[3] += cI(0, 0) * wj[3] + cI(0, 1) * wj[4] + cI(0, 2) * wj[5];
+        Rj[4] += cI(1, 0) * wj[3] + cI(1, 1) * wj[4] + cI(1, 2) * wj[5];
+        Rj[5] += cI(2, 0) * wj[3] + cI(2, 1) * wj[4] + cI(2, 2) * wj[5];
+    }
+}
+
+void ChParticleCloudSoA::IntLoadLumpedMass_Md(const unsigned int off,
+                                              ChVectorDynamic<>& Md,
+                                              double& err,
+                                              const double c) {
+    const auto& I = m_mass.GetBodyInertia();
+    const double cm = c * m_mass.GetBodyMass();
+
+    int n = (int)m_particles.size();
+    double* Mp = Md.data() + off;
+    for (int j = 0; j < n; j++) {
+        Mp[6 * j + 0] += cm;
+        Mp[6 * j + 1] += cm;
+        Mp[6 * j + 2] += cm;
+        Mp[6 * j + 3] += c * I(0, 0);
+        Mp[6 * j + 4] += c * I(1, 1);
+        Mp[6 * j + 5] += c * I(2, 2);
+    }
+
+    // if there is off-diagonal inertia, add to error, as lumping can give inconsistent results
+    err += n * (I(0, 1) + I(0, 2) + I(1, 2));
+}
+
+void ChParticleCloudSoA::IntToDescriptor(const unsigned int off_v,
+                                         const ChStateDelta& v,
+                                         const ChVectorDynamic<>& R,
+                                         const unsigned int off_L,
+                                         const ChVectorDynamic<>& L,
+                                         const ChVectorDynamic<>& Qc) {
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        m_particles[j].m_variables.State() = v.segment(off_v + 6 * j, 6);
+        m_particles[j].m_variables.Force() = R.segment(off_v + 6 * j, 6);
+    }
+}
+
+void ChParticleCloudSoA::IntFromDescriptor(const unsigned int off_v,
+                                           ChStateDelta& v,
+                                           const unsigned int off_L,
+                                           ChVectorDynamic<>& L) {
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        v.segment(off_v + 6 * j, 6) = m_particles[j].m_variables.State();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Solver functions
+// -----------------------------------------------------------------------------
+
+void ChParticleCloudSoA::InjectVariables(ChSystemDescriptor& descriptor) {
+    for (auto& particle : m_particles) {
+        particle.m_variables.SetDisabled(!IsActive());
+        descriptor.InsertVariables(&particle.m_variables);
+    }
+}
+
+void ChParticleCloudSoA::VariablesFbReset() {
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        m_particles[j].m_variables.Force().setZero();
+    }
+}
+
+void ChParticleCloudSoA::VariablesFbLoadForces(double factor) {
+    ChVector3d Gforce;
+    if (GetSystem())
+        Gforce = GetSystem()->GetGravitationalAcceleration() * m_mass.GetBodyMass();
+
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        AddParticleForces(j, Gforce, factor, m_particles[j].m_variables.Force().data());
+    }
+}
+
+void ChParticleCloudSoA::VariablesQbLoadSpeed() {
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        auto qb = m_particles[j].m_variables.State();
+        qb(0) = m_vel[0][j];
+        qb(1) = m_vel[1][j];
+        qb(2) = m_vel[2][j];
+        qb(3) = m_omg[0][j];
+        qb(4) = m_omg[1][j];
+        qb(5) = m_omg[2][j];
+    }
+}
+
+void ChParticleCloudSoA::VariablesFbIncrementMq() {
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        auto& variables = m_particles[j].m_variables;
+        variables.AddMassTimesVector(variables.Force(), variables.State());
+    }
+}
+
+void ChParticleCloudSoA::VariablesQbSetSpeed(double step) {
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        auto qb = m_particles[j].m_variables.State();
+        for (int i = 0; i < 3; i++) {
+            // compute accelerations by BDF (approximate by differentiation)
+            if (step) {
+                m_acc[i][j] = (qb(i) - m_vel[i][j]) / step;
+                m_alpha[i][j] = (qb(3 + i) - m_omg[i][j]) / step;
+            }
+            m_vel[i][j] = qb(i);
+            m_omg[i][j] = qb(3 + i);
+        }
+    }
+}
+
+void ChParticleCloudSoA::VariablesQbIncrementPosition(double step) {
+    if (!IsActive())
+        return;
+
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        auto qb = m_particles[j].m_variables.State();
+
+        // advance position: pos' = pos + dt * vel
+        m_pos[0][j] += qb(0) * step;
+        m_pos[1][j] += qb(1) * step;
+        m_pos[2][j] += qb(2) * step;
+
+        // advance rotation: q' = q * Dq_loc, with Dq_loc the rotation by dt * w_loc
+        ChQuaternion<> rel_q;
+        rel_q.SetFromRotVec(ChVector3d(qb.segment(3, 3)) * step);
+        SetParticleRot(j, GetParticleRot(j) * rel_q);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Collision functions
+// -----------------------------------------------------------------------------
+
+void ChParticleCloudSoA::EnableCollision(bool state) {
+    // Nothing to do if no change in state
+    if (state == m_collide)
+        return;
+
+    m_collide = state;
+
+    // Nothing to do if no collision model, not attached to a system, or the collision system was not initialized
+    // (in the latter case, the collision models will be processed at initialization)
+    if (!m_collision_model || !GetSystem())
+        return;
+    auto coll_sys = GetSystem()->GetCollisionSystem();
+    if (!coll_sys || !coll_sys->IsInitialized())
+        return;
+
+    for (auto& particle : m_particles) {
+        if (m_collide)
+            coll_sys->Add(particle.GetCollisionModel());
+        else
+            coll_sys->Remove(particle.GetCollisionModel());
+    }
+}
+
+void ChParticleCloudSoA::AddCollisionModelsToSystem(ChCollisionSystem* coll_sys) const {
+    if (m_collide && m_collision_model) {
+        for (const auto& particle : m_particles)
+            coll_sys->Add(particle.GetCollisionModel());
+    }
+}
+
+void ChParticleCloudSoA::RemoveCollisionModelsFromSystem(ChCollisionSystem* coll_sys) const {
+    if (m_collision_model) {
+        for (const auto& particle : m_particles)
+            coll_sys->Remove(particle.GetCollisionModel());
+    }
+}
+
+void ChParticleCloudSoA::SyncCollisionModels() {
+    if (!m_collision_model)
+        return;
+
+    // Each collision model only updates its own position and bounding box
+    int n = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+#pragma omp parallel for num_threads(nthreads) if (n >= MIN_PARALLEL_PARTICLES)
+    for (int j = 0; j < n; j++) {
+        m_particles[j].GetCollisionModel()->SyncPosition();
+    }
+}
+
+}  // end namespace chrono
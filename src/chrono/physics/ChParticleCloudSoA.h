@@ -0,0 +1,313 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CH_PARTICLE_CLOUD_SOA_H
+#define CH_PARTICLE_CLOUD_SOA_H
+
+#include <deque>
+#include <vector>
+
+#include "chrono/collision/ChCollisionModel.h"
+#include "chrono/physics/ChContactable.h"
+#include "chrono/physics/ChPhysicsItem.h"
+#include "chrono/solver/ChVariablesBodySharedMass.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_physics
+/// @{
+
+/// Cloud of rigid particles with the same mass, inertia, and collision shapes, using a structure-of-arrays layout.
+/// Unlike ChParticleCloud, the particle states (positions, rotations, velocities, accelerations, and applied forces)
+/// are stored in separate contiguous arrays, one per component, which are processed with simple (vectorizable and
+/// multithreaded) loops in the state and residual functions. All particles use the same collision model "template"
+/// (see ChCollisionModel::SetShapeTemplate), so that collision systems which support it (e.g., Bullet) create the
+/// collision geometry only once for the entire cloud.
+/// Each particle is represented in the contact and solver machinery by a lightweight Particle object (a contactable
+/// with its own solver variables) which refers to the arrays of the cloud. A particle cloud can therefore be used in
+/// any ChSystemNSC or ChSystemSMC, with any collision system.
+class ChApi ChParticleCloudSoA : public ChPhysicsItem {
+  public:
+    /// Contactable object representing a single particle in the cloud.
+    class ChApi Particle : public ChContactable_1vars<6> {
+      public:
+        Particle(ChParticleCloudSoA* cloud, unsigned int index);
+
+        /// Return the cloud of this particle.
+        ChParticleCloudSoA* GetCloud() const { return m_cloud; }
+
+        /// Return the index of this particle in its cloud.
+        unsigned int GetIndex() const { return m_index; }
+
+        /// Return the particle frame (expressed in the absolute frame).
+        ChFrame<> GetFrame() const;
+
+        /// Access the solver variables of this particle.
+        ChVariablesBodySharedMass& Variables() { return m_variables; }
+
+        // INTERFACE TO ChContactable
+
+        virtual ChContactable::eChContactableType GetContactableType() const override { return CONTACTABLE_6; }
+        virtual ChVariables* GetVariables1() override { return &m_variables; }
+        virtual bool IsContactActive() override { return true; }
+        virtual int GetContactableNumCoordsPosLevel() override { return 7; }
+        virtual int GetContactableNumCoordsVelLevel() override { return 6; }
+        virtual void ContactableGetStateBlockPosLevel(ChState& x) override;
+        virtual void ContactableGetStateBlockVelLevel(ChStateDelta& w) override;
+        virtual void ContactableIncrementState(const ChState& x, const ChStateDelta& dw, ChState& x_new) override;
+        virtual ChVector3d GetContactPoint(const ChVector3d& loc_point, const ChState& state_x) override;
+        virtual ChVector3d GetContactPointSpeed(const ChVector3d& loc_point,
+                                                const ChState& state_x,
+                                                const ChStateDelta& state_w) override;
+        virtual ChVector3d GetContactPointSpeed(const ChVector3d& abs_point) override;
+        virtual ChFrame<> GetCollisionModelFrame() override { return GetFrame(); }
+        virtual void ContactForceLoadResidual_F(const ChVector3d& F,
+                                                const ChVector3d& T,
+                                                const ChVector3d& abs_point,
+                                                ChVectorDynamic<>& R) override;
+        virtual void ContactComputeQ(const ChVector3d& F,
+                                     const ChVector3d& T,
+                                     const ChVector3d& point,
+                                     const ChState& state_x,
+                                     ChVectorDynamic<>& Q,
+                                     int offset) override;
+        virtual void ComputeJacobianForContactPart(
+            const ChVector3d& abs_point,
+            ChMatrix33<>& contact_plane,
+            ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_N,
+            ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_U,
+            ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_V,
+            bool second) override;
+        virtual void ComputeJacobianForRollingContactPart(
+            const ChVector3d& abs_point,
+            ChMatrix33<>& contact_plane,
+            ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_N,
+            ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_U,
+            ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_V,
+            bool second) override;
+        virtual double GetContactableMass() override { return m_variables.GetBodyMass(); }
+        virtual ChPhysicsItem* GetPhysicsItem() override { return m_cloud; }
+
+      private:
+        ChParticleCloudSoA* m_cloud;            ///< owner cloud
+        unsigned int m_index;                   ///< index in the cloud arrays
+        ChVariablesBodySharedMass m_variables;  ///< solver variables
+
+        friend class ChParticleCloudSoA;
+    };
+
+    ChParticleCloudSoA();
+    ChParticleCloudSoA(const ChParticleCloudSoA& other);
+    ~ChParticleCloudSoA();
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChParticleCloudSoA* Clone() const override { return new ChParticleCloudSoA(*this); }
+
+    /// Set the mass of each particle. Must be positive.
+    void SetMass(double mass);
+
+    /// Get the mass of each particle.
+    double GetMass() const { return m_mass.GetBodyMass(); }
+
+    /// Set the inertia tensor of each particle (expressed in the particle frame).
+    void SetInertia(const ChMatrix33<>& inertia);
+
+    /// Set the diagonal part of the inertia tensor of each particle.
+    void SetInertiaXX(const ChVector3d& iner);
+
+    /// Get the inertia tensor of each particle.
+    const ChMatrix33<>& GetInertia() const { return m_mass.GetBodyInertia(); }
+
+    /// Add a collision shape to the collision model template used by all particles.
+    /// All shapes must be added before the first particle is created.
+    void AddCollisionShape(std::shared_ptr<ChCollisionShape> shape, const ChFrame<>& frame = ChFrame<>());
+
+    /// Get the collision model template used by all particles.
+    std::shared_ptr<ChCollisionModel> GetCollisionModel() const { return m_collision_model; }
+
+    /// Enable/disable the collision for this cloud of particles (default: false).
+    void EnableCollision(bool state);
+
+    virtual bool IsCollisionEnabled() const override { return m_collide; }
+
+    /// Set the state of all particles in the cloud to 'fixed' (default: false).
+    /// If true, the particles do not move.
+    void SetFixed(bool state) { m_fixed = state; }
+
+    /// Return true if the cloud is currently active and therefore included into the system solver.
+    virtual bool IsActive() const override { return !m_fixed; }
+
+    /// Reserve storage for the given number of particles.
+    void Reserve(size_t num_particles);
+
+    /// Add a new particle to the cloud, with specified initial position, rotation, and linear velocity.
+    /// Return the index of the new particle.
+    unsigned int AddParticle(const ChVector3d& pos,
+                             const ChQuaterniond& rot = QUNIT,
+                             const ChVector3d& vel = VNULL);
+
+    /// Get the number of particles.
+    size_t GetNumParticles() const { return m_particles.size(); }
+
+    /// Access the contactable object of the specified particle.
+    Particle& GetParticle(unsigned int n) { return m_particles[n]; }
+
+    /// Get the position of the specified particle.
+    ChVector3d GetParticlePos(unsigned int n) const { return ChVector3d(m_pos[0][n], m_pos[1][n], m_pos[2][n]); }
+
+    /// Get the rotation of the specified particle.
+    ChQuaterniond GetParticleRot(unsigned int n) const {
+        return ChQuaterniond(m_rot[0][n], m_rot[1][n], m_rot[2][n], m_rot[3][n]);
+    }
+
+    /// Get the linear velocity of the specified particle (expressed in the absolute frame).
+    ChVector3d GetParticleVel(unsigned int n) const { return ChVector3d(m_vel[0][n], m_vel[1][n], m_vel[2][n]); }
+
+    /// Get the angular velocity of the specified particle (expressed in the particle frame).
+    ChVector3d GetParticleAngVelLocal(unsigned int n) const {
+        return ChVector3d(m_omg[0][n], m_omg[1][n], m_omg[2][n]);
+    }
+
+    /// Get the linear acceleration of the specified particle (expressed in the absolute frame).
+    ChVector3d GetParticleAcc(unsigned int n) const { return ChVector3d(m_acc[0][n], m_acc[1][n], m_acc[2][n]); }
+
+    /// Set the position of the specified particle.
+    void SetParticlePos(unsigned int n, const ChVector3d& pos);
+
+    /// Set the rotation of the specified particle.
+    void SetParticleRot(unsigned int n, const ChQuaterniond& rot);
+
+    /// Set the linear velocity of the specified particle (expressed in the absolute frame).
+    void SetParticleVel(unsigned int n, const ChVector3d& vel);
+
+    /// Set the angular velocity of the specified particle (expressed in the particle frame).
+    void SetParticleAngVelLocal(unsigned int n, const ChVector3d& omg);
+
+    /// Set an external force on the specified particle (applied at the particle center, in the absolute frame).
+    void SetParticleForce(unsigned int n, const ChVector3d& force);
+
+    /// Set an external torque on the specified particle (expressed in the particle frame).
+    void SetParticleTorque(unsigned int n, const ChVector3d& torque);
+
+    /// Set no speed and no accelerations for all particles (but do not change the positions).
+    void ForceToRest() override;
+
+    /// Get the number of visual model clones (one per particle).
+    virtual unsigned int GetNumVisualModelClones() const override { return (unsigned int)m_particles.size(); }
+
+    /// Get the frame of the visual model of the specified particle.
+    virtual ChFrame<> GetVisualModelFrame(unsigned int nclone = 0) const override;
+
+    /// Number of coordinates of the particle cloud (7 per particle, as quaternions are used for rotation).
+    virtual unsigned int GetNumCoordsPosLevel() override { return 7 * (unsigned int)m_particles.size(); }
+
+    /// Number of coordinates of the particle cloud (6 per particle).
+    virtual unsigned int GetNumCoordsVelLevel() override { return 6 * (unsigned int)m_particles.size(); }
+
+    // STATE FUNCTIONS
+
+    virtual void IntStateGather(const unsigned int off_x,
+                                ChState& x,
+                                const unsigned int off_v,
+                                ChStateDelta& v,
+                                double& T) override;
+    virtual void IntStateScatter(const unsigned int off_x,
+                                 const ChState& x,
+                                 const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const double T,
+                                 bool full_update) override;
+    virtual void IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) override;
+    virtual void IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) override;
+    virtual void IntStateIncrement(const unsigned int off_x,
+                                   ChState& x_new,
+                                   const ChState& x,
+                                   const unsigned int off_v,
+                                   const ChStateDelta& Dv) override;
+    virtual void IntStateGetIncrement(const unsigned int off_x,
+                                      const ChState& x_new,
+                                      const ChState& x,
+                                      const unsigned int off_v,
+                                      ChStateDelta& Dv) override;
+    virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
+    virtual void IntLoadResidual_Mv(const unsigned int off,
+                                    ChVectorDynamic<>& R,
+                                    const ChVectorDynamic<>& w,
+                                    const double c) override;
+    virtual void IntLoadLumpedMass_Md(const unsigned int off,
+                                      ChVectorDynamic<>& Md,
+                                      double& err,
+                                      const double c) override;
+    virtual void IntToDescriptor(const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const ChVectorDynamic<>& R,
+                                 const unsigned int off_L,
+                                 const ChVectorDynamic<>& L,
+                                 const ChVectorDynamic<>& Qc) override;
+    virtual void IntFromDescriptor(const unsigned int off_v,
+                                   ChStateDelta& v,
+                                   const unsigned int off_L,
+                                   ChVectorDynamic<>& L) override;
+
+    // SOLVER FUNCTIONS
+
+    virtual void InjectVariables(ChSystemDescriptor& descriptor) override;
+    virtual void VariablesFbReset() override;
+    virtual void VariablesFbLoadForces(double factor = 1) override;
+    virtual void VariablesQbLoadSpeed() override;
+    virtual void VariablesFbIncrementMq() override;
+    virtual void VariablesQbSetSpeed(double step = 0) override;
+    virtual void VariablesQbIncrementPosition(double step) override;
+
+    // COLLISION FUNCTIONS
+
+    /// Add collision models (if any) for all particles to the provided collision system.
+    virtual void AddCollisionModelsToSystem(ChCollisionSystem* coll_sys) const override;
+
+    /// Remove the collision models (if any) for all particles from the provided collision system.
+    virtual void RemoveCollisionModelsFromSystem(ChCollisionSystem* coll_sys) const override;
+
+    /// Synchronize the position and bounding box of all particle collision models (if any).
+    virtual void SyncCollisionModels() override;
+
+  private:
+    /// Add the generalized forces on particle j (gravity, gyroscopic torque, external force and torque), scaled by c,
+    /// to the 6 values starting at f.
+    void AddParticleForces(size_t j, const ChVector3d& gravity_force, double c, double* f) const;
+
+    /// Return the number of threads for the loops over particles.
+    int GetNumThreads() const;
+
+    std::deque<Particle> m_particles;  ///< particle contactables (stable addresses)
+    ChSharedMassBody m_mass;           ///< shared mass and inertia
+
+    std::vector<double> m_pos[3];     ///< particle positions
+    std::vector<double> m_rot[4];     ///< particle rotations (quaternion components)
+    std::vector<double> m_vel[3];     ///< particle linear velocities (absolute frame)
+    std::vector<double> m_omg[3];     ///< particle angular velocities (local frame)
+    std::vector<double> m_acc[3];     ///< particle linear accelerations (absolute frame)
+    std::vector<double> m_alpha[3];   ///< particle angular accelerations (local frame)
+    std::vector<double> m_force[3];   ///< external forces (absolute frame)
+    std::vector<double> m_torque[3];  ///< external torques (local frame)
+
+    std::shared_ptr<ChCollisionModel> m_collision_model;  ///< collision model template
+    bool m_collide;                                       ///< collision enabled
+    bool m_fixed;                                         ///< particles fixed to ground
+};
+
+/// @} chrono_physics
+
+}  // end namespace chrono
+
+#endif
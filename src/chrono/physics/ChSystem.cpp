@@ -33,6 +33,7 @@
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChMatrix.h"
 #include "chrono/utils/ChProfiler.h"
+#include "chrono/utils/ChTracer.h"
 #include "chrono/physics/ChLinkMate.h"
 
 namespace chrono {
@@ -1029,18 +1030,32 @@ bool ChSystem::StateSolveCorrection(
 
     // If the solver's Setup() must be called or if the solver's Solve() requires it,
     // fill the sparse system structures with information in G and Cq.
-    if (force_setup || GetSolver()->SolveRequiresMatrix()) {
+    bool load_matrix = force_setup || GetSolver()->SolveRequiresMatrix();
+
+    // If the timestepper reuses a Newton matrix factorized at a previous solve, the constraint Jacobians must still be
+    // refreshed, since they are also used in the residual calculations (Cq'*L).
+    bool reuse_matrix = false;
+    if (!force_setup) {
+        auto implicit_stepper = dynamic_cast<ChImplicitIterativeTimestepper*>(timestepper.get());
+        reuse_matrix = implicit_stepper && implicit_stepper->GetJacobianUpdateMethod() !=
+                                               ChImplicitIterativeTimestepper::JacobianUpdate::EVERY_ITERATION;
+    }
+
+    if (load_matrix || reuse_matrix) {
+        CH_TRACE_ZONE("ChSystem::LoadJacobians", "system");
         timer_jacobian.start();
 
         // Cq  matrix
         LoadConstraintJacobians();
 
-        // G matrix: M, K, R components
-        if (c_a || c_v || c_x)
-            LoadKRMMatrices(-c_x, -c_v, c_a);
+        if (load_matrix) {
+            // G matrix: M, K, R components
+            if (c_a || c_v || c_x)
+                LoadKRMMatrices(-c_x, -c_v, c_a);
 
-        // For ChVariable objects without a ChKRMBlock, just use the 'a' coefficient
-        descriptor->SetMassFactor(c_a);
+            // For ChVariable objects without a ChKRMBlock, just use the 'a' coefficient
+            descriptor->SetMassFactor(c_a);
+        }
 
         timer_jacobian.stop();
     }
@@ -1630,6 +1645,9 @@ bool ChSystem::AdvanceDynamics() {
 }
 
 int ChSystem::DoStepDynamics(double step_size) {
+    CH_TRACE_BEGIN_STEP(this, (int64_t)stepcount + 1);  // step counter incremented in AdvanceDynamics
+    CH_TRACE_ZONE("ChSystem::DoStepDynamics", "system");
+
     Initialize();
 
     applied_forces_current = false;
@@ -861,6 +861,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     friend class ChVisualSystem;
     friend class ChCollisionSystem;
+    friend class ChStateCheckpoint;
 
     friend class modal::ChModalAssembly;
 };
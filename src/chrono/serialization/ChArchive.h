@@ -37,6 +37,8 @@ namespace chrono {
 // forward reference
 class ChArchiveOut;
 class ChArchiveIn;
+template <class Real>
+class ChVector3;
 
 /// Macro to create a ChDetect_ArchiveInConstructor that can be used in
 /// templates, to select which specialized template to use
@@ -846,6 +848,27 @@ class ChApi ChArchiveOut : public ChArchive {
     /// For null pointers, always return 'already_stored'=true, and 'obj_ID'=0.
     void PutPointer(void* object, bool& already_stored, size_t& obj_ID);
 
+    /// Write the elements of a contiguous array one at a time (default implementation of out_array_bulk).
+    template <class T>
+    void out_array_elements(ChValue& bVal, const T* data, size_t msize) {
+        for (size_t i = 0; i < msize; ++i) {
+            ChNameValue<T> array_val(std::to_string(i), data[i]);
+            this->out(array_val);
+            this->out_array_between(bVal, msize);
+        }
+    }
+
+    /// Write a std::vector of arithmetic values as a bulk array.
+    template <class T>
+    void out_vector_bulk(ChNameValue<std::vector<T>> bVal) {
+        ChValueSpecific<std::vector<T>> specVal(bVal.value(), bVal.name(), bVal.flags(), bVal.GetCausality(),
+                                                bVal.GetVariability());
+        this->out_array_pre(specVal, bVal.value().size());
+        if (!bVal.value().empty())
+            this->out_array_bulk(specVal, bVal.value().data(), bVal.value().size());
+        this->out_array_end(specVal, bVal.value().size());
+    }
+
   public:
     //---------------------------------------------------
     // INTERFACES - to be implemented by children classes
@@ -888,6 +911,19 @@ class ChApi ChArchiveOut : public ChArchive {
     virtual void out_array_between(ChValue& bVal, size_t msize) = 0;
     virtual void out_array_end(ChValue& bVal, size_t msize) = 0;
 
+    // for contiguous arrays of arithmetic values: write all 'msize' elements of the array started with out_array_pre.
+    // The default implementation writes one element at a time; archives can override these to write a single block.
+    virtual void out_array_bulk(ChValue& bVal, const double* data, size_t msize) {
+        out_array_elements(bVal, data, msize);
+    }
+    virtual void out_array_bulk(ChValue& bVal, const float* data, size_t msize) {
+        out_array_elements(bVal, data, msize);
+    }
+    virtual void out_array_bulk(ChValue& bVal, const int* data, size_t msize) { out_array_elements(bVal, data, msize); }
+    virtual void out_array_bulk(ChValue& bVal, const unsigned int* data, size_t msize) {
+        out_array_elements(bVal, data, msize);
+    }
+
     //---------------------------------------------------
 
     // trick to wrap enum mappers:
@@ -927,6 +963,25 @@ class ChApi ChArchiveOut : public ChArchive {
         this->out_array_end(specVal, bVal.value().size());
     }
 
+    // fast path for std::vector containers of arithmetic values (written as one block, if supported by the archive)
+    void out(ChNameValue<std::vector<double>> bVal) { out_vector_bulk(bVal); }
+    void out(ChNameValue<std::vector<float>> bVal) { out_vector_bulk(bVal); }
+    void out(ChNameValue<std::vector<int>> bVal) { out_vector_bulk(bVal); }
+    void out(ChNameValue<std::vector<unsigned int>> bVal) { out_vector_bulk(bVal); }
+
+    // fast path for std::vector containers of 3D vectors (written as an array of 3*size scalars)
+    template <class Real>
+    void out(ChNameValue<std::vector<ChVector3<Real>>> bVal) {
+        static_assert(sizeof(ChVector3<Real>) == 3 * sizeof(Real), "ChVector3 is not tightly packed");
+        ChValueSpecific<std::vector<ChVector3<Real>>> specVal(bVal.value(), bVal.name(), bVal.flags(),
+                                                              bVal.GetCausality(), bVal.GetVariability());
+        size_t arraysize = 3 * bVal.value().size();
+        this->out_array_pre(specVal, arraysize);
+        if (arraysize > 0)
+            this->out_array_bulk(specVal, bVal.value().data()->data(), arraysize);
+        this->out_array_end(specVal, arraysize);
+    }
+
     // trick to wrap std::list container
     template <class T>
     void out(ChNameValue<std::list<T>> bVal) {
@@ -1147,6 +1202,30 @@ class ChApi ChArchiveIn : public ChArchive {
         internal_id_ptr[obj_ID] = object;
     }
 
+    /// Read the elements of a contiguous array one at a time (default implementation of in_array_bulk).
+    template <class T>
+    void in_array_elements(const std::string& name, T* data, size_t msize) {
+        for (size_t i = 0; i < msize; ++i) {
+            ChNameValue<T> array_val(std::to_string(i), data[i]);
+            this->in(array_val);
+            this->in_array_between(name);
+        }
+    }
+
+    /// Read a std::vector of arithmetic values as a bulk array.
+    template <class T>
+    bool in_vector_bulk(ChNameValue<std::vector<T>> bVal) {
+        bVal.value().clear();
+        size_t arraysize;
+        if (!this->in_array_pre(bVal.name(), arraysize))
+            return false;
+        bVal.value().resize(arraysize);
+        if (arraysize > 0)
+            this->in_array_bulk(bVal.name(), bVal.value().data(), arraysize);
+        this->in_array_end(bVal.name());
+        return true;
+    }
+
   public:
     //---------------------------------------------------
     // INTERFACES - to be implemented by children classes
@@ -1175,6 +1254,21 @@ class ChApi ChArchiveIn : public ChArchive {
     virtual void in_array_between(const std::string& name) = 0;
     virtual void in_array_end(const std::string& name) = 0;
 
+    // for contiguous arrays of arithmetic values: read all 'msize' elements of the array started with in_array_pre.
+    // The default implementation reads one element at a time; archives can override these to read a single block.
+    virtual void in_array_bulk(const std::string& name, double* data, size_t msize) {
+        in_array_elements(name, data, msize);
+    }
+    virtual void in_array_bulk(const std::string& name, float* data, size_t msize) {
+        in_array_elements(name, data, msize);
+    }
+    virtual void in_array_bulk(const std::string& name, int* data, size_t msize) {
+        in_array_elements(name, data, msize);
+    }
+    virtual void in_array_bulk(const std::string& name, unsigned int* data, size_t msize) {
+        in_array_elements(name, data, msize);
+    }
+
     //---------------------------------------------------
 
     // trick to wrap enum mappers:
@@ -1225,6 +1319,31 @@ class ChApi ChArchiveIn : public ChArchive {
         return true;
     }
 
+    // fast path for std::vector containers of arithmetic values (read as one block, if supported by the archive)
+    bool in(ChNameValue<std::vector<double>> bVal) { return in_vector_bulk(bVal); }
+    bool in(ChNameValue<std::vector<float>> bVal) { return in_vector_bulk(bVal); }
+    bool in(ChNameValue<std::vector<int>> bVal) { return in_vector_bulk(bVal); }
+    bool in(ChNameValue<std::vector<unsigned int>> bVal) { return in_vector_bulk(bVal); }
+
+    // fast path for std::vector containers of 3D vectors (read from an array of 3*size scalars)
+    template <class Real>
+    bool in(ChNameValue<std::vector<ChVector3<Real>>> bVal) {
+        static_assert(sizeof(ChVector3<Real>) == 3 * sizeof(Real), "ChVector3 is not tightly packed");
+        bVal.value().clear();
+        size_t arraysize;
+        if (!this->in_array_pre(bVal.name(), arraysize))
+            return false;
+        if (arraysize % 3 != 0) {
+            throw std::runtime_error("Size of saved array " + std::string(bVal.name()) +
+                                     " is not a multiple of 3 (expected 3D vectors).");
+        }
+        bVal.value().resize(arraysize / 3);
+        if (arraysize > 0)
+            this->in_array_bulk(bVal.name(), bVal.value().data()->data(), arraysize);
+        this->in_array_end(bVal.name());
+        return true;
+    }
+
     // trick to wrap std::list container
     template <class T>
     bool in(ChNameValue<std::list<T>> bVal) {
@@ -2,7 +2,15 @@
 
 namespace chrono {
 
-ChArchiveOutBinary::ChArchiveOutBinary(std::ostream& stream_out) : m_ostream(stream_out) {}
+ChArchiveOutBinary::ChArchiveOutBinary(std::ostream& stream_out) : m_ostream(stream_out) {
+    union {
+        int word;
+        unsigned char byte;
+    } endian_test;
+
+    endian_test.word = 1;
+    m_big_endian_machine = (endian_test.byte != 1 ? true : false);
+}
 
 ChArchiveOutBinary::~ChArchiveOutBinary() {}
 
@@ -59,6 +67,22 @@ void ChArchiveOutBinary::out_array_between(ChValue& bVal, size_t size) {}
 
 void ChArchiveOutBinary::out_array_end(ChValue& bVal, size_t size) {}
 
+void ChArchiveOutBinary::out_array_bulk(ChValue& bVal, const double* data, size_t size) {
+    write_array(data, size);
+}
+
+void ChArchiveOutBinary::out_array_bulk(ChValue& bVal, const float* data, size_t size) {
+    write_array(data, size);
+}
+
+void ChArchiveOutBinary::out_array_bulk(ChValue& bVal, const int* data, size_t size) {
+    write_array(data, size);
+}
+
+void ChArchiveOutBinary::out_array_bulk(ChValue& bVal, const unsigned int* data, size_t size) {
+    write_array(data, size);
+}
+
 // for custom c++ objects:
 
 void ChArchiveOutBinary::out(ChValue& bVal, bool tracked, size_t obj_ID) {
@@ -186,6 +210,22 @@ bool ChArchiveInBinary::in_array_pre(const std::string& name, size_t& size) {
     return true;
 }
 
+void ChArchiveInBinary::in_array_bulk(const std::string& name, double* data, size_t size) {
+    read_array(data, size);
+}
+
+void ChArchiveInBinary::in_array_bulk(const std::string& name, float* data, size_t size) {
+    read_array(data, size);
+}
+
+void ChArchiveInBinary::in_array_bulk(const std::string& name, int* data, size_t size) {
+    read_array(data, size);
+}
+
+void ChArchiveInBinary::in_array_bulk(const std::string& name, unsigned int* data, size_t size) {
+    read_array(data, size);
+}
+
 bool ChArchiveInBinary::in_ref(ChNameValue<ChFunctorArchiveIn> bVal, void** ptr, std::string& true_classname) {
     void* new_ptr = nullptr;
 
@@ -13,6 +13,7 @@
 #ifndef CHARCHIVEBINARY_H
 #define CHARCHIVEBINARY_H
 
+#include <algorithm>
 #include <cstring>
 
 #include "chrono/serialization/ChArchive.h"
@@ -68,6 +69,12 @@ class ChApi ChArchiveOutBinary : public ChArchiveOut {
     virtual void out_array_between(ChValue& bVal, size_t size);
     virtual void out_array_end(ChValue& bVal, size_t size);
 
+    // contiguous arrays of arithmetic values are written as a single block
+    virtual void out_array_bulk(ChValue& bVal, const double* data, size_t size) override;
+    virtual void out_array_bulk(ChValue& bVal, const float* data, size_t size) override;
+    virtual void out_array_bulk(ChValue& bVal, const int* data, size_t size) override;
+    virtual void out_array_bulk(ChValue& bVal, const unsigned int* data, size_t size) override;
+
     // for custom c++ objects:
     virtual void out(ChValue& bVal, bool tracked, size_t obj_ID);
 
@@ -75,11 +82,33 @@ class ChApi ChArchiveOutBinary : public ChArchiveOut {
 
   protected:
     std::ostream& m_ostream;
+    bool m_big_endian_machine;
 
     template <typename T>
     std::ostream& write(T val) {
+        if (m_big_endian_machine) {
+            StreamSwapBytes<T>(&val);
+        }
         return m_ostream.write(reinterpret_cast<char*>(&val), sizeof(T));
     }
+
+    template <typename T>
+    std::ostream& write_array(const T* data, size_t size) {
+        if (!m_big_endian_machine)
+            return m_ostream.write(reinterpret_cast<const char*>(data), size * sizeof(T));
+        // swap bytes in a small buffer, to keep the input data untouched
+        const size_t chunk = 512;
+        T buffer[chunk];
+        for (size_t start = 0; start < size; start += chunk) {
+            size_t n = std::min(chunk, size - start);
+            for (size_t i = 0; i < n; i++) {
+                buffer[i] = data[start + i];
+                StreamSwapBytes<T>(&buffer[i]);
+            }
+            m_ostream.write(reinterpret_cast<const char*>(buffer), n * sizeof(T));
+        }
+        return m_ostream;
+    }
 };
 
 template <>
@@ -128,6 +157,12 @@ class ChApi ChArchiveInBinary : public ChArchiveIn {
     virtual void in_array_between(const std::string& name) override {}
     virtual void in_array_end(const std::string& name) override {}
 
+    // contiguous arrays of arithmetic values are read as a single block
+    virtual void in_array_bulk(const std::string& name, double* data, size_t size) override;
+    virtual void in_array_bulk(const std::string& name, float* data, size_t size) override;
+    virtual void in_array_bulk(const std::string& name, int* data, size_t size) override;
+    virtual void in_array_bulk(const std::string& name, unsigned int* data, size_t size) override;
+
     // for custom c++ objects
     virtual bool in(ChNameValue<ChFunctorArchiveIn> bVal) override;
 
@@ -146,6 +181,16 @@ class ChApi ChArchiveInBinary : public ChArchiveIn {
 
         return m_istream;
     }
+
+    template <typename T>
+    std::istream& read_array(T* data, size_t size) {
+        m_istream.read(reinterpret_cast<char*>(data), size * sizeof(T));
+        if (m_big_endian_machine) {
+            for (size_t i = 0; i < size; i++)
+                StreamSwapBytes<T>(&data[i]);
+        }
+        return m_istream;
+    }
 };
 
 template <>
@@ -145,6 +145,18 @@ void ChArchiveOutJSON::out_array_pre(ChValue& bVal, size_t msize) {
     is_array.push(true);
 }
 void ChArchiveOutJSON::out_array_between(ChValue& bVal, size_t msize) {}
+void ChArchiveOutJSON::out_array_bulk(ChValue& bVal, const double* data, size_t msize) {
+    out_array_values(data, msize);
+}
+void ChArchiveOutJSON::out_array_bulk(ChValue& bVal, const float* data, size_t msize) {
+    out_array_values(data, msize);
+}
+void ChArchiveOutJSON::out_array_bulk(ChValue& bVal, const int* data, size_t msize) {
+    out_array_values(data, msize);
+}
+void ChArchiveOutJSON::out_array_bulk(ChValue& bVal, const unsigned int* data, size_t msize) {
+    out_array_values(data, msize);
+}
 void ChArchiveOutJSON::out_array_end(ChValue& bVal, size_t msize) {
     --tablevel;
     nitems.pop();
@@ -422,6 +434,51 @@ void ChArchiveInJSON::in_array_end(const std::string& name) {
     this->array_index.pop();
 }
 
+// for contiguous arrays of arithmetic values
+
+static void GetArrayValue(const rapidjson::Value& mval, double& val, const std::string& name) {
+    if (!mval.IsNumber())
+        throw std::runtime_error("Invalid number in array '" + name + "'");
+    val = mval.GetDouble();
+}
+static void GetArrayValue(const rapidjson::Value& mval, float& val, const std::string& name) {
+    if (!mval.IsNumber())
+        throw std::runtime_error("Invalid number in array '" + name + "'");
+    val = (float)mval.GetDouble();
+}
+static void GetArrayValue(const rapidjson::Value& mval, int& val, const std::string& name) {
+    if (!mval.IsInt())
+        throw std::runtime_error("Invalid integer number in array '" + name + "'");
+    val = mval.GetInt();
+}
+static void GetArrayValue(const rapidjson::Value& mval, unsigned int& val, const std::string& name) {
+    if (!mval.IsUint())
+        throw std::runtime_error("Invalid unsigned integer number in array '" + name + "'");
+    val = mval.GetUint();
+}
+
+template <typename T>
+static void GetArrayValues(rapidjson::Value& level, int& index, T* data, size_t msize, const std::string& name) {
+    if (!level.IsArray() || index + msize > level.Size())
+        throw std::runtime_error("Invalid array [...] after '" + name + "'");
+    for (size_t i = 0; i < msize; ++i)
+        GetArrayValue(level[(rapidjson::SizeType)(index + i)], data[i], name);
+    index += (int)msize;
+}
+
+void ChArchiveInJSON::in_array_bulk(const std::string& name, double* data, size_t msize) {
+    GetArrayValues(*level, array_index.top(), data, msize, name);
+}
+void ChArchiveInJSON::in_array_bulk(const std::string& name, float* data, size_t msize) {
+    GetArrayValues(*level, array_index.top(), data, msize, name);
+}
+void ChArchiveInJSON::in_array_bulk(const std::string& name, int* data, size_t msize) {
+    GetArrayValues(*level, array_index.top(), data, msize, name);
+}
+void ChArchiveInJSON::in_array_bulk(const std::string& name, unsigned int* data, size_t msize) {
+    GetArrayValues(*level, array_index.top(), data, msize, name);
+}
+
 //  for custom c++ objects:
 
 bool ChArchiveInJSON::in(ChNameValue<ChFunctorArchiveIn> bVal) {
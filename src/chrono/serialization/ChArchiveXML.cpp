@@ -3,6 +3,7 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <cstdlib>
 #include <cstring>
 
 namespace chrono {
@@ -138,6 +139,18 @@ void ChArchiveOutXML::out_array_pre(ChValue& bVal, size_t msize) {
     is_array.push(true);
 }
 void ChArchiveOutXML::out_array_between(ChValue& bVal, size_t msize) {}
+void ChArchiveOutXML::out_array_bulk(ChValue& bVal, const double* data, size_t msize) {
+    out_array_values(data, msize);
+}
+void ChArchiveOutXML::out_array_bulk(ChValue& bVal, const float* data, size_t msize) {
+    out_array_values(data, msize);
+}
+void ChArchiveOutXML::out_array_bulk(ChValue& bVal, const int* data, size_t msize) {
+    out_array_values(data, msize);
+}
+void ChArchiveOutXML::out_array_bulk(ChValue& bVal, const unsigned int* data, size_t msize) {
+    out_array_values(data, msize);
+}
 void ChArchiveOutXML::out_array_end(ChValue& bVal, size_t msize) {
     --tablevel;
     nitems.pop();
@@ -381,7 +394,15 @@ bool ChArchiveInXML::in_array_pre(const std::string& name, size_t& msize) {
         return false;
     msize = 0;
     for (rapidxml::xml_node<>* countnode = mval->first_node(); countnode; countnode = countnode->next_sibling()) {
-        ++msize;
+        if (countnode->type() == rapidxml::node_element)
+            ++msize;
+    }
+    // arrays of arithmetic values written in compact form: count the whitespace-separated values
+    if (msize == 0) {
+        std::istringstream values(mval->value());
+        std::string token;
+        while (values >> token)
+            ++msize;
     }
 
     this->levels.push(mval);
@@ -400,6 +421,68 @@ void ChArchiveInXML::in_array_end(const std::string& name) {
     this->array_index.pop();
 }
 
+// for contiguous arrays of arithmetic values
+
+static bool ParseArrayValue(const char* str, char** end, double& val) {
+    val = std::strtod(str, end);
+    return *end != str;
+}
+static bool ParseArrayValue(const char* str, char** end, float& val) {
+    val = std::strtof(str, end);
+    return *end != str;
+}
+static bool ParseArrayValue(const char* str, char** end, int& val) {
+    val = (int)std::strtol(str, end, 10);
+    return *end != str;
+}
+static bool ParseArrayValue(const char* str, char** end, unsigned int& val) {
+    val = (unsigned int)std::strtoul(str, end, 10);
+    return *end != str;
+}
+
+static bool HasElementNodes(rapidxml::xml_node<>* node) {
+    for (rapidxml::xml_node<>* child = node->first_node(); child; child = child->next_sibling()) {
+        if (child->type() == rapidxml::node_element)
+            return true;
+    }
+    return false;
+}
+
+template <typename T>
+static void ParseArrayValues(const char* str, T* data, size_t msize, const std::string& name) {
+    char* end;
+    for (size_t i = 0; i < msize; ++i) {
+        if (!ParseArrayValue(str, &end, data[i]))
+            throw std::runtime_error("Invalid number in array '" + name + "'");
+        str = end;
+    }
+}
+
+void ChArchiveInXML::in_array_bulk(const std::string& name, double* data, size_t msize) {
+    if (HasElementNodes(level))
+        in_array_elements(name, data, msize);
+    else
+        ParseArrayValues(level->value(), data, msize, name);
+}
+void ChArchiveInXML::in_array_bulk(const std::string& name, float* data, size_t msize) {
+    if (HasElementNodes(level))
+        in_array_elements(name, data, msize);
+    else
+        ParseArrayValues(level->value(), data, msize, name);
+}
+void ChArchiveInXML::in_array_bulk(const std::string& name, int* data, size_t msize) {
+    if (HasElementNodes(level))
+        in_array_elements(name, data, msize);
+    else
+        ParseArrayValues(level->value(), data, msize, name);
+}
+void ChArchiveInXML::in_array_bulk(const std::string& name, unsigned int* data, size_t msize) {
+    if (HasElementNodes(level))
+        in_array_elements(name, data, msize);
+    else
+        ParseArrayValues(level->value(), data, msize, name);
+}
+
 //  for custom c++ objects:
 
 bool ChArchiveInXML::in(ChNameValue<ChFunctorArchiveIn> bVal) {
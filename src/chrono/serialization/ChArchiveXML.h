@@ -50,12 +50,35 @@ class ChApi ChArchiveOutXML : public ChArchiveOut {
     virtual void out_array_between(ChValue& bVal, size_t msize);
     virtual void out_array_end(ChValue& bVal, size_t msize);
 
+    // contiguous arrays of arithmetic values are written in compact form (whitespace-separated values)
+    virtual void out_array_bulk(ChValue& bVal, const double* data, size_t msize) override;
+    virtual void out_array_bulk(ChValue& bVal, const float* data, size_t msize) override;
+    virtual void out_array_bulk(ChValue& bVal, const int* data, size_t msize) override;
+    virtual void out_array_bulk(ChValue& bVal, const unsigned int* data, size_t msize) override;
+
     // for custom c++ objects:
     virtual void out(ChValue& bVal, bool tracked, size_t obj_ID);
 
     virtual void out_ref(ChValue& bVal, bool already_inserted, size_t obj_ID, size_t ext_ID);
 
   protected:
+    template <typename T>
+    void out_array_values(const T* data, size_t msize) {
+        const size_t values_per_line = 16;
+        for (size_t i = 0; i < msize; ++i) {
+            if (i % values_per_line == 0) {
+                if (i > 0)
+                    m_ostream << "\n";
+                indent();
+            } else {
+                m_ostream << " ";
+            }
+            m_ostream << data[i];
+        }
+        m_ostream << "\n";
+        nitems.top() += (int)msize;
+    }
+
     int tablevel;
     std::ostream& m_ostream;
     std::stack<int> nitems;
@@ -92,6 +115,13 @@ class ChApi ChArchiveInXML : public ChArchiveIn {
 
     virtual void in_array_end(const std::string& name) override;
 
+    // contiguous arrays of arithmetic values are parsed directly from the array text
+    // (arrays written one element at a time are also accepted)
+    virtual void in_array_bulk(const std::string& name, double* data, size_t msize) override;
+    virtual void in_array_bulk(const std::string& name, float* data, size_t msize) override;
+    virtual void in_array_bulk(const std::string& name, int* data, size_t msize) override;
+    virtual void in_array_bulk(const std::string& name, unsigned int* data, size_t msize) override;
+
     //  for custom c++ objects:
     virtual bool in(ChNameValue<ChFunctorArchiveIn> bVal) override;
 
@@ -0,0 +1,583 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "chrono/serialization/ChStateCheckpoint.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+// -----------------------------------------------------------------------------
+// File layout: header, block table, and block data (each block at an offset aligned to 64 bytes)
+// -----------------------------------------------------------------------------
+
+static const char checkpoint_magic[8] = {'C', 'H', 'S', 'T', 'A', 'T', 'E', '\0'};
+static const uint32_t checkpoint_version = 1;
+static const size_t checkpoint_alignment = 64;
+
+struct CheckpointHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_blocks;
+    uint64_t file_size;
+    char reserved[40];
+};
+
+struct CheckpointBlockEntry {
+    char name[32];         // block name (null-terminated)
+    uint64_t offset;       // offset of block data from start of file
+    uint64_t size;         // size of block data
+    uint64_t stored_size;  // size of block data in the file (different from size if compressed)
+    uint32_t flags;        // block flags (see below)
+    uint32_t reserved;
+};
+
+static_assert(sizeof(CheckpointHeader) == 64, "unexpected checkpoint header size");
+static_assert(sizeof(CheckpointBlockEntry) == 64, "unexpected checkpoint block entry size");
+
+static const uint32_t block_compressed = 1;
+
+// Cached reactions of a contact, with collision models and shapes identified by body index and shape index.
+struct CheckpointContactRecord {
+    int32_t bodyA;
+    int32_t shapeA;
+    int32_t bodyB;
+    int32_t shapeB;
+    double point[3];
+    float reactions[6];
+};
+
+static_assert(sizeof(CheckpointContactRecord) == 64, "unexpected contact record size");
+
+static size_t Align(size_t offset) {
+    return (offset + checkpoint_alignment - 1) & ~(checkpoint_alignment - 1);
+}
+
+// -----------------------------------------------------------------------------
+// Block compression.
+// Blocks with a size multiple of 8 are first shuffled, grouping together the bytes of same significance of all 8-byte
+// values (for state vectors, sign and exponent bytes are often identical). The result is then run-length encoded,
+// with control bytes 0-127 followed by 1-128 literal bytes and control bytes 128-255 followed by a byte repeated 3-130
+// times.
+// -----------------------------------------------------------------------------
+
+static void Compress(const char* data, size_t size, std::vector<char>& out) {
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(data);
+    std::vector<unsigned char> shuffled;
+    if (size % 8 == 0) {
+        size_t n = size / 8;
+        shuffled.resize(size);
+        for (size_t i = 0; i < n; i++)
+            for (size_t k = 0; k < 8; k++)
+                shuffled[k * n + i] = in[i * 8 + k];
+        in = shuffled.data();
+    }
+
+    out.clear();
+    size_t i = 0;
+    while (i < size) {
+        size_t run = 1;
+        while (i + run < size && run < 130 && in[i + run] == in[i])
+            run++;
+        if (run >= 3) {
+            out.push_back((char)(128 + run - 3));
+            out.push_back((char)in[i]);
+            i += run;
+            continue;
+        }
+        size_t start = i;
+        while (i < size && i - start < 128) {
+            if (i + 2 < size && in[i] == in[i + 1] && in[i] == in[i + 2])
+                break;
+            i++;
+        }
+        out.push_back((char)(i - start - 1));
+        out.insert(out.end(), (const char*)in + start, (const char*)in + i);
+    }
+}
+
+static bool Decompress(const char* data, size_t stored_size, size_t size, std::vector<char>& out) {
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(data);
+    std::vector<unsigned char> buffer(size);
+
+    size_t i = 0;
+    size_t pos = 0;
+    while (i < stored_size) {
+        unsigned int c = in[i++];
+        if (c < 128) {
+            size_t len = c + 1;
+            if (i + len > stored_size || pos + len > size)
+                return false;
+            std::memcpy(&buffer[pos], in + i, len);
+            i += len;
+            pos += len;
+        } else {
+            size_t run = c - 128 + 3;
+            if (i >= stored_size || pos + run > size)
+                return false;
+            std::fill(buffer.begin() + pos, buffer.begin() + pos + run, in[i++]);
+            pos += run;
+        }
+    }
+    if (pos != size)
+        return false;
+
+    out.resize(size);
+    if (size % 8 == 0) {
+        size_t n = size / 8;
+        for (size_t j = 0; j < n; j++)
+            for (size_t k = 0; k < 8; k++)
+                out[j * 8 + k] = (char)buffer[k * n + j];
+    } else {
+        std::memcpy(out.data(), buffer.data(), size);
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+ChStateCheckpoint::ChStateCheckpoint() : m_compress(false), m_map(nullptr), m_map_size(0) {}
+
+ChStateCheckpoint::~ChStateCheckpoint() {
+    Unmap();
+}
+
+void ChStateCheckpoint::Unmap() {
+#if !defined(_WIN32)
+    if (m_map)
+        munmap(m_map, m_map_size);
+#endif
+    m_map = nullptr;
+    m_map_size = 0;
+}
+
+void ChStateCheckpoint::Clear() {
+    m_blocks.clear();
+    Unmap();
+}
+
+ChStateCheckpoint::Block& ChStateCheckpoint::NewBlock(const std::string& name) {
+    assert(name.size() < sizeof(CheckpointBlockEntry::name));
+    auto block = std::find_if(m_blocks.begin(), m_blocks.end(), [&name](const Block& b) { return b.name == name; });
+    if (block == m_blocks.end()) {
+        m_blocks.push_back(Block());
+        block = m_blocks.end() - 1;
+    }
+    block->name = name;
+    block->data = nullptr;
+    block->size = 0;
+    block->buffer.clear();
+    return *block;
+}
+
+const ChStateCheckpoint::Block* ChStateCheckpoint::FindBlock(const std::string& name) const {
+    for (const auto& block : m_blocks) {
+        if (block.name == name)
+            return &block;
+    }
+    return nullptr;
+}
+
+void ChStateCheckpoint::AddBlock(const std::string& name, const void* data, size_t size) {
+    auto& block = NewBlock(name);
+    block.data = static_cast<const char*>(data);
+    block.size = size;
+}
+
+void ChStateCheckpoint::AddBlock(const std::string& name, std::vector<char>&& data) {
+    auto& block = NewBlock(name);
+    block.size = data.size();
+    block.buffer = std::move(data);
+}
+
+bool ChStateCheckpoint::HasBlock(const std::string& name) const {
+    return FindBlock(name) != nullptr;
+}
+
+const char* ChStateCheckpoint::GetBlock(const std::string& name, size_t& size) const {
+    auto block = FindBlock(name);
+    if (!block) {
+        size = 0;
+        return nullptr;
+    }
+    size = block->size;
+    return block->GetData();
+}
+
+void ChStateCheckpoint::AddVector(const std::string& name, const ChVectorDynamic<>& v) {
+    std::vector<char> data(v.size() * sizeof(double));
+    if (v.size() > 0)
+        std::memcpy(data.data(), v.data(), data.size());
+    AddBlock(name, std::move(data));
+}
+
+bool ChStateCheckpoint::GetVector(const std::string& name, ChVectorDynamic<>& v) const {
+    auto block = FindBlock(name);
+    if (!block || block->size != v.size() * sizeof(double))
+        return false;
+    if (block->size > 0)
+        std::memcpy(v.data(), block->GetData(), block->size);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool ChStateCheckpoint::Write(const std::string& filename) {
+    size_t num_blocks = m_blocks.size();
+
+    // Compress blocks (if enabled) and lay out the file
+    std::vector<CheckpointBlockEntry> entries(num_blocks);
+    std::vector<std::vector<char>> compressed(num_blocks);
+    std::vector<const char*> stored(num_blocks);
+    size_t offset = Align(sizeof(CheckpointHeader) + num_blocks * sizeof(CheckpointBlockEntry));
+    for (size_t i = 0; i < num_blocks; i++) {
+        const auto& block = m_blocks[i];
+        auto& entry = entries[i];
+        std::memset(&entry, 0, sizeof(entry));
+        std::strncpy(entry.name, block.name.c_str(), sizeof(entry.name) - 1);
+        entry.size = block.size;
+        entry.stored_size = block.size;
+        stored[i] = block.GetData();
+        if (m_compress && block.size > 0) {
+            Compress(block.GetData(), block.size, compressed[i]);
+            if (compressed[i].size() < block.size) {
+                entry.stored_size = compressed[i].size();
+                entry.flags = block_compressed;
+                stored[i] = compressed[i].data();
+            }
+        }
+        entry.offset = offset;
+        offset = Align(offset + (size_t)entry.stored_size);
+    }
+
+    CheckpointHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, checkpoint_magic, sizeof(checkpoint_magic));
+    header.version = checkpoint_version;
+    header.num_blocks = (uint32_t)num_blocks;
+    header.file_size = offset;
+
+    std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+    if (!ofs.good())
+        return false;
+
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (num_blocks > 0)
+        ofs.write(reinterpret_cast<const char*>(entries.data()), num_blocks * sizeof(CheckpointBlockEntry));
+
+    const char padding[checkpoint_alignment] = {};
+    size_t pos = sizeof(CheckpointHeader) + num_blocks * sizeof(CheckpointBlockEntry);
+    for (size_t i = 0; i < num_blocks; i++) {
+        ofs.write(padding, (std::streamsize)(entries[i].offset - pos));
+        ofs.write(stored[i], (std::streamsize)entries[i].stored_size);
+        pos = (size_t)(entries[i].offset + entries[i].stored_size);
+    }
+    ofs.write(padding, (std::streamsize)(offset - pos));
+
+    return ofs.good();
+}
+
+bool ChStateCheckpoint::Read(const std::string& filename, bool memory_map) {
+    Clear();
+
+    CheckpointHeader header;
+    std::vector<CheckpointBlockEntry> entries;
+    std::ifstream ifs;
+    size_t file_size = 0;
+    const char* file_data = nullptr;
+
+#if !defined(_WIN32)
+    if (memory_map) {
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            struct stat st;
+            if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(CheckpointHeader)) {
+                void* map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (map != MAP_FAILED) {
+                    m_map = map;
+                    m_map_size = (size_t)st.st_size;
+                    file_size = m_map_size;
+                    file_data = static_cast<const char*>(map);
+                }
+            }
+            close(fd);
+        }
+        // If the file could not be mapped, fall back to reading it through a stream
+    }
+#endif
+
+    // Read and validate the header and the block table
+    if (file_data) {
+        std::memcpy(&header, file_data, sizeof(header));
+    } else {
+        ifs.open(filename, std::ios::binary | std::ios::ate);
+        if (!ifs.good())
+            return false;
+        file_size = (size_t)ifs.tellg();
+        ifs.seekg(0);
+        if (file_size < sizeof(CheckpointHeader) || !ifs.read(reinterpret_cast<char*>(&header), sizeof(header)))
+            return false;
+    }
+
+    size_t table_end = sizeof(CheckpointHeader) + (size_t)header.num_blocks * sizeof(CheckpointBlockEntry);
+    if (std::memcmp(header.magic, checkpoint_magic, sizeof(checkpoint_magic)) != 0 ||
+        header.version != checkpoint_version || header.file_size != file_size || table_end > file_size) {
+        Clear();
+        return false;
+    }
+
+    entries.resize(header.num_blocks);
+    if (header.num_blocks > 0) {
+        if (file_data) {
+            std::memcpy(entries.data(), file_data + sizeof(CheckpointHeader),
+                        entries.size() * sizeof(CheckpointBlockEntry));
+        } else if (!ifs.read(reinterpret_cast<char*>(entries.data()), entries.size() * sizeof(CheckpointBlockEntry))) {
+            return false;
+        }
+    }
+
+    // Load the data blocks
+    for (const auto& entry : entries) {
+        if (entry.offset + entry.stored_size > file_size || entry.name[sizeof(entry.name) - 1] != '\0') {
+            Clear();
+            return false;
+        }
+
+        m_blocks.push_back(Block());
+        auto& block = m_blocks.back();
+        block.name = entry.name;
+        block.data = nullptr;
+        block.size = (size_t)entry.size;
+
+        std::vector<char> stored;
+        const char* stored_data = nullptr;
+        if (file_data) {
+            stored_data = file_data + entry.offset;
+        } else {
+            stored.resize((size_t)entry.stored_size);
+            ifs.seekg((std::streamoff)entry.offset);
+            if (entry.stored_size > 0 && !ifs.read(stored.data(), (std::streamsize)entry.stored_size)) {
+                Clear();
+                return false;
+            }
+            stored_data = stored.data();
+        }
+
+        if (entry.flags & block_compressed) {
+            if (!Decompress(stored_data, (size_t)entry.stored_size, block.size, block.buffer)) {
+                Clear();
+                return false;
+            }
+        } else if (entry.stored_size != entry.size) {
+            Clear();
+            return false;
+        } else if (file_data) {
+            block.data = stored_data;
+        } else {
+            block.buffer = std::move(stored);
+        }
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChStateCheckpoint::AddSystem(ChSystem& sys) {
+    sys.Setup();
+
+    auto contact_container = sys.GetContactContainer();
+    unsigned int num_constr_assembly = sys.GetNumConstraints() - contact_container->GetNumConstraints();
+
+    uint64_t info[4] = {sys.GetNumCoordsPosLevel(), sys.GetNumCoordsVelLevel(), num_constr_assembly,
+                        sys.GetBodies().size()};
+    AddBlock("system.info", std::vector<char>(reinterpret_cast<char*>(info), reinterpret_cast<char*>(info + 4)));
+
+    // State vectors
+    ChState x(sys.GetNumCoordsPosLevel(), &sys);
+    ChStateDelta v(sys.GetNumCoordsVelLevel(), &sys);
+    ChStateDelta a(sys.GetNumCoordsVelLevel(), &sys);
+    ChVectorDynamic<> L(sys.GetNumConstraints());
+    double T;
+    sys.StateGather(x, v, T);
+    sys.StateGatherAcceleration(a);
+    sys.StateGatherReactions(L);
+
+    AddBlock("system.time", std::vector<char>(reinterpret_cast<char*>(&T), reinterpret_cast<char*>(&T + 1)));
+    AddVector("system.x", x);
+    AddVector("system.v", v);
+    AddVector("system.a", a);
+
+    // Lagrange multipliers of the assembly constraints (contacts are recreated at the next collision detection pass
+    // and are warm-started from the reaction cache)
+    AddVector("system.L", L.head(num_constr_assembly));
+
+    // Rotation derivatives of the bodies (not exactly recovered from the angular velocities and accelerations)
+    const auto& bodies = sys.GetBodies();
+    ChVectorDynamic<> rot_derivs(8 * bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        rot_derivs.segment(8 * i + 0, 4) = bodies[i]->GetRotDt().eigen();
+        rot_derivs.segment(8 * i + 4, 4) = bodies[i]->GetRotDt2().eigen();
+    }
+    AddVector("body.rot_derivs", rot_derivs);
+
+    // Contact warm-start data, with collision models and shapes identified by their indices
+    auto nsc = std::dynamic_pointer_cast<ChContactContainerNSC>(contact_container);
+    if (!nsc || !nsc->IsReactionCacheEnabled())
+        return;
+
+    std::unordered_map<const ChCollisionModel*, int> model_index;
+    for (int i = 0; i < (int)bodies.size(); i++) {
+        if (bodies[i]->GetCollisionModel())
+            model_index[bodies[i]->GetCollisionModel().get()] = i;
+    }
+
+    auto shape_index = [](const ChCollisionModel* model, const ChCollisionShape* shape) {
+        const auto& shapes = model->GetShapeInstances();
+        for (int i = 0; i < (int)shapes.size(); i++) {
+            if (shapes[i].first.get() == shape)
+                return i;
+        }
+        return -1;
+    };
+
+    // Entries for collision models not associated with a body of the system are not saved
+    std::vector<CheckpointContactRecord> records;
+    for (const auto& cr : nsc->GetReactionCache()) {
+        auto bodyA = model_index.find(cr.modelA);
+        auto bodyB = model_index.find(cr.modelB);
+        if (bodyA == model_index.end() || bodyB == model_index.end())
+            continue;
+        CheckpointContactRecord record;
+        record.bodyA = bodyA->second;
+        record.shapeA = shape_index(cr.modelA, cr.shapeA);
+        record.bodyB = bodyB->second;
+        record.shapeB = shape_index(cr.modelB, cr.shapeB);
+        if (record.shapeA < 0 || record.shapeB < 0)
+            continue;
+        record.point[0] = cr.point.x();
+        record.point[1] = cr.point.y();
+        record.point[2] = cr.point.z();
+        std::copy(std::begin(cr.reactions), std::end(cr.reactions), std::begin(record.reactions));
+        records.push_back(record);
+    }
+
+    std::vector<char> data(records.size() * sizeof(CheckpointContactRecord));
+    if (!records.empty())
+        std::memcpy(data.data(), records.data(), data.size());
+    AddBlock("contact.reaction_cache", std::move(data));
+}
+
+bool ChStateCheckpoint::RestoreSystem(ChSystem& sys) const {
+    size_t size;
+    auto info_data = GetBlock("system.info", size);
+    if (!info_data || size != 4 * sizeof(uint64_t))
+        return false;
+    uint64_t info[4];
+    std::memcpy(info, info_data, sizeof(info));
+
+    auto time_data = GetBlock("system.time", size);
+    if (!time_data || size != sizeof(double))
+        return false;
+    double T;
+    std::memcpy(&T, time_data, sizeof(double));
+
+    // Perform the initial setup of the system (if not already done), so that it is not done on the restored state
+    sys.Initialize();
+    sys.Setup();
+
+    // Check the system topology
+    auto contact_container = sys.GetContactContainer();
+    unsigned int num_constr_assembly = sys.GetNumConstraints() - contact_container->GetNumConstraints();
+    const auto& bodies = sys.GetBodies();
+    if (info[0] != sys.GetNumCoordsPosLevel() || info[1] != sys.GetNumCoordsVelLevel() ||
+        info[2] != num_constr_assembly || info[3] != bodies.size())
+        return false;
+
+    ChState x(sys.GetNumCoordsPosLevel(), &sys);
+    ChStateDelta v(sys.GetNumCoordsVelLevel(), &sys);
+    ChStateDelta a(sys.GetNumCoordsVelLevel(), &sys);
+    ChVectorDynamic<> L(num_constr_assembly);
+    ChVectorDynamic<> rot_derivs(8 * bodies.size());
+    if (!GetVector("system.x", x) || !GetVector("system.v", v) || !GetVector("system.a", a) ||
+        !GetVector("system.L", L) || !GetVector("body.rot_derivs", rot_derivs))
+        return false;
+
+    // Map the contact warm-start data to the collision models and shapes of the system
+    std::vector<ChContactContainerNSC::CachedReactions> cache;
+    auto nsc = std::dynamic_pointer_cast<ChContactContainerNSC>(contact_container);
+    bool has_cache = nsc && HasBlock("contact.reaction_cache");
+    if (has_cache) {
+        auto cache_data = GetBlock("contact.reaction_cache", size);
+        if (size % sizeof(CheckpointContactRecord) != 0)
+            return false;
+        size_t num_records = size / sizeof(CheckpointContactRecord);
+        cache.resize(num_records);
+        for (size_t i = 0; i < num_records; i++) {
+            CheckpointContactRecord record;
+            std::memcpy(&record, cache_data + i * sizeof(CheckpointContactRecord), sizeof(record));
+            if (record.bodyA < 0 || record.bodyA >= (int)bodies.size() || record.bodyB < 0 ||
+                record.bodyB >= (int)bodies.size())
+                return false;
+            auto modelA = bodies[record.bodyA]->GetCollisionModel();
+            auto modelB = bodies[record.bodyB]->GetCollisionModel();
+            if (!modelA || !modelB || record.shapeA < 0 || record.shapeA >= (int)modelA->GetNumShapes() ||
+                record.shapeB < 0 || record.shapeB >= (int)modelB->GetNumShapes())
+                return false;
+            auto& cr = cache[i];
+            cr.modelA = modelA.get();
+            cr.modelB = modelB.get();
+            cr.shapeA = modelA->GetShapeInstance(record.shapeA).first.get();
+            cr.shapeB = modelB->GetShapeInstance(record.shapeB).first.get();
+            cr.point = ChVector3d(record.point[0], record.point[1], record.point[2]);
+            std::copy(std::begin(record.reactions), std::end(record.reactions), std::begin(cr.reactions));
+        }
+    }
+
+    // Remove all contacts (restoring the warm-start data, if available)
+    if (has_cache)
+        nsc->SetReactionCache(cache);
+    else
+        contact_container->RemoveAllContacts();
+    sys.Setup();
+
+    // Restore the system state. The body rotation derivatives obtained from the angular velocities and accelerations
+    // are overwritten with their saved values, so that the restored state is bit-exact, before the full update.
+    sys.StateScatter(x, v, T, false);
+    sys.StateScatterAcceleration(a);
+    for (size_t i = 0; i < bodies.size(); i++) {
+        bodies[i]->SetRotDt(ChQuaternion<>(rot_derivs.segment(8 * i + 0, 4)));
+        bodies[i]->SetRotDt2(ChQuaternion<>(rot_derivs.segment(8 * i + 4, 4)));
+    }
+    sys.Update(T, true);
+    sys.StateScatterReactions(L);
+
+    return true;
+}
+
+}  // end namespace chrono
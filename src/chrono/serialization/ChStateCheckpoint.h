@@ -0,0 +1,121 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CH_STATE_CHECKPOINT_H
+#define CH_STATE_CHECKPOINT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+// Forward references
+class ChSystem;
+
+/// @addtogroup chrono_serialization
+/// @{
+
+/// Binary checkpoint of the state of a Chrono system.
+/// Unlike the archive-based serialization, which saves and recreates the complete model, a state checkpoint only saves
+/// the state of an existing model: time, generalized positions, velocities and accelerations (as obtained with
+/// ChSystem::StateGather), body rotation derivatives, Lagrange multipliers, and the contact warm-start data of an NSC
+/// system (see ChContactContainerNSC::GetReactionCache). Restoring a checkpoint therefore requires a system with the
+/// same topology (same bodies, links, collision shapes, etc., created in the same order), for which the restored state
+/// is bit-exact.
+/// Data held internally by the collision system (e.g., Bullet persistent contact manifolds) is not saved.
+///
+/// A checkpoint file is a sequence of named data blocks, each stored contiguously at an offset aligned to 64 bytes.
+/// Blocks are written directly from memory (e.g., from the state vectors) and, if the file is memory-mapped when read
+/// back, accessed in place. Other objects with state not captured by the system state vectors can add their own blocks
+/// (e.g., SCMTerrain::AddToCheckpoint). Blocks can optionally be compressed with a lossless scheme (byte shuffling
+/// followed by run-length encoding), effective for state vectors with many zero or repeated values.
+/// Checkpoint files are specific to a given platform (no endianness conversion is performed).
+class ChApi ChStateCheckpoint {
+  public:
+    ChStateCheckpoint();
+    ChStateCheckpoint(const ChStateCheckpoint&) = delete;
+    ~ChStateCheckpoint();
+
+    /// Enable/disable compression of data blocks when writing a checkpoint file (default: false).
+    /// A block is stored compressed only if this reduces its size.
+    void EnableCompression(bool val) { m_compress = val; }
+
+    /// Remove all data blocks (and unmap the checkpoint file, if any).
+    void Clear();
+
+    /// Add a data block, referencing the given memory.
+    /// The data is not copied and must remain valid until the checkpoint is written.
+    void AddBlock(const std::string& name, const void* data, size_t size);
+
+    /// Add a data block, taking ownership of the given data.
+    void AddBlock(const std::string& name, std::vector<char>&& data);
+
+    /// Add data blocks with the current state of the given system.
+    /// The system state vectors are gathered in buffers owned by the checkpoint.
+    void AddSystem(ChSystem& sys);
+
+    /// Write all data blocks to the specified file. Return false if the file cannot be written.
+    bool Write(const std::string& filename);
+
+    /// Read a checkpoint file, replacing all current data blocks.
+    /// If memory_map is true, the file is memory-mapped (POSIX platforms only) and uncompressed blocks are accessed
+    /// in place; if mapping fails, the file is read in memory instead. Otherwise, the file is read in memory. Return
+    /// false if the file cannot be read or is not valid.
+    bool Read(const std::string& filename, bool memory_map = true);
+
+    /// Return true if the checkpoint has a data block with the given name.
+    bool HasBlock(const std::string& name) const;
+
+    /// Return the data of the block with the given name and its size (nullptr if there is no such block).
+    const char* GetBlock(const std::string& name, size_t& size) const;
+
+    /// Restore the state of the given system from the data blocks added with AddSystem.
+    /// Return false if the checkpoint does not contain a system state or if the system topology does not match.
+    /// All contacts of the system are removed. Contacts are recreated at the next collision detection pass, using the
+    /// restored warm-start data (if the checkpoint was created from an NSC system with the reaction cache enabled).
+    bool RestoreSystem(ChSystem& sys) const;
+
+  private:
+    /// Data block of a checkpoint.
+    struct Block {
+        std::string name;          ///< block name
+        const char* data;          ///< start of block data (external or memory-mapped)
+        size_t size;               ///< size of block data
+        std::vector<char> buffer;  ///< block data owned by the checkpoint (if any)
+
+        const char* GetData() const { return buffer.empty() ? data : buffer.data(); }
+    };
+
+    Block& NewBlock(const std::string& name);
+    const Block* FindBlock(const std::string& name) const;
+    void Unmap();
+
+    void AddVector(const std::string& name, const ChVectorDynamic<>& v);
+    bool GetVector(const std::string& name, ChVectorDynamic<>& v) const;
+
+    std::vector<Block> m_blocks;  ///< data blocks
+    bool m_compress;              ///< if true, compress data blocks when writing
+    void* m_map;                  ///< start of the memory-mapped checkpoint file (if any)
+    size_t m_map_size;            ///< size of the memory-mapped checkpoint file
+};
+
+/// @} chrono_serialization
+
+}  // end namespace chrono
+
+#endif
@@ -12,11 +12,13 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <iomanip>
 
 #include "chrono/core/ChSparsityPatternLearner.h"
 
 #include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/utils/ChTracer.h"
 
 #define SPM_DEF_SPARSITY 0.9  ///< default predicted sparsity (in [0,1])
 
@@ -26,6 +28,8 @@ ChDirectSolverLS::ChDirectSolverLS()
     : m_lock(false),
       m_use_learner(true),
       m_force_update(true),
+      m_incremental(false),
+      m_analyze(true),
       m_null_pivot_detection(false),
       m_use_rhs_sparsity(false),
       m_use_perm(false),
@@ -33,7 +37,44 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_dim(0),
       m_sparsity(-1),
       m_solve_call(0),
-      m_setup_call(0) {}
+      m_setup_call(0),
+      m_analyze_call(0),
+      m_nnz(-1) {}
+
+// Sparse matrix proxy used for incremental assembly.
+// No nonzeros are stored in the matrix itself. In recording mode, all calls to SetElement are appended to the entry
+// map. In replay mode, the row and column indices are checked against the recorded entries and only the values and
+// overwrite flags are updated; any mismatch invalidates the entry map.
+class ChDirectSolverLS::EntryRecorder : public ChSparseMatrix {
+  public:
+    EntryRecorder(int dim, EntryMap& entries, bool replay)
+        : ChSparseMatrix(dim, dim), m_entries(entries), m_replay(replay), m_next(0), m_valid(true) {}
+
+    virtual void SetElement(int row, int col, double val, bool overwrite = true) override {
+        if (!m_replay) {
+            m_entries.row.push_back(row);
+            m_entries.col.push_back(col);
+            m_entries.val.push_back(val);
+            m_entries.overwrite.push_back(overwrite);
+        } else if (m_valid && m_next < m_entries.row.size() && m_entries.row[m_next] == row &&
+                   m_entries.col[m_next] == col) {
+            m_entries.val[m_next] = val;
+            m_entries.overwrite[m_next] = overwrite;
+        } else {
+            m_valid = false;
+        }
+        m_next++;
+    }
+
+    /// Return true if the recorded entries match the sequence of entries written during replay.
+    bool IsValid() const { return !m_replay || (m_valid && m_next == m_entries.row.size()); }
+
+  private:
+    EntryMap& m_entries;
+    bool m_replay;
+    size_t m_next;
+    bool m_valid;
+};
 
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
@@ -43,6 +84,8 @@ void ChDirectSolverLS::ResetTimers() {
 }
 
 bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChDirectSolverLS::Setup", "solver");
+
     m_timer_setup_assembly.start();
 
     // Calculate problem size.
@@ -60,31 +103,52 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
     bool call_reserve = !m_use_learner && (m_setup_call == 0 || !m_lock);
 
-    if (verbose) {
-        std::cout << "Solver setup" << std::endl;
-        std::cout << "  call number:    " << m_setup_call << std::endl;
-        std::cout << "  use learner?    " << m_use_learner << std::endl;
-        std::cout << "  pattern locked? " << m_lock << std::endl;
-        std::cout << "  CALL learner:   " << call_learner << std::endl;
-        std::cout << "  CALL reserve:   " << call_reserve << std::endl;
-    }
+    bool new_pattern = false;
 
-    if (call_learner) {
-        ChSparsityPatternLearner sparsity_pattern(m_dim, m_dim);
-        sysd.BuildSystemMatrix(&sparsity_pattern, nullptr);
-        sparsity_pattern.Apply(m_mat);
-        m_force_update = false;
-    } else if (call_reserve) {
-        double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
-        m_mat.resize(m_dim, m_dim);
-        m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
-    }
+    if (m_incremental) {
+        if (verbose) {
+            std::cout << "Solver setup" << std::endl;
+            std::cout << "  call number:    " << m_setup_call << std::endl;
+            std::cout << "  incremental assembly" << std::endl;
+        }
 
-    // Let the system descriptor load the current matrix
-    sysd.BuildSystemMatrix(&m_mat, nullptr);
+        new_pattern = AssembleIncremental(sysd);
+    } else {
+        if (verbose) {
+            std::cout << "Solver setup" << std::endl;
+            std::cout << "  call number:    " << m_setup_call << std::endl;
+            std::cout << "  use learner?    " << m_use_learner << std::endl;
+            std::cout << "  pattern locked? " << m_lock << std::endl;
+            std::cout << "  CALL learner:   " << call_learner << std::endl;
+            std::cout << "  CALL reserve:   " << call_reserve << std::endl;
+        }
 
-    // Allow the matrix to be compressed
-    m_mat.makeCompressed();
+        if (call_learner) {
+            ChSparsityPatternLearner sparsity_pattern(m_dim, m_dim);
+            sysd.BuildSystemMatrix(&sparsity_pattern, nullptr);
+            sparsity_pattern.Apply(m_mat);
+            m_force_update = false;
+        } else if (call_reserve) {
+            double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
+            m_mat.resize(m_dim, m_dim);
+            m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
+        }
+
+        // Let the system descriptor load the current matrix
+        sysd.BuildSystemMatrix(&m_mat, nullptr);
+
+        // Allow the matrix to be compressed
+        m_mat.makeCompressed();
+
+        new_pattern = call_learner || call_reserve;
+    }
+
+    // The symbolic analysis must be redone if the sparsity pattern was recreated or if nonzeros were inserted.
+    m_analyze = new_pattern || m_mat.nonZeros() != m_nnz;
+    if (m_analyze) {
+        m_nnz = (int)m_mat.nonZeros();
+        m_analyze_call++;
+    }
 
     m_timer_setup_assembly.stop();
 
@@ -103,8 +167,8 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         std::cout << " Solver setup [" << m_setup_call << "] n = " << m_dim << "  nnz = " << (int)m_mat.nonZeros()
                   << std::endl;
         std::cout << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSeconds() << "s\n"
-                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s"
-                  << std::endl;
+                  << (m_analyze ? "  analyze+factorize: " : "  factorize:         ")
+                  << m_timer_setup_solvercall.GetTimeSeconds() << "s" << std::endl;
     }
 
     m_setup_call++;
@@ -119,6 +183,8 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 }
 
 double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChDirectSolverLS::Solve", "solver");
+
     // Assemble the problem right-hand side vector
     m_timer_solve_assembly.start();
     sysd.BuildSystemMatrix(nullptr, &m_rhs);
@@ -165,6 +231,11 @@ bool ChDirectSolverLS::SetupCurrent() {
     // Allow the matrix to be compressed, if not yet compressed
     m_mat.makeCompressed();
 
+    // The matrix was filled externally, so its sparsity pattern may have changed
+    m_analyze = true;
+    m_nnz = (int)m_mat.nonZeros();
+    m_analyze_call++;
+
     m_timer_setup_assembly.stop();
 
     // Let the concrete solver perform the factorization
@@ -220,6 +291,84 @@ double ChDirectSolverLS::SolveCurrent() {
     return result;
 }
 
+bool ChDirectSolverLS::AssembleIncremental(ChSystemDescriptor& sysd) {
+    bool new_pattern = false;
+
+    // Unless a rebuild was requested, collect the entry values, checking that they match the recorded entries
+    if (!m_force_update && m_mat.rows() == m_dim) {
+        EntryRecorder recorder(m_dim, m_entries, true);
+        sysd.BuildSystemMatrix(&recorder, nullptr);
+        new_pattern = !recorder.IsValid();
+    } else {
+        new_pattern = true;
+    }
+
+    // If needed, record the matrix entries and rebuild the matrix pattern and entry map
+    if (new_pattern) {
+        m_entries.row.clear();
+        m_entries.col.clear();
+        m_entries.val.clear();
+        m_entries.overwrite.clear();
+        EntryRecorder recorder(m_dim, m_entries, false);
+        sysd.BuildSystemMatrix(&recorder, nullptr);
+        BuildEntryMap();
+        m_force_update = false;
+    }
+
+    // Scatter entry values to their slots.
+    // Entries with the same slot are processed in call order, so that the result is identical to that obtained by
+    // loading the matrix directly.
+    const auto& entries = m_entries;
+    double* values = m_mat.valuePtr();
+    int nnz = (int)m_mat.nonZeros();
+
+#pragma omp parallel for num_threads(Eigen::nbThreads()) if (nnz > 10000)
+    for (int s = 0; s < nnz; s++) {
+        double v = 0;
+        for (int k = entries.slot_ptr[s]; k < entries.slot_ptr[s + 1]; k++) {
+            int e = entries.slot_entries[k];
+            v = entries.overwrite[e] ? entries.val[e] : v + entries.val[e];
+        }
+        values[s] = v;
+    }
+
+    return new_pattern;
+}
+
+void ChDirectSolverLS::BuildEntryMap() {
+    int num_entries = (int)m_entries.row.size();
+
+    // Create the compressed matrix with the pattern of the recorded entries (values are loaded later)
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(num_entries);
+    for (int e = 0; e < num_entries; e++)
+        triplets.push_back(Eigen::Triplet<double>(m_entries.row[e], m_entries.col[e], 0.0));
+    m_mat.resize(m_dim, m_dim);
+    m_mat.setFromTriplets(triplets.begin(), triplets.end());
+    m_mat.makeCompressed();
+
+    // Find the slot of each entry in the matrix value array
+    int nnz = (int)m_mat.nonZeros();
+    const int* outer = m_mat.outerIndexPtr();
+    const int* inner = m_mat.innerIndexPtr();
+    std::vector<int> slot(num_entries);
+    for (int e = 0; e < num_entries; e++) {
+        int row = m_entries.row[e];
+        slot[e] = (int)(std::lower_bound(inner + outer[row], inner + outer[row + 1], m_entries.col[e]) - inner);
+    }
+
+    // Group entries by slot, preserving call order within each slot (counting sort)
+    m_entries.slot_ptr.assign(nnz + 1, 0);
+    for (int e = 0; e < num_entries; e++)
+        m_entries.slot_ptr[slot[e] + 1]++;
+    for (int s = 0; s < nnz; s++)
+        m_entries.slot_ptr[s + 1] += m_entries.slot_ptr[s];
+    m_entries.slot_entries.resize(num_entries);
+    std::vector<int> pos(m_entries.slot_ptr.begin(), m_entries.slot_ptr.end() - 1);
+    for (int e = 0; e < num_entries; e++)
+        m_entries.slot_entries[pos[slot[e]]++] = e;
+}
+
 // ---------------------------------------------------------------------------
 
 void ChDirectSolverLS::WriteMatrix(const std::string& filename, const ChSparseMatrix& M) {
@@ -256,11 +405,12 @@ void ChDirectSolverLS::ArchiveOut(ChArchiveOut& archive_out) {
     archive_out << CHNVP(m_use_learner);
     archive_out << CHNVP(m_use_perm);
     archive_out << CHNVP(m_use_rhs_sparsity);
+    archive_out << CHNVP(m_incremental);
 }
 
 void ChDirectSolverLS::ArchiveIn(ChArchiveIn& archive_in) {
     // version number
-    /*int version =*/archive_in.VersionRead<ChDirectSolverLS>();
+    int version = archive_in.VersionRead<ChDirectSolverLS>();
 
     // deserialize parent class
     ChSolver::ArchiveIn(archive_in);
@@ -270,12 +420,16 @@ void ChDirectSolverLS::ArchiveIn(ChArchiveIn& archive_in) {
     archive_in >> CHNVP(m_use_learner);
     archive_in >> CHNVP(m_use_perm);
     archive_in >> CHNVP(m_use_rhs_sparsity);
+    if (version >= 1)
+        archive_in >> CHNVP(m_incremental);
 }
 
 // ---------------------------------------------------------------------------
 
 bool ChSolverSparseLU::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    if (m_analyze)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -304,7 +458,9 @@ void ChSolverSparseLU::PrintErrorMessage() {
 // ---------------------------------------------------------------------------
 
 bool ChSolverSparseQR::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    if (m_analyze)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -19,6 +19,8 @@
 #include "chrono/core/ChTimer.h"
 #include "chrono/solver/ChSolverLS.h"
 
+#include <vector>
+
 #include <Eigen/SparseLU>
 
 namespace chrono {
@@ -37,9 +39,10 @@ performing the actual matrix factorization and then computing the solution vecto
 See ChSolverMkl (which implements Eigen's interface to the Intel MKL Pardiso solver) and ChSolverMumps (which interfaces
 to the MUMPS solver).
 
-ChDirectSolverLS manages the detection and update of the matrix sparsity pattern, providing two main features:
+ChDirectSolverLS manages the detection and update of the matrix sparsity pattern, providing three main features:
 - sparsity pattern lock
 - sparsity pattern learning
+- incremental matrix assembly
 
 The sparsity pattern \e lock skips sparsity identification or reserving memory for nonzeros on all but the first call to
 Setup. This feature is intended for problems where the system matrix sparsity pattern does not change significantly from
@@ -56,6 +59,17 @@ to a fully dense matrix). This value is used if the sparsity pattern learner is
 space for matrix indices and nonzeros.
 See #SetSparsityEstimate();
 
+The \e incremental assembly feature is intended for problems with a fixed topology (e.g., FEA meshes and mechanisms
+without contacts). On the first call to Setup, all matrix entries written by the system descriptor are recorded and
+mapped to their slots in the value array of the compressed matrix. On subsequent calls, matrix assembly reduces to
+collecting the entry values and scattering them (in parallel) to their slots, with no search or insertion. The entry
+map is rebuilt automatically whenever the sequence of entries written by the system descriptor changes.\n
+See #UseIncrementalAssembly();
+
+Independent of the above settings, the symbolic analysis of the matrix (e.g., fill-reducing ordering) is performed only
+if the matrix sparsity pattern changed since the last factorization, provided the concrete solver supports separate
+analysis and factorization phases.
+
 <br>
 
 <div class="ce-warning">
@@ -92,6 +106,13 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
     void ForceSparsityPatternUpdate() { m_force_update = true; }
 
+    /// Enable/disable incremental assembly of the system matrix (default: false).\n
+    /// If enabled, the map from matrix entries to slots in the compressed matrix is built on the first call to Setup
+    /// and reused on subsequent calls, as long as the system descriptor writes the same sequence of matrix entries.
+    /// The sparsity pattern learner, the sparsity pattern lock, and the sparsity estimate are ignored in this mode.
+    /// Numeric assembly uses the number of threads set for Eigen (see ChSystem::SetNumThreads).
+    void UseIncrementalAssembly(bool val) { m_incremental = val; }
+
     /// Set estimate for matrix sparsity, a value in [0,1], with 0 indicating a fully dense matrix (default: 0.9).\n
     /// Only used if the sparsity pattern learner is disabled.
     void SetSparsityEstimate(double sparsity) { m_sparsity = sparsity; }
@@ -111,6 +132,9 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// A concrete direct sparse solver may or may not support this feature.
     virtual void EnableNullPivotDetection(bool val, double threshold = 0) { m_null_pivot_detection = val; }
 
+    /// Return the number of symbolic analyses of the matrix performed during calls to Setup.
+    unsigned int GetNumAnalyzeCalls() const { return m_analyze_call; }
+
     /// Reset timers for internal phases in Solve and Setup.
     void ResetTimers();
 
@@ -177,6 +201,8 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     virtual ChDirectSolverLS* AsDirect() override { return this; }
 
     /// Factorize the current sparse matrix and return true if successful.
+    /// A concrete solver which supports separate analysis and factorization phases should perform the symbolic analysis
+    /// only if #m_analyze is true.
     virtual bool FactorizeMatrix() = 0;
 
     /// Solve the linear system using the current factorization and right-hand side vector.
@@ -198,12 +224,15 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChVectorDynamic<double> m_rhs;  ///< right-hand side vector
     ChVectorDynamic<double> m_sol;  ///< solution vector
 
-    unsigned int m_solve_call;  ///< counter for calls to Solve
-    unsigned int m_setup_call;  ///< counter for calls to Setup
+    unsigned int m_solve_call;    ///< counter for calls to Solve
+    unsigned int m_setup_call;    ///< counter for calls to Setup
+    unsigned int m_analyze_call;  ///< counter for symbolic analyses of the matrix
 
     bool m_lock;          ///< is the matrix sparsity pattern locked?
     bool m_use_learner;   ///< use the sparsity pattern learner?
     bool m_force_update;  ///< force a call to the sparsity pattern learner?
+    bool m_incremental;   ///< use incremental matrix assembly?
+    bool m_analyze;       ///< must the concrete solver perform the symbolic analysis?
 
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
@@ -215,10 +244,34 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChTimer m_timer_solve_solvercall;  ///< timer for solution
 
   private:
+    class EntryRecorder;
+
+    /// Matrix entries written by the system descriptor, in call order, and their slots in the compressed matrix.
+    struct EntryMap {
+        std::vector<int> row;           ///< row index of each entry
+        std::vector<int> col;           ///< column index of each entry
+        std::vector<double> val;        ///< value of each entry
+        std::vector<char> overwrite;    ///< overwrite flag of each entry
+        std::vector<int> slot_ptr;      ///< start of each slot in slot_entries (size: nnz + 1)
+        std::vector<int> slot_entries;  ///< entry indices, grouped by slot (in call order within a slot)
+    };
+
+    /// Assemble the system matrix using the entry map, rebuilding the map and the matrix pattern if needed.
+    /// Return true if the matrix sparsity pattern was (re)created.
+    bool AssembleIncremental(ChSystemDescriptor& sysd);
+
+    /// Build the sparsity pattern of the problem matrix and the entry-to-slot map from the recorded entries.
+    void BuildEntryMap();
+
     void WriteMatrix(const std::string& filename, const ChSparseMatrix& M);
     void WriteVector(const std::string& filename, const ChVectorDynamic<double>& v);
+
+    EntryMap m_entries;  ///< entry map for incremental assembly
+    int m_nnz;           ///< number of nonzeros at the last symbolic analysis
 };
 
+CH_CLASS_VERSION(ChDirectSolverLS, 1)
+
 // ---------------------------------------------------------------------------
 
 /// Sparse LU direct solver.\n
@@ -25,6 +25,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/utils/ChTracer.h"
 
 // =============================================================================
 
@@ -181,6 +182,8 @@ ChIterativeSolverLS::~ChIterativeSolverLS() {
 }
 
 bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChIterativeSolverLS::Setup", "solver");
+
     // Calculate problem size
     int dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
 
@@ -216,6 +219,8 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
 }
 
 double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChIterativeSolverLS::Solve", "solver");
+
     // Assemble the problem right-hand side vector
     sysd.BuildSystemMatrix(nullptr, &m_rhs);
 
@@ -15,6 +15,7 @@
 #include "chrono/core/ChSparsityPatternLearner.h"
 
 #include "chrono/solver/ChSolverADMM.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -43,6 +44,8 @@ ChSolverADMM::ChSolverADMM(std::shared_ptr<ChDirectSolverLS> my_LS_engine) : ChS
 }
 
 double ChSolverADMM::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverADMM::Solve", "solver");
+
     switch (this->acceleration) {
         case AdmmAcceleration::BASIC:
             return _SolveBasic(sysd);
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverAPGD.h"
+#include "chrono/utils/ChTracer.h"
 
 #include <iostream>
 #include <sstream>
@@ -70,6 +71,8 @@ double ChSolverAPGD::Res4(ChSystemDescriptor& sysd) {
 }
 
 double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverAPGD::Solve", "solver");
+
     bool verbose = false;
     const std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
     const std::vector<ChVariables*>& mvariables = sysd.GetVariables();
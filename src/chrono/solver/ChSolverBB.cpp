@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverBB.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -22,6 +23,8 @@ CH_FACTORY_REGISTER(ChSolverBB)
 ChSolverBB::ChSolverBB() : n_armijo(10), max_armijo_backtrace(3), lastgoodres(1e30) {}
 
 double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverBB::Solve", "solver");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
     std::vector<ChVariables*>& mvariables = sysd.GetVariables();
 
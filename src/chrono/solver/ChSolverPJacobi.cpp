@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPJacobi.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -24,6 +25,8 @@ ChSolverPJacobi::ChSolverPJacobi() : maxviolation(0) {
 }
 
 double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPJacobi::Solve", "solver");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
     std::vector<ChVariables*>& mvariables = sysd.GetVariables();
 
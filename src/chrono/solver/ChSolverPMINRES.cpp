@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPMINRES.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -25,6 +26,8 @@ ChSolverPMINRES::ChSolverPMINRES()
       r_proj_resid(1e30) {}
 
 double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPMINRES::Solve", "solver");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
     std::vector<ChVariables*>& mvariables = sysd.GetVariables();
 
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -23,6 +24,8 @@ CH_UPCASTING(ChSolverPSOR, ChIterativeSolverVI)
 ChSolverPSOR::ChSolverPSOR() : maxviolation(0) {}
 
 double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPSOR::Solve", "solver");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
     std::vector<ChVariables*>& mvariables = sysd.GetVariables();
 
@@ -0,0 +1,429 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono/solver/ChSolverPSORmt.h"
+#include "chrono/utils/ChOpenMP.h"
+#include "chrono/utils/ChTracer.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverPSORmt)
+CH_UPCASTING(ChSolverPSORmt, ChIterativeSolverVI)
+
+ChSolverPSORmt::ChSolverPSORmt() : m_nthreads(ChOMP::GetNumProcs()), m_symmetric(false), maxviolation(0) {}
+
+void ChSolverPSORmt::SetNumThreads(int nthreads) {
+    m_nthreads = std::max(1, nthreads);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSolverPSORmt::PackConstraints(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariables();
+
+    // Refresh offsets of variables and constraints
+    unsigned int n_q = sysd.CountActiveVariables();
+    sysd.CountActiveConstraints();
+
+    // Map each column of the system-level vector 'q' to the active variables that own it
+    m_var_list.clear();
+    m_var_of_col.assign(n_q, -1);
+    for (auto var : mvariables) {
+        if (!var->IsActive())
+            continue;
+        int iv = (int)m_var_list.size();
+        for (unsigned int k = 0; k < var->GetDOF(); k++)
+            m_var_of_col[var->GetOffset() + k] = iv;
+        m_var_list.push_back(var);
+    }
+    m_q.setZero(n_q);
+
+    m_row_con.clear();
+    for (auto con : mconstraints) {
+        if (con->IsActive())
+            m_row_con.push_back(con);
+    }
+    int n_rows = (int)m_row_con.size();
+
+    // Collect the Jacobians of all active constraints, one row per constraint.
+    // Columns within a row are kept sorted by the sparse matrix, so the columns of a given variable are contiguous.
+    m_Cq_matrix.resize(n_rows, n_q);
+    m_Cq_matrix.reserve(Eigen::VectorXi::Constant(n_rows, 12));
+    for (int r = 0; r < n_rows; r++)
+        m_row_con[r]->PasteJacobianInto(m_Cq_matrix, r, 0);
+    m_Cq_matrix.makeCompressed();
+
+    // Size of each packed row: all DOFs of each variable touched by the constraint
+    m_row_ptr.resize(n_rows + 1);
+    m_row_ptr[0] = 0;
+
+#pragma omp parallel for schedule(static) num_threads(m_nthreads)
+    for (int r = 0; r < n_rows; r++) {
+        int size = 0;
+        int last_var = -1;
+        for (ChSparseMatrix::InnerIterator it(m_Cq_matrix, r); it; ++it) {
+            int iv = m_var_of_col[it.col()];
+            if (iv >= 0 && iv != last_var) {
+                size += (int)m_var_list[iv]->GetDOF();
+                last_var = iv;
+            }
+        }
+        m_row_ptr[r + 1] = size;
+    }
+
+    for (int r = 0; r < n_rows; r++)
+        m_row_ptr[r + 1] += m_row_ptr[r];
+
+    m_col.resize(m_row_ptr[n_rows]);
+    m_Cq.resize(m_row_ptr[n_rows]);
+    m_Eq.resize(m_row_ptr[n_rows]);
+    m_g.resize(n_rows);
+    m_b.resize(n_rows);
+    m_cfm.resize(n_rows);
+
+    // Fill packed rows with [Cq_i] and [Eq_i]=[invM]*[Cq_i]', compute g_i=[Cq_i]*[invM]*[Cq_i]' + cfm_i
+#pragma omp parallel for schedule(static) num_threads(m_nthreads)
+    for (int r = 0; r < n_rows; r++) {
+        double g = 0;
+        int p = m_row_ptr[r];
+        ChSparseMatrix::InnerIterator it(m_Cq_matrix, r);
+        while (it) {
+            int iv = m_var_of_col[it.col()];
+            if (iv < 0) {
+                ++it;
+                continue;
+            }
+            ChVariables* var = m_var_list[iv];
+            int off = (int)var->GetOffset();
+            int dof = (int)var->GetDOF();
+
+            for (int k = 0; k < dof; k++) {
+                m_col[p + k] = off + k;
+                m_Cq[p + k] = 0;
+            }
+            for (; it && it.col() < off + dof; ++it)
+                m_Cq[p + it.col() - off] = it.value();
+
+            Eigen::Map<ChVectorDynamic<>> Cq_v(&m_Cq[p], dof);
+            Eigen::Map<ChVectorDynamic<>> Eq_v(&m_Eq[p], dof);
+            var->ComputeMassInverseTimesVector(Eq_v, Cq_v);
+            g += Cq_v.dot(Eq_v);
+
+            p += dof;
+        }
+
+        m_cfm[r] = m_row_con[r]->GetComplianceTerm();
+        m_b[r] = m_row_con[r]->GetRightHandSide();
+        m_g[r] = g + m_cfm[r];
+    }
+}
+
+void ChSolverPSORmt::ColorBlocks() {
+    int n_rows = (int)m_row_con.size();
+
+    // Split rows into blocks: friction triplets n,u,v are processed together, all other constraints individually
+    m_block_ptr.clear();
+    int r = 0;
+    while (r < n_rows) {
+        m_block_ptr.push_back(r);
+        if (m_row_con[r]->GetMode() == ChConstraint::Mode::FRICTION && r + 2 < n_rows &&
+            m_row_con[r + 1]->GetMode() == ChConstraint::Mode::FRICTION &&
+            m_row_con[r + 2]->GetMode() == ChConstraint::Mode::FRICTION) {
+            // Average all g_i for the triplet of contact constraints n,u,v
+            double average_g_i = (m_g[r] + m_g[r + 1] + m_g[r + 2]) / 3.0;
+            m_g[r] = m_g[r + 1] = m_g[r + 2] = average_g_i;
+            r += 3;
+        } else {
+            r += 1;
+        }
+    }
+    int n_blocks = (int)m_block_ptr.size();
+    m_block_ptr.push_back(n_rows);
+
+    // Greedy coloring: assign to each block the smallest color not used by any block sharing one of its variables
+    int n_vars = (int)m_var_list.size();
+    std::vector<std::vector<int>> var_colors(n_vars);
+    std::vector<int> var_stamp(n_vars, -1);
+    std::vector<int> color_stamp;
+    std::vector<int> block_color(n_blocks);
+    std::vector<int> block_vars;
+    int n_colors = 0;
+
+    for (int b = 0; b < n_blocks; b++) {
+        // Collect the (distinct) variables of this block and mark the colors already used by them
+        block_vars.clear();
+        for (int row = m_block_ptr[b]; row < m_block_ptr[b + 1]; row++) {
+            for (int p = m_row_ptr[row]; p < m_row_ptr[row + 1]; p++) {
+                int iv = m_var_of_col[m_col[p]];
+                if (var_stamp[iv] == b)
+                    continue;
+                var_stamp[iv] = b;
+                block_vars.push_back(iv);
+                for (int c : var_colors[iv])
+                    color_stamp[c] = b;
+            }
+        }
+
+        int color = 0;
+        while (color < n_colors && color_stamp[color] == b)
+            color++;
+        if (color == n_colors) {
+            color_stamp.push_back(-1);
+            n_colors++;
+        }
+
+        block_color[b] = color;
+        for (int iv : block_vars)
+            var_colors[iv].push_back(color);
+    }
+
+    // Sort blocks by color, preserving the original order within each color
+    m_color_ptr.assign(n_colors + 1, 0);
+    for (int b = 0; b < n_blocks; b++)
+        m_color_ptr[block_color[b] + 1]++;
+    for (int c = 0; c < n_colors; c++)
+        m_color_ptr[c + 1] += m_color_ptr[c];
+
+    std::vector<int> fill(m_color_ptr.begin(), m_color_ptr.end() - 1);
+    m_block_order.resize(n_blocks);
+    for (int b = 0; b < n_blocks; b++)
+        m_block_order[fill[block_color[b]]++] = b;
+}
+
+// -----------------------------------------------------------------------------
+
+double ChSolverPSORmt::RowTimesState(unsigned int row) const {
+    double result = 0;
+    for (int p = m_row_ptr[row]; p < m_row_ptr[row + 1]; p++)
+        result += m_Cq[p] * m_q(m_col[p]);
+    return result;
+}
+
+void ChSolverPSORmt::IncrementStateRow(unsigned int row, double deltal) {
+    for (int p = m_row_ptr[row]; p < m_row_ptr[row + 1]; p++)
+        m_q(m_col[p]) += m_Eq[p] * deltal;
+}
+
+double ChSolverPSORmt::SweepBlock(unsigned int block, double& maxdeltalambda) {
+    unsigned int row = m_block_ptr[block];
+    unsigned int n = m_block_ptr[block + 1] - row;
+    ChConstraint* con = m_row_con[row];
+
+    if (n == 3) {
+        // Friction triplet n,u,v
+        double old_lambda[3];
+        double candidate_violation = 0;
+        for (unsigned int k = 0; k < 3; k++) {
+            ChConstraint* con_k = m_row_con[row + k];
+
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual =
+                RowTimesState(row + k) + m_b[row + k] + m_cfm[row + k] * con_k->GetLagrangeMultiplier();
+
+            if (k == 0)
+                candidate_violation = std::abs(std::min(0.0, mresidual));
+
+            // update:   lambda += delta_lambda;
+            double deltal = (m_omega / m_g[row + k]) * (-mresidual);
+            old_lambda[k] = con_k->GetLagrangeMultiplier();
+            con_k->SetLagrangeMultiplier(old_lambda[k] + deltal);
+        }
+
+        con->Project();  // the N normal component will take care of N,U,V
+
+        for (unsigned int k = 0; k < 3; k++) {
+            ChConstraint* con_k = m_row_con[row + k];
+            double new_lambda = con_k->GetLagrangeMultiplier();
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (m_shlambda != 1.0) {
+                new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda[k];
+                con_k->SetLagrangeMultiplier(new_lambda);
+            }
+            double true_delta = new_lambda - old_lambda[k];
+            IncrementStateRow(row + k, true_delta);
+            maxdeltalambda = std::max(maxdeltalambda, std::abs(true_delta));
+        }
+
+        return candidate_violation;
+    }
+
+    // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+    double mresidual = RowTimesState(row) + m_b[row] + m_cfm[row] * con->GetLagrangeMultiplier();
+
+    // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+    double candidate_violation;
+    if (con->GetMode() == ChConstraint::Mode::UNILATERAL)
+        candidate_violation = std::abs(std::min(0.0, mresidual));
+    else
+        candidate_violation = std::abs(con->Violation(mresidual));
+
+    // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+    double deltal = (m_omega / m_g[row]) * (-mresidual);
+
+    // update:   lambda += delta_lambda;
+    double old_lambda = con->GetLagrangeMultiplier();
+    con->SetLagrangeMultiplier(old_lambda + deltal);
+
+    // If new lagrangian multiplier does not satisfy inequalities, project
+    // it into an admissible orthant (or, in general, onto an admissible set)
+    con->Project();
+
+    double new_lambda = con->GetLagrangeMultiplier();
+
+    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+    if (m_shlambda != 1.0) {
+        new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+        con->SetLagrangeMultiplier(new_lambda);
+    }
+
+    double true_delta = new_lambda - old_lambda;
+    IncrementStateRow(row, true_delta);
+    maxdeltalambda = std::max(maxdeltalambda, std::abs(true_delta));
+
+    return candidate_violation;
+}
+
+// -----------------------------------------------------------------------------
+
+double ChSolverPSORmt::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPSORmt::Solve", "solver");
+
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+
+    m_iterations = 0;
+    maxviolation = 0;
+
+    // 1)  Pack Jacobians, g_i=[Cq_i]*[invM_i]*[Cq_i]' and [Eq_i]=[invM_i]*[Cq_i]' of all active constraints,
+    //     then color the constraint blocks so that blocks of the same color do not share variables.
+    PackConstraints(sysd);
+    ColorBlocks();
+
+    int n_vars = (int)m_var_list.size();
+    int n_colors = (int)GetNumColors();
+
+    // 2)  Compute, for all items with variables, the initial guess for
+    //     still unconstrained system:
+#pragma omp parallel for schedule(static) num_threads(m_nthreads)
+    for (int iv = 0; iv < n_vars; iv++) {
+        ChVariables* var = m_var_list[iv];
+        var->ComputeMassInverseTimesVector(m_q.segment(var->GetOffset(), var->GetDOF()),
+                                           var->Force());  // q = [M]'*fb
+    }
+
+    // 3)  For all items with variables, add the effect of initial (guessed)
+    //     lagrangian reactions of constraints, if a warm start is desired.
+    //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
+    if (m_warm_start) {
+#pragma omp parallel num_threads(m_nthreads)
+        {
+            for (int c = 0; c < n_colors; c++) {
+#pragma omp for schedule(static)
+                for (int k = m_color_ptr[c]; k < m_color_ptr[c + 1]; k++) {
+                    int b = m_block_order[k];
+                    for (int row = m_block_ptr[b]; row < m_block_ptr[b + 1]; row++)
+                        IncrementStateRow(row, m_row_con[row]->GetLagrangeMultiplier());
+                }
+            }
+        }
+    } else {
+        for (auto con : mconstraints)
+            con->SetLagrangeMultiplier(0.);
+    }
+
+    // 4)  Perform the iteration loops.
+    //     Colors are processed in sequence; all blocks of a given color are processed concurrently.
+    //     With a symmetric sweep, odd iterations traverse the colors in reverse order.
+    std::fill(violation_history.begin(), violation_history.end(), 0.0);
+    std::fill(dlambda_history.begin(), dlambda_history.end(), 0.0);
+
+    std::vector<double> thread_violation(m_nthreads);
+    std::vector<double> thread_deltalambda(m_nthreads);
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        bool backward = m_symmetric && (iter % 2 == 1);
+
+        std::fill(thread_violation.begin(), thread_violation.end(), 0.0);
+        std::fill(thread_deltalambda.begin(), thread_deltalambda.end(), 0.0);
+
+#pragma omp parallel num_threads(m_nthreads)
+        {
+            CH_TRACE_ZONE("ChSolverPSORmt::Sweep thread", "solver");
+            int tid = ChOMP::GetThreadNum();
+            double violation = 0;
+            double deltalambda = 0;
+
+            for (int i = 0; i < n_colors; i++) {
+                int c = backward ? n_colors - 1 - i : i;
+#pragma omp for schedule(static)
+                for (int k = m_color_ptr[c]; k < m_color_ptr[c + 1]; k++)
+                    violation = std::max(violation, SweepBlock(m_block_order[k], deltalambda));
+            }
+
+            thread_violation[tid] = violation;
+            thread_deltalambda[tid] = deltalambda;
+        }
+
+        maxviolation = *std::max_element(thread_violation.begin(), thread_violation.end());
+        double maxdeltalambda = *std::max_element(thread_deltalambda.begin(), thread_deltalambda.end());
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        // With a symmetric sweep, only test after a complete forward + backward pass.
+        if (maxviolation < m_tolerance && (!m_symmetric || backward))
+            break;
+    }
+
+    // 5)  Scatter the system-level vector 'q' back into the variables
+#pragma omp parallel for schedule(static) num_threads(m_nthreads)
+    for (int iv = 0; iv < n_vars; iv++) {
+        ChVariables* var = m_var_list[iv];
+        var->State() = m_q.segment(var->GetOffset(), var->GetDOF());
+    }
+
+    return maxviolation;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSolverPSORmt::ArchiveOut(ChArchiveOut& archive_out) {
+    // version number
+    archive_out.VersionWrite<ChSolverPSORmt>();
+    // serialize parent class
+    ChIterativeSolverVI::ArchiveOut(archive_out);
+    // serialize all member data:
+    archive_out << CHNVP(m_nthreads);
+    archive_out << CHNVP(m_symmetric);
+}
+
+void ChSolverPSORmt::ArchiveIn(ChArchiveIn& archive_in) {
+    // version number
+    /*int version =*/archive_in.VersionRead<ChSolverPSORmt>();
+    // deserialize parent class
+    ChIterativeSolverVI::ArchiveIn(archive_in);
+    // stream in all member data:
+    archive_in >> CHNVP(m_nthreads);
+    archive_in >> CHNVP(m_symmetric);
+}
+
+}  // end namespace chrono
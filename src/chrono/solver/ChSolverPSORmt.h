@@ -0,0 +1,118 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CHSOLVER_PSOR_MT_H
+#define CHSOLVER_PSOR_MT_H
+
+#include <vector>
+
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Multithreaded variant of the projected SOR solver (see ChSolverPSOR and ChSolverPSSOR).\n
+/// At the beginning of each Solve(), the constraint Jacobians [Cq_i], the products [Eq_i]=[invM]*[Cq_i]' and the Schur
+/// diagonal terms g_i are packed into flat arrays, indexed directly into a system-level vector of variables 'q'. The
+/// constraints (with friction triplets n,u,v treated as a single block) are then colored so that no two blocks of the
+/// same color share a ChVariables object. Blocks of the same color are swept concurrently, colors are swept in
+/// sequence. The per-block update (over-relaxation, sharpness factor, friction cone projection) is the same as in the
+/// serial ChSolverPSOR, so this is still a projected Gauss-Seidel method, only with a different constraint ordering.\n
+/// If the symmetric sweep is enabled, each iteration performs a forward and a backward sweep over the colors, as in
+/// ChSolverPSSOR.\n
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
+/// solver.
+class ChApi ChSolverPSORmt : public ChIterativeSolverVI {
+  public:
+    ChSolverPSORmt();
+
+    ~ChSolverPSORmt() {}
+
+    virtual Type GetType() const override { return m_symmetric ? Type::PSSOR : Type::PSOR; }
+
+    /// Set the number of OpenMP threads used for the constraint sweeps (default: number of available processors).
+    void SetNumThreads(int nthreads);
+
+    /// Return the number of threads used for the constraint sweeps.
+    int GetNumThreads() const { return m_nthreads; }
+
+    /// Enable/disable the symmetric (forward + backward) sweep, as in ChSolverPSSOR (default: false).
+    void EnableSymmetricSweep(bool val) { m_symmetric = val; }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum constraint violation after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Return the tolerance error reached during the last solve.
+    /// For the PSOR solver, this is the maximum constraint violation.
+    virtual double GetError() const override { return maxviolation; }
+
+    /// Return the number of colors (i.e., sequential sweep stages) used during the last solve.
+    unsigned int GetNumColors() const { return (unsigned int)(m_color_ptr.empty() ? 0 : m_color_ptr.size() - 1); }
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& archive_out) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& archive_in) override;
+
+  private:
+    /// Pack Jacobians, [invM]*[Cq]' and Schur diagonal of all active constraints into flat arrays.
+    void PackConstraints(ChSystemDescriptor& sysd);
+
+    /// Group constraints into blocks (single rows or friction triplets) and color the block/variable graph.
+    void ColorBlocks();
+
+    /// Perform the projected update of the given block. Returns the (true) constraint violation.
+    double SweepBlock(unsigned int block, double& maxdeltalambda);
+
+    /// Compute [Cq_r]*q for the given packed row.
+    double RowTimesState(unsigned int row) const;
+
+    /// Perform q += [Eq_r]*deltal for the given packed row.
+    void IncrementStateRow(unsigned int row, double deltal);
+
+    int m_nthreads;    ///< number of threads used in the sweeps
+    bool m_symmetric;  ///< if true, perform forward and backward sweeps
+    double maxviolation;
+
+    ChVectorDynamic<> m_q;  ///< system-level vector of variables
+
+    std::vector<ChVariables*> m_var_list;  ///< active variables
+    std::vector<int> m_var_of_col;         ///< index in m_var_list of the variables owning each column of 'q'
+
+    std::vector<ChConstraint*> m_row_con;  ///< active constraints, one per packed row
+    std::vector<int> m_row_ptr;            ///< start of each row in m_col/m_Cq/m_Eq (size: num. rows + 1)
+    std::vector<int> m_col;                ///< column (index in 'q') of each packed entry
+    std::vector<double> m_Cq;              ///< packed Jacobian entries
+    std::vector<double> m_Eq;              ///< packed [invM]*[Cq]' entries
+    std::vector<double> m_g;               ///< Schur diagonal terms
+    std::vector<double> m_b;               ///< constraint right-hand sides
+    std::vector<double> m_cfm;             ///< constraint compliance terms
+
+    std::vector<int> m_block_ptr;    ///< first row of each block (size: num. blocks + 1)
+    std::vector<int> m_block_order;  ///< block indices, sorted by color
+    std::vector<int> m_color_ptr;    ///< start of each color in m_block_order (size: num. colors + 1)
+
+    ChSparseMatrix m_Cq_matrix;  ///< scratch matrix for collecting the constraint Jacobians
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPSSOR.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -22,6 +23,8 @@ CH_FACTORY_REGISTER(ChSolverPSSOR)
 ChSolverPSSOR::ChSolverPSSOR() : maxviolation(0) {}
 
 double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPSSOR::Solve", "solver");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
     std::vector<ChVariables*>& mvariables = sysd.GetVariables();
 
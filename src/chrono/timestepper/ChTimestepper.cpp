@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -68,6 +69,80 @@ void ChTimestepper::ArchiveIn(ChArchiveIn& archive) {
 
 // -----------------------------------------------------------------------------
 
+// Trick to avoid putting the following mapper macro inside the class definition in .h file:
+// enclose macros in local 'ChImplicitIterativeTimestepper_JacobianUpdate_enum_mapper'.
+class ChImplicitIterativeTimestepper_JacobianUpdate_enum_mapper : public ChImplicitIterativeTimestepper {
+  public:
+    CH_ENUM_MAPPER_BEGIN(JacobianUpdate);
+    CH_ENUM_VAL(JacobianUpdate::EVERY_ITERATION);
+    CH_ENUM_VAL(JacobianUpdate::EVERY_STEP);
+    CH_ENUM_VAL(JacobianUpdate::AUTOMATIC);
+    CH_ENUM_MAPPER_END(JacobianUpdate);
+};
+
+bool ChImplicitIterativeTimestepper::JacobianUpdateRequired(double h, unsigned int nv, unsigned int nc) const {
+    if (jacobian_update != JacobianUpdate::AUTOMATIC)
+        return true;
+    return !jacobian_valid || h != jacobian_h || nv != jacobian_nv || nc != jacobian_nc;
+}
+
+void ChImplicitIterativeTimestepper::JacobianUpdated(double h, unsigned int nv, unsigned int nc) {
+    jacobian_valid = true;
+    jacobian_h = h;
+    jacobian_nv = nv;
+    jacobian_nc = nc;
+}
+
+bool ChImplicitIterativeTimestepper::MonitorJacobianReuse(double nrm, double nrm_prev) {
+    if (nrm_prev <= 0)
+        return true;
+
+    double rate = nrm / nrm_prev;
+
+    // Diverging iteration: force a matrix update
+    if (rate >= 1) {
+        jacobian_valid = false;
+        return false;
+    }
+
+    // Slow convergence: update the matrix at the next step
+    if (rate > jacobian_max_rate)
+        jacobian_valid = false;
+
+    return true;
+}
+
+void ChImplicitIterativeTimestepper::ArchiveOut(ChArchiveOut& archive) {
+    // version number
+    archive.VersionWrite(2);
+    // serialize all member data:
+    archive << CHNVP(maxiters);
+    archive << CHNVP(reltol);
+    archive << CHNVP(abstolS);
+    archive << CHNVP(abstolL);
+    ChImplicitIterativeTimestepper_JacobianUpdate_enum_mapper::JacobianUpdate_mapper jacobianmapper;
+    archive << CHNVP(jacobianmapper(jacobian_update), "jacobian_update");
+    archive << CHNVP(jacobian_max_rate);
+}
+
+void ChImplicitIterativeTimestepper::ArchiveIn(ChArchiveIn& archive) {
+    // version number
+    int version = archive.VersionRead();
+    // stream in all member data:
+    archive >> CHNVP(maxiters);
+    archive >> CHNVP(reltol);
+    archive >> CHNVP(abstolS);
+    archive >> CHNVP(abstolL);
+    if (version >= 2) {
+        ChImplicitIterativeTimestepper_JacobianUpdate_enum_mapper::JacobianUpdate_mapper jacobianmapper;
+        archive >> CHNVP(jacobianmapper(jacobian_update), "jacobian_update");
+        archive >> CHNVP(jacobian_max_rate);
+    }
+    jacobian_valid = false;
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerExpl)
 CH_UPCASTING(ChTimestepperEulerExpl, ChTimestepperIorder)
@@ -76,6 +151,8 @@ CH_UPCASTING(ChTimestepperEulerExpl, ChExplicitTimestepper)
 // Euler explicit timestepper.
 // This performs the typical  y_new = y+ dy/dt * dt integration with Euler formula.
 void ChTimestepperEulerExpl::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerExpl::Advance", "timestepper");
+
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -129,6 +206,8 @@ CH_UPCASTING(ChTimestepperEulerExplIIorder, ChExplicitTimestepper)
 //    v_new = v + a * dt
 // integration with Euler formula.
 void ChTimestepperEulerExplIIorder::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerExplIIorder::Advance", "timestepper");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -184,6 +263,8 @@ CH_UPCASTING(ChTimestepperEulerSemiImplicit, ChExplicitTimestepper)
 //    x_new = x + v_new * dt
 // integration with Euler semi-implicit formula.
 void ChTimestepperEulerSemiImplicit::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerSemiImplicit::Advance", "timestepper");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -235,6 +316,8 @@ CH_UPCASTING(ChTimestepperRungeKuttaExpl, ChExplicitTimestepper)
 
 // Performs a step of a 4th order explicit Runge-Kutta integration scheme.
 void ChTimestepperRungeKuttaExpl::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperRungeKuttaExpl::Advance", "timestepper");
+
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -299,6 +382,8 @@ CH_UPCASTING(ChTimestepperHeun, ChExplicitTimestepper)
 
 // Performs a step of a Heun explicit integrator. It is like a 2nd Runge Kutta.
 void ChTimestepperHeun::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperHeun::Advance", "timestepper");
+
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -360,6 +445,8 @@ CH_UPCASTING(ChTimestepperLeapfrog, ChExplicitTimestepper)
 // Suggestion: use the ChTimestepperEulerSemiImplicit, it gives
 // the same accuracy with a bit of faster performance.
 void ChTimestepperLeapfrog::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperLeapfrog::Advance", "timestepper");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -414,6 +501,8 @@ CH_UPCASTING(ChTimestepperEulerImplicit, ChImplicitIterativeTimestepper)
 
 // Performs a step of Euler implicit for II order systems
 void ChTimestepperEulerImplicit::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerImplicit::Advance", "timestepper");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -444,8 +533,19 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
-
-    for (int i = 0; i < this->GetMaxIters(); ++i) {
+    numfallbacks = 0;
+
+    // Decide whether the Newton matrix must be updated at the first iteration.
+    // With JacobianUpdate::AUTOMATIC, a Newton matrix from a previous step may be reused; in that case, monitor the
+    // convergence rate and restart the iteration with an updated matrix on divergence or lack of convergence.
+    unsigned int nv = mintegrable->GetNumCoordsVelLevel();
+    unsigned int nc = mintegrable->GetNumConstraints();
+    bool call_setup = JacobianUpdateRequired(dt, nv, nc);
+    bool matrix_is_reused = !call_setup;
+    double Dv_nrm_prev = 0;
+
+    // Evaluate the residuals at the current estimate and return true if the iteration has converged
+    auto converged = [&]() {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
         R.setZero();
         Qc.setZero();
@@ -454,14 +554,22 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
         mintegrable->LoadResidual_CqL(R, L, dt);           // R += dt*Cq'*l
         mintegrable->LoadConstraint_C(Qc, 1.0 / dt, Qc_do_clamp,
                                       Qc_clamping);  // Qc= C/dt  (sign flipped later in StateSolveCorrection)
+        return (R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL);
+    };
+
+    for (int i = 0; i < this->GetMaxIters(); ++i) {
+        bool done = converged();
 
         if (verbose)
             std::cout << " Euler iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                       << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if (done)
             break;
 
+        if (verbose && jacobian_update != JacobianUpdate::EVERY_ITERATION && call_setup)
+            std::cout << " Euler call Setup." << std::endl;
+
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
             1.0,                            // factor for  M
@@ -470,12 +578,18 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
+            call_setup                      // call the solver's Setup?
         );
 
         numiters++;
-        numsetups++;
         numsolves++;
+        if (call_setup) {
+            numsetups++;
+            JacobianUpdated(dt, nv, nc);
+        }
+
+        // Unless using full Newton, do not call Setup again
+        call_setup = (jacobian_update == JacobianUpdate::EVERY_ITERATION);
 
         Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -483,6 +597,32 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
         Vnew += Dv;
 
         Xnew = X + Vnew * dt;
+
+        // If the Newton matrix is from a previous step, restart with an updated matrix on divergence or if the
+        // maximum number of iterations was reached
+        if (matrix_is_reused) {
+            double Dv_nrm = Dv.norm();
+            bool restart = !MonitorJacobianReuse(Dv_nrm, Dv_nrm_prev);
+            // At the last iteration, restart only if the corrected estimate does not pass the convergence test
+            if (!restart && i == this->GetMaxIters() - 1) {
+                if (converged())
+                    break;
+                restart = true;
+            }
+            if (restart) {
+                if (verbose)
+                    std::cout << " Euler restart iteration with updated matrix." << std::endl;
+                Xnew = X + V * dt;
+                Vnew = V;
+                L.setZero();
+                call_setup = true;
+                matrix_is_reused = false;
+                numfallbacks++;
+                i = -1;
+                continue;
+            }
+            Dv_nrm_prev = Dv_nrm;
+        }
     }
 
     mintegrable->StateScatterAcceleration(
@@ -526,6 +666,8 @@ CH_UPCASTING(ChTimestepperEulerImplicitLinearized, ChImplicitTimestepper)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the typical Anitescu stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerImplicitLinearized::Advance", "timestepper");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -615,6 +757,8 @@ CH_UPCASTING(ChTimestepperEulerImplicitProjected, ChImplicitTimestepper)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the Tasora stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerImplicitProjected::Advance", "timestepper");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -726,6 +870,8 @@ CH_UPCASTING(ChTimestepperTrapezoidal, ChImplicitIterativeTimestepper)
 // order in constraint reactions. Use damped HHT or damped Newmark for
 // more advanced options.
 void ChTimestepperTrapezoidal::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperTrapezoidal::Advance", "timestepper");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -840,6 +986,8 @@ CH_UPCASTING(ChTimestepperTrapezoidalLinearized, ChImplicitIterativeTimestepper)
 
 // Performs a step of trapezoidal implicit linearized for II order systems
 void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperTrapezoidalLinearized::Advance", "timestepper");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -939,6 +1087,8 @@ CH_UPCASTING(ChTimestepperTrapezoidalLinearized2, ChImplicitIterativeTimestepper
 // Performs a step of trapezoidal implicit linearized for II order systems
 /// SIMPLIFIED VERSION -DOES NOT WORK - PREFER ChTimestepperTrapezoidalLinearized
 void ChTimestepperTrapezoidalLinearized2::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperTrapezoidalLinearized2::Advance", "timestepper");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -1043,6 +1193,8 @@ void ChTimestepperNewmark::SetGammaBeta(double mgamma, double mbeta) {
 
 // Performs a step of Newmark constrained implicit for II order DAE systems
 void ChTimestepperNewmark::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperNewmark::Advance", "timestepper");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -1077,9 +1229,19 @@ void ChTimestepperNewmark::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
-    bool call_setup = true;
-
-    for (int i = 0; i < this->GetMaxIters(); ++i) {
+    numfallbacks = 0;
+
+    // Decide whether the Newton matrix must be updated at the first iteration.
+    // With JacobianUpdate::AUTOMATIC, a Newton matrix from a previous step may be reused; in that case, monitor the
+    // convergence rate and restart the iteration with an updated matrix on divergence or lack of convergence.
+    unsigned int nv = mintegrable->GetNumCoordsVelLevel();
+    unsigned int nc = mintegrable->GetNumConstraints();
+    bool call_setup = JacobianUpdateRequired(dt, nv, nc);
+    bool matrix_is_reused = !call_setup;
+    double Da_nrm_prev = 0;
+
+    // Evaluate the residuals at the current estimate and return true if the iteration has converged
+    auto converged = [&]() {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
 
         R.setZero(mintegrable->GetNumCoordsVelLevel());
@@ -1090,12 +1252,17 @@ void ChTimestepperNewmark::Advance(const double dt) {
         mintegrable->LoadConstraint_C(
             Qc, (1.0 / (beta * dt * dt)), Qc_do_clamp,
             Qc_clamping);  //  Qc = 1/(beta*dt^2)*C  (sign will be flipped later in StateSolveCorrection)
+        return (R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL);
+    };
+
+    for (int i = 0; i < this->GetMaxIters(); ++i) {
+        bool done = converged();
 
         if (verbose)
             std::cout << " Newmark iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                       << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+        if (done) {
             if (verbose) {
                 std::cout << " Newmark NR converged (" << i << ")."
                           << "  T = " << T + dt << "  h = " << dt << std::endl;
@@ -1103,7 +1270,7 @@ void ChTimestepperNewmark::Advance(const double dt) {
             break;
         }
 
-        if (verbose && modified_Newton && call_setup)
+        if (verbose && jacobian_update != JacobianUpdate::EVERY_ITERATION && call_setup)
             std::cout << " Newmark call Setup." << std::endl;
 
         mintegrable->StateSolveCorrection(  //
@@ -1121,10 +1288,11 @@ void ChTimestepperNewmark::Advance(const double dt) {
         numsolves++;
         if (call_setup) {
             numsetups++;
+            JacobianUpdated(dt, nv, nc);
         }
 
-        // If using modified Newton, do not call Setup again
-        call_setup = !modified_Newton;
+        // Unless using full Newton, do not call Setup again
+        call_setup = (jacobian_update == JacobianUpdate::EVERY_ITERATION);
 
         L += Dl;  // Note it is not -= Dl because we assume StateSolveCorrection flips sign of Dl
         Anew += Da;
@@ -1132,6 +1300,33 @@ void ChTimestepperNewmark::Advance(const double dt) {
         Xnew = X + V * dt + A * (dt * dt * (0.5 - beta)) + Anew * (dt * dt * beta);
 
         Vnew = V + A * (dt * (1.0 - gamma)) + Anew * (dt * gamma);
+
+        // If the Newton matrix is from a previous step, restart with an updated matrix on divergence or if the
+        // maximum number of iterations was reached
+        if (matrix_is_reused) {
+            double Da_nrm = Da.norm();
+            bool restart = !MonitorJacobianReuse(Da_nrm, Da_nrm_prev);
+            // At the last iteration, restart only if the corrected estimate does not pass the convergence test
+            if (!restart && i == this->GetMaxIters() - 1) {
+                if (converged())
+                    break;
+                restart = true;
+            }
+            if (restart) {
+                if (verbose)
+                    std::cout << " Newmark restart iteration with updated matrix." << std::endl;
+                Anew.setZero(mintegrable->GetNumCoordsVelLevel(), mintegrable);
+                Vnew = V;
+                Xnew = X + Vnew * dt;
+                L.setZero();
+                call_setup = true;
+                matrix_is_reused = false;
+                numfallbacks++;
+                i = -1;
+                continue;
+            }
+            Da_nrm_prev = Da_nrm;
+        }
     }
 
     X = Xnew;
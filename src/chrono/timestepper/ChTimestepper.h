@@ -232,19 +232,48 @@ class ChApi ChImplicitTimestepper {};
 /// using an iterative process, up to a desired tolerance. At each iteration,
 /// a linear system must be solved.
 class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
+  public:
+    /// Strategy for updating the Newton matrix (Jacobian) during the nonlinear iterations.
+    enum class JacobianUpdate {
+        EVERY_ITERATION,  ///< full Newton: the Newton matrix is updated at every iteration
+        EVERY_STEP,       ///< modified Newton: the Newton matrix is updated once at the beginning of each step
+        AUTOMATIC         ///< modified Newton: the Newton matrix is reused across steps until convergence slows down
+    };
+
   protected:
     unsigned int maxiters;  ///< maximum number of iterations
     double reltol;          ///< relative tolerance
     double abstolS;         ///< absolute tolerance (states)
     double abstolL;         ///< absolute tolerance (Lagrange multipliers)
 
-    unsigned int numiters;   ///< number of iterations
-    unsigned int numsetups;  ///< number of calls to the solver's Setup function
-    unsigned int numsolves;  ///< number of calls to the solver's Solve function
+    unsigned int numiters;      ///< number of iterations
+    unsigned int numsetups;     ///< number of calls to the solver's Setup function
+    unsigned int numsolves;     ///< number of calls to the solver's Solve function
+    unsigned int numfallbacks;  ///< number of Newton restarts with an updated Newton matrix
+
+    JacobianUpdate jacobian_update;  ///< Newton matrix update strategy
+    double jacobian_max_rate;        ///< maximum convergence rate for reusing the Newton matrix (AUTOMATIC)
+    bool jacobian_valid;             ///< can the current Newton matrix be reused in a new step?
+    double jacobian_h;               ///< step size used in the current Newton matrix
+    unsigned int jacobian_nv;        ///< number of velocity-level coordinates for the current Newton matrix
+    unsigned int jacobian_nc;        ///< number of constraints for the current Newton matrix
 
   public:
     ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+        : maxiters(6),
+          reltol(1e-4),
+          abstolS(1e-10),
+          abstolL(1e-10),
+          numiters(0),
+          numsetups(0),
+          numsolves(0),
+          numfallbacks(0),
+          jacobian_update(JacobianUpdate::EVERY_STEP),
+          jacobian_max_rate(0.5),
+          jacobian_valid(false),
+          jacobian_h(0),
+          jacobian_nv(0),
+          jacobian_nc(0) {}
     virtual ~ChImplicitIterativeTimestepper() {}
 
     /// Set the max number of iterations using the Newton Raphson procedure
@@ -275,6 +304,24 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
         abstolL = abs_tol;
     }
 
+    /// Set the strategy for updating the Newton matrix.
+    /// With JacobianUpdate::AUTOMATIC, the Newton matrix (and its factorization, for direct solvers) is reused across
+    /// steps, as long as the step size and the problem size do not change. The contraction rate of the Newton
+    /// corrections is monitored; the matrix is updated at the next step if the rate exceeds the value set with
+    /// SetJacobianMaxRate, and the current step is restarted with an updated matrix if the iteration diverges or does
+    /// not converge. Not all implicit timesteppers support all strategies (see the derived classes).
+    void SetJacobianUpdateMethod(JacobianUpdate method) {
+        jacobian_update = method;
+        jacobian_valid = false;
+    }
+
+    /// Return the strategy for updating the Newton matrix.
+    JacobianUpdate GetJacobianUpdateMethod() const { return jacobian_update; }
+
+    /// Set the maximum Newton contraction rate (ratio of successive correction norms) for which a Newton matrix from a
+    /// previous step is still considered acceptable (default: 0.5). Only used with JacobianUpdate::AUTOMATIC.
+    void SetJacobianMaxRate(double rate) { jacobian_max_rate = rate; }
+
     /// Return the number of iterations.
     unsigned int GetNumIterations() const { return numiters; }
 
@@ -284,27 +331,35 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     /// Return the number of calls to the solver's Solve function.
     unsigned int GetNumSolveCalls() const { return numsolves; }
 
+    /// Return the number of solver Setup calls avoided during the last step by reusing an existing Newton matrix.
+    /// This is the number of Newton iterations which, under full Newton, would have required an update (and
+    /// factorization) of the Newton matrix.
+    unsigned int GetNumSetupsAvoided() const { return numsolves - numsetups; }
+
+    /// Return the number of times the Newton iteration was restarted with an updated Newton matrix during the last step
+    /// because a reused matrix led to divergence or lack of convergence. Only relevant with JacobianUpdate::AUTOMATIC.
+    unsigned int GetNumJacobianFallbacks() const { return numfallbacks; }
+
     /// Method to allow serialization of transient data to archives.
-    virtual void ArchiveOut(ChArchiveOut& archive) {
-        // version number
-        archive.VersionWrite(1);
-        // serialize all member data:
-        archive << CHNVP(maxiters);
-        archive << CHNVP(reltol);
-        archive << CHNVP(abstolS);
-        archive << CHNVP(abstolL);
-    }
+    virtual void ArchiveOut(ChArchiveOut& archive);
 
     /// Method to allow de-serialization of transient data from archives.
-    virtual void ArchiveIn(ChArchiveIn& archive) {
-        // version number
-        /*int version =*/archive.VersionRead();
-        // stream in all member data:
-        archive >> CHNVP(maxiters);
-        archive >> CHNVP(reltol);
-        archive >> CHNVP(abstolS);
-        archive >> CHNVP(abstolL);
-    }
+    virtual void ArchiveIn(ChArchiveIn& archive);
+
+  protected:
+    /// Return true if the Newton matrix must be updated at the beginning of a step of size h.
+    /// Always true, except when using JacobianUpdate::AUTOMATIC and the current Newton matrix is still valid for the
+    /// given step size and problem size.
+    bool JacobianUpdateRequired(double h, unsigned int nv, unsigned int nc) const;
+
+    /// Mark the Newton matrix as updated for a step of size h and the given problem size.
+    void JacobianUpdated(double h, unsigned int nv, unsigned int nc);
+
+    /// Monitor the convergence of a Newton iteration performed with a Newton matrix from a previous step, given the
+    /// norms of the current and previous corrections. If the contraction rate is too large, the matrix is marked for
+    /// update at the next step. Return false if the iteration diverges (in which case the step should be restarted
+    /// with an updated Newton matrix).
+    bool MonitorJacobianReuse(double nrm, double nrm_prev);
 };
 
 /// Euler explicit timestepper.
@@ -460,8 +515,11 @@ class ChApi ChTimestepperEulerImplicit : public ChTimestepperIIorder, public ChI
 
   public:
     /// Constructors (default empty)
+    /// By default, the Newton matrix is updated at every iteration (see SetJacobianUpdateMethod).
     ChTimestepperEulerImplicit(ChIntegrableIIorder* intgr = nullptr)
-        : ChTimestepperIIorder(intgr), ChImplicitIterativeTimestepper() {}
+        : ChTimestepperIIorder(intgr), ChImplicitIterativeTimestepper() {
+        jacobian_update = JacobianUpdate::EVERY_ITERATION;
+    }
 
     virtual Type GetType() const override { return Type::EULER_IMPLICIT; }
 
@@ -637,14 +695,13 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     ChVectorDynamic<> R;
     ChVectorDynamic<> Rold;
     ChVectorDynamic<> Qc;
-    bool modified_Newton;
 
   public:
     /// Constructors (default empty)
     ChTimestepperNewmark(ChIntegrableIIorder* intgr = nullptr)
         : ChTimestepperIIorder(intgr), ChImplicitIterativeTimestepper() {
         SetGammaBeta(0.6, 0.3);  // default values with some damping, and that works also with DAE constraints
-        modified_Newton = true;  // default use modified Newton with jacobian factorization only at beginning
+        jacobian_update = JacobianUpdate::EVERY_STEP;  // default modified Newton, with factorization only at beginning
     }
 
     virtual Type GetType() const override { return Type::NEWMARK; }
@@ -667,7 +724,10 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     /// If enabled, the Newton matrix is evaluated, assembled, and factorized only once per step.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
     /// Modified Newton iteration is enabled by default.
-    void SetModifiedNewton(bool val) { modified_Newton = val; }
+    /// See SetJacobianUpdateMethod for reusing the Newton matrix across steps.
+    void SetModifiedNewton(bool val) {
+        SetJacobianUpdateMethod(val ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION);
+    }
 
     /// Performs an integration timestep
     virtual void Advance(const double dt  ///< timestep to advance
@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -33,8 +34,7 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* intgr)
       step_decrease_factor(0.5),
       h_min(1e-10),
       h(1e6),
-      num_successful_steps(0),
-      modified_Newton(true) {
+      num_successful_steps(0) {
     SetAlpha(-0.2);  // default: some dissipation
 }
 
@@ -50,6 +50,8 @@ void ChTimestepperHHT::SetAlpha(double val) {
 
 // Performs a step of HHT (generalized alpha) implicit for II order systems
 void ChTimestepperHHT::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperHHT::Advance", "timestepper");
+
     // Downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -78,6 +80,7 @@ void ChTimestepperHHT::Advance(const double dt) {
     numiters = 0;            // total number of NR iterations for this step
     numsetups = 0;
     numsolves = 0;
+    numfallbacks = 0;
 
     // If we had a streak of successful steps, consider a stepsize increase.
     // Note that we never attempt a step larger than the specified dt value.
@@ -99,12 +102,14 @@ void ChTimestepperHHT::Advance(const double dt) {
 
     // Monitor flags controlling whther or not the Newton matrix must be updated.
     // If using modified Newton, a matrix update occurs:
-    //   - at the beginning of a step
+    //   - at the beginning of a step (unless reusing the matrix from a previous step, with JacobianUpdate::AUTOMATIC)
     //   - on a stepsize decrease
-    //   - if the Newton iteration does not converge with an out-of-date matrix
+    //   - if the Newton iteration does not converge with a matrix from a previous step (JacobianUpdate::AUTOMATIC)
     // Otherwise, the matrix is updated at each iteration.
+    unsigned int nv = mintegrable->GetNumCoordsVelLevel();
+    unsigned int nc = mintegrable->GetNumConstraints();
     matrix_is_current = false;
-    call_setup = true;
+    call_setup = JacobianUpdateRequired(h, nv, nc);
 
     // Loop until reaching final time
     while (true) {
@@ -114,10 +119,11 @@ void ChTimestepperHHT::Advance(const double dt) {
         Da_nrm_hist.fill(0.0);
         Dl_nrm_hist.fill(0.0);
         bool converged = false;
+        bool matrix_is_reused = (jacobian_update == JacobianUpdate::AUTOMATIC) && !call_setup;
         unsigned int it;
 
         for (it = 0; it < maxiters; it++) {
-            if (verbose && modified_Newton && call_setup)
+            if (verbose && jacobian_update != JacobianUpdate::EVERY_ITERATION && call_setup)
                 std::cout << " HHT call Setup." << std::endl;
 
             // Solve linear system and increment state
@@ -128,14 +134,21 @@ void ChTimestepperHHT::Advance(const double dt) {
             numsolves++;
             if (call_setup) {
                 numsetups++;
+                JacobianUpdated(h, nv, nc);
             }
 
             // If using modified Newton, do not call Setup again
-            call_setup = !modified_Newton;
+            call_setup = (jacobian_update == JacobianUpdate::EVERY_ITERATION);
 
             // Check convergence
             converged = CheckConvergence(it);
-            if (converged)
+
+            // If the Newton matrix is from a previous step, monitor the convergence rate
+            bool diverging = false;
+            if (matrix_is_reused && it > 0)
+                diverging = !MonitorJacobianReuse(Da_nrm_hist[it % 3], Da_nrm_hist[(it - 1) % 3]);
+
+            if (converged || diverging)
                 break;
         }
 
@@ -166,20 +179,19 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
-            /*
-            } else if (!matrix_is_current) {
-                // ------ NR did not converge but the matrix was out-of-date
+        } else if (matrix_is_reused) {
+            // ------ NR did not converge but the matrix was from a previous step
 
-                // reset the count of successive successful steps
-                num_successful_steps = 0;
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
 
-                // re-attempt step with updated matrix
-                if (verbose) {
-                    std::cout << " HHT re-attempt step with updated matrix." << std::endl;
-                }
+            // re-attempt step with updated matrix
+            if (verbose) {
+                std::cout << " HHT re-attempt step with updated matrix." << std::endl;
+            }
 
-                call_setup = true;
-            */
+            numfallbacks++;
+            call_setup = true;
 
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
@@ -72,8 +72,11 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// If enabled, the Newton matrix is evaluated, assembled, and factorized only once
     /// per step or if the Newton iteration does not converge with an out-of-date matrix.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
+    /// See SetJacobianUpdateMethod for reusing the Newton matrix across steps.
     /// Default: true.
-    void SetModifiedNewton(bool enable) { modified_Newton = enable; }
+    void SetModifiedNewton(bool enable) {
+        SetJacobianUpdateMethod(enable ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION);
+    }
 
     /// Perform an integration timestep, by advancing the state by the specified time step.
     virtual void Advance(const double dt) override;
@@ -123,7 +126,6 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     double h;                           ///< internal stepsize
     unsigned int num_successful_steps;  ///< number of successful steps
 
-    bool modified_Newton;    ///< use modified Newton?
     bool matrix_is_current;  ///< is the Newton matrix up-to-date?
     bool call_setup;         ///< should the solver's Setup function be called?
 
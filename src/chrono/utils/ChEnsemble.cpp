@@ -0,0 +1,202 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+#include "chrono/core/ChTimer.h"
+#include "chrono/utils/ChEnsemble.h"
+
+namespace chrono {
+namespace utils {
+
+// Task queue of a worker thread (indices of the simulations assigned to the worker).
+// The owner takes tasks from the front; thieves take tasks from the back.
+namespace {
+struct TaskQueue {
+    std::mutex mutex;
+    std::deque<int> tasks;
+
+    bool PopFront(int& task) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks.empty())
+            return false;
+        task = tasks.front();
+        tasks.pop_front();
+        return true;
+    }
+
+    bool PopBack(int& task) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks.empty())
+            return false;
+        task = tasks.back();
+        tasks.pop_back();
+        return true;
+    }
+
+    void PushBack(int task) {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(task);
+    }
+};
+}  // namespace
+
+// Pin the calling thread to the n-th core available to the process.
+static void PinThread(int n) {
+#ifdef __linux__
+    cpu_set_t available;
+    CPU_ZERO(&available);
+    if (sched_getaffinity(0, sizeof(available), &available) != 0)
+        return;
+    int num_cpus = CPU_COUNT(&available);
+    if (num_cpus == 0)
+        return;
+    int target = n % num_cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (!CPU_ISSET(cpu, &available))
+            continue;
+        if (target-- == 0) {
+            cpu_set_t cpuset;
+            CPU_ZERO(&cpuset);
+            CPU_SET(cpu, &cpuset);
+            pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+            return;
+        }
+    }
+#endif
+}
+
+ChEnsemble::ChEnsemble(int num_threads)
+    : m_pin_threads(false), m_steps_per_task(100), m_single_threaded(true), m_wall_time(0), m_num_steals(0) {
+    m_num_threads = num_threads > 0 ? num_threads : std::max(1, (int)std::thread::hardware_concurrency());
+}
+
+void ChEnsemble::Run(int num_simulations, Factory factory) {
+    m_simulations.clear();
+    m_simulations.resize(num_simulations);
+
+    // Distribute the simulations to the worker queues (round-robin)
+    std::vector<TaskQueue> queues(m_num_threads);
+    for (int i = 0; i < num_simulations; i++)
+        queues[i % m_num_threads].tasks.push_back(i);
+
+    std::atomic<int> remaining(num_simulations);
+    std::atomic<int> num_steals(0);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    // Idle workers block until a task is queued or all simulations are complete.
+    // The number of queued tasks is only incremented (and 'remaining' only decremented) with wait_mutex held, so that
+    // no notification is missed.
+    std::atomic<int> num_queued(num_simulations);
+    std::mutex wait_mutex;
+    std::condition_variable wait_cv;
+
+    auto worker = [&](int tid) {
+        if (m_pin_threads)
+            PinThread(tid);
+
+        while (remaining.load() > 0) {
+            // Take a task from the own queue or, if empty, steal one from another queue
+            int sim;
+            bool found = queues[tid].PopFront(sim);
+            for (int k = 1; !found && k < m_num_threads; k++) {
+                if (queues[(tid + k) % m_num_threads].PopBack(sim)) {
+                    found = true;
+                    num_steals++;
+                }
+            }
+            if (!found) {
+                std::unique_lock<std::mutex> lock(wait_mutex);
+                wait_cv.wait(lock, [&]() { return num_queued.load() > 0 || remaining.load() == 0; });
+                continue;
+            }
+            num_queued--;
+
+            // Create the simulation (at first run) and advance it by a number of steps.
+            // A simulation is accessed by a single worker at a time (the one which removed it from a queue).
+            bool done = false;
+            try {
+                auto& simulation = m_simulations[sim];
+                if (!simulation) {
+                    simulation = factory(sim);
+                    if (m_single_threaded)
+                        simulation->GetSystem()->SetNumThreads(1, 1, 1);
+                }
+                for (int k = 0; k < m_steps_per_task && !done; k++)
+                    done = !simulation->Advance();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error)
+                    error = std::current_exception();
+                done = true;
+            }
+
+            if (done) {
+                std::lock_guard<std::mutex> lock(wait_mutex);
+                if (--remaining == 0)
+                    wait_cv.notify_all();
+            } else {
+                queues[tid].PushBack(sim);
+                std::lock_guard<std::mutex> lock(wait_mutex);
+                num_queued++;
+                wait_cv.notify_one();
+            }
+        }
+    };
+
+    ChTimer timer;
+    timer.start();
+
+    std::vector<std::thread> threads;
+    for (int tid = 0; tid < m_num_threads; tid++)
+        threads.push_back(std::thread(worker, tid));
+    for (auto& thread : threads)
+        thread.join();
+
+    timer.stop();
+    m_wall_time = timer.GetTimeSeconds();
+    m_num_steals = num_steals.load();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+double ChEnsemble::GetSimulatedTime() const {
+    double time = 0;
+    for (const auto& simulation : m_simulations) {
+        if (simulation)
+            time += simulation->GetSystem()->GetChTime();
+    }
+    return time;
+}
+
+double ChEnsemble::GetThroughput() const {
+    if (m_wall_time <= 0)
+        return 0;
+    return GetSimulatedTime() / m_wall_time / m_num_threads;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,135 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CH_ENSEMBLE_H
+#define CH_ENSEMBLE_H
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Runner for an ensemble of independent simulations (e.g., Monte-Carlo or design-of-experiments sweeps).
+/// The simulations are advanced by a pool of worker threads, in tasks of a given number of steps, using work-stealing
+/// scheduling: each worker advances the simulations in its own queue and, when idle, steals a simulation from the
+/// queue of another worker. To avoid oversubscription of the cores, each Chrono system in the ensemble is (by default)
+/// set to use a single thread (see ChSystem::SetNumThreads), so that parallelism is exploited only across simulations.
+///
+/// Simulations are created (through a user-provided factory) by the worker thread which first runs them, so that all
+/// their data is allocated from the heap arena of that thread (for allocators with per-thread arenas, such as the
+/// glibc malloc) and first touched on the core that will likely run them. Optionally, worker threads can be pinned to
+/// cores (currently supported on Linux only).
+class ChApi ChEnsemble {
+  public:
+    /// Interface for a member simulation of the ensemble.
+    class ChApi Simulation {
+      public:
+        virtual ~Simulation() {}
+
+        /// Return the underlying Chrono system.
+        virtual ChSystem* GetSystem() = 0;
+
+        /// Advance the simulation by one step. Return false once the simulation is complete.
+        virtual bool Advance() = 0;
+    };
+
+    /// Simulation of a Chrono system, advanced with a fixed step size up to a specified end time.
+    class ChApi SystemSimulation : public Simulation {
+      public:
+        SystemSimulation(std::shared_ptr<ChSystem> sys, double step, double end_time)
+            : m_sys(sys), m_step(step), m_end_time(end_time) {}
+
+        virtual ChSystem* GetSystem() override { return m_sys.get(); }
+
+        virtual bool Advance() override {
+            m_sys->DoStepDynamics(m_step);
+            return m_sys->GetChTime() < m_end_time - 1e-3 * m_step;
+        }
+
+      private:
+        std::shared_ptr<ChSystem> m_sys;
+        double m_step;
+        double m_end_time;
+    };
+
+    /// Factory for the member simulations, called with the index of the simulation to be created.
+    typedef std::function<std::shared_ptr<Simulation>(int)> Factory;
+
+    /// Create an ensemble runner with the specified number of worker threads.
+    /// If num_threads <= 0, use as many threads as hardware threads.
+    ChEnsemble(int num_threads = 0);
+
+    /// Return the number of worker threads.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Enable/disable pinning of worker threads to cores (default: false).
+    /// If enabled, worker threads are pinned, in order, to the cores available to the process.
+    void SetThreadPinning(bool val) { m_pin_threads = val; }
+
+    /// Set the number of simulation steps in a scheduling task (default: 100).
+    /// Larger values reduce scheduling overhead; smaller values improve load balancing.
+    void SetStepsPerTask(int num_steps) { m_steps_per_task = std::max(1, num_steps); }
+
+    /// Enable/disable forcing the Chrono system of each simulation to use a single thread (default: true).
+    void SetSingleThreadedSystems(bool val) { m_single_threaded = val; }
+
+    /// Create and run an ensemble of the specified number of simulations, until all of them are complete.
+    /// Simulations are created with the provided factory. If a simulation throws an exception, that simulation is
+    /// abandoned and the first such exception is rethrown once all other simulations are complete.
+    void Run(int num_simulations, Factory factory);
+
+    /// Return the specified simulation of the last ensemble run.
+    std::shared_ptr<Simulation> GetSimulation(int i) const { return m_simulations[i]; }
+
+    /// Return the number of simulations of the last ensemble run.
+    int GetNumSimulations() const { return (int)m_simulations.size(); }
+
+    /// Return the wall-clock time of the last ensemble run (in seconds).
+    double GetWallTime() const { return m_wall_time; }
+
+    /// Return the total simulated time of the last ensemble run (sum over all simulations, in seconds).
+    double GetSimulatedTime() const;
+
+    /// Return the throughput of the last ensemble run, in simulated seconds per wall-clock second per thread.
+    double GetThroughput() const;
+
+    /// Return the number of tasks stolen by idle workers during the last ensemble run.
+    int GetNumSteals() const { return m_num_steals; }
+
+  private:
+    int m_num_threads;
+    bool m_pin_threads;
+    int m_steps_per_task;
+    bool m_single_threaded;
+
+    std::vector<std::shared_ptr<Simulation>> m_simulations;
+    double m_wall_time;
+    int m_num_steals;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
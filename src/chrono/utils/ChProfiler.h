@@ -35,6 +35,7 @@
     #include <ratio>
     #include <chrono>
     #include "chrono/core/ChApiCE.h"
+    #include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 namespace utils {
@@ -131,11 +132,21 @@ class ChApi ChProfileManager {
 };
 
 /// Simple way to profile a function's scope.
+/// If tracing is enabled (see ChTracer), the scope is also recorded as a traced zone.
 class ChApi ChProfileSample {
   public:
+    #ifdef CHRONO_TRACE_ENABLED
+    ChProfileSample(const char* name) : m_zone(name, "profile") { ChProfileManager::Start_Profile(name); }
+    #else
     ChProfileSample(const char* name) { ChProfileManager::Start_Profile(name); }
+    #endif
 
     ~ChProfileSample(void) { ChProfileManager::Stop_Profile(); }
+
+    #ifdef CHRONO_TRACE_ENABLED
+  private:
+    ChTraceZone m_zone;
+    #endif
 };
 
 }  // end namespace utils
@@ -0,0 +1,248 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+#include "chrono/utils/ChTracer.h"
+
+namespace chrono {
+
+// Event buffer of a thread.
+// Buffers are owned by the tracer (and outlive their threads), so that events recorded by threads of a terminated
+// OpenMP team or std::thread remain available for export.
+namespace {
+struct ThreadBuffer {
+    int index;                            // thread index (order of first recorded event)
+    std::string name;                     // optional thread name
+    std::vector<ChTracer::Event> events;  // recorded events
+    int system;                           // system last set by this thread (-1 if none)
+    int64_t step;                         // step last set by this thread
+};
+}  // namespace
+
+// Registry of all thread buffers.
+static std::mutex g_tracer_mutex;
+static std::vector<std::unique_ptr<ThreadBuffer>> g_tracer_buffers;
+
+// Registry of the simulated systems, and system and step last set by any thread.
+static std::unordered_map<const void*, int> g_tracer_systems;
+static std::atomic<int> g_tracer_system(-1);
+static std::atomic<int64_t> g_tracer_step(0);
+
+std::atomic<bool> ChTracer::m_enabled(false);
+const std::chrono::steady_clock::time_point ChTracer::m_epoch = std::chrono::steady_clock::now();
+
+void ChTracer::Enable(bool val) {
+    m_enabled.store(val);
+}
+
+// Return the event buffer of the calling thread (created at the first call from a thread).
+static ThreadBuffer& GetThreadBuffer() {
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) {
+        std::lock_guard<std::mutex> lock(g_tracer_mutex);
+        g_tracer_buffers.emplace_back(new ThreadBuffer);
+        buffer = g_tracer_buffers.back().get();
+        buffer->index = (int)g_tracer_buffers.size() - 1;
+        buffer->events.reserve(4096);
+        buffer->system = -1;
+        buffer->step = 0;
+    }
+    return *buffer;
+}
+
+void ChTracer::BeginStep(const void* system, int64_t step) {
+    if (!IsEnabled())
+        return;
+
+    int index;
+    {
+        std::lock_guard<std::mutex> lock(g_tracer_mutex);
+        index = g_tracer_systems.insert({system, (int)g_tracer_systems.size()}).first->second;
+    }
+
+    auto& buffer = GetThreadBuffer();
+    buffer.system = index;
+    buffer.step = step;
+
+    g_tracer_system.store(index, std::memory_order_relaxed);
+    g_tracer_step.store(step, std::memory_order_relaxed);
+}
+
+void ChTracer::SetThreadName(const std::string& name) {
+    GetThreadBuffer().name = name;
+}
+
+void ChTracer::Record(const char* name, const char* category, int64_t start, int64_t end) {
+    auto& buffer = GetThreadBuffer();
+    if (buffer.system >= 0) {
+        buffer.events.push_back({name, category, start, end - start, buffer.system, buffer.step});
+    } else {
+        buffer.events.push_back({name, category, start, end - start, g_tracer_system.load(std::memory_order_relaxed),
+                                 g_tracer_step.load(std::memory_order_relaxed)});
+    }
+}
+
+void ChTracer::Clear() {
+    std::lock_guard<std::mutex> lock(g_tracer_mutex);
+    for (auto& buffer : g_tracer_buffers) {
+        buffer->events.clear();
+        buffer->system = -1;
+        buffer->step = 0;
+    }
+    g_tracer_systems.clear();
+    g_tracer_system.store(-1);
+    g_tracer_step.store(0);
+}
+
+size_t ChTracer::GetNumEvents() {
+    std::lock_guard<std::mutex> lock(g_tracer_mutex);
+    size_t num_events = 0;
+    for (const auto& buffer : g_tracer_buffers)
+        num_events += buffer->events.size();
+    return num_events;
+}
+
+std::vector<ChTracer::Event> ChTracer::GetEvents(std::vector<int>* threads) {
+    std::vector<std::pair<Event, int>> all_events;
+    {
+        std::lock_guard<std::mutex> lock(g_tracer_mutex);
+        for (const auto& buffer : g_tracer_buffers)
+            for (const auto& event : buffer->events)
+                all_events.push_back({event, buffer->index});
+    }
+
+    // Sort by start time; enclosing zones (longer duration) first for equal start times
+    std::stable_sort(all_events.begin(), all_events.end(), [](const auto& a, const auto& b) {
+        if (a.first.start != b.first.start)
+            return a.first.start < b.first.start;
+        return a.first.duration > b.first.duration;
+    });
+
+    std::vector<Event> events(all_events.size());
+    if (threads)
+        threads->resize(all_events.size());
+    for (size_t i = 0; i < all_events.size(); i++) {
+        events[i] = all_events[i].first;
+        if (threads)
+            (*threads)[i] = all_events[i].second;
+    }
+
+    return events;
+}
+
+// Write a string in JSON format (with escaped special characters).
+static void WriteJSONString(std::ofstream& file, const std::string& str) {
+    file << '"';
+    for (char c : str) {
+        switch (c) {
+            case '"':
+                file << "\\\"";
+                break;
+            case '\\':
+                file << "\\\\";
+                break;
+            case '\n':
+                file << "\\n";
+                break;
+            default:
+                file << c;
+        }
+    }
+    file << '"';
+}
+
+bool ChTracer::WriteChromeTrace(const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open())
+        return false;
+
+    std::vector<int> threads;
+    auto events = GetEvents(&threads);
+
+    // Chrome trace timestamps and durations are in microseconds
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    file.precision(3);
+    file << std::fixed;
+
+    bool first = true;
+    {
+        std::lock_guard<std::mutex> lock(g_tracer_mutex);
+        for (const auto& buffer : g_tracer_buffers) {
+            if (first)
+                first = false;
+            else
+                file << ",\n";
+            file << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":0,\"tid\":" << buffer->index
+                 << ",\"args\":{\"name\":";
+            WriteJSONString(file, buffer->name.empty() ? "thread " + std::to_string(buffer->index) : buffer->name);
+            file << "}}";
+        }
+    }
+
+    for (size_t i = 0; i < events.size(); i++) {
+        const auto& event = events[i];
+        if (first)
+            first = false;
+        else
+            file << ",\n";
+        file << "{\"ph\":\"X\",\"name\":";
+        WriteJSONString(file, event.name);
+        file << ",\"cat\":";
+        WriteJSONString(file, event.category);
+        file << ",\"pid\":0,\"tid\":" << threads[i] << ",\"ts\":" << event.start * 1e-3
+             << ",\"dur\":" << event.duration * 1e-3 << ",\"args\":{\"system\":" << event.system << ",\"step\":" << event.step << "}}";
+    }
+
+    file << "\n]}\n";
+
+    return file.good();
+}
+
+bool ChTracer::WriteStepSummary(const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open())
+        return false;
+
+    struct Summary {
+        int calls = 0;
+        int64_t total = 0;
+        int64_t max = 0;
+    };
+
+    // Aggregate events per system, per step, and per zone name
+    std::map<std::tuple<int, int64_t, std::string>, Summary> summaries;
+    for (const auto& event : GetEvents()) {
+        auto& summary = summaries[std::make_tuple(event.system, event.step, std::string(event.name))];
+        summary.calls++;
+        summary.total += event.duration;
+        summary.max = std::max(summary.max, event.duration);
+    }
+
+    file << "system,step,zone,calls,total_ms,max_ms\n";
+    for (const auto& entry : summaries) {
+        file << std::get<0>(entry.first) << "," << std::get<1>(entry.first) << "," << std::get<2>(entry.first) << ","
+             << entry.second.calls << "," << entry.second.total * 1e-6 << "," << entry.second.max * 1e-6 << "\n";
+    }
+
+    return file.good();
+}
+
+}  // end namespace chrono
@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CH_TRACER_H
+#define CH_TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Thread-aware recorder of timed zones (scoped code regions).
+/// Each thread records the zones it executes in its own event buffer, without synchronization with other threads.
+/// Recorded events can be exported in the Chrome trace event format (JSON, which can be loaded in chrome://tracing or
+/// in the Perfetto UI) or aggregated per simulation step in a CSV file.
+///
+/// Each event is tagged with the simulated system and the index of its step during which the zone started. A thread
+/// uses the system and step it last set with BeginStep; threads that never called BeginStep (e.g., OpenMP worker
+/// threads) use the system and step last set by any thread. As such, events recorded by worker threads while several
+/// systems are simulated concurrently may be assigned to the wrong system.
+///
+/// Zones are typically marked with the CH_TRACE_ZONE macro, which is used throughout the Chrono hot paths (system
+/// step, timesteppers, solvers, collision detection, FEA meshes, vehicle subsystems). These macros are compiled only
+/// if Chrono was configured with USE_CHRONO_TRACE=ON; otherwise they expand to nothing and have no run-time cost.
+/// In that configuration, scopes profiled with CH_PROFILE (see ChProfiler) are also recorded, in the "profile" category.
+/// Even when compiled, events are only recorded while tracing is enabled (see Enable).
+///
+/// Recording is not synchronized with Clear, Write, and Export functions, which must therefore be called while no
+/// other thread records events (for example, between simulation steps).
+class ChApi ChTracer {
+  public:
+    /// A recorded zone.
+    struct Event {
+        const char* name;      ///< zone name (string literal)
+        const char* category;  ///< zone category (string literal)
+        int64_t start;         ///< start time, in nanoseconds since the tracer epoch
+        int64_t duration;      ///< duration, in nanoseconds
+        int system;            ///< index of the simulated system (order of first BeginStep call), -1 if none
+        int64_t step;          ///< index of the step of that system during which the zone started
+    };
+
+    /// Enable/disable recording of events (default: false).
+    static void Enable(bool val);
+
+    /// Return true if events are currently recorded.
+    static bool IsEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+
+    /// Mark the beginning of step 'step' of the given system (any pointer identifying the simulated system), for the
+    /// calling thread. Called by ChSystem::DoStepDynamics.
+    static void BeginStep(const void* system, int64_t step);
+
+    /// Set a name for the calling thread, used in the exported traces.
+    static void SetThreadName(const std::string& name);
+
+    /// Record a zone executed by the calling thread, with given start and end times (see Now).
+    static void Record(const char* name, const char* category, int64_t start, int64_t end);
+
+    /// Current time, in nanoseconds since the tracer epoch.
+    static int64_t Now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch)
+            .count();
+    }
+
+    /// Discard all recorded events and the registered systems.
+    static void Clear();
+
+    /// Return the number of recorded events (over all threads).
+    static size_t GetNumEvents();
+
+    /// Return the events recorded by all threads, in a single list sorted by start time.
+    /// The thread index of each event (in the order in which threads recorded their first event) is returned in
+    /// the optional 'threads' vector.
+    static std::vector<Event> GetEvents(std::vector<int>* threads = nullptr);
+
+    /// Write all recorded events to the specified file in the Chrome trace event format (JSON).
+    /// Return false if the file cannot be written.
+    static bool WriteChromeTrace(const std::string& filename);
+
+    /// Write the recorded events, aggregated per step and per zone, to the specified CSV file.
+    /// Each line reports the system index, step index, zone name, number of calls, and total and maximum zone times
+    /// (in ms), summed over all threads. Return false if the file cannot be written.
+    static bool WriteStepSummary(const std::string& filename);
+
+  private:
+    static std::atomic<bool> m_enabled;
+    static const std::chrono::steady_clock::time_point m_epoch;
+};
+
+/// Scoped zone, recorded in the ChTracer from construction to destruction.
+/// Use through the CH_TRACE_ZONE macro.
+class ChTraceZone {
+  public:
+    ChTraceZone(const char* name, const char* category)
+        : m_name(ChTracer::IsEnabled() ? name : nullptr), m_category(category) {
+        if (m_name)
+            m_start = ChTracer::Now();
+    }
+
+    ~ChTraceZone() {
+        if (m_name)
+            ChTracer::Record(m_name, m_category, m_start, ChTracer::Now());
+    }
+
+    ChTraceZone(const ChTraceZone&) = delete;
+    ChTraceZone& operator=(const ChTraceZone&) = delete;
+
+  private:
+    const char* m_name;
+    const char* m_category;
+    int64_t m_start;
+};
+
+/// @} chrono_utils
+
+}  // end namespace chrono
+
+#define CH_TRACE_CONCAT_IMPL(a, b) a##b
+#define CH_TRACE_CONCAT(a, b) CH_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef CHRONO_TRACE_ENABLED
+    /// Record the enclosing scope as a zone with the given name and category (string literals).
+    #define CH_TRACE_ZONE(name, category) \
+        chrono::ChTraceZone CH_TRACE_CONCAT(ch_trace_zone_, __LINE__)(name, category)
+    /// Mark the beginning of step 'step' of the given system.
+    #define CH_TRACE_BEGIN_STEP(system, step) chrono::ChTracer::BeginStep(system, step)
+#else
+    #define CH_TRACE_ZONE(name, category)
+    #define CH_TRACE_BEGIN_STEP(system, step)
+#endif
+
+#endif
@@ -13,6 +13,8 @@
 %csmethodmodifiers chrono::ChTimestepperHHT::GetNumIterations "public"
 %csmethodmodifiers chrono::ChTimestepperHHT::GetNumSetupCalls "public"
 %csmethodmodifiers chrono::ChTimestepperHHT::GetNumSolveCalls "public"
+%csmethodmodifiers chrono::ChTimestepperHHT::GetNumSetupsAvoided "public"
+%csmethodmodifiers chrono::ChTimestepperHHT::GetNumJacobianFallbacks "public"
 
 %csmethodmodifiers chrono::ChTimestepperEulerImplicit::SetMaxIters "public"
 %csmethodmodifiers chrono::ChTimestepperEulerImplicit::SetRelTolerance "public"
@@ -20,6 +22,8 @@
 %csmethodmodifiers chrono::ChTimestepperEulerImplicit::GetNumIterations "public"
 %csmethodmodifiers chrono::ChTimestepperEulerImplicit::GetNumSetupCalls "public"
 %csmethodmodifiers chrono::ChTimestepperEulerImplicit::GetNumSolveCalls "public"
+%csmethodmodifiers chrono::ChTimestepperEulerImplicit::GetNumSetupsAvoided "public"
+%csmethodmodifiers chrono::ChTimestepperEulerImplicit::GetNumJacobianFallbacks "public"
 
 %csmethodmodifiers chrono::ChTimestepper::GetType "public virtual new"
 
@@ -35,6 +39,8 @@
     int GetNumIterations() const {return $self->GetNumIterations();}
     int GetNumSetupCalls() const {return $self->GetNumSetupCalls();}
     int GetNumSolveCalls() const {return $self->GetNumSolveCalls();}
+    int GetNumSetupsAvoided() const {return $self->GetNumSetupsAvoided();}
+    int GetNumJacobianFallbacks() const {return $self->GetNumJacobianFallbacks();}
 }
 
 %extend chrono::ChTimestepperEulerImplicit
@@ -46,6 +52,8 @@
     int GetNumIterations() const {return $self->GetNumIterations();}
     int GetNumSetupCalls() const {return $self->GetNumSetupCalls();}
     int GetNumSolveCalls() const {return $self->GetNumSolveCalls();}
+    int GetNumSetupsAvoided() const {return $self->GetNumSetupsAvoided();}
+    int GetNumJacobianFallbacks() const {return $self->GetNumJacobianFallbacks();}
 }
 
 #endif             // --------------------------------------------------------------------- CSHARP
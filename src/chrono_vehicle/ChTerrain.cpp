@@ -42,5 +42,23 @@ void ChTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector3d&
     friction = GetCoefficientFriction(loc);
 }
 
+void ChTerrain::GetHeights(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const {
+    heights.resize(locs.size());
+    for (size_t i = 0; i < locs.size(); i++)
+        heights[i] = GetHeight(locs[i]);
+}
+
+void ChTerrain::GetProperties(const std::vector<ChVector3d>& locs,
+                              std::vector<double>& heights,
+                              std::vector<ChVector3d>& normals,
+                              std::vector<float>& frictions) const {
+    size_t n = locs.size();
+    heights.resize(n);
+    normals.resize(n);
+    frictions.resize(n);
+    for (size_t i = 0; i < n; i++)
+        GetProperties(locs[i], heights[i], normals[i], frictions[i]);
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
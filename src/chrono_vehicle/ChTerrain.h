@@ -19,6 +19,8 @@
 #ifndef CH_TERRAIN_H
 #define CH_TERRAIN_H
 
+#include <vector>
+
 #include "chrono/core/ChVector3.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
@@ -57,6 +59,20 @@ class CH_VEHICLE_API ChTerrain {
     /// Get all terrain characteristics at the point below the specified location.
     virtual void GetProperties(const ChVector3d& loc, double& height, ChVector3d& normal, float& friction) const;
 
+    /// Get the terrain heights below the specified locations.
+    /// The output vector is resized to the number of query locations. The default implementation calls GetHeight for
+    /// each location.
+    virtual void GetHeights(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// The output vectors are resized to the number of query locations. The default implementation calls
+    /// GetProperties for each location; derived classes override this function to amortize the cost of the queries
+    /// over the entire batch (e.g., for the many terrain samples of a tire contact patch).
+    virtual void GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& frictions) const;
+
     /// Class to be used as a functor interface for location-dependent terrain height.
     class CH_VEHICLE_API HeightFunctor {
       public:
@@ -23,6 +23,7 @@
 
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChTracer.h"
 
 #include "chrono_vehicle/ChWorldFrame.h"
 #include "chrono_vehicle/ChVehicle.h"
@@ -30,6 +31,7 @@
 #include "chrono_vehicle/ChVehicleVisualSystem.h"
 
 #include "chrono_vehicle/output/ChVehicleOutputASCII.h"
+#include "chrono_vehicle/output/ChVehicleOutputAsync.h"
 #ifdef CHRONO_HAS_HDF5
     #include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
 #endif
@@ -118,7 +120,8 @@ void ChVehicle::EnableRealtime(bool val) {
 void ChVehicle::SetOutput(ChVehicleOutput::Type type,
                           const std::string& out_dir,
                           const std::string& out_name,
-                          double output_step) {
+                          double output_step,
+                          bool async) {
     m_output = true;
     m_output_step = output_step;
 
@@ -135,6 +138,15 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
 #endif
             break;
     }
+
+    if (async && m_output_db)
+        m_output_db = new ChVehicleOutputAsync(m_output_db);
+}
+
+void ChVehicle::SetOutput(ChVehicleOutput* database, double output_step, bool async) {
+    m_output = true;
+    m_output_step = output_step;
+    m_output_db = async ? new ChVehicleOutputAsync(database) : database;
 }
 
 void ChVehicle::SetOutput(ChVehicleOutput::Type type, std::ostream& out_stream, double output_step) {
@@ -175,6 +187,8 @@ void ChVehicle::InitializePowertrain(std::shared_ptr<ChPowertrainAssembly> power
 // -----------------------------------------------------------------------------
 
 void ChVehicle::Advance(double step) {
+    CH_TRACE_ZONE("ChVehicle::Advance", "vehicle");
+
     // Ensure the vehicle mass includes the mass of subsystems that may have been initialized after the vehicle
     if (!m_initialized) {
         InitializeInertiaProperties();
@@ -213,10 +213,21 @@ class CH_VEHICLE_API ChVehicle {
     void SetCollisionSystemType(ChCollisionSystem::Type collsys_type);
 
     /// Enable output for this vehicle system.
+    /// If asynchronous output is requested, output data is buffered and written to file on a background thread (see
+    /// ChVehicleOutputAsync), so that the simulation thread does not wait on file I/O.
     void SetOutput(ChVehicleOutput::Type type,   ///< [int] type of output DB
                    const std::string& out_dir,   ///< [in] output directory name
                    const std::string& out_name,  ///< [in] rootname of output file
-                   double output_step            ///< [in] interval between output times
+                   double output_step,           ///< [in] interval between output times
+                   bool async = false            ///< [in] write output asynchronously
+    );
+
+    /// Enable output for this vehicle system using the provided output database.
+    /// The vehicle takes ownership of the database, which is deleted at destruction. Use this function to configure
+    /// the database before output starts (e.g., ChVehicleOutputHDF5::SetCompression).
+    void SetOutput(ChVehicleOutput* database,  ///< [in] output database
+                   double output_step,         ///< [in] interval between output times
+                   bool async = false          ///< [in] write output asynchronously
     );
 
     /// Enable output for this vehicle system using an existing output stream.
@@ -0,0 +1,227 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Base class for a vehicle output database.
+//
+// =============================================================================
+
+#include "chrono_vehicle/ChVehicleOutput.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+// Default implementation of the output functions: extract the output data and
+// pass it to the concrete output database.
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutput::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    std::vector<BodyData> data;
+    GetData(bodies, data);
+    WriteBodyData(data);
+}
+
+void ChVehicleOutput::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
+    std::vector<AuxRefBodyData> data;
+    GetData(bodies, data);
+    WriteAuxRefBodyData(data);
+}
+
+void ChVehicleOutput::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
+    std::vector<MarkerData> data;
+    GetData(markers, data);
+    WriteMarkerData(data);
+}
+
+void ChVehicleOutput::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    std::vector<ShaftData> data;
+    GetData(shafts, data);
+    WriteShaftData(data);
+}
+
+void ChVehicleOutput::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+    std::vector<JointData> data;
+    GetData(joints, data);
+    WriteJointData(data);
+}
+
+void ChVehicleOutput::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
+    std::vector<CoupleData> data;
+    GetData(couples, data);
+    WriteCoupleData(data);
+}
+
+void ChVehicleOutput::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
+    std::vector<LinSpringData> data;
+    GetData(springs, data);
+    WriteLinSpringData(data);
+}
+
+void ChVehicleOutput::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
+    std::vector<RotSpringData> data;
+    GetData(springs, data);
+    WriteRotSpringData(data);
+}
+
+void ChVehicleOutput::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
+    std::vector<BodyLoadData> data;
+    GetData(loads, data);
+    WriteBodyLoadData(data);
+}
+
+// -----------------------------------------------------------------------------
+// Extraction of output data records.
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutput::GetData(const std::vector<std::shared_ptr<ChBody>>& bodies, std::vector<BodyData>& data) {
+    data.resize(bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const auto& body = bodies[i];
+        auto& d = data[i];
+        d.id = body->GetIdentifier();
+        d.name = body->GetName();
+        d.pos = body->GetPos();
+        d.rot = body->GetRot();
+        d.lin_vel = body->GetPosDt();
+        d.ang_vel = body->GetAngVelParent();
+        d.lin_acc = body->GetPosDt2();
+        d.ang_acc = body->GetAngAccParent();
+    }
+}
+
+void ChVehicleOutput::GetData(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies,
+                              std::vector<AuxRefBodyData>& data) {
+    data.resize(bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const auto& body = bodies[i];
+        auto& d = data[i];
+        d.id = body->GetIdentifier();
+        d.name = body->GetName();
+        d.pos = body->GetPos();
+        d.rot = body->GetRot();
+        d.lin_vel = body->GetPosDt();
+        d.ang_vel = body->GetAngVelParent();
+        d.lin_acc = body->GetPosDt2();
+        d.ang_acc = body->GetAngAccParent();
+        d.ref_pos = body->GetFrameRefToAbs().GetPos();
+        d.ref_vel = body->GetFrameRefToAbs().GetPosDt();
+        d.ref_acc = body->GetFrameRefToAbs().GetPosDt2();
+    }
+}
+
+void ChVehicleOutput::GetData(const std::vector<std::shared_ptr<ChMarker>>& markers, std::vector<MarkerData>& data) {
+    data.resize(markers.size());
+    for (size_t i = 0; i < markers.size(); i++) {
+        const auto& marker = markers[i];
+        auto& d = data[i];
+        d.id = marker->GetIdentifier();
+        d.name = marker->GetName();
+        d.pos = marker->GetAbsCoordsys().pos;
+        d.vel = marker->GetAbsCoordsysDt().pos;
+        d.acc = marker->GetAbsCoordsysDt2().pos;
+    }
+}
+
+void ChVehicleOutput::GetData(const std::vector<std::shared_ptr<ChShaft>>& shafts, std::vector<ShaftData>& data) {
+    data.resize(shafts.size());
+    for (size_t i = 0; i < shafts.size(); i++) {
+        const auto& shaft = shafts[i];
+        auto& d = data[i];
+        d.id = shaft->GetIdentifier();
+        d.name = shaft->GetName();
+        d.pos = shaft->GetPos();
+        d.vel = shaft->GetPosDt();
+        d.acc = shaft->GetPosDt2();
+        d.torque = shaft->GetAppliedLoad();
+    }
+}
+
+void ChVehicleOutput::GetData(const std::vector<std::shared_ptr<ChLink>>& joints, std::vector<JointData>& data) {
+    data.resize(joints.size());
+    for (size_t i = 0; i < joints.size(); i++) {
+        const auto& joint = joints[i];
+        auto& d = data[i];
+        auto reaction = joint->GetReaction2();
+        d.id = joint->GetIdentifier();
+        d.name = joint->GetName();
+        d.force = reaction.force;
+        d.torque = reaction.torque;
+        auto C = joint->GetConstraintViolation();
+        d.violations.resize(C.size());
+        for (int k = 0; k < C.size(); k++)
+            d.violations[k] = C(k);
+    }
+}
+
+void ChVehicleOutput::GetData(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples,
+                              std::vector<CoupleData>& data) {
+    data.resize(couples.size());
+    for (size_t i = 0; i < couples.size(); i++) {
+        const auto& couple = couples[i];
+        auto& d = data[i];
+        d.id = couple->GetIdentifier();
+        d.name = couple->GetName();
+        d.pos = couple->GetRelativePos();
+        d.vel = couple->GetRelativePosDt();
+        d.acc = couple->GetRelativePosDt2();
+        d.torque1 = couple->GetReaction1();
+        d.torque2 = couple->GetReaction2();
+    }
+}
+
+void ChVehicleOutput::GetData(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs,
+                              std::vector<LinSpringData>& data) {
+    data.resize(springs.size());
+    for (size_t i = 0; i < springs.size(); i++) {
+        const auto& spring = springs[i];
+        auto& d = data[i];
+        d.id = spring->GetIdentifier();
+        d.name = spring->GetName();
+        d.point1 = spring->GetPoint1Abs();
+        d.point2 = spring->GetPoint2Abs();
+        d.length = spring->GetLength();
+        d.vel = spring->GetVelocity();
+        d.force = spring->GetForce();
+    }
+}
+
+void ChVehicleOutput::GetData(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs,
+                              std::vector<RotSpringData>& data) {
+    data.resize(springs.size());
+    for (size_t i = 0; i < springs.size(); i++) {
+        const auto& spring = springs[i];
+        auto& d = data[i];
+        d.id = spring->GetIdentifier();
+        d.name = spring->GetName();
+        d.angle = spring->GetAngle();
+        d.vel = spring->GetVelocity();
+        d.torque = spring->GetTorque();
+    }
+}
+
+void ChVehicleOutput::GetData(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads,
+                              std::vector<BodyLoadData>& data) {
+    data.resize(loads.size());
+    for (size_t i = 0; i < loads.size(); i++) {
+        const auto& load = loads[i];
+        auto& d = data[i];
+        d.id = load->GetIdentifier();
+        d.name = load->GetName();
+        d.force = load->GetForce();
+        d.torque = load->GetTorque();
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
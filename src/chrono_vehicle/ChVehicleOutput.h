@@ -41,6 +41,9 @@ namespace vehicle {
 /// @{
 
 /// Base class for a vehicle output database.
+/// The output data of the various vehicle components is first extracted in plain data records (see GetData) which are
+/// then written by the concrete output database. As such, the data records do not reference any Chrono objects and can
+/// be written at a later time (see ChVehicleOutputAsync).
 class CH_VEHICLE_API ChVehicleOutput {
   public:
     enum Type {
@@ -49,6 +52,92 @@ class CH_VEHICLE_API ChVehicleOutput {
         HDF5    ///< HDF-5
     };
 
+    /// Output data for a body.
+    struct BodyData {
+        int id;              ///< body identifier
+        std::string name;    ///< body name
+        ChVector3d pos;      ///< position
+        ChQuaterniond rot;   ///< orientation
+        ChVector3d lin_vel;  ///< linear velocity
+        ChVector3d ang_vel;  ///< angular velocity (expressed in absolute frame)
+        ChVector3d lin_acc;  ///< linear acceleration
+        ChVector3d ang_acc;  ///< angular acceleration (expressed in absolute frame)
+    };
+
+    /// Output data for a body with an auxiliary reference frame.
+    struct AuxRefBodyData : public BodyData {
+        ChVector3d ref_pos;  ///< position of reference frame
+        ChVector3d ref_vel;  ///< linear velocity of reference frame
+        ChVector3d ref_acc;  ///< linear acceleration of reference frame
+    };
+
+    /// Output data for a marker.
+    struct MarkerData {
+        int id;            ///< marker identifier
+        std::string name;  ///< marker name
+        ChVector3d pos;    ///< absolute position
+        ChVector3d vel;    ///< absolute linear velocity
+        ChVector3d acc;    ///< absolute linear acceleration
+    };
+
+    /// Output data for a shaft.
+    struct ShaftData {
+        int id;            ///< shaft identifier
+        std::string name;  ///< shaft name
+        double pos;        ///< angle
+        double vel;        ///< angular velocity
+        double acc;        ///< angular acceleration
+        double torque;     ///< applied torque
+    };
+
+    /// Output data for a joint.
+    struct JointData {
+        int id;                          ///< joint identifier
+        std::string name;                ///< joint name
+        ChVector3d force;                ///< reaction force
+        ChVector3d torque;               ///< reaction torque
+        std::vector<double> violations;  ///< constraint violations
+    };
+
+    /// Output data for a shaft couple.
+    struct CoupleData {
+        int id;            ///< couple identifier
+        std::string name;  ///< couple name
+        double pos;        ///< relative angle
+        double vel;        ///< relative angular velocity
+        double acc;        ///< relative angular acceleration
+        double torque1;    ///< reaction torque on shaft 1
+        double torque2;    ///< reaction torque on shaft 2
+    };
+
+    /// Output data for a translational spring.
+    struct LinSpringData {
+        int id;             ///< spring identifier
+        std::string name;   ///< spring name
+        ChVector3d point1;  ///< absolute position of point on 1st body
+        ChVector3d point2;  ///< absolute position of point on 2nd body
+        double length;      ///< spring length
+        double vel;         ///< spring velocity
+        double force;       ///< spring force
+    };
+
+    /// Output data for a rotational spring.
+    struct RotSpringData {
+        int id;            ///< spring identifier
+        std::string name;  ///< spring name
+        double angle;      ///< spring angle
+        double vel;        ///< spring angular velocity
+        double torque;     ///< spring torque
+    };
+
+    /// Output data for a body-body load.
+    struct BodyLoadData {
+        int id;             ///< load identifier
+        std::string name;   ///< load name
+        ChVector3d force;   ///< load force
+        ChVector3d torque;  ///< load torque
+    };
+
     ChVehicleOutput() {}
     virtual ~ChVehicleOutput() {}
 
@@ -56,15 +145,37 @@ class CH_VEHICLE_API ChVehicleOutput {
 
     virtual void WriteSection(const std::string& name) = 0;
 
-    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) = 0;
-    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) = 0;
-    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) = 0;
-    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) = 0;
-    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) = 0;
-    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) = 0;
-    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) = 0;
-    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) = 0;
-    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) = 0;
+    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies);
+    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies);
+    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers);
+    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts);
+    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints);
+    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples);
+    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs);
+    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs);
+    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads);
+
+    virtual void WriteBodyData(const std::vector<BodyData>& bodies) = 0;
+    virtual void WriteAuxRefBodyData(const std::vector<AuxRefBodyData>& bodies) = 0;
+    virtual void WriteMarkerData(const std::vector<MarkerData>& markers) = 0;
+    virtual void WriteShaftData(const std::vector<ShaftData>& shafts) = 0;
+    virtual void WriteJointData(const std::vector<JointData>& joints) = 0;
+    virtual void WriteCoupleData(const std::vector<CoupleData>& couples) = 0;
+    virtual void WriteLinSpringData(const std::vector<LinSpringData>& springs) = 0;
+    virtual void WriteRotSpringData(const std::vector<RotSpringData>& springs) = 0;
+    virtual void WriteBodyLoadData(const std::vector<BodyLoadData>& loads) = 0;
+
+    /// Extract output data records from the given list of components.
+    /// The output vector is resized as needed; existing records (and their allocated memory) are reused.
+    static void GetData(const std::vector<std::shared_ptr<ChBody>>& bodies, std::vector<BodyData>& data);
+    static void GetData(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies, std::vector<AuxRefBodyData>& data);
+    static void GetData(const std::vector<std::shared_ptr<ChMarker>>& markers, std::vector<MarkerData>& data);
+    static void GetData(const std::vector<std::shared_ptr<ChShaft>>& shafts, std::vector<ShaftData>& data);
+    static void GetData(const std::vector<std::shared_ptr<ChLink>>& joints, std::vector<JointData>& data);
+    static void GetData(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples, std::vector<CoupleData>& data);
+    static void GetData(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs, std::vector<LinSpringData>& data);
+    static void GetData(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs, std::vector<RotSpringData>& data);
+    static void GetData(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads, std::vector<BodyLoadData>& data);
 };
 
 /// @} vehicle
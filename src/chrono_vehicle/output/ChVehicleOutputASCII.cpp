@@ -18,10 +18,6 @@
 
 #include <iostream>
 
-#include "chrono/physics/ChLinkLock.h"
-#include "chrono/physics/ChLinkUniversal.h"
-#include "chrono/physics/ChLinkDistance.h"
-
 #include "chrono_vehicle/output/ChVehicleOutputASCII.h"
 
 namespace chrono {
@@ -46,65 +42,55 @@ void ChVehicleOutputASCII::WriteSection(const std::string& name) {
     m_stream << "  \"" << name << "\"" << std::endl;
 }
 
-void ChVehicleOutputASCII::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
-    for (auto body : bodies) {
-        m_stream << "    body: " << body->GetIdentifier() << " \"" << body->GetName() << "\" ";
-        m_stream << body->GetPos() << " " << body->GetRot() << " ";
-        m_stream << body->GetPosDt() << " " << body->GetAngVelParent() << " ";
-        m_stream << body->GetPosDt2() << " " << body->GetAngAccParent() << " ";
+void ChVehicleOutputASCII::WriteBodyData(const std::vector<BodyData>& bodies) {
+    for (const auto& body : bodies) {
+        m_stream << "    body: " << body.id << " \"" << body.name << "\" ";
+        m_stream << body.pos << " " << body.rot << " ";
+        m_stream << body.lin_vel << " " << body.ang_vel << " ";
+        m_stream << body.lin_acc << " " << body.ang_acc << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
-    for (auto body : bodies) {
-        auto& ref_pos = body->GetFrameRefToAbs().GetPos();
-        auto& ref_vel = body->GetFrameRefToAbs().GetPosDt();
-        auto& ref_acc = body->GetFrameRefToAbs().GetPosDt2();
-
-        m_stream << "    body auxref: " << body->GetIdentifier() << " \"" << body->GetName() << "\" ";
-        m_stream << body->GetPos() << " " << body->GetRot() << " ";
-        m_stream << body->GetPosDt() << " " << body->GetAngVelParent() << " ";
-        m_stream << body->GetPosDt2() << " " << body->GetAngAccParent() << " ";
-        m_stream << ref_pos << " " << ref_vel << " " << ref_acc << " ";
+void ChVehicleOutputASCII::WriteAuxRefBodyData(const std::vector<AuxRefBodyData>& bodies) {
+    for (const auto& body : bodies) {
+        m_stream << "    body auxref: " << body.id << " \"" << body.name << "\" ";
+        m_stream << body.pos << " " << body.rot << " ";
+        m_stream << body.lin_vel << " " << body.ang_vel << " ";
+        m_stream << body.lin_acc << " " << body.ang_acc << " ";
+        m_stream << body.ref_pos << " " << body.ref_vel << " " << body.ref_acc << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
-    for (auto marker : markers) {
-        m_stream << "    marker: " << marker->GetIdentifier() << " \"" << marker->GetName() << "\" ";
-        m_stream << marker->GetAbsCoordsys().pos << " ";
-        m_stream << marker->GetAbsCoordsysDt().pos << " ";
-        m_stream << marker->GetAbsCoordsysDt2().pos << " ";
+void ChVehicleOutputASCII::WriteMarkerData(const std::vector<MarkerData>& markers) {
+    for (const auto& marker : markers) {
+        m_stream << "    marker: " << marker.id << " \"" << marker.name << "\" ";
+        m_stream << marker.pos << " ";
+        m_stream << marker.vel << " ";
+        m_stream << marker.acc << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
-    for (auto shaft : shafts) {
-        m_stream << "    shaft: " << shaft->GetIdentifier() << " \"" << shaft->GetName() << "\" ";
-        m_stream << shaft->GetPos() << " " << shaft->GetPosDt() << " " << shaft->GetPosDt2() << " ";
-        m_stream << shaft->GetAppliedLoad() << " ";
+void ChVehicleOutputASCII::WriteShaftData(const std::vector<ShaftData>& shafts) {
+    for (const auto& shaft : shafts) {
+        m_stream << "    shaft: " << shaft.id << " \"" << shaft.name << "\" ";
+        m_stream << shaft.pos << " " << shaft.vel << " " << shaft.acc << " ";
+        m_stream << shaft.torque << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+void ChVehicleOutputASCII::WriteJointData(const std::vector<JointData>& joints) {
     for (const auto& joint : joints) {
-        std::vector<double> violations;
-        auto C = joint->GetConstraintViolation();
-        for (int i = 0; i < C.size(); i++)
-            violations.push_back(C(i));
-
-        auto reaction = joint->GetReaction2();
-        m_stream << "    joint: " << joint->GetIdentifier() << " \"" << joint->GetName() << "\" ";
-        m_stream << reaction.force << " " << reaction.torque << " ";
-        for (const auto& val : violations) {
+        m_stream << "    joint: " << joint.id << " \"" << joint.name << "\" ";
+        m_stream << joint.force << " " << joint.torque << " ";
+        for (const auto& val : joint.violations) {
             m_stream << val << " ";
         }
         m_stream << std::endl;
@@ -112,42 +98,41 @@ void ChVehicleOutputASCII::WriteJoints(const std::vector<std::shared_ptr<ChLink>
     }
 }
 
-void ChVehicleOutputASCII::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
-    for (auto couple : couples) {
-        m_stream << "    couple: " << couple->GetIdentifier() << " \"" << couple->GetName() << "\" ";
-        m_stream << couple->GetRelativePos() << " " << couple->GetRelativePosDt() << " " << couple->GetRelativePosDt2()
-                 << " ";
-        m_stream << couple->GetReaction1() << " " << couple->GetReaction2() << " ";
+void ChVehicleOutputASCII::WriteCoupleData(const std::vector<CoupleData>& couples) {
+    for (const auto& couple : couples) {
+        m_stream << "    couple: " << couple.id << " \"" << couple.name << "\" ";
+        m_stream << couple.pos << " " << couple.vel << " " << couple.acc << " ";
+        m_stream << couple.torque1 << " " << couple.torque2 << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
-    for (auto spring : springs) {
-        m_stream << "    lin spring: " << spring->GetIdentifier() << " \"" << spring->GetName() << "\" ";
-        m_stream << spring->GetPoint1Abs() << " " << spring->GetPoint2Abs() << " ";
-        m_stream << spring->GetLength() << " " << spring->GetVelocity() << " ";
-        m_stream << spring->GetForce() << " ";
+void ChVehicleOutputASCII::WriteLinSpringData(const std::vector<LinSpringData>& springs) {
+    for (const auto& spring : springs) {
+        m_stream << "    lin spring: " << spring.id << " \"" << spring.name << "\" ";
+        m_stream << spring.point1 << " " << spring.point2 << " ";
+        m_stream << spring.length << " " << spring.vel << " ";
+        m_stream << spring.force << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
-    for (auto spring : springs) {
-        m_stream << "    rot spring: " << spring->GetIdentifier() << " \"" << spring->GetName() << "\" ";
-        m_stream << spring->GetAngle() << " " << spring->GetVelocity() << " ";
-        m_stream << spring->GetTorque() << " ";
+void ChVehicleOutputASCII::WriteRotSpringData(const std::vector<RotSpringData>& springs) {
+    for (const auto& spring : springs) {
+        m_stream << "    rot spring: " << spring.id << " \"" << spring.name << "\" ";
+        m_stream << spring.angle << " " << spring.vel << " ";
+        m_stream << spring.torque << " ";
         m_stream << std::endl;
         //// TODO
     }
 }
 
-void ChVehicleOutputASCII::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
-    for (auto load : loads) {
-        m_stream << "    body-body load: " << load->GetIdentifier() << " \"" << load->GetName() << "\" ";
-        m_stream << load->GetForce() << " " << load->GetTorque() << " ";
+void ChVehicleOutputASCII::WriteBodyLoadData(const std::vector<BodyLoadData>& loads) {
+    for (const auto& load : loads) {
+        m_stream << "    body-body load: " << load.id << " \"" << load.name << "\" ";
+        m_stream << load.force << " " << load.torque << " ";
         m_stream << std::endl;
         //// TODO
     }
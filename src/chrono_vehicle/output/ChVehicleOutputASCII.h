@@ -41,15 +41,15 @@ class CH_VEHICLE_API ChVehicleOutputASCII : public ChVehicleOutput {
     virtual void WriteTime(int frame, double time) override;
     virtual void WriteSection(const std::string& name) override;
 
-    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
-    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
-    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
-    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
-    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
-    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
-    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) override;
-    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) override;
-    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+    virtual void WriteBodyData(const std::vector<BodyData>& bodies) override;
+    virtual void WriteAuxRefBodyData(const std::vector<AuxRefBodyData>& bodies) override;
+    virtual void WriteMarkerData(const std::vector<MarkerData>& markers) override;
+    virtual void WriteShaftData(const std::vector<ShaftData>& shafts) override;
+    virtual void WriteJointData(const std::vector<JointData>& joints) override;
+    virtual void WriteCoupleData(const std::vector<CoupleData>& couples) override;
+    virtual void WriteLinSpringData(const std::vector<LinSpringData>& springs) override;
+    virtual void WriteRotSpringData(const std::vector<RotSpringData>& springs) override;
+    virtual void WriteBodyLoadData(const std::vector<BodyLoadData>& loads) override;
 
     std::ostream& m_stream;
     std::ofstream m_file_stream;
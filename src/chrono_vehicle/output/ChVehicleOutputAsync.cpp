@@ -0,0 +1,309 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Asynchronous vehicle output database.
+//
+// The ring buffer holds the frames pending writing in [m_head, m_head + m_count)
+// (modulo the buffer size). The frame being filled by the simulation thread is
+// the one immediately following the pending frames; it is handed over to the
+// writer thread by incrementing m_count.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <iostream>
+
+#include "chrono_vehicle/output/ChVehicleOutputAsync.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChVehicleOutputAsync::ChVehicleOutputAsync(ChVehicleOutput* database, int num_frames, FullBufferPolicy policy)
+    : m_database(database),
+      m_policy(policy),
+      m_frames(std::max(num_frames, 2)),
+      m_current(nullptr),
+      m_num_dropped(0),
+      m_head(0),
+      m_count(0),
+      m_stop(false),
+      m_failed(false) {
+    m_writer = std::thread(&ChVehicleOutputAsync::Writer, this);
+}
+
+ChVehicleOutputAsync::~ChVehicleOutputAsync() {
+    Publish();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv_pending.notify_one();
+    m_writer.join();
+
+    if (m_error) {
+        try {
+            std::rethrow_exception(m_error);
+        } catch (const std::exception& e) {
+            std::cerr << "ChVehicleOutputAsync: error writing output: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "ChVehicleOutputAsync: error writing output" << std::endl;
+        }
+    }
+    if (m_num_dropped > 0)
+        std::cerr << "ChVehicleOutputAsync: " << m_num_dropped << " output frames dropped" << std::endl;
+
+    delete m_database;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputAsync::Publish() {
+    if (!m_current)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_count++;
+    }
+    m_cv_pending.notify_one();
+    m_current = nullptr;
+}
+
+void ChVehicleOutputAsync::CheckError() {
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::swap(error, m_error);
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void ChVehicleOutputAsync::Flush() {
+    Publish();
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv_written.wait(lock, [this]() { return m_count == 0; });
+    }
+    CheckError();
+}
+
+ChVehicleOutputAsync::Item* ChVehicleOutputAsync::NewItem(ItemType type) {
+    if (!m_current)
+        return nullptr;
+    if (m_current->num_items == m_current->items.size())
+        m_current->items.emplace_back();
+    Item* item = &m_current->items[m_current->num_items++];
+    item->type = type;
+    return item;
+}
+
+// -----------------------------------------------------------------------------
+// Functions called on the simulation thread
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputAsync::WriteTime(int frame, double time) {
+    Publish();
+    CheckError();
+
+    // Reserve the frame following the pending ones (drop the new frame or wait if the buffer is full)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_count == m_frames.size()) {
+            if (m_policy == FullBufferPolicy::DROP) {
+                m_num_dropped++;
+                return;
+            }
+            m_cv_written.wait(lock, [this]() { return m_count < m_frames.size(); });
+        }
+        m_current = &m_frames[(m_head + m_count) % m_frames.size()];
+    }
+
+    m_current->frame = frame;
+    m_current->time = time;
+    m_current->num_items = 0;
+}
+
+void ChVehicleOutputAsync::WriteSection(const std::string& name) {
+    if (auto item = NewItem(ItemType::SECTION))
+        item->name = name;
+}
+
+void ChVehicleOutputAsync::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    if (auto item = NewItem(ItemType::BODIES))
+        GetData(bodies, item->bodies);
+}
+
+void ChVehicleOutputAsync::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
+    if (auto item = NewItem(ItemType::AUXREF_BODIES))
+        GetData(bodies, item->auxref_bodies);
+}
+
+void ChVehicleOutputAsync::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
+    if (auto item = NewItem(ItemType::MARKERS))
+        GetData(markers, item->markers);
+}
+
+void ChVehicleOutputAsync::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    if (auto item = NewItem(ItemType::SHAFTS))
+        GetData(shafts, item->shafts);
+}
+
+void ChVehicleOutputAsync::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+    if (auto item = NewItem(ItemType::JOINTS))
+        GetData(joints, item->joints);
+}
+
+void ChVehicleOutputAsync::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
+    if (auto item = NewItem(ItemType::COUPLES))
+        GetData(couples, item->couples);
+}
+
+void ChVehicleOutputAsync::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
+    if (auto item = NewItem(ItemType::LIN_SPRINGS))
+        GetData(springs, item->lin_springs);
+}
+
+void ChVehicleOutputAsync::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
+    if (auto item = NewItem(ItemType::ROT_SPRINGS))
+        GetData(springs, item->rot_springs);
+}
+
+void ChVehicleOutputAsync::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
+    if (auto item = NewItem(ItemType::BODY_LOADS))
+        GetData(loads, item->body_loads);
+}
+
+void ChVehicleOutputAsync::WriteBodyData(const std::vector<BodyData>& bodies) {
+    if (auto item = NewItem(ItemType::BODIES))
+        item->bodies = bodies;
+}
+
+void ChVehicleOutputAsync::WriteAuxRefBodyData(const std::vector<AuxRefBodyData>& bodies) {
+    if (auto item = NewItem(ItemType::AUXREF_BODIES))
+        item->auxref_bodies = bodies;
+}
+
+void ChVehicleOutputAsync::WriteMarkerData(const std::vector<MarkerData>& markers) {
+    if (auto item = NewItem(ItemType::MARKERS))
+        item->markers = markers;
+}
+
+void ChVehicleOutputAsync::WriteShaftData(const std::vector<ShaftData>& shafts) {
+    if (auto item = NewItem(ItemType::SHAFTS))
+        item->shafts = shafts;
+}
+
+void ChVehicleOutputAsync::WriteJointData(const std::vector<JointData>& joints) {
+    if (auto item = NewItem(ItemType::JOINTS))
+        item->joints = joints;
+}
+
+void ChVehicleOutputAsync::WriteCoupleData(const std::vector<CoupleData>& couples) {
+    if (auto item = NewItem(ItemType::COUPLES))
+        item->couples = couples;
+}
+
+void ChVehicleOutputAsync::WriteLinSpringData(const std::vector<LinSpringData>& springs) {
+    if (auto item = NewItem(ItemType::LIN_SPRINGS))
+        item->lin_springs = springs;
+}
+
+void ChVehicleOutputAsync::WriteRotSpringData(const std::vector<RotSpringData>& springs) {
+    if (auto item = NewItem(ItemType::ROT_SPRINGS))
+        item->rot_springs = springs;
+}
+
+void ChVehicleOutputAsync::WriteBodyLoadData(const std::vector<BodyLoadData>& loads) {
+    if (auto item = NewItem(ItemType::BODY_LOADS))
+        item->body_loads = loads;
+}
+
+// -----------------------------------------------------------------------------
+// Functions called on the writer thread
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputAsync::Writer() {
+    while (true) {
+        // Wait for a pending frame; exit once stopped and all pending frames were written
+        Frame* frame;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv_pending.wait(lock, [this]() { return m_count > 0 || m_stop; });
+            if (m_count == 0)
+                break;
+            frame = &m_frames[m_head];
+        }
+
+        // Write the frame (without holding the lock). After a failure, pending frames are discarded.
+        if (!m_failed) {
+            try {
+                WriteFrame(*frame);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_error = std::current_exception();
+                m_failed = true;
+            }
+        }
+
+        // Release the frame
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_head = (m_head + 1) % m_frames.size();
+            m_count--;
+        }
+        m_cv_written.notify_one();
+    }
+}
+
+void ChVehicleOutputAsync::WriteFrame(const Frame& frame) {
+    m_database->WriteTime(frame.frame, frame.time);
+    for (size_t i = 0; i < frame.num_items; i++) {
+        const auto& item = frame.items[i];
+        switch (item.type) {
+            case ItemType::SECTION:
+                m_database->WriteSection(item.name);
+                break;
+            case ItemType::BODIES:
+                m_database->WriteBodyData(item.bodies);
+                break;
+            case ItemType::AUXREF_BODIES:
+                m_database->WriteAuxRefBodyData(item.auxref_bodies);
+                break;
+            case ItemType::MARKERS:
+                m_database->WriteMarkerData(item.markers);
+                break;
+            case ItemType::SHAFTS:
+                m_database->WriteShaftData(item.shafts);
+                break;
+            case ItemType::JOINTS:
+                m_database->WriteJointData(item.joints);
+                break;
+            case ItemType::COUPLES:
+                m_database->WriteCoupleData(item.couples);
+                break;
+            case ItemType::LIN_SPRINGS:
+                m_database->WriteLinSpringData(item.lin_springs);
+                break;
+            case ItemType::ROT_SPRINGS:
+                m_database->WriteRotSpringData(item.rot_springs);
+                break;
+            case ItemType::BODY_LOADS:
+                m_database->WriteBodyLoadData(item.body_loads);
+                break;
+        }
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
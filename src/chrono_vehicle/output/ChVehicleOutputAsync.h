@@ -0,0 +1,166 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Asynchronous vehicle output database.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_OUTPUT_ASYNC_H
+#define CH_VEHICLE_OUTPUT_ASYNC_H
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono_vehicle/ChVehicleOutput.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Asynchronous vehicle output database.
+/// Output data is extracted on the simulation thread into a ring buffer of frames and written by a background thread
+/// to an underlying output database (e.g., ChVehicleOutputASCII or ChVehicleOutputHDF5). The frame buffers are reused,
+/// so that after the first pass through the ring buffer no memory is allocated on the simulation thread. Memory use is
+/// bounded by the number of frames in the ring buffer; if all frames are pending when a new output frame starts, the
+/// new frame is either dropped or the simulation thread waits for the writer (see FullBufferPolicy).
+/// All buffered frames are written before the destructor returns.
+///
+/// A frame is handed to the writer thread when the next frame starts (at the next call to WriteTime), at a call to
+/// Flush, or at destruction.
+class CH_VEHICLE_API ChVehicleOutputAsync : public ChVehicleOutput {
+  public:
+    /// Behavior when a new output frame starts while the ring buffer is full.
+    enum class FullBufferPolicy {
+        DROP,  ///< drop the new frame (the simulation thread never waits on the writer)
+        WAIT   ///< wait for the writer thread to free a frame
+    };
+
+    /// Construct an asynchronous output database writing to the specified database.
+    /// The asynchronous database takes ownership of the provided database, which is deleted at destruction.
+    ChVehicleOutputAsync(ChVehicleOutput* database,                        ///< underlying output database
+                         int num_frames = 16,                              ///< number of frames in ring buffer
+                         FullBufferPolicy policy = FullBufferPolicy::DROP  ///< behavior when buffer is full
+    );
+
+    /// Write all buffered frames, stop the writer thread, and delete the underlying database.
+    ~ChVehicleOutputAsync();
+
+    /// Hand over the current frame to the writer thread and wait until all buffered frames were written.
+    /// Output data provided after a call to Flush and before the next call to WriteTime is ignored.
+    /// Rethrows any exception raised by the underlying database since the last check.
+    void Flush();
+
+    /// Return the number of output frames dropped because the ring buffer was full.
+    int GetNumDroppedFrames() const { return m_num_dropped; }
+
+    virtual void WriteTime(int frame, double time) override;
+    virtual void WriteSection(const std::string& name) override;
+
+    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
+    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
+    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
+    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
+    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
+    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
+    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) override;
+    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) override;
+    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+
+    virtual void WriteBodyData(const std::vector<BodyData>& bodies) override;
+    virtual void WriteAuxRefBodyData(const std::vector<AuxRefBodyData>& bodies) override;
+    virtual void WriteMarkerData(const std::vector<MarkerData>& markers) override;
+    virtual void WriteShaftData(const std::vector<ShaftData>& shafts) override;
+    virtual void WriteJointData(const std::vector<JointData>& joints) override;
+    virtual void WriteCoupleData(const std::vector<CoupleData>& couples) override;
+    virtual void WriteLinSpringData(const std::vector<LinSpringData>& springs) override;
+    virtual void WriteRotSpringData(const std::vector<RotSpringData>& springs) override;
+    virtual void WriteBodyLoadData(const std::vector<BodyLoadData>& loads) override;
+
+  private:
+    /// Type of an output item.
+    enum class ItemType {
+        SECTION,
+        BODIES,
+        AUXREF_BODIES,
+        MARKERS,
+        SHAFTS,
+        JOINTS,
+        COUPLES,
+        LIN_SPRINGS,
+        ROT_SPRINGS,
+        BODY_LOADS
+    };
+
+    /// Output item (a section header or a list of data records of a given type).
+    struct Item {
+        ItemType type;
+        std::string name;
+        std::vector<BodyData> bodies;
+        std::vector<AuxRefBodyData> auxref_bodies;
+        std::vector<MarkerData> markers;
+        std::vector<ShaftData> shafts;
+        std::vector<JointData> joints;
+        std::vector<CoupleData> couples;
+        std::vector<LinSpringData> lin_springs;
+        std::vector<RotSpringData> rot_springs;
+        std::vector<BodyLoadData> body_loads;
+    };
+
+    /// Output frame. Items are reused across passes through the ring buffer.
+    struct Frame {
+        int frame;
+        double time;
+        std::vector<Item> items;
+        size_t num_items;
+    };
+
+    Item* NewItem(ItemType type);
+    void Publish();
+    void CheckError();
+    void Writer();
+    void WriteFrame(const Frame& frame);
+
+    ChVehicleOutput* m_database;  ///< underlying output database
+    FullBufferPolicy m_policy;    ///< behavior when ring buffer is full
+    std::vector<Frame> m_frames;  ///< ring buffer of output frames
+
+    // Accessed only by the simulation thread
+    Frame* m_current;   ///< frame currently being filled (nullptr if none)
+    int m_num_dropped;  ///< number of dropped frames
+
+    // Shared between the simulation and writer threads (protected by m_mutex)
+    size_t m_head;               ///< index of next frame to be written
+    size_t m_count;              ///< number of frames pending writing
+    bool m_stop;                 ///< request to stop the writer thread
+    std::exception_ptr m_error;  ///< exception raised by the underlying database
+    std::mutex m_mutex;
+    std::condition_variable m_cv_pending;  ///< signaled when a frame is pending writing
+    std::condition_variable m_cv_written;  ///< signaled when a frame was written
+
+    bool m_failed;         ///< writing failed (accessed only by the writer thread)
+    std::thread m_writer;  ///< writer thread
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -21,9 +21,6 @@
 #include <sstream>
 #include <fstream>
 
-#include "chrono/physics/ChLinkLock.h"
-#include "chrono/physics/ChLinkUniversal.h"
-
 #include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
 
 namespace chrono {
@@ -219,7 +216,7 @@ const H5::CompType& ChVehicleOutputHDF5::getCoupleType() {
                 m_couple_type->insertMember("xd", HOFFSET(couple_info, xd), H5::PredType::NATIVE_DOUBLE);
                 m_couple_type->insertMember("xdd", HOFFSET(couple_info, xdd), H5::PredType::NATIVE_DOUBLE);
                 m_couple_type->insertMember("torque1", HOFFSET(couple_info, t1), H5::PredType::NATIVE_DOUBLE);
-                m_couple_type->insertMember("torque2", HOFFSET(couple_info, t1), H5::PredType::NATIVE_DOUBLE);
+                m_couple_type->insertMember("torque2", HOFFSET(couple_info, t2), H5::PredType::NATIVE_DOUBLE);
             }
         };
         static Initializer ListInitializationGuard;
@@ -281,7 +278,7 @@ const H5::CompType& ChVehicleOutputHDF5::getBodyLoadType() {
 // -----------------------------------------------------------------------------
 
 ChVehicleOutputHDF5::ChVehicleOutputHDF5(const std::string& filename)
-    : m_frame_group(nullptr), m_section_group(nullptr) {
+    : m_frame_group(nullptr), m_section_group(nullptr), m_compression(0) {
     m_fileHDF5 = new H5::H5File(filename, H5F_ACC_TRUNC);
     H5::Group frames_group(m_fileHDF5->createGroup("/Frames"));
 }
@@ -357,166 +354,153 @@ void ChVehicleOutputHDF5::WriteSection(const std::string& name) {
     m_section_group = new H5::Group(m_frame_group->createGroup(name));
 }
 
-void ChVehicleOutputHDF5::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+H5::DataSet ChVehicleOutputHDF5::CreateDataSet(const std::string& name, const H5::CompType& type, hsize_t size) {
+    hsize_t dim[] = {size};
+    H5::DataSpace dataspace(1, dim);
+
+    // Chunked and compressed dataset (a single chunk per dataset)
+    H5::DSetCreatPropList plist;
+    if (m_compression > 0) {
+        plist.setChunk(1, dim);
+        plist.setDeflate(m_compression);
+    }
+
+    return m_section_group->createDataSet(name, type, dataspace, plist);
+}
+
+void ChVehicleOutputHDF5::WriteBodyData(const std::vector<BodyData>& bodies) {
     if (bodies.empty())
         return;
 
     auto nbodies = bodies.size();
-    hsize_t dim[] = {nbodies};
-    H5::DataSpace dataspace(1, dim);
     std::vector<body_info> info(nbodies);
     for (auto i = 0; i < nbodies; i++) {
-        const ChVector3d& p = bodies[i]->GetPos();
-        const ChQuaternion<>& q = bodies[i]->GetRot();
-        info[i] = {bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
+        const auto& b = bodies[i];
+        info[i] = {b.id, b.pos.x(), b.pos.y(), b.pos.z(), b.rot.e0(), b.rot.e1(), b.rot.e2(), b.rot.e3()};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Bodies", getBodyType(), dataspace);
+    H5::DataSet set = CreateDataSet("Bodies", getBodyType(), nbodies);
     set.write(info.data(), getBodyType());
 }
 
-void ChVehicleOutputHDF5::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
+void ChVehicleOutputHDF5::WriteAuxRefBodyData(const std::vector<AuxRefBodyData>& bodies) {
     if (bodies.empty())
         return;
 
     auto nbodies = bodies.size();
-    hsize_t dim[] = {nbodies};
-    H5::DataSpace dataspace(1, dim);
     std::vector<bodyaux_info> info(nbodies);
     for (auto i = 0; i < nbodies; i++) {
-        const ChVector3d& p = bodies[i]->GetPos();
-        const ChQuaternion<>& q = bodies[i]->GetRot();
-        info[i] = {bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
+        const auto& b = bodies[i];
+        info[i] = {b.id, b.pos.x(), b.pos.y(), b.pos.z(), b.rot.e0(), b.rot.e1(), b.rot.e2(), b.rot.e3()};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Bodies AuxRef", getBodyAuxType(), dataspace);
+    H5::DataSet set = CreateDataSet("Bodies AuxRef", getBodyAuxType(), nbodies);
     set.write(info.data(), getBodyAuxType());
 }
 
-void ChVehicleOutputHDF5::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
+void ChVehicleOutputHDF5::WriteMarkerData(const std::vector<MarkerData>& markers) {
     if (markers.empty())
         return;
 
     auto nmarkers = markers.size();
-    hsize_t dim[] = {nmarkers};
-    H5::DataSpace dataspace(1, dim);
     std::vector<marker_info> info(nmarkers);
     for (auto i = 0; i < nmarkers; i++) {
-        const ChVector3d& p = markers[i]->GetAbsCoordsys().pos;
-        const ChVector3d& pd = markers[i]->GetAbsCoordsysDt().pos;
-        const ChVector3d& pdd = markers[i]->GetAbsCoordsysDt2().pos;
-        info[i] = {markers[i]->GetIdentifier(), p.x(), p.y(), p.z(), pd.x(), pd.y(), pd.z(), pdd.x(), pdd.y(), pdd.z()};
+        const auto& m = markers[i];
+        info[i] = {m.id,      m.pos.x(), m.pos.y(), m.pos.z(), m.vel.x(),  //
+                   m.vel.y(), m.vel.z(), m.acc.x(), m.acc.y(), m.acc.z()};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Markers", getMarkerType(), dataspace);
+    H5::DataSet set = CreateDataSet("Markers", getMarkerType(), nmarkers);
     set.write(info.data(), getMarkerType());
 }
 
-void ChVehicleOutputHDF5::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
+void ChVehicleOutputHDF5::WriteShaftData(const std::vector<ShaftData>& shafts) {
     if (shafts.empty())
         return;
 
     auto nshafts = shafts.size();
-    hsize_t dim[] = {nshafts};
-    H5::DataSpace dataspace(1, dim);
     std::vector<shaft_info> info(nshafts);
     for (auto i = 0; i < nshafts; i++) {
-        info[i] = {shafts[i]->GetIdentifier(), shafts[i]->GetPos(), shafts[i]->GetPosDt(), shafts[i]->GetPosDt2(),
-                   shafts[i]->GetAppliedLoad()};
+        const auto& s = shafts[i];
+        info[i] = {s.id, s.pos, s.vel, s.acc, s.torque};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Shafts", getShaftType(), dataspace);
+    H5::DataSet set = CreateDataSet("Shafts", getShaftType(), nshafts);
     set.write(info.data(), getShaftType());
 }
 
-void ChVehicleOutputHDF5::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+void ChVehicleOutputHDF5::WriteJointData(const std::vector<JointData>& joints) {
     if (joints.empty())
         return;
 
     auto njoints = joints.size();
-    hsize_t dim[] = {njoints};
-    H5::DataSpace dataspace(1, dim);
     std::vector<joint_info> info(njoints);
     for (auto i = 0; i < njoints; i++) {
-        auto reaction = joints[i]->GetReaction2();
-        const ChVector3d& f = reaction.force;
-        const ChVector3d& t = reaction.torque;
-        info[i] = {joints[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z()};
+        const auto& j = joints[i];
+        info[i] = {j.id, j.force.x(), j.force.y(), j.force.z(), j.torque.x(), j.torque.y(), j.torque.z()};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Joints", getJointType(), dataspace);
+    H5::DataSet set = CreateDataSet("Joints", getJointType(), njoints);
     set.write(info.data(), getJointType());
 }
 
-void ChVehicleOutputHDF5::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
+void ChVehicleOutputHDF5::WriteCoupleData(const std::vector<CoupleData>& couples) {
     if (couples.empty())
         return;
 
     auto ncouples = couples.size();
-    hsize_t dim[] = {ncouples};
-    H5::DataSpace dataspace(1, dim);
     std::vector<couple_info> info(ncouples);
     for (auto i = 0; i < ncouples; i++) {
-        info[i] = {
-            couples[i]->GetIdentifier(),    couples[i]->GetRelativePos(),     //
-            couples[i]->GetRelativePosDt(), couples[i]->GetRelativePosDt2(),  //
-            couples[i]->GetReaction1(),     couples[i]->GetReaction2()        //
-        };
+        const auto& c = couples[i];
+        info[i] = {c.id, c.pos, c.vel, c.acc, c.torque1, c.torque2};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Couples", getCoupleType(), dataspace);
+    H5::DataSet set = CreateDataSet("Couples", getCoupleType(), ncouples);
     set.write(info.data(), getCoupleType());
 }
 
-void ChVehicleOutputHDF5::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
+void ChVehicleOutputHDF5::WriteLinSpringData(const std::vector<LinSpringData>& springs) {
     if (springs.empty())
         return;
 
     auto nsprings = springs.size();
-    hsize_t dim[] = {nsprings};
-    H5::DataSpace dataspace(1, dim);
     std::vector<linspring_info> info(nsprings);
     for (auto i = 0; i < nsprings; i++) {
-        info[i] = {springs[i]->GetIdentifier(), springs[i]->GetLength(), springs[i]->GetVelocity(),
-                   springs[i]->GetForce()};
+        const auto& s = springs[i];
+        info[i] = {s.id, s.length, s.vel, s.force};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Lin Springs", getLinSpringType(), dataspace);
+    H5::DataSet set = CreateDataSet("Lin Springs", getLinSpringType(), nsprings);
     set.write(info.data(), getLinSpringType());
 }
 
-void ChVehicleOutputHDF5::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
+void ChVehicleOutputHDF5::WriteRotSpringData(const std::vector<RotSpringData>& springs) {
     if (springs.empty())
         return;
 
     auto nsprings = springs.size();
-    hsize_t dim[] = {nsprings};
-    H5::DataSpace dataspace(1, dim);
     std::vector<rotspring_info> info(nsprings);
     for (auto i = 0; i < nsprings; i++) {
-        info[i] = {springs[i]->GetIdentifier(), springs[i]->GetAngle(), springs[i]->GetVelocity(),
-                   springs[i]->GetTorque()};
+        const auto& s = springs[i];
+        info[i] = {s.id, s.angle, s.vel, s.torque};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Rot Springs", getRotSpringType(), dataspace);
+    H5::DataSet set = CreateDataSet("Rot Springs", getRotSpringType(), nsprings);
     set.write(info.data(), getRotSpringType());
 }
 
-void ChVehicleOutputHDF5::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
+void ChVehicleOutputHDF5::WriteBodyLoadData(const std::vector<BodyLoadData>& loads) {
     if (loads.empty())
         return;
 
     auto nloads = loads.size();
-    hsize_t dim[] = {nloads};
-    H5::DataSpace dataspace(1, dim);
     std::vector<bodyload_info> info(nloads);
     for (auto i = 0; i < nloads; i++) {
-        ChVector3d f = loads[i]->GetForce();
-        ChVector3d t = loads[i]->GetTorque();
-        info[i] = {loads[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z()};
+        const auto& l = loads[i];
+        info[i] = {l.id, l.force.x(), l.force.y(), l.force.z(), l.torque.x(), l.torque.y(), l.torque.z()};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Body-body Loads", getBodyLoadType(), dataspace);
+    H5::DataSet set = CreateDataSet("Body-body Loads", getBodyLoadType(), nloads);
     set.write(info.data(), getBodyLoadType());
 }
 
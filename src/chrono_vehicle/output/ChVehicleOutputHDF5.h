@@ -12,7 +12,7 @@
 // Authors: Radu Serban
 // =============================================================================
 //
-// ASCII text vehicle output database.
+// HDF5 vehicle output database.
 //
 // =============================================================================
 
@@ -38,23 +38,32 @@ class CH_VEHICLE_API ChVehicleOutputHDF5 : public ChVehicleOutput {
     ChVehicleOutputHDF5(const std::string& filename);
     ~ChVehicleOutputHDF5();
 
+    /// Set the compression level for the output datasets (default: 0, no compression).
+    /// If a non-zero level is provided (at most 9), datasets are created chunked and compressed with the deflate
+    /// filter. To use compression for vehicle output, construct and configure the database, then pass it to
+    /// ChVehicle::SetOutput.
+    void SetCompression(int level) { m_compression = level; }
+
   private:
     virtual void WriteTime(int frame, double time) override;
     virtual void WriteSection(const std::string& name) override;
 
-    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
-    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
-    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
-    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
-    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
-    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
-    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) override;
-    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) override;
-    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+    virtual void WriteBodyData(const std::vector<BodyData>& bodies) override;
+    virtual void WriteAuxRefBodyData(const std::vector<AuxRefBodyData>& bodies) override;
+    virtual void WriteMarkerData(const std::vector<MarkerData>& markers) override;
+    virtual void WriteShaftData(const std::vector<ShaftData>& shafts) override;
+    virtual void WriteJointData(const std::vector<JointData>& joints) override;
+    virtual void WriteCoupleData(const std::vector<CoupleData>& couples) override;
+    virtual void WriteLinSpringData(const std::vector<LinSpringData>& springs) override;
+    virtual void WriteRotSpringData(const std::vector<RotSpringData>& springs) override;
+    virtual void WriteBodyLoadData(const std::vector<BodyLoadData>& loads) override;
+
+    H5::DataSet CreateDataSet(const std::string& name, const H5::CompType& type, hsize_t size);
 
     H5::H5File* m_fileHDF5;
     H5::Group* m_frame_group;
     H5::Group* m_section_group;
+    int m_compression;
 
     static H5::CompType* m_body_type;
     static H5::CompType* m_bodyaux_type;
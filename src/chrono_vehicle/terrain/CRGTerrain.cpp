@@ -281,11 +281,14 @@ double CRGTerrain::GetHeight(const ChVector3d& loc) const {
 }
 
 ChVector3d CRGTerrain::GetNormal(const ChVector3d& loc) const {
+    return CalcNormal(loc, GetHeight(loc));
+}
+
+ChVector3d CRGTerrain::CalcNormal(const ChVector3d& loc, double z0) const {
     ChVector3d loc_ISO = ChWorldFrame::ToISO(loc);
     // to avoid 'jumping' of the normal vector, we take this smoothing approach
     const double delta = 0.05;
-    double z0, zfront, zleft;
-    z0 = GetHeight(loc);
+    double zfront, zleft;
     zfront = GetHeight(ChWorldFrame::FromISO(loc_ISO + ChVector3d(delta, 0, 0)));
     zleft = GetHeight(ChWorldFrame::FromISO(loc_ISO + ChVector3d(0, delta, 0)));
     ChVector3d p0(loc_ISO.x(), loc_ISO.y(), z0);
@@ -310,6 +313,21 @@ float CRGTerrain::GetCoefficientFriction(const ChVector3d& loc) const {
     return m_friction_fun ? (*m_friction_fun)(loc) : m_friction;
 }
 
+void CRGTerrain::GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& frictions) const {
+    size_t n = locs.size();
+    heights.resize(n);
+    normals.resize(n);
+    frictions.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        heights[i] = GetHeight(locs[i]);
+        normals[i] = CalcNormal(locs[i], heights[i]);
+        frictions[i] = m_friction_fun ? (*m_friction_fun)(locs[i]) : m_friction;
+    }
+}
+
 std::shared_ptr<ChBezierCurve> CRGTerrain::GetRoadCenterLine() {
     std::vector<ChVector3d> pathpoints;
 
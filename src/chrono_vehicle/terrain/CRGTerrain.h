@@ -93,6 +93,15 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value specified at construction.
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override;
 
+    using ChTerrain::GetProperties;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// The terrain height at each location is evaluated only once and reused for the smoothed terrain normal.
+    virtual void GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& frictions) const override;
+
     /// Get the road center line as a Bezier curve.
     std::shared_ptr<ChBezierCurve> GetRoadCenterLine();
 
@@ -143,6 +152,9 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     void ExportCurvesPovray(const std::string& out_dir);
 
   private:
+    /// Calculate the smoothed terrain normal below the specified location, given the terrain height there.
+    ChVector3d CalcNormal(const ChVector3d& loc, double height) const;
+
     /// Build the graphical representation.
     void SetupLineGraphics();
     void SetupMeshGraphics();
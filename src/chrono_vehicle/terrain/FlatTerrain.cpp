@@ -36,5 +36,25 @@ float FlatTerrain::GetCoefficientFriction(const ChVector3d& loc) const {
     return m_friction_fun ? (*m_friction_fun)(loc) : m_friction;
 }
 
+void FlatTerrain::GetHeights(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const {
+    heights.assign(locs.size(), m_height);
+}
+
+void FlatTerrain::GetProperties(const std::vector<ChVector3d>& locs,
+                                std::vector<double>& heights,
+                                std::vector<ChVector3d>& normals,
+                                std::vector<float>& frictions) const {
+    size_t n = locs.size();
+    heights.assign(n, m_height);
+    normals.assign(n, ChWorldFrame::Vertical());
+    if (m_friction_fun) {
+        frictions.resize(n);
+        for (size_t i = 0; i < n; i++)
+            frictions[i] = (*m_friction_fun)(locs[i]);
+    } else {
+        frictions.assign(n, m_friction);
+    }
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
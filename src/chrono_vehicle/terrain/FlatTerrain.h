@@ -57,6 +57,19 @@ class CH_VEHICLE_API FlatTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value specified at construction.
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override;
 
+    /// Get the terrain heights below the specified locations.
+    virtual void GetHeights(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const override;
+
+    using ChTerrain::GetProperties;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// The constant height and normal are broadcast to all locations; the friction functor (if any) is called only
+    /// for the friction coefficients.
+    virtual void GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& frictions) const override;
+
   private:
     double m_height;   ///< terrain height
     float m_friction;  ///< contact coefficient of friction
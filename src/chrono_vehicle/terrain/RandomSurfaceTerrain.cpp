@@ -22,6 +22,7 @@
 // vehicle-terrain interaction (wheeled vehicle with rigid tires or tracked vehicles).
 // ===================================================================================================================
 
+#include <algorithm>
 #include <random>
 #include <cmath>
 
@@ -117,22 +118,21 @@ double RandomSurfaceTerrain::GetHeight(const ChVector3d& loc) const {
     if (loc_ISO.y() < m_ymin || loc_ISO.y() > m_ymax)
         return m_height;
     int ix = (std::abs(loc_ISO.x() - m_xmax) > 1e-6) ? static_cast<int>((loc_ISO.x() - m_xmin) / m_dx) : m_nx - 2;
-    int iy = -1;
-    for (int i = 0; i < m_ny - 1; i++) {
-        if (loc_ISO.y() >= m_y[i] && loc_ISO.y() <= m_y[i + 1]) {
-            iy = i;
-            break;
-        }
-    }
+    // Binary search for the first interval [y_i, y_{i+1}] containing the location (y values are increasing)
+    auto it = std::lower_bound(m_y.begin() + 1, m_y.begin() + m_ny, loc_ISO.y());
+    int iy = std::min(static_cast<int>(it - m_y.begin()) - 1, m_ny - 2);
     return m_height + m_a0(ix, iy) + m_a1(ix, iy) * loc.x() + m_a2(ix, iy) * loc.y() + m_a3(ix, iy) * loc.x() * loc.y();
 }
 
 ChVector3d RandomSurfaceTerrain::GetNormal(const ChVector3d& loc) const {
+    return CalcNormal(loc, GetHeight(loc));
+}
+
+ChVector3d RandomSurfaceTerrain::CalcNormal(const ChVector3d& loc, double z0) const {
     ChVector3d loc_ISO = ChWorldFrame::ToISO(loc);
     // to avoid 'jumping' of the normal vector, we take this smoothing approach
     const double delta = 0.05;
-    double z0, zfront, zleft;
-    z0 = GetHeight(loc);
+    double zfront, zleft;
     zfront = GetHeight(ChWorldFrame::FromISO(loc_ISO + ChVector3d(delta, 0, 0)));
     zleft = GetHeight(ChWorldFrame::FromISO(loc_ISO + ChVector3d(0, delta, 0)));
     ChVector3d p0(loc_ISO.x(), loc_ISO.y(), z0);
@@ -157,6 +157,21 @@ float RandomSurfaceTerrain::GetCoefficientFriction(const ChVector3d& loc) const
     return m_friction_fun ? (*m_friction_fun)(loc) : m_friction;
 }
 
+void RandomSurfaceTerrain::GetProperties(const std::vector<ChVector3d>& locs,
+                                         std::vector<double>& heights,
+                                         std::vector<ChVector3d>& normals,
+                                         std::vector<float>& frictions) const {
+    size_t n = locs.size();
+    heights.resize(n);
+    normals.resize(n);
+    frictions.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        heights[i] = GetHeight(locs[i]);
+        normals[i] = CalcNormal(locs[i], heights[i]);
+        frictions[i] = m_friction_fun ? (*m_friction_fun)(locs[i]) : m_friction;
+    }
+}
+
 void RandomSurfaceTerrain::GenerateSurfaceCanonical(double unevenness, double waviness) {
     m_unevenness = ChClamp(unevenness, 1.0e-6, m_classLimits[7]);
     m_waviness = waviness;
@@ -164,6 +164,15 @@ class CH_VEHICLE_API RandomSurfaceTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value specified at construction.
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override;
 
+    using ChTerrain::GetProperties;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// The terrain height at each location is evaluated only once and reused for the smoothed terrain normal.
+    virtual void GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& frictions) const override;
+
     /// Get the (detrended) root mean square of the tracks, height offset is not considered [m]
     double GetRMS() { return m_rms; }
 
@@ -197,6 +206,9 @@ class CH_VEHICLE_API RandomSurfaceTerrain : public ChTerrain {
                     RandomSurfaceTerrain::VisualisationType vType = RandomSurfaceTerrain::VisualisationType::MESH);
 
   private:
+    /// Calculate the smoothed terrain normal below the specified location, given the terrain height there.
+    ChVector3d CalcNormal(const ChVector3d& loc, double height) const;
+
     double m_unevenness;
     double m_waviness;
     double m_rms;                      ///< (detrended) root mean square of the uneven tracks
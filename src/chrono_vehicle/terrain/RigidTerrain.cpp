@@ -27,6 +27,7 @@
 #include "chrono/assets/ChVisualShapeTriangleMesh.h"
 #include "chrono/physics/ChContactMaterialNSC.h"
 #include "chrono/physics/ChContactMaterialSMC.h"
+#include "chrono/utils/ChUtils.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
@@ -50,6 +51,7 @@ RigidTerrain::RigidTerrain(ChSystem* system)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_use_mesh_index(true),
       m_contact_callback(nullptr),
       m_collision_family(14),
       m_initialized(false) {}
@@ -61,6 +63,7 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_use_mesh_index(true),
       m_contact_callback(nullptr),
       m_collision_family(14),
       m_initialized(false) {
@@ -179,6 +182,10 @@ void RigidTerrain::InitializePatch(std::shared_ptr<Patch> patch) {
     // Initialize the patch
     patch->Initialize();
 
+    // Build the height-field index of a mesh patch
+    if (m_use_mesh_index && patch->m_type != PatchType::BOX)
+        std::static_pointer_cast<MeshPatch>(patch)->BuildIndex();
+
     // All patches are added to the same collision family and collision with other models in this family is disabled
     patch->m_body->GetCollisionModel()->SetFamily(m_collision_family);
     patch->m_body->GetCollisionModel()->DisallowCollisionsWith(m_collision_family);
@@ -1075,6 +1082,53 @@ void RigidTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector
         friction = (*m_friction_fun)(loc);
 }
 
+void RigidTerrain::GetHeights(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const {
+    if (m_height_fun) {
+        heights.resize(locs.size());
+        for (size_t i = 0; i < locs.size(); i++)
+            heights[i] = (*m_height_fun)(locs[i]);
+        return;
+    }
+
+    std::vector<ChVector3d> normals;
+    std::vector<float> frictions;
+    GetProperties(locs, heights, normals, frictions);
+}
+
+void RigidTerrain::GetProperties(const std::vector<ChVector3d>& locs,
+                                 std::vector<double>& heights,
+                                 std::vector<ChVector3d>& normals,
+                                 std::vector<float>& frictions) const {
+    size_t n = locs.size();
+
+    if (m_height_fun && m_normal_fun && m_friction_fun) {
+        heights.resize(n);
+        normals.resize(n);
+        frictions.resize(n);
+    } else {
+        heights.assign(n, std::numeric_limits<double>::lowest());
+        normals.assign(n, ChWorldFrame::Vertical());
+        frictions.assign(n, 0.8f);
+
+        for (auto patch : m_patches)
+            patch->FindPoints(locs, heights, normals, frictions);
+
+        for (size_t i = 0; i < n; i++) {
+            if (heights[i] == std::numeric_limits<double>::lowest())
+                heights[i] = 0;
+        }
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        if (m_height_fun)
+            heights[i] = (*m_height_fun)(locs[i]);
+        if (m_normal_fun)
+            normals[i] = (*m_normal_fun)(locs[i]);
+        if (m_friction_fun)
+            frictions[i] = (*m_friction_fun)(locs[i]);
+    }
+}
+
 bool RigidTerrain::FindPoint(const ChVector3d loc, double& height, ChVector3d& normal, float& friction) const {
     bool hit = false;
     height = std::numeric_limits<double>::lowest();
@@ -1096,6 +1150,31 @@ bool RigidTerrain::FindPoint(const ChVector3d loc, double& height, ChVector3d& n
     return hit;
 }
 
+void RigidTerrain::Patch::FindPoints(const std::vector<ChVector3d>& locs,
+                                     std::vector<double>& heights,
+                                     std::vector<ChVector3d>& normals,
+                                     std::vector<float>& frictions) const {
+    const ChVector3d& center = m_body->GetPos();
+    const ChVector3d& vertical = ChWorldFrame::Vertical();
+    double radius2 = m_radius * m_radius;
+
+    for (size_t i = 0; i < locs.size(); i++) {
+        // Skip this location if the vertical ray does not intersect the patch bounding sphere
+        ChVector3d d = locs[i] - center;
+        double dv = Vdot(d, vertical);
+        if (d.Length2() - dv * dv > radius2)
+            continue;
+
+        double height;
+        ChVector3d normal;
+        if (FindPoint(locs[i], height, normal) && height > heights[i]) {
+            heights[i] = height;
+            normals[i] = normal;
+            frictions[i] = m_friction;
+        }
+    }
+}
+
 bool RigidTerrain::BoxPatch::FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const {
     // Ray definition (in global frame)
     ChVector3d A = loc;                        // start point
@@ -1113,6 +1192,9 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector3d& loc, double& height, Ch
 }
 
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    if (!m_cell_start.empty())
+        return FindPointIndexed(loc, height, normal);
+
     ChVector3d from = loc;
     ChVector3d to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
@@ -1124,6 +1206,141 @@ bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, C
     return result.hit;
 }
 
+// -----------------------------------------------------------------------------
+// Height-field index of a mesh patch.
+// The mesh faces are projected onto the horizontal plane and registered in all cells of a uniform 2D grid overlapped
+// by their projected bounding box. A vertical ray through a given location can only hit faces registered in the grid
+// cell containing that location; the highest such face point below the ray origin is the ray cast result.
+// -----------------------------------------------------------------------------
+void RigidTerrain::MeshPatch::BuildIndex() {
+    const auto& vertices = m_trimesh->GetCoordsVertices();
+    const auto& idx_vertices = m_trimesh->GetIndicesVertexes();
+
+    // Mesh vertices in the ISO world frame
+    std::vector<ChVector3d> verts(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++)
+        verts[i] = ChWorldFrame::ToISO(m_body->TransformPointLocalToParent(vertices[i]));
+
+    // Cache data for all non-vertical faces and their projected bounding boxes
+    m_faces.clear();
+    m_faces.reserve(idx_vertices.size());
+    std::vector<ChVector2d> fmin;
+    std::vector<ChVector2d> fmax;
+    ChVector2d gmin(+std::numeric_limits<double>::max());
+    ChVector2d gmax(-std::numeric_limits<double>::max());
+    for (const auto& idx : idx_vertices) {
+        const auto& p0 = verts[idx[0]];
+        const auto& p1 = verts[idx[1]];
+        const auto& p2 = verts[idx[2]];
+
+        IndexedFace face;
+        face.v0 = ChVector2d(p0.x(), p0.y());
+        face.e1 = ChVector2d(p1.x() - p0.x(), p1.y() - p0.y());
+        face.e2 = ChVector2d(p2.x() - p0.x(), p2.y() - p0.y());
+        double det = face.e1.x() * face.e2.y() - face.e1.y() * face.e2.x();
+        if (std::abs(det) < 1e-14 * (face.e1.Length2() + face.e2.Length2()))
+            continue;
+        face.inv_det = 1 / det;
+        face.h0 = p0.z();
+        face.dh1 = p1.z() - p0.z();
+        face.dh2 = p2.z() - p0.z();
+        face.normal = Vcross(p1 - p0, p2 - p0).GetNormalized();
+        if (face.normal.z() < 0)
+            face.normal = -face.normal;
+        m_faces.push_back(face);
+
+        ChVector2d bmin(std::min({p0.x(), p1.x(), p2.x()}), std::min({p0.y(), p1.y(), p2.y()}));
+        ChVector2d bmax(std::max({p0.x(), p1.x(), p2.x()}), std::max({p0.y(), p1.y(), p2.y()}));
+        fmin.push_back(bmin);
+        fmax.push_back(bmax);
+        gmin = ChVector2d(std::min(gmin.x(), bmin.x()), std::min(gmin.y(), bmin.y()));
+        gmax = ChVector2d(std::max(gmax.x(), bmax.x()), std::max(gmax.y(), bmax.y()));
+    }
+
+    m_cell_start.clear();
+    m_cell_faces.clear();
+    if (m_faces.empty())
+        return;
+
+    // Grid cell size, such that there are about 2 faces per cell
+    int num_faces = (int)m_faces.size();
+    double lx = std::max(gmax.x() - gmin.x(), 1e-6);
+    double ly = std::max(gmax.y() - gmin.y(), 1e-6);
+    double size = std::sqrt(2 * lx * ly / num_faces);
+    m_grid_nx = std::max(1, std::min((int)std::ceil(lx / size), 4 * num_faces));
+    m_grid_ny = std::max(1, std::min((int)std::ceil(ly / size), 4 * num_faces));
+    size = std::max(lx / m_grid_nx, ly / m_grid_ny) * (1 + 1e-9);
+    m_grid_min = gmin;
+    m_grid_inv_size = 1 / size;
+
+    // Count faces in each cell, then fill cell face lists (compressed row storage)
+    auto cell_range = [&](int f, int& i0, int& i1, int& j0, int& j1) {
+        i0 = ChClamp((int)std::floor((fmin[f].x() - gmin.x()) * m_grid_inv_size), 0, m_grid_nx - 1);
+        i1 = ChClamp((int)std::floor((fmax[f].x() - gmin.x()) * m_grid_inv_size), 0, m_grid_nx - 1);
+        j0 = ChClamp((int)std::floor((fmin[f].y() - gmin.y()) * m_grid_inv_size), 0, m_grid_ny - 1);
+        j1 = ChClamp((int)std::floor((fmax[f].y() - gmin.y()) * m_grid_inv_size), 0, m_grid_ny - 1);
+    };
+
+    m_cell_start.assign(m_grid_nx * m_grid_ny + 1, 0);
+    for (int f = 0; f < num_faces; f++) {
+        int i0, i1, j0, j1;
+        cell_range(f, i0, i1, j0, j1);
+        for (int j = j0; j <= j1; j++)
+            for (int i = i0; i <= i1; i++)
+                m_cell_start[j * m_grid_nx + i + 1]++;
+    }
+    for (int c = 0; c < m_grid_nx * m_grid_ny; c++)
+        m_cell_start[c + 1] += m_cell_start[c];
+
+    m_cell_faces.resize(m_cell_start.back());
+    std::vector<int> cell_pos(m_cell_start.begin(), m_cell_start.end() - 1);
+    for (int f = 0; f < num_faces; f++) {
+        int i0, i1, j0, j1;
+        cell_range(f, i0, i1, j0, j1);
+        for (int j = j0; j <= j1; j++)
+            for (int i = i0; i <= i1; i++)
+                m_cell_faces[cell_pos[j * m_grid_nx + i]++] = f;
+    }
+}
+
+bool RigidTerrain::MeshPatch::FindPointIndexed(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    ChVector3d p = ChWorldFrame::ToISO(loc);
+
+    // Grid cell containing the query location
+    int i = (int)std::floor((p.x() - m_grid_min.x()) * m_grid_inv_size);
+    int j = (int)std::floor((p.y() - m_grid_min.y()) * m_grid_inv_size);
+    if (i < 0 || i >= m_grid_nx || j < 0 || j >= m_grid_ny)
+        return false;
+
+    // Find the highest face point below the query location
+    const double tol = 1e-10;
+    bool hit = false;
+    height = std::numeric_limits<double>::lowest();
+    int c = j * m_grid_nx + i;
+    for (int k = m_cell_start[c]; k < m_cell_start[c + 1]; k++) {
+        const auto& face = m_faces[m_cell_faces[k]];
+
+        // Barycentric coordinates of the projected location
+        ChVector2d d(p.x() - face.v0.x(), p.y() - face.v0.y());
+        double u = (d.x() * face.e2.y() - d.y() * face.e2.x()) * face.inv_det;
+        double v = (face.e1.x() * d.y() - face.e1.y() * d.x()) * face.inv_det;
+        if (u < -tol || v < -tol || u + v > 1 + tol)
+            continue;
+
+        double h = face.h0 + u * face.dh1 + v * face.dh2;
+        if (h <= p.z() && h > height) {
+            hit = true;
+            height = h;
+            normal = face.normal;
+        }
+    }
+
+    if (hit)
+        normal = ChWorldFrame::FromISO(normal);
+
+    return hit;
+}
+
 // -----------------------------------------------------------------------------
 // Export all patch meshes
 // -----------------------------------------------------------------------------
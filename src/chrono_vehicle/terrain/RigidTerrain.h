@@ -76,6 +76,16 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         Patch();
 
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const = 0;
+
+        /// Find the points on this patch below the specified locations.
+        /// The output height, normal, and friction at a given location are overwritten only if the patch point is
+        /// higher than the current height value. Locations whose vertical ray misses the patch bounding sphere are
+        /// skipped.
+        virtual void FindPoints(const std::vector<ChVector3d>& locs,
+                                std::vector<double>& heights,
+                                std::vector<ChVector3d>& normals,
+                                std::vector<float>& frictions) const;
+
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) {}
         virtual void ExportMeshWavefront(const std::string& out_dir) {}
 
@@ -184,6 +194,14 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// default, this option is disabled.  This function must be called before Initialize.
     void UseLocationDependentFriction(bool val) { m_use_friction_functor = val; }
 
+    /// Enable use of a height-field index for terrain queries on mesh patches (default: true).
+    /// If enabled, a uniform 2D grid of the mesh faces (projected onto the horizontal plane) is built for each mesh
+    /// patch at initialization. Terrain height, normal, and friction queries are then answered by testing only the
+    /// faces in the grid cell containing the query location, instead of ray casting into the collision system. The
+    /// result is identical (to round-off) with the ray casting result. Note that the index assumes that mesh patches
+    /// are not moved after initialization. This function must be called before Initialize.
+    void UseMeshIndex(bool val) { m_use_mesh_index = val; }
+
     /// Get the terrain height below the specified location.
     /// This function should return the height of the closest point *below* the specified location (in the direction of
     /// the current world vertical). If a user-provided functor object of type ChTerrain::HeightFunctor is provided,
@@ -217,6 +235,20 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
                                ChVector3d& normal,
                                float& friction) const override;
 
+    /// Get the terrain heights below the specified locations.
+    /// See the batch version of GetProperties.
+    virtual void GetHeights(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const override;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// The patches are processed one at a time, over all query locations, and ray casting into a patch is skipped for
+    /// locations that are outside its bounding sphere. Locations without a terrain point are assigned height=0,
+    /// normal=world vertical, and friction=0.8. As for the single-location query, user-provided functors take
+    /// precedence over the terrain geometry.
+    virtual void GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& frictions) const override;
+
     /// Export all patch meshes as macros in PovRay include files.
     void ExportMeshPovray(const std::string& out_dir, bool smoothed = false);
 
@@ -245,6 +277,19 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
     };
 
+    /// Mesh face, as stored in the height-field index of a mesh patch.
+    /// All quantities are expressed in the ISO world frame (Z up).
+    struct IndexedFace {
+        ChVector2d v0;      ///< first vertex (horizontal projection)
+        ChVector2d e1;      ///< first edge (horizontal projection)
+        ChVector2d e2;      ///< second edge (horizontal projection)
+        double inv_det;     ///< inverse determinant of the projected edges
+        double h0;          ///< height of first vertex
+        double dh1;         ///< height change along first edge
+        double dh2;         ///< height change along second edge
+        ChVector3d normal;  ///< face normal (pointing up)
+    };
+
     /// Patch represented as a mesh.
     struct CH_VEHICLE_API MeshPatch : public Patch {
         std::shared_ptr<ChTriangleMeshConnected> m_trimesh;  ///< associated mesh (contact and visualization)
@@ -254,12 +299,27 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
         virtual void ExportMeshWavefront(const std::string& out_dir) override;
+
+        /// Build the height-field index (uniform grid over the horizontal projection of the mesh faces).
+        void BuildIndex();
+
+        /// Find the point below the specified location using the height-field index.
+        bool FindPointIndexed(const ChVector3d& loc, double& height, ChVector3d& normal) const;
+
+        std::vector<IndexedFace> m_faces;  ///< non-vertical mesh faces
+        ChVector2d m_grid_min;             ///< grid lower corner (ISO horizontal coordinates)
+        double m_grid_inv_size;            ///< inverse of grid cell size
+        int m_grid_nx;                     ///< number of grid cells in X direction
+        int m_grid_ny;                     ///< number of grid cells in Y direction
+        std::vector<int> m_cell_start;     ///< start of the face list of each cell (size nx*ny+1)
+        std::vector<int> m_cell_faces;     ///< face indices, grouped by grid cell
     };
 
     ChSystem* m_system;
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
     bool m_use_friction_functor;
+    bool m_use_mesh_index;
     std::shared_ptr<ChContactContainer::AddContactCallback> m_contact_callback;
 
     void AddPatch(std::shared_ptr<Patch> patch,
@@ -17,8 +17,10 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
+#include <cstring>
 #include <queue>
 #include <unordered_set>
 #include <limits>
@@ -32,6 +34,7 @@
 #include "chrono/fea/ChContactSurfaceMesh.h"
 #include "chrono/assets/ChTexture.h"
 #include "chrono/assets/ChVisualShapeBox.h"
+#include "chrono/serialization/ChStateCheckpoint.h"
 #include "chrono/utils/ChConvexHull.h"
 #include "chrono/utils/ChUtils.h"
 
@@ -83,6 +86,21 @@ float SCMTerrain::GetCoefficientFriction(const ChVector3d& loc) const {
     return m_friction_fun ? (*m_friction_fun)(loc) : 0.8f;
 }
 
+// Get all terrain characteristics at the points below the specified locations.
+void SCMTerrain::GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& frictions) const {
+    m_loader->GetProperties(locs, heights, normals);
+    if (m_friction_fun) {
+        frictions.resize(locs.size());
+        for (size_t i = 0; i < locs.size(); i++)
+            frictions[i] = (*m_friction_fun)(locs[i]);
+    } else {
+        frictions.assign(locs.size(), 0.8f);
+    }
+}
+
 // Get SCM information at the node closest to the specified location.
 SCMTerrain::NodeInfo SCMTerrain::GetNodeInfo(const ChVector3d& loc) const {
     return m_loader->GetNodeInfo(loc);
@@ -249,6 +267,25 @@ void SCMTerrain::SetModifiedNodes(const std::vector<NodeLevel>& nodes) {
     m_loader->SetModifiedNodes(nodes);
 }
 
+void SCMTerrain::AddToCheckpoint(ChStateCheckpoint& checkpoint, const std::string& name) const {
+    m_loader->AddToCheckpoint(checkpoint, name);
+}
+
+bool SCMTerrain::RestoreFromCheckpoint(const ChStateCheckpoint& checkpoint, const std::string& name) {
+    return m_loader->RestoreFromCheckpoint(checkpoint, name);
+}
+
+// Set the size of the tiles storing the grid node records.
+void SCMTerrain::SetGridTileSize(int size) {
+    m_loader->m_grid.SetTileSize(size);
+}
+
+// Enable paging of grid tiles far from all moving patches.
+void SCMTerrain::EnableGridPaging(double distance, const std::string& swap_file) {
+    m_loader->m_paging_distance = std::max(distance, 0.0);
+    m_loader->m_grid.SetSwapFile(swap_file);
+}
+
 bool SCMTerrain::GetContactForceBody(std::shared_ptr<ChBody> body, ChVector3d& force, ChVector3d& torque) const {
     auto itr = m_loader->m_body_forces.find(body.get());
     if (itr == m_loader->m_body_forces.end()) {
@@ -293,6 +330,16 @@ int SCMTerrain::GetNumErosionNodes() const {
     return m_loader->m_num_erosion_nodes;
 }
 
+// Return the number of allocated grid tiles.
+int SCMTerrain::GetNumGridTiles() const {
+    return m_loader->m_grid.GetNumTiles();
+}
+
+// Return the number of grid tiles currently paged in.
+int SCMTerrain::GetNumResidentGridTiles() const {
+    return m_loader->m_grid.GetNumResidentTiles();
+}
+
 // Timer information
 double SCMTerrain::GetTimerMovingPatches() const {
     return 1e3 * m_loader->m_timer_moving_patches();
@@ -339,6 +386,8 @@ void SCMTerrain::PrintStepStatistics(std::ostream& os) const {
     os << "   Number ray hits:         " << m_loader->m_num_ray_hits << std::endl;
     os << "   Number contact patches:  " << m_loader->m_num_contact_patches << std::endl;
     os << "   Number erosion nodes:    " << m_loader->m_num_erosion_nodes << std::endl;
+    os << "   Number grid tiles:       " << m_loader->m_grid.GetNumTiles() << " (resident: "
+       << m_loader->m_grid.GetNumResidentTiles() << ")" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -399,6 +448,8 @@ SCMLoader::SCMLoader(ChSystem* system, bool visualization_mesh) : m_soil_fun(nul
 
     m_moving_patch = false;
 
+    m_paging_distance = -1;
+
     m_cosim_mode = false;
 }
 
@@ -720,16 +771,16 @@ SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector3d& loc) const {
     int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
     ChVector2i ij(i, j);
 
-    // First query the hash-map
-    auto p = m_grid_map.find(ij);
-    if (p != m_grid_map.end()) {
-        ni.sinkage = p->second.sinkage;
-        ni.sinkage_plastic = p->second.sinkage_plastic;
-        ni.sinkage_elastic = p->second.sinkage_elastic;
-        ni.sigma = p->second.sigma;
-        ni.sigma_yield = p->second.sigma_yield;
-        ni.kshear = p->second.kshear;
-        ni.tau = p->second.tau;
+    // First query the grid of modified nodes
+    NodeRecord nr;
+    if (m_grid.Get(ij, nr)) {
+        ni.sinkage = nr.sinkage;
+        ni.sinkage_plastic = nr.sinkage_plastic;
+        ni.sinkage_elastic = nr.sinkage_elastic;
+        ni.sigma = nr.sigma;
+        ni.sigma_yield = nr.sigma_yield;
+        ni.kshear = nr.kshear;
+        ni.tau = nr.tau;
         return ni;
     }
 
@@ -813,10 +864,10 @@ ChVector3d SCMLoader::GetInitNormal(const ChVector2i& loc) const {
 
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMLoader::GetHeight(const ChVector2i& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the grid of modified nodes
+    NodeRecord nr;
+    if (m_grid.Get(loc, nr))
+        return nr.level;
 
     // Else return undeformed height
     return GetInitHeight(loc);
@@ -900,6 +951,26 @@ ChVector3d SCMLoader::GetNormal(const ChVector3d& loc) const {
     return ChWorldFrame::FromISO(nrm_abs);
 }
 
+// Get the terrain heights and normals at the points below the specified locations.
+void SCMLoader::GetProperties(const std::vector<ChVector3d>& locs,
+                              std::vector<double>& heights,
+                              std::vector<ChVector3d>& normals) const {
+    size_t n = locs.size();
+    heights.resize(n);
+    normals.resize(n);
+    for (size_t k = 0; k < n; k++) {
+        // Express location in the SCM frame and find the closest grid vertex (approximation)
+        ChVector3d loc_loc = m_plane.TransformPointParentToLocal(locs[k]);
+        ChVector2i ij(static_cast<int>(std::round(loc_loc.x() / m_delta)),
+                      static_cast<int>(std::round(loc_loc.y() / m_delta)));
+
+        // Height and normal (relative to SCM plane) at grid vertex, expressed in global frame
+        loc_loc.z() = GetHeight(ij);
+        heights[k] = ChWorldFrame::Height(m_plane.TransformPointLocalToParent(loc_loc));
+        normals[k] = ChWorldFrame::FromISO(m_plane.TransformDirectionLocalToParent(GetNormal(ij)));
+    }
+}
+
 // Synchronize information for a moving patch
 void SCMLoader::UpdateMovingPatch(MovingPatchInfo& p, const ChVector3d& Z) {
     ChVector2d p_min(+std::numeric_limits<double>::max());
@@ -1031,10 +1102,6 @@ static const std::vector<ChVector2i> neighbors4{
     ChVector2i(0, 1)    // N
 };
 
-// Default implementation uses Map-Reduce for collecting ray intersection hits.
-// The alternative is to simultaenously load the global map of hits while ray casting (using a critical section).
-////#define RAY_CASTING_WITH_CRITICAL_SECTION
-
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMLoader::ComputeInternalForces() {
     // Initialize list of modified visualization mesh vertices (use any externally modified vertices)
@@ -1044,7 +1111,7 @@ void SCMLoader::ComputeInternalForces() {
     // Reset quantities at grid nodes modified over previous step
     // (required for bulldozing effects and for proper visualization coloring)
     for (const auto& ij : m_modified_nodes) {
-        auto& nr = m_grid_map.at(ij);
+        auto& nr = m_grid.At(ij);
         nr.sigma = 0;
         nr.sinkage_elastic = 0;
         nr.step_plastic_flow = 0;
@@ -1093,6 +1160,16 @@ void SCMLoader::ComputeInternalForces() {
         UpdateFixedPatch(m_patches[0]);
     }
 
+    // Page out grid tiles far from all patches and page in tiles overlapped by a patch
+    if (m_paging_distance >= 0) {
+        std::vector<std::pair<ChVector2i, ChVector2i>> ranges;
+        for (const auto& p : m_patches) {
+            if (!p.m_range.empty())
+                ranges.push_back(std::make_pair(p.m_range.front(), p.m_range.back()));
+        }
+        m_grid.UpdatePaging(ranges, static_cast<int>(std::ceil(m_paging_distance / m_delta)));
+    }
+
     m_timer_moving_patches.stop();
 
     // -------------------------
@@ -1101,87 +1178,48 @@ void SCMLoader::ComputeInternalForces() {
 
     // Information of vertices with ray-cast hits
     struct HitRecord {
+        ChVector2i ij;               // grid node
         ChContactable* contactable;  // pointer to hit object
         ChVector3d abs_point;        // hit point, expressed in global frame
         int patch_id;                // index of associated patch id
+        NodeRecord* nr;              // persistent record of the grid node
+        bool active;                 // true if the node is in contact (positive pressure)
+        ChVector3d point_abs;        // grid node location, expressed in global frame
+        ChVector3d force;            // contact force at grid node, expressed in global frame
+    };
+
+    // Ordering of hit records by grid node
+    auto hit_less = [](const HitRecord& a, const HitRecord& b) {
+        return a.ij.x() < b.ij.x() || (a.ij.x() == b.ij.x() && a.ij.y() < b.ij.y());
     };
 
-    // Hash-map for vertices with ray-cast hits
-    std::unordered_map<ChVector2i, HitRecord, CoordHash> hits;
+    // List of ray-cast hits, sorted by grid node (no duplicates)
+    std::vector<HitRecord> hits;
 
     m_num_ray_casts = 0;
     m_num_ray_hits = 0;
 
     m_timer_ray_casting.start();
 
-#ifdef RAY_CASTING_WITH_CRITICAL_SECTION
-
-    int nthreads = GetSystem()->GetNumThreadsChrono();
-
-    // Loop through all moving patches (user-defined or default one)
-    for (auto& p : m_patches) {
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            ChVector2i ij = p.m_range[k];
-
-            // Move from (i, j) to (x, y, z) representation in the world frame
-            double x = ij.x() * m_delta;
-            double y = ij.y() * m_delta;
-            double z;
-    #pragma omp critical(SCM_ray_casting)
-            z = GetHeight(ij);
-
-            ChVector3d vertex_abs = m_plane.TransformPointLocalToParent(ChVector3d(x, y, z));
-
-            // Create ray at current grid location
-            ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector3d to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector3d from = to - m_Z * m_test_offset_down;
-
-            // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
-
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
-
-            if (mrayhit_result.hit) {
-    #pragma omp critical(SCM_ray_casting)
-                {
-                    // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
-                    }
-
-                    // Add to our map of hits to process
-                    HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                    hits.insert(std::make_pair(ij, record));
-                    m_num_ray_hits++;
-                }
-            }
-        }
-        m_num_ray_casts += num_ray_casts;
-    }
-
-#else
-
-    // Map-reduce approach (to eliminate critical section)
-
+    // Rays are generated concurrently (ray generation does not modify the grid, so all grid queries are lock-free) and
+    // then cast into the collision system as a single batch for each patch.
     const int nthreads = GetSystem()->GetNumThreadsChrono();
-    std::vector<std::unordered_map<ChVector2i, HitRecord, CoordHash>> t_hits(nthreads);
+    auto coll_sys = GetSystem()->GetCollisionSystem();
+    std::vector<ChCollisionSystem::ChRay> rays;
+    std::vector<char> ray_active;
+    std::vector<ChVector2i> ray_nodes;
+    std::vector<ChCollisionSystem::ChRayhitResult> ray_results;
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
         m_timer_ray_testing.start();
 
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            int t_num = ChOMP::GetThreadNum();
+        // Create rays at all grid nodes in the patch range
+        int num_nodes = (int)p.m_range.size();
+        rays.resize(num_nodes);
+        ray_active.resize(num_nodes);
+    #pragma omp parallel for schedule(static) num_threads(nthreads)
+        for (int k = 0; k < num_nodes; k++) {
             ChVector2i ij = p.m_range[k];
 
             // Move from (i, j) to (x, y, z) representation in the world frame
@@ -1192,47 +1230,71 @@ void SCMLoader::ComputeInternalForces() {
             ChVector3d vertex_abs = m_plane.TransformPointLocalToParent(ChVector3d(x, y, z));
 
             // Create ray at current grid location
-            ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector3d to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector3d from = to - m_Z * m_test_offset_down;
+            rays[k].to = vertex_abs + m_Z * m_test_offset_up;
+            rays[k].from = rays[k].to - m_Z * m_test_offset_down;
 
             // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
-
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
+            ray_active[k] = !m_moving_patch || RayOBBtest(p, rays[k].from, m_Z);
+        }
 
-            if (mrayhit_result.hit) {
-                // Add to our map of hits to process
-                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
+        // Discard rejected rays
+        int num_rays = 0;
+        ray_nodes.clear();
+        for (int k = 0; k < num_nodes; k++) {
+            if (ray_active[k]) {
+                rays[num_rays++] = rays[k];
+                ray_nodes.push_back(p.m_range[k]);
             }
         }
+        rays.resize(num_rays);
 
         m_timer_ray_testing.stop();
 
-        m_num_ray_casts += num_ray_casts;
+        // Cast rays into collision system
+        coll_sys->RayHitBatch(rays, ray_results);
+        m_num_ray_casts += num_rays;
 
-        // Sequential insertion in global hits
-        for (int t_num = 0; t_num < nthreads; t_num++) {
-            for (auto& h : t_hits[t_num]) {
-                // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
-                    double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
-                }
-                ////hits.insert(h);
-            }
-
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
-            t_hits[t_num].clear();
+        // Add to the list of hits
+        for (int k = 0; k < num_rays; k++) {
+            const auto& result = ray_results[k];
+            if (!result.hit)
+                continue;
+            HitRecord record;
+            record.ij = ray_nodes[k];
+            record.contactable = result.hitModel->GetContactable();
+            record.abs_point = result.abs_hitPoint;
+            record.patch_id = -1;
+            record.nr = nullptr;
+            record.active = false;
+            hits.push_back(record);
         }
-        m_num_ray_hits = (int)hits.size();
     }
 
-#endif
+    // Sort hits by grid node. A node may be hit from overlapping patches, in which case only the first hit (in patch
+    // order) is retained.
+    std::stable_sort(hits.begin(), hits.end(), hit_less);
+    hits.erase(std::unique(hits.begin(), hits.end(),
+                           [](const HitRecord& a, const HitRecord& b) { return a.ij == b.ij; }),
+               hits.end());
+    m_num_ray_hits = (int)hits.size();
+
+    // Find the hit record for a given grid node (nullptr if the node was not hit)
+    auto find_hit = [&hits, &hit_less](const ChVector2i& ij) -> HitRecord* {
+        HitRecord key;
+        key.ij = ij;
+        auto itr = std::lower_bound(hits.begin(), hits.end(), key, hit_less);
+        return (itr != hits.end() && itr->ij == ij) ? &(*itr) : nullptr;
+    };
+
+    // Initialize the records of grid nodes hit for the first time and cache pointers to all node records.
+    // Pointers to grid node records remain valid when other records are added (tiles are not paged out here).
+    for (auto& h : hits) {
+        h.nr = m_grid.Find(h.ij);
+        if (!h.nr) {
+            double z = GetInitHeight(h.ij);
+            h.nr = &m_grid.Set(h.ij, NodeRecord(z, z, GetInitNormal(h.ij)));
+        }
+    }
 
     m_timer_ray_casting.stop();
 
@@ -1256,13 +1318,13 @@ void SCMLoader::ComputeInternalForces() {
     // Use a queue-based flood-filling algorithm based on the neighbors of each hit node.
     m_num_contact_patches = 0;
     for (auto& h : hits) {
-        if (h.second.patch_id != -1)
+        if (h.patch_id != -1)
             continue;
 
-        ChVector2i ij = h.first;
+        ChVector2i ij = h.ij;
 
         // Make a new contact patch and add this hit node to it
-        h.second.patch_id = m_num_contact_patches++;
+        h.patch_id = m_num_contact_patches++;
         ContactPatchRecord patch;
         patch.nodes.push_back(ij);
         patch.points.push_back(ChVector2d(m_delta * ij.x(), m_delta * ij.y()));
@@ -1272,24 +1334,24 @@ void SCMLoader::ComputeInternalForces() {
         todo.push(ij);
 
         while (!todo.empty()) {
-            auto crt = hits.find(todo.front());  // Current hit node is first element in queue
-            todo.pop();                          // Remove first element from queue
+            auto crt = find_hit(todo.front());  // Current hit node is first element in queue
+            todo.pop();                         // Remove first element from queue
 
-            ChVector2i crt_ij = crt->first;
-            int crt_patch = crt->second.patch_id;
+            ChVector2i crt_ij = crt->ij;
+            int crt_patch = crt->patch_id;
 
             // Loop through the neighbors of the current hit node
             for (int k = 0; k < 4; k++) {
                 ChVector2i nbr_ij = crt_ij + neighbors4[k];
                 // If neighbor is not a hit node, move on
-                auto nbr = hits.find(nbr_ij);
-                if (nbr == hits.end())
+                auto nbr = find_hit(nbr_ij);
+                if (!nbr)
                     continue;
                 // If neighbor already assigned to a contact patch, move on
-                if (nbr->second.patch_id != -1)
+                if (nbr->patch_id != -1)
                     continue;
                 // Assign neighbor to the same contact patch
-                nbr->second.patch_id = crt_patch;
+                nbr->patch_id = crt_patch;
                 // Add neighbor point to patch lists
                 patch.nodes.push_back(nbr_ij);
                 patch.points.push_back(ChVector2d(m_delta * nbr_ij.x(), m_delta * nbr_ij.y()));
@@ -1321,41 +1383,56 @@ void SCMLoader::ComputeInternalForces() {
 
     m_timer_contact_forces.start();
 
-    // Initialize local values for the soil parameters
-    double Bekker_Kphi = m_Bekker_Kphi;
-    double Bekker_Kc = m_Bekker_Kc;
-    double Bekker_n = m_Bekker_n;
-    double Mohr_cohesion = m_Mohr_cohesion;
-    double Mohr_mu = m_Mohr_mu;
-    double Janosi_shear = m_Janosi_shear;
-    double elastic_K = m_elastic_K;
-    double damping_R = m_damping_R;
-
-    // Process only hit nodes
-    for (auto& h : hits) {
-        ChVector2d ij = h.first;
+    // Soil parameters at each hit node.
+    // A user-provided soil parameter functor is not required to be thread-safe, so it is evaluated sequentially.
+    struct SoilParameters {
+        double Bekker_Kphi;
+        double Bekker_Kc;
+        double Bekker_n;
+        double Mohr_cohesion;
+        double Mohr_mu;
+        double Janosi_shear;
+        double elastic_K;
+        double damping_R;
+    };
+    SoilParameters soil = {m_Bekker_Kphi,   m_Bekker_Kc,    m_Bekker_n,  m_Mohr_cohesion,
+                           m_Mohr_mu,       m_Janosi_shear, m_elastic_K, m_damping_R};
+    std::vector<SoilParameters> hit_soil;
+    if (m_soil_fun) {
+        hit_soil.resize(hits.size(), soil);
+        for (size_t k = 0; k < hits.size(); k++) {
+            auto& sp = hit_soil[k];
+            auto hit_point_loc = m_plane.TransformPointParentToLocal(hits[k].abs_point);
+            double Mohr_friction;
+            m_soil_fun->Set(hit_point_loc, sp.Bekker_Kphi, sp.Bekker_Kc, sp.Bekker_n, sp.Mohr_cohesion, Mohr_friction,
+                            sp.Janosi_shear, sp.elastic_K, sp.damping_R);
+            sp.Mohr_mu = std::tan(Mohr_friction * CH_DEG_TO_RAD);
+        }
+    }
 
-        auto& nr = m_grid_map.at(ij);      // node record
-        const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
+    // Process hit nodes in parallel.
+    // Each hit corresponds to a distinct grid node, so node records can be updated concurrently. Contact forces are
+    // stored in the hit records and accumulated to the contactables afterwards.
+    const double step = GetSystem()->GetStep();
+    int num_hits = (int)hits.size();
 
-        ChContactable* contactable = h.second.contactable;
-        const ChVector3d& hit_point_abs = h.second.abs_point;
-        int patch_id = h.second.patch_id;
+    #pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int k = 0; k < num_hits; k++) {
+        auto& h = hits[k];
+        auto& nr = *h.nr;                  // node record
+        const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
+        const SoilParameters& sp = m_soil_fun ? hit_soil[k] : soil;
 
-        auto hit_point_loc = m_plane.TransformPointParentToLocal(hit_point_abs);
+        ChContactable* contactable = h.contactable;
+        int patch_id = h.patch_id;
 
-        if (m_soil_fun) {
-            double Mohr_friction;
-            m_soil_fun->Set(hit_point_loc, Bekker_Kphi, Bekker_Kc, Bekker_n, Mohr_cohesion, Mohr_friction, Janosi_shear,
-                            elastic_K, damping_R);
-            Mohr_mu = std::tan(Mohr_friction * CH_DEG_TO_RAD);
-        }
+        auto hit_point_loc = m_plane.TransformPointParentToLocal(h.abs_point);
 
         nr.hit_level = hit_point_loc.z();                              // along SCM z axis
         double p_hit_offset = ca * (nr.level_initial - nr.hit_level);  // along local normal direction
 
         // Elastic try (along local normal direction)
-        nr.sigma = elastic_K * (p_hit_offset - nr.sinkage_plastic);
+        nr.sigma = sp.elastic_K * (p_hit_offset - nr.sinkage_plastic);
 
         // Handle unilaterality
         if (nr.sigma < 0) {
@@ -1364,10 +1441,10 @@ void SCMLoader::ComputeInternalForces() {
         }
 
         // Mark current node as modified
-        m_modified_nodes.push_back(ij);
+        h.active = true;
 
         // Calculate velocity at touched grid node
-        ChVector3d point_local(ij.x() * m_delta, ij.y() * m_delta, nr.level);
+        ChVector3d point_local(h.ij.x() * m_delta, h.ij.y() * m_delta, nr.level);
         ChVector3d point_abs = m_plane.TransformPointLocalToParent(point_local);
         ChVector3d speed_abs = contactable->GetContactPointSpeed(point_abs);
 
@@ -1382,16 +1459,16 @@ void SCMLoader::ComputeInternalForces() {
         nr.level = nr.hit_level;
 
         // Accumulate shear for Janosi-Hanamoto (along local tangent direction)
-        nr.kshear += Vdot(speed_abs, -T) * GetSystem()->GetStep();
+        nr.kshear += Vdot(speed_abs, -T) * step;
 
         // Plastic correction (along local normal direction)
         if (nr.sigma > nr.sigma_yield) {
             // Bekker formula
-            nr.sigma = (contact_patches[patch_id].oob * Bekker_Kc + Bekker_Kphi) * pow(nr.sinkage, Bekker_n);
+            nr.sigma = (contact_patches[patch_id].oob * sp.Bekker_Kc + sp.Bekker_Kphi) * pow(nr.sinkage, sp.Bekker_n);
             nr.sigma_yield = nr.sigma;
             double old_sinkage_plastic = nr.sinkage_plastic;
-            nr.sinkage_plastic = nr.sinkage - nr.sigma / elastic_K;
-            nr.step_plastic_flow = (nr.sinkage_plastic - old_sinkage_plastic) / GetSystem()->GetStep();
+            nr.sinkage_plastic = nr.sinkage - nr.sigma / sp.elastic_K;
+            nr.step_plastic_flow = (nr.sinkage_plastic - old_sinkage_plastic) / step;
         }
 
         // Elastic sinkage (along local normal direction)
@@ -1399,14 +1476,14 @@ void SCMLoader::ComputeInternalForces() {
 
         // Add compressive speed-proportional damping (not clamped by pressure yield)
         ////if (Vn < 0) {
-        nr.sigma += -Vn * damping_R;
+        nr.sigma += -Vn * sp.damping_R;
         ////}
 
         // Mohr-Coulomb
-        double tau_max = Mohr_cohesion + nr.sigma * Mohr_mu;
+        double tau_max = sp.Mohr_cohesion + nr.sigma * sp.Mohr_mu;
 
         // Janosi-Hanamoto (along local tangent direction)
-        nr.tau = tau_max * (1.0 - exp(-(nr.kshear / Janosi_shear)));
+        nr.tau = tau_max * (1.0 - exp(-(nr.kshear / sp.Janosi_shear)));
 
         // Calculate normal and tangential forces (in local node directions).
         // If specified, combine properties for soil-contactable interaction and soil-soil interaction.
@@ -1426,10 +1503,29 @@ void SCMLoader::ComputeInternalForces() {
             Ft = T * m_area * nr.tau;
         }
 
+        h.point_abs = point_abs;
+        h.force = Fn + Ft;
+
+        // Update grid node height (in local SCM frame, along SCM z axis)
+        nr.level = nr.level_initial - nr.sinkage / ca;
+
+    }  // end loop on ray hits
+
+    // Accumulate contact forces (sequentially, in grid node order)
+    for (const auto& h : hits) {
+        if (!h.active)
+            continue;
+
+        // Mark current node as modified
+        m_modified_nodes.push_back(h.ij);
+
+        ChContactable* contactable = h.contactable;
+        const ChVector3d& point_abs = h.point_abs;
+        const ChVector3d& force = h.force;
+
         if (ChBody* body = dynamic_cast<ChBody*>(contactable)) {
             // Accumulate resultant force and torque (expressed in global frame) for this rigid body.
             // The resultant force is assumed to be applied at the body COM.
-            ChVector3d force = Fn + Ft;
             ChVector3d moment = Vcross(point_abs - body->GetPos(), force);
 
             auto itr = m_body_forces.find(body);
@@ -1444,8 +1540,6 @@ void SCMLoader::ComputeInternalForces() {
             }
         } else if (fea::ChContactTriangleXYZ* tri = dynamic_cast<fea::ChContactTriangleXYZ*>(contactable)) {
             // Accumulate forces (expressed in global frame) for the nodes of this contact triangle.
-            ChVector3d force = Fn + Ft;
-
             double s[3];
             tri->ComputeUVfromP(point_abs, s[1], s[2]);
             s[0] = 1 - s[1] - s[2];
@@ -1467,7 +1561,7 @@ void SCMLoader::ComputeInternalForces() {
                 // [](){} Trick: no deletion for this shared ptr
                 std::shared_ptr<ChLoadableUV> ssurf(surf, [](ChLoadableUV*) {});
                 auto loader = chrono_types::make_shared<ChLoaderForceOnSurface>(ssurf);
-                loader->SetForce(Fn + Ft);
+                loader->SetForce(force);
                 loader->SetApplication(0.5, 0.5);  //// TODO set UV, now just in middle
                 auto load = chrono_types::make_shared<ChLoad>(loader);
                 this->Add(load);
@@ -1476,11 +1570,7 @@ void SCMLoader::ComputeInternalForces() {
             // Accumulate contact forces for this surface.
             //// TODO
         }
-
-        // Update grid node height (in local SCM frame, along SCM z axis)
-        nr.level = nr.level_initial - nr.sinkage / ca;
-
-    }  // end loop on ray hits
+    }
 
     // Create loads for bodies and nodes to apply the accumulated terrain force/torque for each of them
     if (!m_cosim_mode) {
@@ -1526,18 +1616,19 @@ void SCMLoader::ComputeInternalForces() {
             // Calculate the displaced material from all touched nodes and identify boundary
             double tot_step_flow = 0;
             for (const auto& ij : p.nodes) {                 // for each node in contact patch
-                const auto& nr = m_grid_map.at(ij);          //   get node record
+                const auto& nr = m_grid.At(ij);              //   get node record
                 if (nr.sigma <= 0)                           //   if node not touched
                     continue;                                //     skip (not in effective patch)
                 tot_step_flow += nr.step_plastic_flow;       //   accumulate displaced material
                 for (int k = 0; k < 4; k++) {                //   check each node neighbor
                     ChVector2i nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
-                    ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
-                    ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
+                    ////if (!CheckMeshBounds(nbr_ij))        //     if neighbor out of bounds
+                    ////    continue;                        //       skip neighbor
+                    auto nbr_nr = m_grid.Find(nbr_ij);       //     neighbor node record
+                    if (!nbr_nr)                             //     if neighbor not yet recorded
+                        p_boundary.insert(nbr_ij);           //       set neighbor as boundary
+                    else if (nbr_nr->sigma <= 0)             //     if neighbor not touched
+                        p_boundary.insert(nbr_ij);           //       set neighbor as boundary
                 }
             }
             tot_step_flow *= GetSystem()->GetStep();
@@ -1548,13 +1639,13 @@ void SCMLoader::ComputeInternalForces() {
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
             for (const auto& ij : p_boundary) {                                  // for each node in bndry
                 m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
+                if (!m_grid.Find(ij)) {                                          //   if not yet recorded
                     double z = GetInitHeight(ij);                                //     undeformed height
                     const ChVector3d& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
+                    m_grid.Set(ij, NodeRecord(z, z, n));                         //     add new node record
                     m_modified_nodes.push_back(ij);                              //     mark as modified
                 }                                                                //
-                auto& nr = m_grid_map.at(ij);                                    //   node record
+                auto& nr = m_grid.At(ij);                                        //   node record
                 nr.erosion = true;                                               //   add to erosion domain
                 AddMaterialToNode(diff, nr);                                     //   add raise amount
             }
@@ -1578,16 +1669,16 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2i nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
                     ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
+                    if (!m_grid.Find(nbr_ij)) {                         //   if neighbor not yet recorded
                         double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
                         const ChVector3d& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
                         NodeRecord nr(z, z, n);                         //     create new record
                         nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
+                        m_grid.Set(nbr_ij, nr);                         //     add new node record
                         front.insert(nbr_ij);                           //     add neighbor to new front
                         m_modified_nodes.push_back(nbr_ij);             //     mark as modified
                     } else {                                            //   if neighbor previously recorded
-                        NodeRecord& nr = m_grid_map.at(nbr_ij);         //     get existing record
+                        NodeRecord& nr = m_grid.At(nbr_ij);             //     get existing record
                         if (!nr.erosion && nr.sigma <= 0) {             //     if neighbor not touched
                             nr.erosion = true;                          //       include in erosion domain
                             front.insert(nbr_ij);                       //       add neighbor to new front
@@ -1608,13 +1699,13 @@ void SCMLoader::ComputeInternalForces() {
 
         for (int iter = 0; iter < m_erosion_iterations; iter++) {
             for (const auto& ij : erosion_domain) {
-                auto& nr = m_grid_map.at(ij);
+                auto& nr = m_grid.At(ij);
                 for (int k = 0; k < 4; k++) {
                     ChVector2i nbr_ij = ij + neighbors4[k];
-                    auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
+                    auto rec = m_grid.Find(nbr_ij);
+                    if (!rec)
                         continue;
-                    auto& nbr_nr = rec->second;
+                    auto& nbr_nr = *rec;
 
                     // (3.1) Flow remaining material to neighbor
                     double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
@@ -1659,7 +1750,7 @@ void SCMLoader::ComputeInternalForces() {
         for (const auto& ij : m_modified_nodes) {
             if (!CheckMeshBounds(ij))                 // if node outside mesh
                 continue;                             //   do nothing
-            const auto& nr = m_grid_map.at(ij);       // grid node record
+            const auto& nr = m_grid.At(ij);           // grid node record
             int iv = GetMeshVertexIndex(ij);          // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
             modified_vertices.push_back(iv);          // cache in list of modified mesh vertices
@@ -1782,14 +1873,15 @@ void SCMLoader::UpdateMeshVertexNormal(const ChVector2i ij, int iv) {
 std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMTerrain::NodeLevel> nodes;
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
-        }
+        m_grid.ForEach(
+            [&nodes](const ChVector2i& ij, const NodeRecord& nr) { nodes.push_back(std::make_pair(ij, nr.level)); });
     } else {
+        NodeRecord nr;
         for (const auto& ij : m_modified_nodes) {
-            auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
+            bool found = m_grid.Get(ij, nr);
+            assert(found);
+            (void)found;
+            nodes.push_back(std::make_pair(ij, nr.level));
         }
     }
     return nodes;
@@ -1801,7 +1893,7 @@ std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) c
 void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes) {
     for (const auto& n : nodes) {
         // Modify existing entry in grid map or insert new one
-        m_grid_map[n.first] = SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first));
+        m_grid.Set(n.first, SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first)));
     }
 
     // Update visualization
@@ -1810,7 +1902,7 @@ void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes
             auto ij = n.first;                           // grid location
             if (!CheckMeshBounds(ij))                    // if outside mesh
                 continue;                                //   do nothing
-            const auto& nr = m_grid_map.at(ij);          // grid node record
+            const auto& nr = m_grid.At(ij);              // grid node record
             int iv = GetMeshVertexIndex(ij);             // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);     // update vertex coordinates and color
             if (!m_trimesh_shape->IsWireframe())         // if not in wireframe mode
@@ -1820,5 +1912,439 @@ void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes
     }
 }
 
+// Number of values used to store a node record (in the swap file or in a checkpoint).
+static const int node_record_size = 16;
+
+void SCMLoader::PackNodeRecord(const NodeRecord& nr, double* v) {
+    v[0] = nr.level_initial;
+    v[1] = nr.level;
+    v[2] = nr.hit_level;
+    v[3] = nr.normal.x();
+    v[4] = nr.normal.y();
+    v[5] = nr.normal.z();
+    v[6] = nr.sinkage;
+    v[7] = nr.sinkage_plastic;
+    v[8] = nr.sinkage_elastic;
+    v[9] = nr.sigma;
+    v[10] = nr.sigma_yield;
+    v[11] = nr.kshear;
+    v[12] = nr.tau;
+    v[13] = nr.erosion ? 1 : 0;
+    v[14] = nr.massremainder;
+    v[15] = nr.step_plastic_flow;
+}
+
+void SCMLoader::UnpackNodeRecord(const double* v, NodeRecord& nr) {
+    nr.level_initial = v[0];
+    nr.level = v[1];
+    nr.hit_level = v[2];
+    nr.normal = ChVector3d(v[3], v[4], v[5]);
+    nr.sinkage = v[6];
+    nr.sinkage_plastic = v[7];
+    nr.sinkage_elastic = v[8];
+    nr.sigma = v[9];
+    nr.sigma_yield = v[10];
+    nr.kshear = v[11];
+    nr.tau = v[12];
+    nr.erosion = v[13] != 0;
+    nr.massremainder = v[14];
+    nr.step_plastic_flow = v[15];
+}
+
+// Save all grid node records in a checkpoint data block, as (i, j) grid coordinates followed by the packed record.
+void SCMLoader::AddToCheckpoint(ChStateCheckpoint& checkpoint, const std::string& name) const {
+    const size_t record_size = 2 * sizeof(int32_t) + node_record_size * sizeof(double);
+    std::vector<char> data;
+    m_grid.ForEach([&data, record_size](const ChVector2i& ij, const NodeRecord& nr) {
+        int32_t coords[2] = {ij.x(), ij.y()};
+        double v[node_record_size];
+        PackNodeRecord(nr, v);
+        size_t pos = data.size();
+        data.resize(pos + record_size);
+        std::memcpy(&data[pos], coords, sizeof(coords));
+        std::memcpy(&data[pos + sizeof(coords)], v, sizeof(v));
+    });
+    checkpoint.AddBlock(name, std::move(data));
+}
+
+// Replace all grid node records with those saved in a checkpoint data block.
+bool SCMLoader::RestoreFromCheckpoint(const ChStateCheckpoint& checkpoint, const std::string& name) {
+    const size_t record_size = 2 * sizeof(int32_t) + node_record_size * sizeof(double);
+    size_t size;
+    auto data = checkpoint.GetBlock(name, size);
+    if (!checkpoint.HasBlock(name) || size % record_size != 0)
+        return false;
+
+    // Nodes currently modified (their visualization mesh vertices must be reset if not in the checkpoint)
+    std::vector<ChVector2i> old_nodes;
+    m_grid.ForEach([&old_nodes](const ChVector2i& ij, const NodeRecord&) { old_nodes.push_back(ij); });
+
+    m_grid.Clear();
+    m_modified_nodes.clear();
+
+    std::vector<ChVector2i> new_nodes(size / record_size);
+    for (size_t k = 0; k < new_nodes.size(); k++) {
+        int32_t coords[2];
+        double v[node_record_size];
+        std::memcpy(coords, data + k * record_size, sizeof(coords));
+        std::memcpy(v, data + k * record_size + sizeof(coords), sizeof(v));
+        NodeRecord nr;
+        UnpackNodeRecord(v, nr);
+        new_nodes[k] = ChVector2i(coords[0], coords[1]);
+        m_grid.Set(new_nodes[k], nr);
+    }
+
+    // Update visualization
+    if (m_trimesh_shape) {
+        auto update_vertex = [this](const ChVector2i& ij, const NodeRecord& nr) {
+            if (!CheckMeshBounds(ij))
+                return;
+            int iv = GetMeshVertexIndex(ij);
+            UpdateMeshVertexCoordinates(ij, iv, nr);
+            if (!m_trimesh_shape->IsWireframe())
+                UpdateMeshVertexNormal(ij, iv);
+            m_external_modified_vertices.push_back(iv);
+        };
+        for (const auto& ij : old_nodes) {
+            NodeRecord nr;
+            if (!m_grid.Get(ij, nr)) {
+                double level = GetInitHeight(ij);
+                update_vertex(ij, NodeRecord(level, level, GetInitNormal(ij)));
+            }
+        }
+        for (const auto& ij : new_nodes)
+            update_vertex(ij, m_grid.At(ij));
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Implementation of SCMLoader::NodeGrid
+// -----------------------------------------------------------------------------
+
+SCMLoader::NodeGrid::NodeGrid() : m_tile_size(64), m_swap_end(0) {}
+
+SCMLoader::NodeGrid::~NodeGrid() {
+    if (m_swap.is_open()) {
+        m_swap.close();
+        std::remove(m_swap_filename.c_str());
+    }
+}
+
+// Set the tile size, redistributing any existing node records.
+void SCMLoader::NodeGrid::SetTileSize(int size) {
+    assert(size > 0);
+    if (size == m_tile_size)
+        return;
+
+    std::vector<std::pair<ChVector2i, NodeRecord>> records;
+    ForEach([&records](const ChVector2i& ij, const NodeRecord& nr) { records.push_back(std::make_pair(ij, nr)); });
+    Clear();
+
+    m_tile_size = size;
+    for (const auto& r : records)
+        Set(r.first, r.second);
+}
+
+// Set the swap file, after paging in all tiles currently swapped out.
+void SCMLoader::NodeGrid::SetSwapFile(const std::string& filename) {
+    if (filename == m_swap_filename)
+        return;
+
+    for (auto& t : m_tiles) {
+        if (!t.second.resident)
+            PageIn(t.second);
+        t.second.swap_offset = -1;
+        t.second.swap_capacity = 0;
+    }
+
+    if (m_swap.is_open()) {
+        m_swap.close();
+        std::remove(m_swap_filename.c_str());
+    }
+
+    m_swap_filename = filename;
+    m_swap_end = 0;
+    m_swap_free.clear();
+    if (m_swap_filename.empty())
+        return;
+
+    m_swap.open(m_swap_filename, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_swap.is_open()) {
+        std::cerr << "\nError: cannot open SCM swap file " << m_swap_filename << std::endl;
+        throw std::runtime_error("Cannot open SCM swap file " + m_swap_filename);
+    }
+}
+
+void SCMLoader::NodeGrid::Clear() {
+    m_tiles.clear();
+    m_resident.clear();
+    m_swap_end = 0;
+    m_swap_free.clear();
+}
+
+// Tile coordinates of the specified grid node (rounded towards negative infinity).
+ChVector2i SCMLoader::NodeGrid::TileIndex(const ChVector2i& ij) const {
+    int i = ij.x() >= 0 ? ij.x() / m_tile_size : -((-ij.x() - 1) / m_tile_size) - 1;
+    int j = ij.y() >= 0 ? ij.y() / m_tile_size : -((-ij.y() - 1) / m_tile_size) - 1;
+    return ChVector2i(i, j);
+}
+
+// Index of the specified grid node in the dense array of the given tile.
+int SCMLoader::NodeGrid::NodeIndex(const ChVector2i& ij, const ChVector2i& tile) const {
+    return (ij.x() - tile.x() * m_tile_size) + m_tile_size * (ij.y() - tile.y() * m_tile_size);
+}
+
+// Coordinates of the grid node with given index in the dense array of the given tile.
+ChVector2i SCMLoader::NodeGrid::NodeCoords(int k, const ChVector2i& tile) const {
+    return ChVector2i(tile.x() * m_tile_size + k % m_tile_size, tile.y() * m_tile_size + k / m_tile_size);
+}
+
+// Return the specified tile, paged in. If the tile does not exist, create it.
+SCMLoader::NodeGrid::Tile& SCMLoader::NodeGrid::GetTile(const ChVector2i& tile) {
+    auto itr = m_tiles.find(tile);
+    if (itr == m_tiles.end()) {
+        Tile t;
+        t.index = tile;
+        t.resident = true;
+        t.data.resize(m_tile_size * m_tile_size);
+        t.used.assign(m_tile_size * m_tile_size, 0);
+        t.swap_offset = -1;
+        t.swap_capacity = 0;
+        itr = m_tiles.insert(std::make_pair(tile, std::move(t))).first;
+        m_resident.push_back(&itr->second);
+    } else if (!itr->second.resident) {
+        PageIn(itr->second);
+    }
+    return itr->second;
+}
+
+SCMLoader::NodeRecord* SCMLoader::NodeGrid::Find(const ChVector2i& ij) {
+    auto tile = TileIndex(ij);
+    auto itr = m_tiles.find(tile);
+    if (itr == m_tiles.end())
+        return nullptr;
+
+    auto& t = itr->second;
+    if (!t.resident)
+        PageIn(t);
+
+    int k = NodeIndex(ij, tile);
+    return t.used[k] ? &t.data[k] : nullptr;
+}
+
+SCMLoader::NodeRecord& SCMLoader::NodeGrid::At(const ChVector2i& ij) {
+    auto nr = Find(ij);
+    assert(nr);
+    return *nr;
+}
+
+SCMLoader::NodeRecord& SCMLoader::NodeGrid::Set(const ChVector2i& ij, const NodeRecord& nr) {
+    auto tile = TileIndex(ij);
+    auto& t = GetTile(tile);
+    int k = NodeIndex(ij, tile);
+    t.data[k] = nr;
+    t.used[k] = 1;
+    return t.data[k];
+}
+
+bool SCMLoader::NodeGrid::Get(const ChVector2i& ij, NodeRecord& nr) const {
+    auto tile = TileIndex(ij);
+    auto itr = m_tiles.find(tile);
+    if (itr == m_tiles.end())
+        return false;
+
+    const auto& t = itr->second;
+    int k = NodeIndex(ij, tile);
+
+    if (t.resident) {
+        if (!t.used[k])
+            return false;
+        nr = t.data[k];
+        return true;
+    }
+
+    if (t.swap_offset >= 0)
+        return ReadPagedRecord(t, k, nr);
+
+    // Search the (sorted) records of the tile paged out in memory
+    auto rec = std::lower_bound(t.compact.begin(), t.compact.end(), k,
+                                [](const std::pair<int, NodeRecord>& r, int index) { return r.first < index; });
+    if (rec == t.compact.end() || rec->first != k)
+        return false;
+    nr = rec->second;
+    return true;
+}
+
+// Load the records of a paged-out tile, sorted by node index.
+void SCMLoader::NodeGrid::ReadPaged(const Tile& t, CompactRecords& records) const {
+    assert(!t.resident);
+
+    if (t.swap_offset < 0) {
+        records = t.compact;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_swap_mutex);
+    m_swap.seekg(t.swap_offset);
+
+    int count;
+    m_swap.read(reinterpret_cast<char*>(&count), sizeof(int));
+    records.resize(count);
+    double v[node_record_size];
+    for (auto& r : records) {
+        m_swap.read(reinterpret_cast<char*>(&r.first), sizeof(int));
+        m_swap.read(reinterpret_cast<char*>(v), sizeof(v));
+        UnpackNodeRecord(v, r.second);
+    }
+}
+
+// Load the record of the node with given index from the swap slot of a paged-out tile, with a binary search over the
+// records (sorted by node index). Return false if no record is present.
+bool SCMLoader::NodeGrid::ReadPagedRecord(const Tile& t, int k, NodeRecord& nr) const {
+    assert(!t.resident && t.swap_offset >= 0);
+    const std::streamoff record_size = sizeof(int) + node_record_size * sizeof(double);
+    const std::streamoff records_offset = t.swap_offset + sizeof(int);
+
+    std::lock_guard<std::mutex> lock(m_swap_mutex);
+    m_swap.seekg(t.swap_offset);
+
+    int count;
+    m_swap.read(reinterpret_cast<char*>(&count), sizeof(int));
+    int index = -1;
+    int lo = 0;
+    int hi = count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        m_swap.seekg(records_offset + mid * record_size);
+        m_swap.read(reinterpret_cast<char*>(&index), sizeof(int));
+        if (index < k)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == count)
+        return false;
+
+    m_swap.seekg(records_offset + lo * record_size);
+    m_swap.read(reinterpret_cast<char*>(&index), sizeof(int));
+    if (index != k)
+        return false;
+
+    double v[node_record_size];
+    m_swap.read(reinterpret_cast<char*>(v), sizeof(v));
+    UnpackNodeRecord(v, nr);
+    return true;
+}
+
+// Restore the dense node records of a paged-out tile.
+void SCMLoader::NodeGrid::PageIn(Tile& t) {
+    assert(!t.resident);
+
+    CompactRecords records;
+    ReadPaged(t, records);
+
+    t.data.resize(m_tile_size * m_tile_size);
+    t.used.assign(m_tile_size * m_tile_size, 0);
+    for (const auto& r : records) {
+        t.data[r.first] = r.second;
+        t.used[r.first] = 1;
+    }
+
+    t.compact.clear();
+    t.compact.shrink_to_fit();
+    t.resident = true;
+    m_resident.push_back(&t);
+}
+
+// Release the dense node records of a resident tile, keeping only the records of used nodes (in memory or in the swap
+// file). The resident list is updated by the caller.
+void SCMLoader::NodeGrid::PageOut(Tile& t) {
+    assert(t.resident);
+
+    CompactRecords records;
+    for (int k = 0; k < (int)t.used.size(); k++) {
+        if (t.used[k])
+            records.push_back(std::make_pair(k, t.data[k]));
+    }
+
+    if (m_swap.is_open()) {
+        // Reuse the tile slot in the swap file if large enough. Otherwise, release it and take the smallest released
+        // slot large enough or, if there is none, append a new slot.
+        int count = (int)records.size();
+        if (t.swap_offset < 0 || t.swap_capacity < count) {
+            if (t.swap_offset >= 0)
+                m_swap_free.insert(std::make_pair(t.swap_capacity, t.swap_offset));
+            auto slot = m_swap_free.lower_bound(count);
+            if (slot != m_swap_free.end()) {
+                t.swap_capacity = slot->first;
+                t.swap_offset = slot->second;
+                m_swap_free.erase(slot);
+            } else {
+                t.swap_offset = m_swap_end;
+                t.swap_capacity = count;
+                m_swap_end += sizeof(int) + count * (sizeof(int) + node_record_size * sizeof(double));
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_swap_mutex);
+        m_swap.seekp(t.swap_offset);
+        m_swap.write(reinterpret_cast<const char*>(&count), sizeof(int));
+        double v[node_record_size];
+        for (const auto& r : records) {
+            PackNodeRecord(r.second, v);
+            m_swap.write(reinterpret_cast<const char*>(&r.first), sizeof(int));
+            m_swap.write(reinterpret_cast<const char*>(v), sizeof(v));
+        }
+        m_swap.flush();
+    } else {
+        t.compact = std::move(records);
+    }
+
+    t.data.clear();
+    t.data.shrink_to_fit();
+    t.used.clear();
+    t.used.shrink_to_fit();
+    t.resident = false;
+}
+
+void SCMLoader::NodeGrid::UpdatePaging(const std::vector<std::pair<ChVector2i, ChVector2i>>& ranges, int distance) {
+    // Page out resident tiles with no node within the given distance from any of the node ranges
+    size_t num_resident = 0;
+    for (auto t : m_resident) {
+        int x_min = t->index.x() * m_tile_size;
+        int y_min = t->index.y() * m_tile_size;
+        int x_max = x_min + m_tile_size - 1;
+        int y_max = y_min + m_tile_size - 1;
+        bool close = false;
+        for (const auto& r : ranges) {
+            if (x_max >= r.first.x() - distance && x_min <= r.second.x() + distance &&
+                y_max >= r.first.y() - distance && y_min <= r.second.y() + distance) {
+                close = true;
+                break;
+            }
+        }
+        if (close)
+            m_resident[num_resident++] = t;
+        else
+            PageOut(*t);
+    }
+    m_resident.resize(num_resident);
+
+    // Page in existing tiles overlapping any of the node ranges
+    for (const auto& r : ranges) {
+        auto t_min = TileIndex(r.first);
+        auto t_max = TileIndex(r.second);
+        for (int i = t_min.x(); i <= t_max.x(); i++) {
+            for (int j = t_min.y(); j <= t_max.y(); j++) {
+                auto itr = m_tiles.find(ChVector2i(i, j));
+                if (itr != m_tiles.end() && !itr->second.resident)
+                    PageIn(itr->second);
+            }
+        }
+    }
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
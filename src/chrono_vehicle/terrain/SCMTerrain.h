@@ -21,8 +21,12 @@
 #define SCM_TERRAIN_H
 
 #include <string>
+#include <fstream>
+#include <map>
+#include <mutex>
 #include <ostream>
 #include <unordered_map>
+#include <vector>
 
 #include "chrono/assets/ChVisualShapeTriangleMesh.h"
 #include "chrono/physics/ChBody.h"
@@ -39,6 +43,9 @@
 #include "chrono_vehicle/ChWorldFrame.h"
 
 namespace chrono {
+
+class ChStateCheckpoint;
+
 namespace vehicle {
 
 class SCMLoader;
@@ -204,6 +211,15 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value of 0.8.
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override;
 
+    using ChTerrain::GetProperties;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// The grid node closest to each location is found only once and used for both the terrain height and normal.
+    virtual void GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& frictions) const override;
+
     /// Get SCM information at the node closest to the specified location.
     NodeInfo GetNodeInfo(const ChVector3d& loc) const;
 
@@ -279,6 +295,28 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// Modify the level of grid nodes from the given list.
     void SetModifiedNodes(const std::vector<NodeLevel>& nodes);
 
+    /// Add a data block with the complete state of the SCM grid (all soil properties of all modified nodes) to the
+    /// given checkpoint (see ChStateCheckpoint).
+    void AddToCheckpoint(ChStateCheckpoint& checkpoint, const std::string& name = "scm.grid") const;
+
+    /// Restore the state of the SCM grid from the given checkpoint, replacing all modified nodes.
+    /// Return false if the checkpoint does not have a valid data block with the given name.
+    bool RestoreFromCheckpoint(const ChStateCheckpoint& checkpoint, const std::string& name = "scm.grid");
+
+    /// Set the number of grid nodes along each side of the square tiles storing the SCM node records (default: 64).
+    /// Node records are allocated one tile at a time, as the terrain is first deformed within that tile.
+    void SetGridTileSize(int size);
+
+    /// Enable paging of the SCM grid storage (default: disabled).
+    /// At each step, grid tiles farther than the given distance from all moving patches are paged out and tiles
+    /// overlapped by a moving patch are paged back in. If a swap file is specified, paged-out tiles are written to that
+    /// file (which is overwritten and removed when the terrain is destroyed), so that memory use is bounded by the
+    /// footprint of the moving patches. Otherwise, paged-out tiles are kept in memory in compacted form (only the
+    /// records of modified nodes). Paging is only effective if moving patches are defined (see AddMovingPatch).
+    void EnableGridPaging(double distance,                   ///< [in] paging distance
+                          const std::string& swap_file = ""  ///< [in] swap file for paged-out tiles
+    );
+
     /// Return the cummulative contact force on the specified body  (due to interaction with the SCM terrain).
     /// The return value is true if the specified body experiences contact forces and false otherwise.
     /// If contact forces are applied to the body, they are reduced to the body center of mass.
@@ -296,6 +334,10 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     int GetNumContactPatches() const;
     /// Return the number of nodes in the erosion domain at last step (bulldosing effects).
     int GetNumErosionNodes() const;
+    /// Return the number of allocated grid tiles.
+    int GetNumGridTiles() const;
+    /// Return the number of grid tiles currently paged in.
+    int GetNumResidentGridTiles() const;
 
     /// Return time for updating moving patches at last step (ms).
     double GetTimerMovingPatches() const;
@@ -437,6 +479,85 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         std::size_t operator()(const ChVector2i& p) const { return p.x() * 31 + p.y(); }
     };
 
+    // Storage of grid node records, organized in square tiles of dense node arrays allocated on demand.
+    // Tiles can be paged out, either compacted in memory (only the records of modified nodes are kept) or spilled to a
+    // swap file. A paged-out tile is paged back in when one of its records is accessed for modification.
+    class NodeGrid {
+      public:
+        NodeGrid();
+        ~NodeGrid();
+
+        // Set the number of nodes along each side of a tile (default: 64).
+        void SetTileSize(int size);
+
+        // Set the swap file for paged-out tiles (if empty, paged-out tiles are kept compacted in memory).
+        void SetSwapFile(const std::string& filename);
+
+        // Discard all node records.
+        void Clear();
+
+        // Return the record of the specified node (nullptr if not present).
+        // If needed, the tile containing the node is paged in.
+        NodeRecord* Find(const ChVector2i& ij);
+
+        // Return the record of the specified node (assumed to be present).
+        NodeRecord& At(const ChVector2i& ij);
+
+        // Set the record of the specified node (added if not present).
+        NodeRecord& Set(const ChVector2i& ij, const NodeRecord& nr);
+
+        // Load the record of the specified node into 'nr'. Return false if no record is present.
+        // Paged-out tiles are queried in place, so this function can be called concurrently.
+        bool Get(const ChVector2i& ij, NodeRecord& nr) const;
+
+        // Invoke the given function for all node records, as f(const ChVector2i& ij, const NodeRecord& nr).
+        template <typename Function>
+        void ForEach(Function f) const;
+
+        // Page in all paged-out tiles overlapping the given node ranges ('ranges' contains pairs of minimum and maximum
+        // node coordinates) and page out all resident tiles farther than 'distance' nodes from all of these ranges.
+        void UpdatePaging(const std::vector<std::pair<ChVector2i, ChVector2i>>& ranges, int distance);
+
+        // Return the number of allocated tiles.
+        int GetNumTiles() const { return (int)m_tiles.size(); }
+
+        // Return the number of resident (paged-in) tiles.
+        int GetNumResidentTiles() const { return (int)m_resident.size(); }
+
+      private:
+        typedef std::vector<std::pair<int, NodeRecord>> CompactRecords;
+
+        struct Tile {
+            ChVector2i index;              // tile coordinates
+            bool resident;                 // true if the tile is paged in
+            std::vector<NodeRecord> data;  // dense node records (resident tile)
+            std::vector<char> used;        // flags for nodes with a record (resident tile)
+            CompactRecords compact;        // records of used nodes (tile paged out in memory)
+            std::streamoff swap_offset;    // start of the tile slot in the swap file (-1 if none)
+            int swap_capacity;             // number of records that fit in the swap slot
+        };
+
+        ChVector2i TileIndex(const ChVector2i& ij) const;
+        int NodeIndex(const ChVector2i& ij, const ChVector2i& tile) const;
+        ChVector2i NodeCoords(int k, const ChVector2i& tile) const;
+
+        Tile& GetTile(const ChVector2i& tile);
+        void PageIn(Tile& t);
+        void PageOut(Tile& t);
+        void ReadPaged(const Tile& t, CompactRecords& records) const;
+        bool ReadPagedRecord(const Tile& t, int k, NodeRecord& nr) const;
+
+        int m_tile_size;                                          // number of nodes along each tile side
+        std::unordered_map<ChVector2i, Tile, CoordHash> m_tiles;  // all allocated tiles
+        std::vector<Tile*> m_resident;                            // resident tiles
+
+        std::string m_swap_filename;                     // swap file name (empty if swapping disabled)
+        mutable std::fstream m_swap;                     // swap file stream
+        mutable std::mutex m_swap_mutex;                 // serialize accesses to the swap file stream
+        std::streamoff m_swap_end;                       // current end of swap file
+        std::multimap<int, std::streamoff> m_swap_free;  // released swap slots (capacity -> offset)
+    };
+
     // Create visualization mesh
     void CreateVisualizationMesh(double sizeX, double sizeY);
 
@@ -464,6 +585,11 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     // Get the terrain normal (expressed in World frame) at the point below the specified location.
     ChVector3d GetNormal(const ChVector3d& loc) const;
 
+    // Get the terrain heights and normals (expressed in World frame) at the points below the specified locations.
+    void GetProperties(const std::vector<ChVector3d>& locs,
+                       std::vector<double>& heights,
+                       std::vector<ChVector3d>& normals) const;
+
     // Get index of trimesh vertex corresponding to the specified grid node.
     int GetMeshVertexIndex(const ChVector2i& loc);
 
@@ -535,6 +661,14 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     // Modify the level of grid nodes from the given list.
     void SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes);
 
+    // Save/restore all grid node records in/from a checkpoint.
+    void AddToCheckpoint(ChStateCheckpoint& checkpoint, const std::string& name) const;
+    bool RestoreFromCheckpoint(const ChStateCheckpoint& checkpoint, const std::string& name);
+
+    // Pack/unpack a node record in/from an array of node_record_size values.
+    static void PackNodeRecord(const NodeRecord& nr, double* v);
+    static void UnpackNodeRecord(const double* v, NodeRecord& nr);
+
     PatchType m_type;      ///< type of SCM patch
     ChCoordsys<> m_plane;  ///< SCM frame (deformation occurs along the z axis of this frame)
     ChVector3d m_Z;        ///< SCM plane vertical direction (in absolute frame)
@@ -546,8 +680,9 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     ChMatrixDynamic<> m_heights;  ///< (base) grid heights (when initializing from height-field map)
     double m_base_height;         ///< default height for vertices outside the projection of input mesh
 
-    std::unordered_map<ChVector2i, NodeRecord, CoordHash> m_grid_map;  ///< modified grid nodes (persistent)
-    std::vector<ChVector2i> m_modified_nodes;                          ///< modified grid nodes (current)
+    NodeGrid m_grid;                           ///< modified grid nodes (persistent)
+    std::vector<ChVector2i> m_modified_nodes;  ///< modified grid nodes (current)
+    double m_paging_distance;                  ///< distance for paging out grid tiles (negative if disabled)
 
     std::vector<MovingPatchInfo> m_patches;  ///< set of active moving patches
     bool m_moving_patch;                     ///< user-specified moving patches?
@@ -610,6 +745,24 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     friend class SCMTerrain;
 };
 
+template <typename Function>
+void SCMLoader::NodeGrid::ForEach(Function f) const {
+    CompactRecords records;
+    for (const auto& t : m_tiles) {
+        const auto& tile = t.second;
+        if (tile.resident) {
+            for (int k = 0; k < (int)tile.used.size(); k++) {
+                if (tile.used[k])
+                    f(NodeCoords(k, tile.index), tile.data[k]);
+            }
+        } else {
+            ReadPaged(tile, records);
+            for (const auto& r : records)
+                f(NodeCoords(r.first, tile.index), r.second);
+        }
+    }
+}
+
 /// @} vehicle_terrain
 
 }  // end namespace vehicle
@@ -19,6 +19,8 @@
 //
 // =============================================================================
 
+#include "chrono/utils/ChTracer.h"
+
 #include "chrono_vehicle/ChSubsysDefs.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackedVehicle.h"
 
@@ -71,6 +73,8 @@ void ChTrackedVehicle::Initialize(const ChCoordsys<>& chassisPos, double chassis
 // reference frame).
 // -----------------------------------------------------------------------------
 void ChTrackedVehicle::Synchronize(double time, const DriverInputs& driver_inputs) {
+    CH_TRACE_ZONE("ChTrackedVehicle::Synchronize", "vehicle");
+
     // Let the driveline combine driver inputs if needed
     double braking_left = 0;
     double braking_right = 0;
@@ -112,6 +116,8 @@ void ChTrackedVehicle::Synchronize(double time,
                                    const DriverInputs& driver_inputs,
                                    const TerrainForces& shoe_forces_left,
                                    const TerrainForces& shoe_forces_right) {
+    CH_TRACE_ZONE("ChTrackedVehicle::Synchronize", "vehicle");
+
     // Let the driveline combine driver inputs if needed
     double braking_left = 0;
     double braking_right = 0;
@@ -153,6 +159,8 @@ void ChTrackedVehicle::Synchronize(double time,
 // Advance the state of this vehicle by the specified time step.
 // -----------------------------------------------------------------------------
 void ChTrackedVehicle::Advance(double step) {
+    CH_TRACE_ZONE("ChTrackedVehicle::Advance", "vehicle");
+
     // Advance state of the associated powertrain (if one is attached)
     if (m_powertrain_assembly) {
         m_powertrain_assembly->Advance(step);
@@ -20,6 +20,7 @@
 // =============================================================================
 
 #include <cmath>
+#include <vector>
 
 #include "chrono/physics/ChSystem.h"
 
@@ -271,26 +272,26 @@ bool ChTire::DiscTerrainCollision4pt(
     longitudinal.Normalize();
     ChVector3d lateral = Vcross(normal, longitudinal);
 
-    // Calculate four contact points in the contact patch
+    // Calculate four contact points in the contact patch (terrain heights obtained with a single batch query)
     ChVector3d ptQ1 = wheel_bottom_location + dx * longitudinal;
-    double hQ1 = terrain.GetHeight(ptQ1 + voffset);
+    ChVector3d ptQ2 = wheel_bottom_location - dx * longitudinal;
+    ChVector3d ptQ3 = wheel_bottom_location + dy * lateral;
+    ChVector3d ptQ4 = wheel_bottom_location - dy * lateral;
+
+    std::vector<double> hQ;
+    terrain.GetHeights({ptQ1 + voffset, ptQ2 + voffset, ptQ3 + voffset, ptQ4 + voffset}, hQ);
+
     double ptQ1_height = ChWorldFrame::Height(ptQ1);
-    ptQ1 = ptQ1 - (ptQ1_height - hQ1) * ChWorldFrame::Vertical();
+    ptQ1 = ptQ1 - (ptQ1_height - hQ[0]) * ChWorldFrame::Vertical();
 
-    ChVector3d ptQ2 = wheel_bottom_location - dx * longitudinal;
-    double hQ2 = terrain.GetHeight(ptQ2 + voffset);
     double ptQ2_height = ChWorldFrame::Height(ptQ2);
-    ptQ2 = ptQ2 - (ptQ2_height - hQ2) * ChWorldFrame::Vertical();
+    ptQ2 = ptQ2 - (ptQ2_height - hQ[1]) * ChWorldFrame::Vertical();
 
-    ChVector3d ptQ3 = wheel_bottom_location + dy * lateral;
-    double hQ3 = terrain.GetHeight(ptQ3 + voffset);
     double ptQ3_height = ChWorldFrame::Height(ptQ3);
-    ptQ3 = ptQ3 - (ptQ3_height - hQ3) * ChWorldFrame::Vertical();
+    ptQ3 = ptQ3 - (ptQ3_height - hQ[2]) * ChWorldFrame::Vertical();
 
-    ChVector3d ptQ4 = wheel_bottom_location - dy * lateral;
-    double hQ4 = terrain.GetHeight(ptQ4 + voffset);
     double ptQ4_height = ChWorldFrame::Height(ptQ4);
-    ptQ4 = ptQ4 - (ptQ4_height - hQ4) * ChWorldFrame::Vertical();
+    ptQ4 = ptQ4 - (ptQ4_height - hQ[3]) * ChWorldFrame::Vertical();
 
     // Calculate a smoothed road surface normal
     ChVector3d rQ2Q1 = ptQ1 - ptQ2;
@@ -354,14 +355,24 @@ bool ChTire::DiscTerrainCollisionEnvelope(
 
     const size_t n_div = 180;
     double x_step = 2.0 * disc_radius / n_div;
+
+    // Sample the terrain along the disc diameter in the longitudinal direction, with a single batch query
+    std::vector<ChVector3d> pTest(n_div - 1);
+    std::vector<ChVector3d> pQuery(n_div - 1);
+    for (size_t i = 1; i < n_div; i++) {
+        double x = -disc_radius + x_step * double(i);
+        pTest[i - 1] = disc_center + x * longitudinal;
+        pQuery[i - 1] = pTest[i - 1] + voffset;
+    }
+    std::vector<double> q;
+    terrain.GetHeights(pQuery, q);
+
     double A = 0;  // overlapping area of tire disc and road surface contour
     for (size_t i = 1; i < n_div; i++) {
         double x = -disc_radius + x_step * double(i);
-        ChVector3d pTest = disc_center + x * longitudinal;
-        double q = terrain.GetHeight(pTest + voffset);
-        double a = ChWorldFrame::Height(pTest) - sqrt(disc_radius * disc_radius - x * x);
-        if (q > a) {
-            A += q - a;
+        double a = ChWorldFrame::Height(pTest[i - 1]) - sqrt(disc_radius * disc_radius - x * x);
+        if (q[i - 1] > a) {
+            A += q[i - 1] - a;
         }
     }
     A *= x_step;
@@ -0,0 +1,127 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Benchmark test for the multithreaded assembly of FEA residuals.
+// A square plate of ANCF shell elements (fixed along one edge) deforms under
+// gravity. The same model is simulated with an increasing number of Chrono
+// threads; the time spent in the evaluation of internal forces is reported
+// separately, to measure the scaling of the (colored) element loops.
+//
+// =============================================================================
+
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+template <int N, int T>
+class ANCFshellScaling : public utils::ChBenchmarkTest {
+  public:
+    ANCFshellScaling();
+    virtual ~ANCFshellScaling() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(1e-4); }
+
+    ChSystemSMC* m_system;
+    std::shared_ptr<ChMesh> m_mesh;
+};
+
+template <int N, int T>
+ANCFshellScaling<N, T>::ANCFshellScaling() {
+    m_system = new ChSystemSMC();
+    m_system->SetGravitationalAcceleration(ChVector3d(0, 0, -9.8));
+    m_system->SetNumThreads(T, 1, 1);
+
+    auto solver = chrono_types::make_shared<ChSolverMINRES>();
+    solver->SetMaxIterations(100);
+    solver->SetTolerance(1e-10);
+    solver->EnableDiagonalPreconditioner(true);
+    m_system->SetSolver(solver);
+    m_system->SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    double length = 1;
+    double thickness = 0.01;
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, 2.1e7, 0.3);
+
+    m_mesh = chrono_types::make_shared<ChMesh>();
+    m_system->Add(m_mesh);
+
+    // Create a grid of (N+1) x (N+1) nodes, fixed along the edge x = 0
+    double dx = length / N;
+    ChVector3d dir(0, 0, 1);
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int i = 0; i <= N; i++) {
+        for (int j = 0; j <= N; j++) {
+            auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector3d(i * dx, j * dx, 0), dir);
+            node->SetFixed(i == 0);
+            m_mesh->AddNode(node);
+            nodes.push_back(node);
+        }
+    }
+
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            int n0 = i * (N + 1) + j;
+            auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+            element->SetNodes(nodes[n0], nodes[n0 + N + 1], nodes[n0 + N + 2], nodes[n0 + 1]);
+            element->SetDimensions(dx, dx);
+            element->AddLayer(thickness, 0, mat);
+            element->SetAlphaDamp(0.0);
+            m_mesh->AddElement(element);
+        }
+    }
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 10  // number of steps for hot start
+#define NUM_SIM_STEPS 20   // number of simulation steps for each benchmark
+
+// Define and register a test which also reports the internal force evaluation time and the number of element colors.
+#define CH_BM_SCALING(TEST_NAME, TEST)                                                     \
+    using TEST_NAME = chrono::utils::ChBenchmarkFixture<TEST, NUM_SKIP_STEPS>;             \
+    BENCHMARK_DEFINE_F(TEST_NAME, SimulateLoop)(benchmark::State & st) {                   \
+        while (st.KeepRunning()) {                                                         \
+            m_test->m_mesh->ResetTimers();                                                 \
+            m_test->Simulate(NUM_SIM_STEPS);                                               \
+        }                                                                                  \
+        Report(st);                                                                        \
+        st.counters["FEA_InternalForces"] = m_test->m_mesh->GetTimeInternalForces() * 1e3; \
+        st.counters["FEA_Colors"] = m_test->m_mesh->GetNumElementColors();                 \
+    }                                                                                      \
+    BENCHMARK_REGISTER_F(TEST_NAME, SimulateLoop)->Unit(benchmark::kMillisecond)->Repetitions(5);
+
+using ANCFshell64_1 = ANCFshellScaling<64, 1>;
+using ANCFshell64_2 = ANCFshellScaling<64, 2>;
+using ANCFshell64_4 = ANCFshellScaling<64, 4>;
+using ANCFshell64_8 = ANCFshellScaling<64, 8>;
+
+CH_BM_SCALING(ANCFshell64_1thread, ANCFshell64_1);
+CH_BM_SCALING(ANCFshell64_2threads, ANCFshell64_2);
+CH_BM_SCALING(ANCFshell64_4threads, ANCFshell64_4);
+CH_BM_SCALING(ANCFshell64_8threads, ANCFshell64_8);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
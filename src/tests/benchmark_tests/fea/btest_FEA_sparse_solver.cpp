@@ -14,7 +14,7 @@
 //
 // Benchmark test for sparse matrix setup (assembly of system matrix).
 // This provides a measure of the effect and performance of using the "sparsity
-// learner".
+// learner" and incremental matrix assembly.
 //
 // =============================================================================
 
@@ -156,6 +156,19 @@ class SystemFixture : public ::benchmark::Fixture {
     }                                                                                 \
     BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
 
+#define BM_SOLVER_QR_INCREMENTAL(TEST_NAME, N)                                        \
+    BENCHMARK_TEMPLATE_DEFINE_F(SystemFixture, TEST_NAME, N)(benchmark::State & st) { \
+        auto solver = chrono_types::make_shared<ChSolverSparseQR>();                  \
+        solver->UseIncrementalAssembly(true);                                         \
+        solver->SetVerbose(false);                                                    \
+        m_system->SetSolver(solver);                                                  \
+        while (st.KeepRunning()) {                                                    \
+            m_system->DoStaticLinear();                                               \
+        }                                                                             \
+        Report(st);                                                                   \
+    }                                                                                 \
+    BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
+
 #ifdef CHRONO_PARDISO_MKL
 BM_SOLVER_MKL(MKL_learner_500, 500, true)
 BM_SOLVER_MKL(MKL_no_learner_500, 500, false)
@@ -193,6 +206,12 @@ BM_SOLVER_QR(QR_no_learner_4000, 4000, false)
 BM_SOLVER_QR(QR_learner_8000, 8000, true)
 BM_SOLVER_QR(QR_no_learner_8000, 8000, false)
 
+BM_SOLVER_QR_INCREMENTAL(QR_incremental_500, 500)
+BM_SOLVER_QR_INCREMENTAL(QR_incremental_1000, 1000)
+BM_SOLVER_QR_INCREMENTAL(QR_incremental_2000, 2000)
+BM_SOLVER_QR_INCREMENTAL(QR_incremental_4000, 4000)
+BM_SOLVER_QR_INCREMENTAL(QR_incremental_8000, 8000)
+
 int main(int argc, char* argv[]) {
     ::benchmark::Initialize(&argc, argv);
     ::benchmark::RunSpecifiedBenchmarks();
@@ -259,6 +259,7 @@ int main(int argc, char* argv[]) {
     double chrono_setup = 0;
     double raytest = 0;
     double raycast = 0;
+    long long num_rays = 0;
 
     ChTimer timer;
     timer.start();
@@ -285,6 +286,7 @@ int main(int argc, char* argv[]) {
                 cout << "chrono setup (s):  " << chrono_setup << endl;
                 cout << "raytesting (s):    " << raytest / 1e3 << endl;
                 cout << "raycasting (s):    " << raycast / 1e3 << endl;
+                cout << "rays/second:       " << (raycast > 0 ? num_rays / (raycast / 1e3) : 0) << endl;
                 cout << "RTF:               " << rtf << endl;
                 cout << "\nSCM stats for last step:" << endl;
                 terrain.PrintStepStatistics(cout);
@@ -335,6 +337,7 @@ int main(int argc, char* argv[]) {
         chrono_setup += sys.GetTimerSetup();
         raytest += terrain.GetTimerRayTesting();
         raycast += terrain.GetTimerRayCasting();
+        num_rays += terrain.GetNumRayCasts();
 
         // Increment frame number
         step_number++;
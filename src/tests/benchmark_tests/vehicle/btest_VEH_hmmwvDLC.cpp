@@ -13,10 +13,15 @@
 // =============================================================================
 //
 // Benchmark test for HMMWV double lane change.
+// Also includes a throughput benchmark for an ensemble of such simulations (a
+// sweep over the target vehicle speed), run with the ensemble runner for
+// different numbers of worker threads. Reported throughput is in simulated
+// seconds per wall-clock second per core.
 //
 // =============================================================================
 
 #include "chrono/utils/ChBenchmark.h"
+#include "chrono/utils/ChEnsemble.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/driver/ChPathFollowerDriver.h"
@@ -38,7 +43,7 @@ using namespace chrono::vehicle::hmmwv;
 template <typename EnumClass, EnumClass TIRE_MODEL>
 class HmmwvDlcTest : public utils::ChBenchmarkTest {
   public:
-    HmmwvDlcTest();
+    HmmwvDlcTest(double speed = 12.0);
     ~HmmwvDlcTest();
 
     ChSystem* GetSystem() override { return m_hmmwv->GetSystem(); }
@@ -59,7 +64,7 @@ class HmmwvDlcTest : public utils::ChBenchmarkTest {
 };
 
 template <typename EnumClass, EnumClass TIRE_MODEL>
-HmmwvDlcTest<EnumClass, TIRE_MODEL>::HmmwvDlcTest() : m_step_veh(2e-3), m_step_tire(1e-3) {
+HmmwvDlcTest<EnumClass, TIRE_MODEL>::HmmwvDlcTest(double speed) : m_step_veh(2e-3), m_step_tire(1e-3) {
     EngineModelType engine_model = EngineModelType::SHAFTS;
     TransmissionModelType transmission_model = TransmissionModelType::AUTOMATIC_SHAFTS;
     DrivelineTypeWV drive_type = DrivelineTypeWV::AWD;
@@ -97,7 +102,7 @@ HmmwvDlcTest<EnumClass, TIRE_MODEL>::HmmwvDlcTest() : m_step_veh(2e-3), m_step_t
 
     // Parameterized NATO double lane change (to right)
     auto path = DoubleLaneChangePath(ChVector3d(-125, 0, 0.1), 28.93, 3.6105, 25.0, 50.0, false);
-    m_driver = new ChPathFollowerDriver(m_hmmwv->GetVehicle(), path, "my_path", 12.0);
+    m_driver = new ChPathFollowerDriver(m_hmmwv->GetVehicle(), path, "my_path", speed);
     m_driver->GetSteeringController().SetLookAheadDistance(5.0);
     m_driver->GetSteeringController().SetGains(0.8, 0, 0);
     m_driver->GetSpeedController().SetGains(0.4, 0, 0);
@@ -185,6 +190,55 @@ CH_BM_SIMULATION_ONCE(HmmwvDLC_RIGIDMESH, rigidmesh_test_type, NUM_SKIP_STEPS, N
 
 // =============================================================================
 
+// Ensemble member: a DLC test simulated for a given number of steps.
+class EnsembleMember : public utils::ChEnsemble::Simulation {
+  public:
+    EnsembleMember(double speed, int num_steps) : m_test(speed), m_num_steps(num_steps), m_step(0) {}
+
+    virtual ChSystem* GetSystem() override { return m_test.GetSystem(); }
+
+    virtual bool Advance() override {
+        m_test.ExecuteStep();
+        return ++m_step < m_num_steps;
+    }
+
+  private:
+    tmeasy_test_type m_test;
+    int m_num_steps;
+    int m_step;
+};
+
+#define NUM_SIMS_PER_THREAD 2    // number of ensemble members per worker thread
+#define NUM_ENSEMBLE_STEPS 2500  // number of simulation steps for each member (2e-3 * 2500 = 5s)
+
+static void HmmwvDLC_Ensemble(benchmark::State& st) {
+    int num_threads = (int)st.range(0);
+    int num_sims = NUM_SIMS_PER_THREAD * num_threads;
+
+    for (auto _ : st) {
+        utils::ChEnsemble ensemble(num_threads);
+        ensemble.SetThreadPinning(true);
+        ensemble.Run(num_sims, [num_sims](int i) {
+            double speed = 10.0 + 6.0 * i / num_sims;  // target speed sweep
+            return chrono_types::make_shared<EnsembleMember>(speed, NUM_ENSEMBLE_STEPS);
+        });
+
+        st.counters["Throughput"] = ensemble.GetThroughput();
+        st.counters["Sim_Time"] = ensemble.GetSimulatedTime();
+        st.counters["Steals"] = ensemble.GetNumSteals();
+    }
+}
+BENCHMARK(HmmwvDLC_Ensemble)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+// =============================================================================
+
 int main(int argc, char* argv[]) {
     ::benchmark::Initialize(&argc, argv);
 
@@ -0,0 +1,136 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Benchmark test for terrain queries.
+// Compares scalar (one location at a time) and batch terrain height queries for
+// the sampling pattern of the envelope tire-terrain collision (179 samples along
+// the diameter of each of the 4 tire discs), on different terrain types.
+//
+// =============================================================================
+
+#include <benchmark/benchmark.h>
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/ChWorldFrame.h"
+#include "chrono_vehicle/terrain/FlatTerrain.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+enum class TerrainType { FLAT, RIGID_BOX, RIGID_HEIGHTMAP, SCM };
+
+template <TerrainType TYPE>
+class TerrainQueryFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        sys = new ChSystemSMC();
+        sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+
+        switch (TYPE) {
+            case TerrainType::FLAT:
+                terrain = new FlatTerrain(0);
+                break;
+            case TerrainType::RIGID_BOX: {
+                auto rigid = new RigidTerrain(sys);
+                rigid->AddPatch(mat, CSYSNORM, 64, 64);
+                rigid->Initialize();
+                terrain = rigid;
+                break;
+            }
+            case TerrainType::RIGID_HEIGHTMAP: {
+                auto rigid = new RigidTerrain(sys);
+                rigid->AddPatch(mat, CSYSNORM, vehicle::GetDataFile("terrain/height_maps/test64.bmp"), 64, 64, 0, 2);
+                rigid->Initialize();
+                terrain = rigid;
+                break;
+            }
+            case TerrainType::SCM: {
+                auto scm = new SCMTerrain(sys);
+                scm->Initialize(64, 64, 0.05);
+                terrain = scm;
+                break;
+            }
+        }
+        sys->DoStepDynamics(1e-4);  // initialize the system (and the collision system used for ray casting)
+
+        // Envelope sampling points for 4 tires of radius 0.47 m
+        const double radius = 0.47;
+        const size_t n_div = 180;
+        ChVector3d voffset = radius * ChWorldFrame::Vertical();
+        for (double x : {-1.5, 1.5}) {
+            for (double y : {-0.9, 0.9}) {
+                ChVector3d center(x, y, radius + 0.5);
+                for (size_t i = 1; i < n_div; i++) {
+                    double dx = -radius + 2.0 * radius * double(i) / n_div;
+                    locs.push_back(center + ChVector3d(dx, 0, 0) + voffset);
+                }
+            }
+        }
+    }
+
+    void TearDown(const ::benchmark::State&) override {
+        delete terrain;
+        delete sys;
+        locs.clear();
+    }
+
+    ChSystemSMC* sys;
+    ChTerrain* terrain;
+    std::vector<ChVector3d> locs;
+};
+
+#define BM_TERRAIN_QUERY(NAME, TYPE)                                          \
+    using NAME = TerrainQueryFixture<TYPE>;                                   \
+    BENCHMARK_DEFINE_F(NAME, Scalar)(benchmark::State & st) {                 \
+        std::vector<double> heights(locs.size());                             \
+        for (auto _ : st) {                                                   \
+            for (size_t i = 0; i < locs.size(); i++)                          \
+                heights[i] = terrain->GetHeight(locs[i]);                     \
+            benchmark::DoNotOptimize(heights.data());                         \
+        }                                                                     \
+        st.SetItemsProcessed(st.iterations() * locs.size());                  \
+    }                                                                         \
+    BENCHMARK_REGISTER_F(NAME, Scalar)->Unit(benchmark::kMicrosecond);        \
+    BENCHMARK_DEFINE_F(NAME, Batch)(benchmark::State & st) {                  \
+        std::vector<double> heights;                                          \
+        for (auto _ : st) {                                                   \
+            terrain->GetHeights(locs, heights);                               \
+            benchmark::DoNotOptimize(heights.data());                         \
+        }                                                                     \
+        st.SetItemsProcessed(st.iterations() * locs.size());                  \
+    }                                                                         \
+    BENCHMARK_REGISTER_F(NAME, Batch)->Unit(benchmark::kMicrosecond);         \
+    BENCHMARK_DEFINE_F(NAME, BatchProperties)(benchmark::State & st) {        \
+        std::vector<double> heights;                                          \
+        std::vector<ChVector3d> normals;                                      \
+        std::vector<float> frictions;                                         \
+        for (auto _ : st) {                                                   \
+            terrain->GetProperties(locs, heights, normals, frictions);        \
+            benchmark::DoNotOptimize(heights.data());                         \
+        }                                                                     \
+        st.SetItemsProcessed(st.iterations() * locs.size());                  \
+    }                                                                         \
+    BENCHMARK_REGISTER_F(NAME, BatchProperties)->Unit(benchmark::kMicrosecond);
+
+BM_TERRAIN_QUERY(FlatQuery, TerrainType::FLAT)
+BM_TERRAIN_QUERY(RigidBoxQuery, TerrainType::RIGID_BOX)
+BM_TERRAIN_QUERY(RigidHeightmapQuery, TerrainType::RIGID_HEIGHTMAP)
+BM_TERRAIN_QUERY(SCMQuery, TerrainType::SCM)
@@ -0,0 +1,39 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Common utility functions for collision tests
+//
+// =============================================================================
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+using namespace chrono;
+
+// Create a flat square grid mesh (n x n cells of given size) in the plane z = 0.
+std::shared_ptr<ChTriangleMeshConnected> CreateGrid(int n, double size) {
+    auto mesh = chrono_types::make_shared<ChTriangleMeshConnected>();
+    double x0 = -0.5 * n * size;
+    for (int i = 0; i <= n; i++)
+        for (int j = 0; j <= n; j++)
+            mesh->m_vertices.push_back(ChVector3d(x0 + i * size, x0 + j * size, 0));
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            int v0 = i * (n + 1) + j;
+            int v1 = v0 + n + 1;
+            mesh->m_face_v_indices.push_back(ChVector3i(v0, v1, v1 + 1));
+            mesh->m_face_v_indices.push_back(ChVector3i(v0, v1 + 1, v0 + 1));
+        }
+    }
+    return mesh;
+}
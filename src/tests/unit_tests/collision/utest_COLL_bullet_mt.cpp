@@ -0,0 +1,110 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for multithreaded Bullet collision detection.
+// A packed set of spheres and boxes is processed with a single collision thread
+// and with multiple collision threads (parallel AABB update, broadphase pair
+// search, and contact reporting). The reported contacts must match.
+//
+// =============================================================================
+
+#include <map>
+#include <utility>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Contact data, keyed by the tags of the two bodies in contact.
+typedef std::map<std::pair<int, int>, std::pair<int, double>> ContactMap;
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        int idA = static_cast<ChBody*>(contactobjA)->GetTag();
+        int idB = static_cast<ChBody*>(contactobjB)->GetTag();
+        auto& entry = contacts[std::make_pair(std::min(idA, idB), std::max(idA, idB))];
+        entry.first++;
+        entry.second += distance;
+        return true;
+    }
+
+    ContactMap contacts;
+};
+
+static ContactMap Collide(int num_threads) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetNumThreads(1, num_threads, 1);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetTag(0);
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    // Layers of slightly interpenetrating spheres and boxes
+    int tag = 1;
+    for (int k = 0; k < 3; k++) {
+        for (int i = -8; i <= 8; i++) {
+            for (int j = -8; j <= 8; j++) {
+                std::shared_ptr<ChBody> body;
+                if ((i + j + k) % 2 == 0)
+                    body = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+                else
+                    body = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 0.2, 1000, false, true, mat);
+                body->SetPos(ChVector3d(0.198 * i, 0.198 * j, 0.099 + 0.198 * k));
+                body->SetTag(tag++);
+                sys.AddBody(body);
+            }
+        }
+    }
+
+    sys.Update(false);
+    sys.ComputeCollisions();
+    sys.ComputeCollisions();
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+    return collector->contacts;
+}
+
+TEST(ChCollisionSystemBullet, parallel_collision) {
+    auto contacts_ref = Collide(1);
+    ASSERT_GT(contacts_ref.size(), 0u);
+
+    for (int num_threads : {2, 4}) {
+        auto contacts = Collide(num_threads);
+        ASSERT_EQ(contacts.size(), contacts_ref.size());
+        for (const auto& c : contacts_ref) {
+            auto itr = contacts.find(c.first);
+            ASSERT_TRUE(itr != contacts.end());
+            ASSERT_EQ(itr->second.first, c.second.first);
+            ASSERT_NEAR(itr->second.second, c.second.second, 1e-10);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for static triangle mesh collision shapes in Bullet.
+// A sphere and a box are dropped on a fixed body with a static triangle mesh
+// collision shape (a flat grid). Both must come to rest on the mesh. Ray casts
+// must also hit the mesh.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+#include "gtest/gtest.h"
+
+#include "utest_COLL.h"
+
+using namespace chrono;
+
+TEST(ChCollisionSystemBullet, static_trimesh) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    ground->EnableCollision(true);
+    auto shape = chrono_types::make_shared<ChCollisionShapeTriangleMesh>(mat, CreateGrid(100, 0.1), true, false, 0);
+    ground->AddCollisionShape(shape);
+    sys.AddBody(ground);
+
+    double radius = 0.2;
+    auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+    sphere->SetPos(ChVector3d(-1, 0.33, 0.5));
+    sys.AddBody(sphere);
+
+    double hsize = 0.15;
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(2 * hsize, 2 * hsize, 2 * hsize, 1000, false, true, mat);
+    box->SetPos(ChVector3d(1, -0.27, 0.5));
+    sys.AddBody(box);
+
+    for (int i = 0; i < 1000; i++)
+        sys.DoStepDynamics(1e-3);
+
+    ASSERT_NEAR(sphere->GetPos().z(), radius, 1e-2);
+    ASSERT_NEAR(box->GetPos().z(), hsize, 1e-2);
+    ASSERT_NEAR(sphere->GetPosDt().Length(), 0.0, 1e-2);
+    ASSERT_NEAR(box->GetPosDt().Length(), 0.0, 1e-2);
+
+    // Ray cast onto the mesh
+    ChCollisionSystem::ChRayhitResult result;
+    ASSERT_TRUE(sys.GetCollisionSystem()->RayHit(ChVector3d(3, 3, 1), ChVector3d(3, 3, -1), result));
+    ASSERT_NEAR(result.abs_hitPoint.z(), 0.0, 1e-6);
+}
@@ -0,0 +1,160 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the collision mesh cache.
+// The same Bullet simulation (a sphere and a convex hull dropped on a static
+// triangle mesh, and a non-static triangle mesh dropped on a box) is run twice
+// with the mesh cache enabled. The first run must populate the cache, the
+// second must load all preprocessed mesh data from it. Results must match.
+//
+// =============================================================================
+
+#include "chrono/collision/ChCollisionMeshCache.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+#include "gtest/gtest.h"
+
+#include "utest_COLL.h"
+
+using namespace chrono;
+
+static std::vector<ChVector3d> Simulate() {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    ground->EnableCollision(true);
+    auto shape = chrono_types::make_shared<ChCollisionShapeTriangleMesh>(mat, CreateGrid(50, 0.1), true, false, 0);
+    ground->AddCollisionShape(shape);
+    sys.AddBody(ground);
+
+    auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+    sphere->SetPos(ChVector3d(-1, 0.33, 0.5));
+    sys.AddBody(sphere);
+
+    std::vector<ChVector3d> points = {{-0.1, -0.1, -0.1}, {0.1, -0.1, -0.1}, {0.1, 0.1, -0.1}, {-0.1, 0.1, -0.1},
+                                      {-0.1, -0.1, 0.1},  {0.1, -0.1, 0.1},  {0.1, 0.1, 0.1},  {-0.1, 0.1, 0.1}};
+    auto hull = chrono_types::make_shared<ChBodyEasyConvexHull>(points, 1000, false, true, mat);
+    hull->SetPos(ChVector3d(1, -0.27, 0.5));
+    sys.AddBody(hull);
+
+    auto plate = chrono_types::make_shared<ChBody>();
+    plate->SetPos(ChVector3d(0, 1, 0.5));
+    plate->SetMass(1);
+    plate->EnableCollision(true);
+    auto plate_shape = chrono_types::make_shared<ChCollisionShapeTriangleMesh>(mat, CreateGrid(4, 0.1), false, false);
+    plate->AddCollisionShape(plate_shape);
+    sys.AddBody(plate);
+
+    for (int i = 0; i < 200; i++)
+        sys.DoStepDynamics(1e-3);
+
+    return {sphere->GetPos(), hull->GetPos(), plate->GetPos()};
+}
+
+TEST(ChCollisionMeshCache, bullet) {
+    ASSERT_TRUE(ChCollisionMeshCache::Enable("mesh_cache_test"));
+    ChCollisionMeshCache::ResetStatistics();
+
+    auto pos1 = Simulate();
+    auto stats1 = ChCollisionMeshCache::GetStatistics();
+
+    auto pos2 = Simulate();
+    auto stats2 = ChCollisionMeshCache::GetStatistics();
+
+    ChCollisionMeshCache::Disable();
+
+    // Entries may already exist from a previous test run; in any case, the second run must not miss
+    ASSERT_GT(stats1.num_hits + stats1.num_stores, 0);
+    ASSERT_EQ(stats2.num_misses, stats1.num_misses);
+    ASSERT_GT(stats2.num_hits, stats1.num_hits);
+
+    for (size_t i = 0; i < pos1.size(); i++)
+        ASSERT_NEAR((pos2[i] - pos1[i]).Length(), 0.0, 1e-12);
+}
+
+TEST(ChCollisionMeshCache, bullet_memory_map) {
+    // Populate the cache with entries read in memory, then load them memory-mapped
+    ASSERT_TRUE(ChCollisionMeshCache::Enable("mesh_cache_test_mmap"));
+    ChCollisionMeshCache::ResetStatistics();
+    auto pos1 = Simulate();
+    auto stats1 = ChCollisionMeshCache::GetStatistics();
+
+    ASSERT_TRUE(ChCollisionMeshCache::Enable("mesh_cache_test_mmap", true));
+    auto pos2 = Simulate();
+    auto stats2 = ChCollisionMeshCache::GetStatistics();
+
+    ChCollisionMeshCache::Disable();
+
+    ASSERT_EQ(stats2.num_misses, stats1.num_misses);
+    ASSERT_GT(stats2.num_hits, stats1.num_hits);
+
+    for (size_t i = 0; i < pos1.size(); i++)
+        ASSERT_NEAR((pos2[i] - pos1[i]).Length(), 0.0, 1e-12);
+}
+
+TEST(ChCollisionMeshCache, entries) {
+    std::vector<double> values = {1.5, -2.0, 3.25, 1e-8, 7.0};
+    std::vector<int> indices = {3, 1, 4, 1, 5, 9, 2};
+    ChCollisionMeshCache::Writer writer;
+    writer.Write(values);
+    writer.Write(indices);
+
+    uint64_t key = ChCollisionMeshCache::Hasher().Add(values).Add(indices).GetKey();
+
+    for (bool memory_map : {false, true}) {
+        ASSERT_TRUE(ChCollisionMeshCache::Enable("mesh_cache_test_entries", memory_map));
+        ASSERT_TRUE(ChCollisionMeshCache::Store("test", key, writer.GetBuffer(), 1.0));
+
+        {
+            auto entry = ChCollisionMeshCache::Load("test", key);
+            ASSERT_TRUE(entry != nullptr);
+            ASSERT_EQ(entry->GetSize(), writer.GetBuffer().size());
+            ASSERT_EQ(reinterpret_cast<uintptr_t>(entry->GetData()) % 16, 0u);
+
+            // Read arrays in place, then modify them (changes must not be written back to the cache file)
+            ChCollisionMeshCache::Reader reader(entry->GetData(), entry->GetSize());
+            size_t n;
+            double* v = reader.Read<double>(n);
+            ASSERT_TRUE(v != nullptr);
+            ASSERT_EQ(n, values.size());
+            std::vector<int> idx;
+            ASSERT_TRUE(reader.Read(idx));
+            ASSERT_EQ(idx, indices);
+            for (size_t i = 0; i < n; i++) {
+                ASSERT_EQ(v[i], values[i]);
+                v[i] = 0;
+            }
+        }
+
+        auto entry = ChCollisionMeshCache::Load("test", key);
+        ASSERT_TRUE(entry != nullptr);
+        ChCollisionMeshCache::Reader reader(entry->GetData(), entry->GetSize());
+        std::vector<double> v;
+        ASSERT_TRUE(reader.Read(v));
+        ASSERT_EQ(v, values);
+
+        // Entries with a different key are not found
+        ASSERT_TRUE(ChCollisionMeshCache::Load("test", key + 1) == nullptr);
+    }
+
+    ChCollisionMeshCache::Disable();
+}
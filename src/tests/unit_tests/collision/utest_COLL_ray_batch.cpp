@@ -0,0 +1,83 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for batched ray-hit tests.
+// A grid of vertical rays is cast onto a set of collision shapes, both one ray
+// at a time and as a batch (processed concurrently). The results must match.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+TEST(ChCollisionSystemBullet, ray_batch) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetNumThreads(1, 4, 1);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(1.0, 1.0, 0.5, 1000, true, true, mat);
+    box->SetPos(ChVector3d(-1, 0, 0));
+    box->SetFixed(true);
+    sys.AddBody(box);
+
+    auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, true, true, mat);
+    sphere->SetPos(ChVector3d(1, 0, 0.2));
+    sphere->SetFixed(true);
+    sys.AddBody(sphere);
+
+    auto cyl = chrono_types::make_shared<ChBodyEasyCylinder>(ChAxis::Z, 0.3, 1.0, 1000, true, true, mat);
+    cyl->SetPos(ChVector3d(0, 1, 0));
+    cyl->SetFixed(true);
+    sys.AddBody(cyl);
+
+    sys.DoStepDynamics(1e-3);
+    auto coll_sys = sys.GetCollisionSystem();
+
+    std::vector<ChCollisionSystem::ChRay> rays;
+    for (int i = -30; i <= 30; i++) {
+        for (int j = -30; j <= 30; j++) {
+            ChCollisionSystem::ChRay ray;
+            ray.from = ChVector3d(0.05 * i, 0.05 * j, 2);
+            ray.to = ChVector3d(0.05 * i, 0.05 * j, -2);
+            rays.push_back(ray);
+        }
+    }
+
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    int num_hits = coll_sys->RayHitBatch(rays, results);
+    ASSERT_EQ(results.size(), rays.size());
+    ASSERT_GT(num_hits, 0);
+
+    int num_hits_ref = 0;
+    for (size_t i = 0; i < rays.size(); i++) {
+        ChCollisionSystem::ChRayhitResult result;
+        bool hit = coll_sys->RayHit(rays[i].from, rays[i].to, result);
+        ASSERT_EQ(hit, results[i].hit);
+        if (!hit)
+            continue;
+        num_hits_ref++;
+        ASSERT_EQ(result.hitModel, results[i].hitModel);
+        ASSERT_DOUBLE_EQ(result.dist_factor, results[i].dist_factor);
+        ASSERT_NEAR((result.abs_hitPoint - results[i].abs_hitPoint).Length(), 0.0, 1e-12);
+    }
+    ASSERT_EQ(num_hits, num_hits_ref);
+}
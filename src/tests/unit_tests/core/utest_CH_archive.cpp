@@ -575,3 +575,83 @@ TEST(ChArchiveJSON, ChVectorDynamicTest) {
     ASSERT_DOUBLE_EQ(myVect_before.y(), myVect.y());
     ASSERT_DOUBLE_EQ(myVect_before.z(), myVect.z());
 }
+
+// Round trip of contiguous arrays of arithmetic values (written and read in bulk).
+template <class ArchiveOut, class ArchiveIn>
+void test_bulk_arrays(const std::string& outputfile, std::ios::openmode mode) {
+    std::vector<double> vec_double(100);
+    std::vector<int> vec_int(50);
+    std::vector<unsigned int> vec_uint(20);
+    std::vector<float> vec_float(30);
+    std::vector<double> vec_empty;
+    std::vector<ChVector3d> vec_points(40);
+    ChMatrixDynamic<> matrix(7, 5);
+    for (size_t i = 0; i < vec_double.size(); i++)
+        vec_double[i] = 0.25 * i - 10;
+    for (size_t i = 0; i < vec_int.size(); i++)
+        vec_int[i] = 3 * (int)i - 70;
+    for (size_t i = 0; i < vec_uint.size(); i++)
+        vec_uint[i] = 1000 * (unsigned int)i;
+    for (size_t i = 0; i < vec_float.size(); i++)
+        vec_float[i] = 0.5f * i;
+    for (size_t i = 0; i < vec_points.size(); i++)
+        vec_points[i] = ChVector3d(i, -0.5 * i, 0.125 * i);
+    for (int i = 0; i < matrix.rows(); i++)
+        for (int j = 0; j < matrix.cols(); j++)
+            matrix(i, j) = i - 0.5 * j;
+
+    {
+        std::ofstream mfileo(outputfile, mode);
+        ArchiveOut archive_out(mfileo);
+        archive_out << CHNVP(vec_double);
+        archive_out << CHNVP(vec_int);
+        archive_out << CHNVP(vec_uint);
+        archive_out << CHNVP(vec_float);
+        archive_out << CHNVP(vec_empty);
+        archive_out << CHNVP(vec_points);
+        archive_out << CHNVP(matrix);
+    }
+
+    std::vector<double> vec_double_in;
+    std::vector<int> vec_int_in;
+    std::vector<unsigned int> vec_uint_in;
+    std::vector<float> vec_float_in;
+    std::vector<double> vec_empty_in(3);
+    std::vector<ChVector3d> vec_points_in;
+    ChMatrixDynamic<> matrix_in;
+    {
+        std::ifstream mfilei(outputfile, mode);
+        ArchiveIn archive_in(mfilei);
+        archive_in >> CHNVP(vec_double_in, "vec_double");
+        archive_in >> CHNVP(vec_int_in, "vec_int");
+        archive_in >> CHNVP(vec_uint_in, "vec_uint");
+        archive_in >> CHNVP(vec_float_in, "vec_float");
+        archive_in >> CHNVP(vec_empty_in, "vec_empty");
+        archive_in >> CHNVP(vec_points_in, "vec_points");
+        archive_in >> CHNVP(matrix_in, "matrix");
+    }
+
+    ASSERT_EQ(vec_double_in, vec_double);
+    ASSERT_EQ(vec_int_in, vec_int);
+    ASSERT_EQ(vec_uint_in, vec_uint);
+    ASSERT_EQ(vec_float_in, vec_float);
+    ASSERT_TRUE(vec_empty_in.empty());
+    ASSERT_EQ(vec_points_in.size(), vec_points.size());
+    for (size_t i = 0; i < vec_points.size(); i++)
+        ASSERT_TRUE(vec_points_in[i].Equals(vec_points[i]));
+    ASSERT_EQ(matrix_in.rows(), matrix.rows());
+    ASSERT_EQ(matrix_in.cols(), matrix.cols());
+    ASSERT_TRUE(matrix_in == matrix);
+}
+
+TEST(ChArchiveBinary, BulkArrays) {
+    test_bulk_arrays<ChArchiveOutBinary, ChArchiveInBinary>("ChArchiveBinary_BulkArrays.dat", std::ios::binary);
+}
+
+TEST(ChArchiveJSON, BulkArrays) {
+    test_bulk_arrays<ChArchiveOutJSON, ChArchiveInJSON>("ChArchiveJSON_BulkArrays.json", std::ios::openmode());
+}
+
+TEST(ChArchiveXML, BulkArrays) {
+    test_bulk_arrays<ChArchiveOutXML, ChArchiveInXML>("ChArchiveXML_BulkArrays.xml", std::ios::openmode());
+}
@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for closest-point queries on Bezier curves.
+// Global queries (using the curve BVH) are compared against an exhaustive search
+// over all curve intervals.
+//
+// =============================================================================
+
+#include <cmath>
+#include <random>
+
+#include "chrono/core/ChBezierCurve.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Spline through the nodes of an open spiral or of a closed loop, with some vertical variation.
+static std::shared_ptr<ChBezierCurve> CreatePath(int num_points, bool closed) {
+    std::vector<ChVector3d> points;
+    for (int i = 0; i < num_points; i++) {
+        double a = (closed ? CH_2PI / num_points : 0.02) * i;
+        double r = closed ? 100 : 20 + 0.05 * i;
+        points.push_back(ChVector3d(r * std::cos(a), r * std::sin(a), std::sin(a)));
+    }
+    return chrono_types::make_shared<ChBezierCurve>(points, closed);
+}
+
+// Exhaustive search over all curve intervals.
+static double BruteForceDist2(const ChBezierCurve& path, const ChVector3d& loc) {
+    double d2_min = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < path.GetNumSegments(); i++) {
+        double t;
+        auto p = path.CalcClosestPoint(loc, i, t);
+        d2_min = std::min(d2_min, (p - loc).Length2());
+    }
+    return d2_min;
+}
+
+static void TestGlobalQuery(bool closed) {
+    auto path = CreatePath(2000, closed);
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-150, 150);
+
+    std::vector<ChVector3d> locs;
+    for (int k = 0; k < 200; k++)
+        locs.push_back(ChVector3d(dist(gen), dist(gen), 0.1 * dist(gen)));
+
+    for (const auto& loc : locs) {
+        size_t i;
+        double t;
+        auto p = path->FindClosestPoint(loc, i, t);
+        ASSERT_LT(i, path->GetNumSegments());
+        ASSERT_NEAR((path->Eval(i, t) - p).Length(), 0, 1e-12);
+        ASSERT_NEAR((p - loc).Length2(), BruteForceDist2(*path, loc), 1e-9);
+    }
+
+    // Batch queries
+    std::vector<ChVector3d> points;
+    std::vector<size_t> intervals;
+    std::vector<double> params;
+    path->FindClosestPoints(locs, points, intervals, params);
+    ASSERT_EQ(points.size(), locs.size());
+    for (size_t k = 0; k < locs.size(); k++) {
+        size_t i;
+        double t;
+        auto p = path->FindClosestPoint(locs[k], i, t);
+        ASSERT_EQ(intervals[k], i);
+        ASSERT_EQ(params[k], t);
+        ASSERT_EQ(points[k], p);
+    }
+}
+
+TEST(ChBezierCurve, closest_point_open) {
+    TestGlobalQuery(false);
+}
+
+TEST(ChBezierCurve, closest_point_closed) {
+    TestGlobalQuery(true);
+}
+
+TEST(ChBezierCurve, tracker) {
+    auto path = CreatePath(2000, false);
+    ChBezierCurveTracker tracker(path);
+
+    // Follow the path with small increments, slightly offset from the path
+    tracker.Reset(path->GetPoint(0));
+    ChVector3d point;
+    for (size_t i = 0; i < 100; i++) {
+        auto loc = path->Eval(i, 0.3) + ChVector3d(0, 0, 0.5);
+        tracker.CalcClosestPoint(loc, point);
+        ASSERT_NEAR((point - loc).Length2(), BruteForceDist2(*path, loc), 1e-9);
+    }
+
+    // Jump far along the path (re-acquisition)
+    auto loc = path->Eval(1500, 0.6) + ChVector3d(0, 0, 0.5);
+    int flag = tracker.CalcClosestPoint(loc, point);
+    ASSERT_EQ(flag, 0);
+    ASSERT_NEAR((point - loc).Length2(), BruteForceDist2(*path, loc), 1e-9);
+
+    // Past the end of the path
+    auto tangent = path->EvalDer(path->GetNumSegments() - 1, 1.0).GetNormalized();
+    loc = path->GetPoint(path->GetNumPoints() - 1) + 0.5 * tangent;
+    flag = tracker.CalcClosestPoint(loc, point);
+    ASSERT_EQ(flag, +1);
+}
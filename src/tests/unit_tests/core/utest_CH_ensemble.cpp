@@ -0,0 +1,103 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the ensemble runner.
+// An ensemble of pendulum simulations of different lengths is run with multiple
+// worker threads and the results are compared against sequential simulations.
+//
+// =============================================================================
+
+#include <stdexcept>
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChEnsemble.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const double step = 1e-3;
+
+// Create a pendulum system; the simulation end time depends on the simulation index.
+static std::shared_ptr<ChSystemNSC> CreatePendulum(int i) {
+    auto sys = chrono_types::make_shared<ChSystemNSC>();
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys->AddBody(ground);
+
+    double length = 0.5 + 0.1 * i;
+    auto bob = chrono_types::make_shared<ChBody>();
+    bob->SetPos(ChVector3d(length, 0, 0));
+    sys->AddBody(bob);
+
+    auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(ground, bob, ChFrame<>(VNULL, QUNIT));
+    sys->AddLink(joint);
+
+    return sys;
+}
+
+static double EndTime(int i) {
+    return 0.1 * (1 + i % 5);
+}
+
+TEST(ChEnsemble, pendulums) {
+    const int num_sims = 24;
+
+    utils::ChEnsemble ensemble(4);
+    ensemble.SetStepsPerTask(10);
+    ensemble.Run(num_sims, [](int i) {
+        return chrono_types::make_shared<utils::ChEnsemble::SystemSimulation>(CreatePendulum(i), step, EndTime(i));
+    });
+
+    ASSERT_EQ(ensemble.GetNumSimulations(), num_sims);
+    ASSERT_GT(ensemble.GetWallTime(), 0);
+    ASSERT_GT(ensemble.GetThroughput(), 0);
+
+    double sim_time = 0;
+    for (int i = 0; i < num_sims; i++) {
+        auto sys = ensemble.GetSimulation(i)->GetSystem();
+        ASSERT_NEAR(sys->GetChTime(), EndTime(i), 1e-9);
+        ASSERT_EQ(sys->GetNumThreadsChrono(), 1u);
+        sim_time += sys->GetChTime();
+
+        // Sequential simulation
+        auto sys_ref = CreatePendulum(i);
+        while (sys_ref->GetChTime() < EndTime(i) - 1e-3 * step)
+            sys_ref->DoStepDynamics(step);
+        ASSERT_EQ(sys->GetBodies()[1]->GetPos(), sys_ref->GetBodies()[1]->GetPos());
+    }
+    ASSERT_NEAR(ensemble.GetSimulatedTime(), sim_time, 1e-9);
+}
+
+TEST(ChEnsemble, exception) {
+    utils::ChEnsemble ensemble(2);
+    ASSERT_THROW(ensemble.Run(6,
+                              [](int i) -> std::shared_ptr<utils::ChEnsemble::Simulation> {
+                                  if (i == 3)
+                                      throw std::runtime_error("failed");
+                                  return chrono_types::make_shared<utils::ChEnsemble::SystemSimulation>(
+                                      CreatePendulum(i), step, 0.05);
+                              }),
+                 std::runtime_error);
+
+    for (int i = 0; i < 6; i++) {
+        if (i != 3)
+            ASSERT_NEAR(ensemble.GetSimulation(i)->GetSystem()->GetChTime(), 0.05, 1e-9);
+    }
+}
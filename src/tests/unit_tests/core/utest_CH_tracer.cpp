@@ -0,0 +1,161 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the tracing of timed zones (ChTracer).
+//
+// =============================================================================
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "chrono/utils/ChTracer.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static void Work() {
+    ChTraceZone zone("outer", "test");
+    {
+        ChTraceZone inner("inner", "test");
+        volatile double sum = 0;
+        for (int i = 0; i < 10000; i++)
+            sum = sum + i;
+    }
+}
+
+static std::string ReadFile(const std::string& filename) {
+    std::ifstream file(filename);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+TEST(ChTracer, disabled) {
+    ChTracer::Enable(false);
+    ChTracer::Clear();
+    Work();
+    ASSERT_EQ(ChTracer::GetNumEvents(), 0u);
+}
+
+TEST(ChTracer, nested_zones) {
+    int system;
+    ChTracer::Clear();
+    ChTracer::Enable(true);
+    ChTracer::BeginStep(&system, 1);
+    Work();
+    ChTracer::Enable(false);
+
+    auto events = ChTracer::GetEvents();
+    ASSERT_EQ(events.size(), 2u);
+    ASSERT_STREQ(events[0].name, "outer");
+    ASSERT_STREQ(events[1].name, "inner");
+    ASSERT_LE(events[0].start, events[1].start);
+    ASSERT_GE(events[0].start + events[0].duration, events[1].start + events[1].duration);
+    ASSERT_EQ(events[0].system, 0);
+    ASSERT_EQ(events[1].system, 0);
+    ASSERT_EQ(events[0].step, 1);
+    ASSERT_EQ(events[1].step, 1);
+}
+
+TEST(ChTracer, systems) {
+    // Two systems, each stepped by its own thread
+    int systems[2];
+    const int num_steps[2] = {3, 5};
+
+    ChTracer::Clear();
+    ChTracer::Enable(true);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 2; i++) {
+        threads.push_back(std::thread([&systems, &num_steps, i]() {
+            for (int step = 1; step <= num_steps[i]; step++) {
+                ChTracer::BeginStep(&systems[i], step);
+                Work();
+            }
+        }));
+    }
+    for (auto& t : threads)
+        t.join();
+    ChTracer::Enable(false);
+
+    // Events are tagged with the step of their own system
+    std::vector<int> thread_ids;
+    auto events = ChTracer::GetEvents(&thread_ids);
+    ASSERT_EQ(events.size(), (size_t)(2 * (num_steps[0] + num_steps[1])));
+    std::map<int, int> system_of_thread;
+    std::map<int, int> events_per_system;
+    std::map<int, int64_t> last_step;
+    for (size_t i = 0; i < events.size(); i++) {
+        ASSERT_GE(events[i].system, 0);
+        ASSERT_LT(events[i].system, 2);
+        auto itr = system_of_thread.insert({thread_ids[i], events[i].system}).first;
+        ASSERT_EQ(itr->second, events[i].system);
+        ASSERT_GE(events[i].step, last_step[events[i].system]);
+        last_step[events[i].system] = events[i].step;
+        events_per_system[events[i].system]++;
+    }
+    ASSERT_EQ(system_of_thread.size(), 2u);
+    ASSERT_EQ(events_per_system[0] + events_per_system[1], (int)events.size());
+    ASSERT_TRUE(last_step[0] == num_steps[0] || last_step[0] == num_steps[1]);
+    ASSERT_EQ(last_step[0] + last_step[1], num_steps[0] + num_steps[1]);
+    ASSERT_EQ(events_per_system[0], 2 * last_step[0]);
+}
+
+TEST(ChTracer, threads) {
+    ChTracer::Clear();
+    ChTracer::Enable(true);
+
+    int system;
+    const int num_threads = 4;
+    const int num_steps = 3;
+    for (int step = 1; step <= num_steps; step++) {
+        ChTracer::BeginStep(&system, step);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < num_threads; i++)
+            threads.push_back(std::thread(Work));
+        for (auto& t : threads)
+            t.join();
+    }
+    ChTracer::Enable(false);
+
+    std::vector<int> thread_ids;
+    auto events = ChTracer::GetEvents(&thread_ids);
+    ASSERT_EQ(events.size(), (size_t)(2 * num_threads * num_steps));
+    ASSERT_EQ(thread_ids.size(), events.size());
+    for (size_t i = 1; i < events.size(); i++)
+        ASSERT_LE(events[i - 1].start, events[i].start);
+
+    // Chrome trace export
+    ASSERT_TRUE(ChTracer::WriteChromeTrace("tracer_test.json"));
+    auto json = ReadFile("tracer_test.json");
+    ASSERT_EQ(json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), 0u);
+    ASSERT_NE(json.find("\"ph\":\"X\",\"name\":\"outer\",\"cat\":\"test\""), std::string::npos);
+    ASSERT_NE(json.find("\"ph\":\"M\",\"name\":\"thread_name\""), std::string::npos);
+
+    // Per-step summary (header and one line per step and zone)
+    ASSERT_TRUE(ChTracer::WriteStepSummary("tracer_test.csv"));
+    std::ifstream csv("tracer_test.csv");
+    std::string line;
+    std::getline(csv, line);
+    ASSERT_EQ(line, "system,step,zone,calls,total_ms,max_ms");
+    int num_lines = 0;
+    while (std::getline(csv, line)) {
+        ASSERT_NE(line.find("," + std::to_string(num_threads) + ","), std::string::npos);
+        num_lines++;
+    }
+    ASSERT_EQ(num_lines, 2 * num_steps);
+}
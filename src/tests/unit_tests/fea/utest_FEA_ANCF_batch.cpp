@@ -0,0 +1,304 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the batched evaluation of ANCF element internal forces.
+// Homogeneous meshes of ANCF beam (3243, 3333), shell (3443, 3833), and
+// hexahedral (3843) elements are simulated with and without batched evaluation
+// of the internal forces, with and without structural damping. The results
+// must match. The shell elements use multiple layers with different fiber
+// angles (one stiffness matrix per layer) and the 3243 beam elements use
+// separate integration blocks for the Poisson effect.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementBeamANCF_3243.h"
+#include "chrono/fea/ChElementBeamANCF_3333.h"
+#include "chrono/fea/ChElementHexaANCF_3843.h"
+#include "chrono/fea/ChElementShellANCF_3443.h"
+#include "chrono/fea/ChElementShellANCF_3833.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Create a cantilever of ANCF beam elements.
+static void CreateBeam(std::shared_ptr<ChMesh> mesh, double alpha, std::vector<std::shared_ptr<ChNodeFEAbase>>& nodes) {
+    auto material = chrono_types::make_shared<ChMaterialBeamANCF>(7850, 2.1e9, 0.3, 10 * (1 + 0.3) / (12 + 11 * 0.3),
+                                                                  10 * (1 + 0.3) / (12 + 11 * 0.3));
+    int num_elements = 19;
+    double dx = 1.0 / (2 * num_elements);
+
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector3d(0, 0, 0), VECT_Y, VECT_Z);
+    nodeA->SetFixed(true);
+    mesh->AddNode(nodeA);
+    nodes.push_back(nodeA);
+    for (int i = 1; i <= num_elements; i++) {
+        auto nodeC = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector3d(dx * (2 * i - 1), 0, 0), VECT_Y, VECT_Z);
+        auto nodeB = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector3d(dx * (2 * i), 0, 0), VECT_Y, VECT_Z);
+        mesh->AddNode(nodeC);
+        mesh->AddNode(nodeB);
+        nodes.push_back(nodeC);
+        nodes.push_back(nodeB);
+
+        auto element = chrono_types::make_shared<ChElementBeamANCF_3333>();
+        element->SetNodes(nodeA, nodeB, nodeC);
+        element->SetDimensions(2 * dx, 0.02, 0.02);
+        element->SetMaterial(material);
+        element->SetAlphaDamp(alpha);
+        mesh->AddElement(element);
+
+        nodeA = nodeB;
+    }
+}
+
+// Create a cantilever of ANCF beam elements with 2 nodes.
+static void CreateBeam3243(std::shared_ptr<ChMesh> mesh,
+                           double alpha,
+                           std::vector<std::shared_ptr<ChNodeFEAbase>>& nodes) {
+    auto material = chrono_types::make_shared<ChMaterialBeamANCF>(7850, 2.1e9, 0.3, 10 * (1 + 0.3) / (12 + 11 * 0.3),
+                                                                  10 * (1 + 0.3) / (12 + 11 * 0.3));
+    int num_elements = 19;
+    double dx = 1.0 / num_elements;
+
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyzDDD>(ChVector3d(0, 0, 0), VECT_X, VECT_Y, VECT_Z);
+    nodeA->SetFixed(true);
+    mesh->AddNode(nodeA);
+    nodes.push_back(nodeA);
+    for (int i = 1; i <= num_elements; i++) {
+        auto nodeB = chrono_types::make_shared<ChNodeFEAxyzDDD>(ChVector3d(dx * i, 0, 0), VECT_X, VECT_Y, VECT_Z);
+        mesh->AddNode(nodeB);
+        nodes.push_back(nodeB);
+
+        auto element = chrono_types::make_shared<ChElementBeamANCF_3243>();
+        element->SetNodes(nodeA, nodeB);
+        element->SetDimensions(dx, 0.02, 0.02);
+        element->SetMaterial(material);
+        element->SetAlphaDamp(alpha);
+        mesh->AddElement(element);
+
+        nodeA = nodeB;
+    }
+}
+
+// Orthotropic material for the layered shell elements.
+static std::shared_ptr<ChMaterialShellANCF> CreateShellMaterial() {
+    return chrono_types::make_shared<ChMaterialShellANCF>(7850, ChVector3d(2.1e8, 1.0e8, 1.0e8),
+                                                          ChVector3d(0.3, 0.2, 0.2), ChVector3d(6e7, 4e7, 4e7));
+}
+
+// Create a cantilever plate of 4-node ANCF shell elements, with two layers with different fiber angles.
+static void CreateShell3443(std::shared_ptr<ChMesh> mesh,
+                            double alpha,
+                            std::vector<std::shared_ptr<ChNodeFEAbase>>& nodes) {
+    auto material = CreateShellMaterial();
+    int nx = 6;
+    int ny = 3;
+    double dx = 0.1;
+    double dy = 0.1;
+
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> grid;
+    for (int i = 0; i <= nx; i++) {
+        for (int j = 0; j <= ny; j++) {
+            auto node = chrono_types::make_shared<ChNodeFEAxyzDDD>(ChVector3d(dx * i, dy * j, 0), VECT_X, VECT_Y,
+                                                                   VECT_Z);
+            node->SetFixed(i == 0);
+            mesh->AddNode(node);
+            nodes.push_back(node);
+            grid.push_back(node);
+        }
+    }
+    for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+            int a = i * (ny + 1) + j;
+            int b = a + ny + 1;
+            auto element = chrono_types::make_shared<ChElementShellANCF_3443>();
+            element->SetNodes(grid[a], grid[b], grid[b + 1], grid[a + 1]);
+            element->SetDimensions(dx, dy);
+            element->AddLayer(0.005, 0 * CH_DEG_TO_RAD, material);
+            element->AddLayer(0.005, 45 * CH_DEG_TO_RAD, material);
+            element->SetAlphaDamp(alpha);
+            mesh->AddElement(element);
+        }
+    }
+}
+
+// Create a cantilever plate of 8-node ANCF shell elements, with two layers with different fiber angles.
+static void CreateShell3833(std::shared_ptr<ChMesh> mesh,
+                            double alpha,
+                            std::vector<std::shared_ptr<ChNodeFEAbase>>& nodes) {
+    auto material = CreateShellMaterial();
+    int nx = 6;
+    int ny = 2;
+    double dx = 0.1;
+    double dy = 0.1;
+
+    // Nodes on a grid with half the element size (the element centers are not used)
+    std::vector<std::shared_ptr<ChNodeFEAxyzDD>> grid((2 * nx + 1) * (2 * ny + 1));
+    for (int i = 0; i <= 2 * nx; i++) {
+        for (int j = 0; j <= 2 * ny; j++) {
+            if (i % 2 == 1 && j % 2 == 1)
+                continue;
+            auto node = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector3d(0.5 * dx * i, 0.5 * dy * j, 0), VECT_Z,
+                                                                  VNULL);
+            node->SetFixed(i == 0);
+            mesh->AddNode(node);
+            nodes.push_back(node);
+            grid[i * (2 * ny + 1) + j] = node;
+        }
+    }
+    auto N = [&grid, ny](int i, int j) { return grid[i * (2 * ny + 1) + j]; };
+    for (int i = 0; i < 2 * nx; i += 2) {
+        for (int j = 0; j < 2 * ny; j += 2) {
+            auto element = chrono_types::make_shared<ChElementShellANCF_3833>();
+            element->SetNodes(N(i, j), N(i + 2, j), N(i + 2, j + 2), N(i, j + 2),  //
+                              N(i + 1, j), N(i + 2, j + 1), N(i + 1, j + 2), N(i, j + 1));
+            element->SetDimensions(dx, dy);
+            element->AddLayer(0.005, 0 * CH_DEG_TO_RAD, material);
+            element->AddLayer(0.005, 45 * CH_DEG_TO_RAD, material);
+            element->SetAlphaDamp(alpha);
+            mesh->AddElement(element);
+        }
+    }
+}
+
+// Create a cantilever plate of ANCF hexahedral elements.
+static void CreateHexa(std::shared_ptr<ChMesh> mesh, double alpha, std::vector<std::shared_ptr<ChNodeFEAbase>>& nodes) {
+    auto material = chrono_types::make_shared<ChMaterialHexaANCF>(7810, 1e7, 0.3);
+    int nx = 6;
+    int ny = 3;
+    double dx = 0.1;
+    double dy = 0.1;
+    double dz = 0.02;
+
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> bottom;
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> top;
+    for (int i = 0; i <= nx; i++) {
+        for (int j = 0; j <= ny; j++) {
+            auto nb = chrono_types::make_shared<ChNodeFEAxyzDDD>(ChVector3d(dx * i, dy * j, 0), VECT_X, VECT_Y, VECT_Z);
+            auto nt = chrono_types::make_shared<ChNodeFEAxyzDDD>(ChVector3d(dx * i, dy * j, dz), VECT_X, VECT_Y, VECT_Z);
+            nb->SetFixed(i == 0);
+            nt->SetFixed(i == 0);
+            mesh->AddNode(nb);
+            mesh->AddNode(nt);
+            nodes.push_back(nb);
+            nodes.push_back(nt);
+            bottom.push_back(nb);
+            top.push_back(nt);
+        }
+    }
+    for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+            int a = i * (ny + 1) + j;
+            int b = a + ny + 1;
+            auto element = chrono_types::make_shared<ChElementHexaANCF_3843>();
+            element->SetNodes(bottom[a], bottom[b], bottom[b + 1], bottom[a + 1], top[a], top[b], top[b + 1],
+                              top[a + 1]);
+            element->SetDimensions(dx, dy, dz);
+            element->SetMaterial(material);
+            element->SetAlphaDamp(alpha);
+            mesh->AddElement(element);
+        }
+    }
+}
+
+typedef void (*MeshCreator)(std::shared_ptr<ChMesh>, double, std::vector<std::shared_ptr<ChNodeFEAbase>>&);
+
+// Simulate the mesh and return the nodal displacements.
+static std::vector<ChVector3d> Simulate(MeshCreator create, double alpha, bool batched, unsigned int& num_batches) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.8));
+
+    auto solver = chrono_types::make_shared<ChSolverSparseQR>();
+    solver->LockSparsityPattern(true);
+    sys.SetSolver(solver);
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    mesh->EnableBatchedEvaluation(batched);
+    sys.Add(mesh);
+
+    std::vector<std::shared_ptr<ChNodeFEAbase>> nodes;
+    create(mesh, alpha, nodes);
+
+    std::vector<ChVector3d> disp;
+    for (const auto& node : nodes)
+        disp.push_back(std::dynamic_pointer_cast<ChNodeFEAxyz>(node)->GetPos());
+
+    for (int i = 0; i < 20; i++)
+        sys.DoStepDynamics(1e-3);
+
+    num_batches = batched ? mesh->GetNumElementBatches() : 0;
+
+    for (size_t i = 0; i < nodes.size(); i++)
+        disp[i] = std::dynamic_pointer_cast<ChNodeFEAxyz>(nodes[i])->GetPos() - disp[i];
+    return disp;
+}
+
+static void Compare(MeshCreator create, double alpha) {
+    unsigned int num_batches;
+    auto disp_ref = Simulate(create, alpha, false, num_batches);
+    auto disp = Simulate(create, alpha, true, num_batches);
+    ASSERT_GT(num_batches, 0u);
+
+    // Free end must have moved under gravity
+    ASSERT_LT(disp_ref.back().z(), -1e-6);
+
+    ASSERT_EQ(disp.size(), disp_ref.size());
+    for (size_t i = 0; i < disp.size(); i++)
+        ASSERT_NEAR((disp[i] - disp_ref[i]).Length(), 0.0, 1e-10);
+}
+
+TEST(ChElementANCFBatch, beam_3333) {
+    Compare(CreateBeam, 0.0);
+}
+
+TEST(ChElementANCFBatch, beam_3333_damping) {
+    Compare(CreateBeam, 0.01);
+}
+
+TEST(ChElementANCFBatch, hexa_3843) {
+    Compare(CreateHexa, 0.0);
+}
+
+TEST(ChElementANCFBatch, hexa_3843_damping) {
+    Compare(CreateHexa, 0.01);
+}
+
+TEST(ChElementANCFBatch, beam_3243) {
+    Compare(CreateBeam3243, 0.0);
+}
+
+TEST(ChElementANCFBatch, beam_3243_damping) {
+    Compare(CreateBeam3243, 0.01);
+}
+
+TEST(ChElementANCFBatch, shell_3443) {
+    Compare(CreateShell3443, 0.0);
+}
+
+TEST(ChElementANCFBatch, shell_3443_damping) {
+    Compare(CreateShell3443, 0.01);
+}
+
+TEST(ChElementANCFBatch, shell_3833) {
+    Compare(CreateShell3833, 0.0);
+}
+
+TEST(ChElementANCFBatch, shell_3833_damping) {
+    Compare(CreateShell3833, 0.01);
+}
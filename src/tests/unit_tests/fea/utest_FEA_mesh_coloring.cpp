@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the colored assembly of FEA residuals in ChMesh.
+// A plate of ANCF shell elements is simulated with one and with multiple Chrono
+// threads. The element coloring of a structured quad grid must use 4 colors and
+// the results must be identical.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+static std::vector<ChVector3d> Simulate(int num_threads, unsigned int& num_colors) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.8));
+    sys.SetNumThreads(num_threads, 1, 1);
+
+    auto solver = chrono_types::make_shared<ChSolverMINRES>();
+    solver->SetMaxIterations(200);
+    solver->SetTolerance(1e-12);
+    sys.SetSolver(solver);
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, 2.1e7, 0.3);
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    int n = 8;
+    double dx = 1.0 / n;
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= n; j++) {
+            auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector3d(i * dx, j * dx, 0), ChVector3d(0, 0, 1));
+            node->SetFixed(i == 0);
+            mesh->AddNode(node);
+            nodes.push_back(node);
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            int n0 = i * (n + 1) + j;
+            auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+            element->SetNodes(nodes[n0], nodes[n0 + n + 1], nodes[n0 + n + 2], nodes[n0 + 1]);
+            element->SetDimensions(dx, dx);
+            element->AddLayer(0.01, 0, mat);
+            element->SetAlphaDamp(0.01);
+            mesh->AddElement(element);
+        }
+    }
+
+    for (int i = 0; i < 20; i++)
+        sys.DoStepDynamics(1e-3);
+
+    num_colors = mesh->GetNumElementColors();
+
+    std::vector<ChVector3d> pos;
+    for (const auto& node : nodes)
+        pos.push_back(node->GetPos());
+    return pos;
+}
+
+TEST(ChMesh, colored_assembly) {
+    unsigned int num_colors;
+    auto pos_ref = Simulate(1, num_colors);
+    ASSERT_EQ(num_colors, 4u);
+
+    // Tip must have moved under gravity
+    ASSERT_LT(pos_ref.back().z(), -1e-6);
+
+    auto pos = Simulate(4, num_colors);
+    ASSERT_EQ(num_colors, 4u);
+    for (size_t i = 0; i < pos.size(); i++)
+        ASSERT_NEAR((pos[i] - pos_ref[i]).Length(), 0.0, 1e-12);
+}
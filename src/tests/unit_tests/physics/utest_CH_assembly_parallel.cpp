@@ -0,0 +1,124 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the parallel processing of ChAssembly items.
+// A grid of bodies connected by springs and joints (with many links sharing
+// the same bodies, including a hub body connected to all others) is simulated
+// with one and with multiple Chrono threads. In the parallel run, links are
+// processed in groups of links that do not share bodies, and the links of the
+// hub body that do not fit in a group are processed serially. The states of
+// the two runs must match.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Simulate the system with the given number of Chrono threads and return the state of all bodies.
+static void Simulate(int num_threads, ChVectorDynamic<>& x, ChVectorDynamic<>& v) {
+    ChSystemNSC sys;
+    sys.SetNumThreads(num_threads, 1, 1);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    // Grid of bodies, with the first row connected to ground through revolute joints
+    const int n = 10;
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            auto body = chrono_types::make_shared<ChBody>();
+            body->SetMass(1.0 + 0.01 * (i + j));
+            body->SetInertiaXX(ChVector3d(0.1, 0.1, 0.1));
+            body->SetPos(ChVector3d(i, j, 0));
+            sys.AddBody(body);
+            bodies.push_back(body);
+
+            if (i == 0) {
+                auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+                joint->Initialize(ground, body, ChFrame<>(ChVector3d(-0.5, j, 0), QuatFromAngleX(CH_PI_2)));
+                sys.AddLink(joint);
+            }
+        }
+    }
+
+    // Springs between neighboring bodies
+    auto add_spring = [&sys](std::shared_ptr<ChBody> b1, std::shared_ptr<ChBody> b2, double k) {
+        auto spring = chrono_types::make_shared<ChLinkTSDA>();
+        spring->Initialize(b1, b2, false, b1->GetPos(), b2->GetPos());
+        spring->SetSpringCoefficient(k);
+        spring->SetDampingCoefficient(10);
+        sys.AddLink(spring);
+    };
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (i + 1 < n)
+                add_spring(bodies[i * n + j], bodies[(i + 1) * n + j], 1e3);
+            if (j + 1 < n)
+                add_spring(bodies[i * n + j], bodies[i * n + j + 1], 1e3);
+        }
+    }
+
+    // Hub body connected to all grid bodies (more links than available groups)
+    auto hub = chrono_types::make_shared<ChBody>();
+    hub->SetMass(5.0);
+    hub->SetInertiaXX(ChVector3d(1, 1, 1));
+    hub->SetPos(ChVector3d(0.5 * (n - 1), 0.5 * (n - 1), -1));
+    sys.AddBody(hub);
+    for (const auto& body : bodies)
+        add_spring(hub, body, 1e2);
+
+    for (int i = 0; i < 50; i++)
+        sys.DoStepDynamics(1e-3);
+
+    bodies.push_back(hub);
+    x.resize(7 * bodies.size());
+    v.resize(6 * bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        x.segment(7 * i, 3) = bodies[i]->GetPos().eigen();
+        x.segment(7 * i + 3, 4) = bodies[i]->GetRot().eigen();
+        v.segment(6 * i, 3) = bodies[i]->GetPosDt().eigen();
+        v.segment(6 * i + 3, 3) = bodies[i]->GetAngVelParent().eigen();
+    }
+}
+
+TEST(ChAssembly, parallel_links) {
+    ChVectorDynamic<> x_ref, v_ref;
+    Simulate(1, x_ref, v_ref);
+
+    // The grid must have deformed under gravity
+    ASSERT_GT(std::abs(x_ref(7 * 99 + 2)), 1e-4);
+
+    for (int num_threads : {2, 4}) {
+        ChVectorDynamic<> x, v;
+        Simulate(num_threads, x, v);
+        ASSERT_EQ(x.size(), x_ref.size());
+        ASSERT_EQ(v.size(), v_ref.size());
+        ASSERT_NEAR((x - x_ref).lpNorm<Eigen::Infinity>(), 0.0, 1e-10);
+        ASSERT_NEAR((v - v_ref).lpNorm<Eigen::Infinity>(), 0.0, 1e-10);
+    }
+}
@@ -0,0 +1,240 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for binary state checkpoints.
+// A system is simulated, checkpointed, and further simulated. An identical
+// system is then restored from the checkpoint and simulated for the same
+// number of steps. States must match bit-exactly. Also checks that the NSC
+// contact warm-start data is saved and restored.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/serialization/ChStateCheckpoint.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Create a chain of pendulums connected with revolute joints.
+static void CreateChain(ChSystem& sys) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto prev = ground;
+    for (int i = 0; i < 5; i++) {
+        auto body = chrono_types::make_shared<ChBodyEasyBox>(1.0, 0.1, 0.1, 1000, false, false);
+        body->SetPos(ChVector3d(i + 0.5, 0, 0));
+        sys.AddBody(body);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(prev, body, ChFrame<>(ChVector3d(i, 0, 0), QUNIT));
+        sys.AddLink(joint);
+
+        prev = body;
+    }
+}
+
+// Gather the state of the given system.
+static void GetState(ChSystem& sys, ChVectorDynamic<>& xv) {
+    ChState x(sys.GetNumCoordsPosLevel(), &sys);
+    ChStateDelta v(sys.GetNumCoordsVelLevel(), &sys);
+    double T;
+    sys.StateGather(x, v, T);
+    xv.resize(x.size() + v.size() + 1);
+    xv << x, v, T;
+}
+
+static void TestChain(bool compress, bool memory_map) {
+    const std::string filename = "checkpoint_chain.dat";
+    const double step = 1e-3;
+
+    ChSystemNSC sys1;
+    CreateChain(sys1);
+    for (int i = 0; i < 50; i++)
+        sys1.DoStepDynamics(step);
+
+    ChVectorDynamic<> state1;
+    GetState(sys1, state1);
+
+    {
+        ChStateCheckpoint checkpoint;
+        checkpoint.EnableCompression(compress);
+        checkpoint.AddSystem(sys1);
+        ASSERT_TRUE(checkpoint.Write(filename));
+    }
+
+    for (int i = 0; i < 50; i++)
+        sys1.DoStepDynamics(step);
+
+    // Restore the checkpoint in a new system
+    ChSystemNSC sys2;
+    CreateChain(sys2);
+
+    ChStateCheckpoint checkpoint;
+    ASSERT_TRUE(checkpoint.Read(filename, memory_map));
+    ASSERT_TRUE(checkpoint.RestoreSystem(sys2));
+    std::remove(filename.c_str());
+
+    ChVectorDynamic<> state2;
+    GetState(sys2, state2);
+    ASSERT_EQ(state1.size(), state2.size());
+    for (int i = 0; i < state1.size(); i++)
+        ASSERT_EQ(state1[i], state2[i]);
+
+    for (int i = 0; i < 50; i++)
+        sys2.DoStepDynamics(step);
+
+    GetState(sys1, state1);
+    GetState(sys2, state2);
+    for (int i = 0; i < state1.size(); i++)
+        ASSERT_EQ(state1[i], state2[i]);
+}
+
+TEST(ChStateCheckpoint, chain) {
+    TestChain(false, false);
+}
+
+TEST(ChStateCheckpoint, chain_compressed) {
+    TestChain(true, false);
+}
+
+TEST(ChStateCheckpoint, chain_memory_mapped) {
+    TestChain(false, true);
+    TestChain(true, true);
+}
+
+TEST(ChStateCheckpoint, topology_mismatch) {
+    ChSystemNSC sys1;
+    CreateChain(sys1);
+    ChStateCheckpoint checkpoint;
+    checkpoint.AddSystem(sys1);
+
+    ChSystemNSC sys2;
+    CreateChain(sys2);
+    sys2.AddBody(chrono_types::make_shared<ChBody>());
+    ASSERT_FALSE(checkpoint.RestoreSystem(sys2));
+}
+
+TEST(ChStateCheckpoint, blocks) {
+    const std::string filename = "checkpoint_blocks.dat";
+
+    std::vector<double> data(1000, 0.0);
+    for (size_t i = 0; i < data.size(); i += 10)
+        data[i] = 1.0 / (i + 1);
+    std::vector<char> text = {'s', 't', 'a', 't', 'e'};
+
+    ChStateCheckpoint checkpoint;
+    checkpoint.EnableCompression(true);
+    checkpoint.AddBlock("data", data.data(), data.size() * sizeof(double));
+    checkpoint.AddBlock("text", std::vector<char>(text));
+    checkpoint.AddBlock("empty", nullptr, 0);
+    ASSERT_TRUE(checkpoint.Write(filename));
+
+    ChStateCheckpoint checkpoint2;
+    ASSERT_TRUE(checkpoint2.Read(filename));
+    std::remove(filename.c_str());
+
+    size_t size;
+    auto data2 = reinterpret_cast<const double*>(checkpoint2.GetBlock("data", size));
+    ASSERT_EQ(size, data.size() * sizeof(double));
+    for (size_t i = 0; i < data.size(); i++)
+        ASSERT_EQ(data[i], data2[i]);
+
+    auto text2 = checkpoint2.GetBlock("text", size);
+    ASSERT_EQ(std::vector<char>(text2, text2 + size), text);
+
+    ASSERT_TRUE(checkpoint2.HasBlock("empty"));
+    ASSERT_FALSE(checkpoint2.HasBlock("missing"));
+}
+
+// Create a system with a ball on a fixed box (contacts are added directly to the contact container).
+static std::shared_ptr<ChContactContainerNSC> CreateContact(ChSystemNSC& sys) {
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    ground->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 4, 4, 1),
+                              ChFrame<>(ChVector3d(0, 0, -0.5)));
+    sys.AddBody(ground);
+
+    auto ball = chrono_types::make_shared<ChBody>();
+    ball->SetPos(ChVector3d(0, 0, 0.5));
+    ball->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat, 0.5));
+    sys.AddBody(ball);
+
+    auto container = std::static_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer());
+    container->EnableReactionCache(true);
+    return container;
+}
+
+// Add contacts between the two bodies at the given points, in a new collision detection pass.
+static void AddContacts(ChSystemNSC& sys, const std::vector<ChVector3d>& points) {
+    auto container = sys.GetContactContainer();
+    container->BeginAddContact();
+    for (const auto& p : points) {
+        ChCollisionInfo cinfo;
+        cinfo.modelA = sys.GetBodies()[0]->GetCollisionModel().get();
+        cinfo.modelB = sys.GetBodies()[1]->GetCollisionModel().get();
+        cinfo.shapeA = cinfo.modelA->GetShapeInstance(0).first.get();
+        cinfo.shapeB = cinfo.modelB->GetShapeInstance(0).first.get();
+        cinfo.vpA = p;
+        cinfo.vpB = p - ChVector3d(0, 0, 0.001);
+        cinfo.vN = ChVector3d(0, 0, 1);
+        cinfo.distance = -0.001;
+        container->AddContact(cinfo);
+    }
+    container->EndAddContact();
+}
+
+TEST(ChStateCheckpoint, contact_warm_start) {
+    ChSystemNSC sys1;
+    auto container1 = CreateContact(sys1);
+    AddContacts(sys1, {ChVector3d(0.1, 0, 0), ChVector3d(-0.1, 0, 0)});
+    ChVectorDynamic<> L(6);
+    L << 10, 1, 2, 20, 3, 4;
+    container1->IntStateScatterReactions(0, L);
+
+    ChStateCheckpoint checkpoint;
+    checkpoint.AddSystem(sys1);
+    ASSERT_TRUE(checkpoint.HasBlock("contact.reaction_cache"));
+
+    ChSystemNSC sys2;
+    auto container2 = CreateContact(sys2);
+    ASSERT_TRUE(checkpoint.RestoreSystem(sys2));
+    ASSERT_EQ(container2->GetNumContacts(), 0u);
+    ASSERT_EQ(container2->GetReactionCache().size(), 2u);
+
+    // Contacts created at the next collision detection pass are warm started from the restored cache
+    AddContacts(sys2, {ChVector3d(-0.102, 0, 0), ChVector3d(0.101, 0, 0)});
+    ASSERT_EQ(container2->GetNumCachedContacts(), 2u);
+
+    ChVectorDynamic<> L2(6);
+    container2->IntStateGatherReactions(0, L2);
+    ASSERT_EQ(L2(0), 20);
+    ASSERT_EQ(L2(1), 3);
+    ASSERT_EQ(L2(2), 4);
+    ASSERT_EQ(L2(3), 10);
+    ASSERT_EQ(L2(4), 1);
+    ASSERT_EQ(L2(5), 2);
+}
@@ -0,0 +1,165 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the pool of contact objects used by the contact containers.
+// Checks the reuse of contact objects over successive collision detection
+// passes, the growth of the pool past one memory block (contact addresses must
+// stay valid), and the release of unused contact objects.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChContactPool.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Mock contact type, counting constructions and destructions.
+class TestContact {
+  public:
+    TestContact(int id) : m_id(id) { num_constructed++; }
+    ~TestContact() { num_destroyed++; }
+
+    void Reset(int id) { m_id = id; }
+    int GetId() const { return m_id; }
+
+    static int num_constructed;
+    static int num_destroyed;
+
+  private:
+    int m_id;
+};
+
+int TestContact::num_constructed = 0;
+int TestContact::num_destroyed = 0;
+
+typedef ChContactPool<TestContact> TestPool;
+
+// Activate the given number of contacts, reusing existing objects first (as done by the contact containers).
+static std::vector<TestContact*> AddContacts(TestPool& pool, int num_contacts) {
+    std::vector<TestContact*> contacts;
+    for (int i = 0; i < num_contacts; i++) {
+        TestContact* contact = pool.Reuse();
+        if (contact)
+            contact->Reset(i);
+        else
+            contact = pool.Emplace(i);
+        contacts.push_back(contact);
+    }
+    return contacts;
+}
+
+TEST(ChContactPool, reuse) {
+    TestContact::num_constructed = 0;
+    TestContact::num_destroyed = 0;
+
+    TestPool pool;
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.Reuse(), nullptr);
+
+    // First pass: all contacts are constructed
+    auto contacts1 = AddContacts(pool, 100);
+    ASSERT_EQ(pool.size(), 100u);
+    ASSERT_EQ(pool.capacity(), 100u);
+    ASSERT_EQ(TestContact::num_constructed, 100);
+
+    // Second pass, with fewer contacts: existing objects are reused in order, none is constructed or destroyed
+    pool.Rewind();
+    ASSERT_TRUE(pool.empty());
+    auto contacts2 = AddContacts(pool, 60);
+    ASSERT_EQ(pool.size(), 60u);
+    ASSERT_EQ(pool.capacity(), 100u);
+    ASSERT_EQ(TestContact::num_constructed, 100);
+    ASSERT_EQ(TestContact::num_destroyed, 0);
+    for (size_t i = 0; i < contacts2.size(); i++)
+        ASSERT_EQ(contacts2[i], contacts1[i]);
+
+    // Only the active contacts are visited
+    int count = 0;
+    for (auto contact : pool) {
+        ASSERT_EQ(contact->GetId(), count);
+        ASSERT_EQ(contact, pool[count]);
+        count++;
+    }
+    ASSERT_EQ(count, 60);
+
+    // Third pass, with more contacts: all inactive objects are reused before new ones are constructed
+    pool.Rewind();
+    auto contacts3 = AddContacts(pool, 120);
+    ASSERT_EQ(pool.size(), 120u);
+    ASSERT_EQ(pool.capacity(), 120u);
+    ASSERT_EQ(TestContact::num_constructed, 120);
+    for (size_t i = 0; i < contacts1.size(); i++)
+        ASSERT_EQ(contacts3[i], contacts1[i]);
+
+    pool.Clear();
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.capacity(), 0u);
+    ASSERT_EQ(TestContact::num_destroyed, 120);
+}
+
+TEST(ChContactPool, growth) {
+    TestContact::num_constructed = 0;
+    TestContact::num_destroyed = 0;
+
+    {
+        TestPool pool;
+
+        // Grow past several memory blocks (the address of the first contact must not change)
+        const int num_contacts = 3 * (int)TestPool::BLOCK_SIZE + 10;
+        std::vector<TestContact*> contacts;
+        for (int i = 0; i < num_contacts; i++) {
+            contacts.push_back(pool.Emplace(i));
+            ASSERT_EQ(pool[0], contacts[0]);
+        }
+        ASSERT_EQ(pool.size(), (size_t)num_contacts);
+        ASSERT_EQ(pool.capacity(), (size_t)num_contacts);
+
+        // Contact addresses did not change and contacts are contiguous within each block
+        for (int i = 0; i < num_contacts; i++) {
+            ASSERT_EQ(pool[i], contacts[i]);
+            ASSERT_EQ(contacts[i]->GetId(), i);
+            if (i % TestPool::BLOCK_SIZE != 0) {
+                ASSERT_EQ(contacts[i], contacts[i - 1] + 1);
+            }
+        }
+
+        // Trimming with most contacts active keeps all objects
+        pool.Trim();
+        ASSERT_EQ(pool.capacity(), (size_t)num_contacts);
+
+        // Trimming with few active contacts releases all but one block of inactive objects
+        pool.Rewind();
+        AddContacts(pool, 10);
+        pool.Trim();
+        ASSERT_EQ(pool.size(), 10u);
+        ASSERT_EQ(pool.capacity(), 2 * TestPool::BLOCK_SIZE);
+        ASSERT_EQ(TestContact::num_destroyed, num_contacts - 2 * (int)TestPool::BLOCK_SIZE);
+        for (int i = 0; i < 10; i++)
+            ASSERT_EQ(pool[i], contacts[i]);
+
+        // Grow again past the released blocks
+        pool.Rewind();
+        auto contacts2 = AddContacts(pool, num_contacts);
+        ASSERT_EQ(pool.capacity(), (size_t)num_contacts);
+        for (int i = 0; i < num_contacts; i++)
+            ASSERT_EQ(contacts2[i]->GetId(), i);
+        ASSERT_EQ(TestContact::num_constructed, 2 * num_contacts - 2 * (int)TestPool::BLOCK_SIZE);
+    }
+
+    // All contact objects are destroyed with the pool
+    ASSERT_EQ(TestContact::num_destroyed, TestContact::num_constructed);
+}
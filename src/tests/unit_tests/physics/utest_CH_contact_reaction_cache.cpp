@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the persistent reaction cache of the NSC contact container.
+// Contacts between the same pair of collision shapes are added in consecutive
+// collision detection passes. Reactions set on a contact must be carried over
+// to the matching contact of the next pass (used to warm start the solver).
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+class ReactionCacheTest : public ::testing::Test {
+  protected:
+    ReactionCacheTest();
+
+    // Add contacts at the given points (in the absolute frame) in a new collision detection pass.
+    void AddContacts(const std::vector<ChVector3d>& points);
+
+    ChSystemNSC sys;
+    std::shared_ptr<ChBody> ground;
+    std::shared_ptr<ChBody> ball;
+    std::shared_ptr<ChContactContainerNSC> container;
+};
+
+ReactionCacheTest::ReactionCacheTest() {
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    ground->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 4, 4, 1),
+                              ChFrame<>(ChVector3d(0, 0, -0.5)));
+    sys.AddBody(ground);
+
+    ball = chrono_types::make_shared<ChBody>();
+    ball->SetPos(ChVector3d(0, 0, 0.5));
+    ball->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat, 0.5));
+    sys.AddBody(ball);
+
+    container = std::static_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer());
+    container->EnableReactionCache(true);
+    container->SetReactionCacheTolerance(0.01);
+}
+
+void ReactionCacheTest::AddContacts(const std::vector<ChVector3d>& points) {
+    container->BeginAddContact();
+    for (const auto& p : points) {
+        ChCollisionInfo cinfo;
+        cinfo.modelA = ground->GetCollisionModel().get();
+        cinfo.modelB = ball->GetCollisionModel().get();
+        cinfo.shapeA = cinfo.modelA->GetShapeInstance(0).first.get();
+        cinfo.shapeB = cinfo.modelB->GetShapeInstance(0).first.get();
+        cinfo.vpA = p;
+        cinfo.vpB = p - ChVector3d(0, 0, 0.001);
+        cinfo.vN = ChVector3d(0, 0, 1);
+        cinfo.distance = -0.001;
+        container->AddContact(cinfo);
+    }
+    container->EndAddContact();
+}
+
+TEST_F(ReactionCacheTest, warm_start) {
+    // First pass: no cached reactions
+    AddContacts({ChVector3d(0.1, 0, 0), ChVector3d(-0.1, 0, 0)});
+    ASSERT_EQ(container->GetNumContacts(), 2u);
+    ASSERT_EQ(container->GetNumCachedContacts(), 0u);
+
+    ChVectorDynamic<> L(6);
+    L << 10, 1, 2, 20, 3, 4;
+    container->IntStateScatterReactions(0, L);
+
+    // Second pass: contacts moved slightly and reported in reverse order
+    AddContacts({ChVector3d(-0.102, 0, 0), ChVector3d(0.101, 0, 0)});
+    ASSERT_EQ(container->GetNumCachedContacts(), 2u);
+
+    ChVectorDynamic<> L1(6);
+    container->IntStateGatherReactions(0, L1);
+    ASSERT_DOUBLE_EQ(L1(0), 20);
+    ASSERT_DOUBLE_EQ(L1(1), 3);
+    ASSERT_DOUBLE_EQ(L1(2), 4);
+    ASSERT_DOUBLE_EQ(L1(3), 10);
+    ASSERT_DOUBLE_EQ(L1(4), 1);
+    ASSERT_DOUBLE_EQ(L1(5), 2);
+
+    // Third pass: one contact persists, one is new (too far from any previous contact point)
+    AddContacts({ChVector3d(0.101, 0, 0), ChVector3d(0.3, 0, 0)});
+    ASSERT_EQ(container->GetNumCachedContacts(), 1u);
+
+    ChVectorDynamic<> L2(6);
+    container->IntStateGatherReactions(0, L2);
+    ASSERT_DOUBLE_EQ(L2(0), 10);
+    ASSERT_DOUBLE_EQ(L2(3), 0);
+    ASSERT_DOUBLE_EQ(L2(4), 0);
+    ASSERT_DOUBLE_EQ(L2(5), 0);
+}
+
+TEST_F(ReactionCacheTest, disabled) {
+    container->EnableReactionCache(false);
+
+    AddContacts({ChVector3d(0.1, 0, 0)});
+    ChVectorDynamic<> L(3);
+    L << 10, 1, 2;
+    container->IntStateScatterReactions(0, L);
+
+    AddContacts({ChVector3d(0.1, 0, 0)});
+    ASSERT_EQ(container->GetNumCachedContacts(), 0u);
+
+    ChVectorDynamic<> L1(3);
+    container->IntStateGatherReactions(0, L1);
+    ASSERT_DOUBLE_EQ(L1(0), 0);
+    ASSERT_DOUBLE_EQ(L1(1), 0);
+    ASSERT_DOUBLE_EQ(L1(2), 0);
+}
@@ -0,0 +1,310 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the batched, multithreaded SMC contact force calculation.
+// A pile of spheres is simulated with the default SMC force algorithm (batched
+// calculation) and with a user-provided reference algorithm, a copy of the
+// original scalar implementation (contact forces calculated one at a time).
+// Results must match to round-off, with one and with multiple threads.
+//
+// =============================================================================
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChContactSMC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Reference force algorithm: original scalar implementation of the default SMC force calculation.
+// Since this is not the default algorithm, contact forces are calculated one contact at a time.
+class ReferenceForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueSMC {
+  public:
+    virtual ChWrenchd CalculateForceTorque(
+        const ChSystemSMC& sys,                    ///< containing system
+        const ChVector3d& normal_dir,              ///< normal contact direction (expressed in global frame)
+        const ChVector3d& p1,                      ///< most penetrated point on obj1 (expressed in global frame)
+        const ChVector3d& p2,                      ///< most penetrated point on obj2 (expressed in global frame)
+        const ChVector3d& vel1,                    ///< velocity of contact point on obj1 (expressed in global frame)
+        const ChVector3d& vel2,                    ///< velocity of contact point on obj2 (expressed in global frame)
+        const ChContactMaterialCompositeSMC& mat,  ///< composite material for contact pair
+        double delta,                              ///< overlap in normal direction
+        double eff_radius,                         ///< effective radius of curvature at contact
+        double mass1,                              ///< mass of obj1
+        double mass2,                              ///< mass of obj2
+        ChContactable* objA,                       ///< pointer to contactable obj1
+        ChContactable* objB                        ///< pointer to contactable obj2
+    ) const override {
+        // Set contact force to zero if no penetration.
+        if (delta <= 0) {
+            return {VNULL, VNULL};
+        }
+
+        // Extract parameters from containing system
+        double dT = sys.GetStep();
+        bool use_mat_props = sys.UsingMaterialProperties();
+        ChSystemSMC::ContactForceModel contact_model = sys.GetContactForceModel();
+        ChSystemSMC::AdhesionForceModel adhesion_model = sys.GetAdhesionForceModel();
+        ChSystemSMC::TangentialDisplacementModel tdispl_model = sys.GetTangentialDisplacementModel();
+
+        // Relative velocity at contact
+        ChVector3d relvel = vel2 - vel1;
+        double relvel_n_mag = relvel.Dot(normal_dir);
+        ChVector3d relvel_n = relvel_n_mag * normal_dir;
+        ChVector3d relvel_t = relvel - relvel_n;
+        double relvel_t_mag = relvel_t.Length();
+
+        // Calculate effective mass
+        double eff_mass = mass1 * mass2 / (mass1 + mass2);
+
+        // Calculate stiffness and viscous damping coefficients.
+        // All models use the following formulas for normal and tangential forces:
+        //     Fn = kn * delta_n - gn * v_n
+        //     Ft = kt * delta_t - gt * v_t
+        double kn = 0;
+        double kt = 0;
+        double gn = 0;
+        double gt = 0;
+
+        constexpr double eps = std::numeric_limits<double>::epsilon();
+
+        switch (contact_model) {
+            case ChSystemSMC::Flores:
+                // Currently not implemented.  Fall through to Hooke.
+            case ChSystemSMC::Hooke:
+                if (use_mat_props) {
+                    double tmp_k = (16.0 / 15) * std::sqrt(eff_radius) * mat.E_eff;
+                    double v2 = sys.GetCharacteristicImpactVelocity() * sys.GetCharacteristicImpactVelocity();
+                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+                    loge = (mat.cr_eff > 1 - eps) ? std::log(1 - eps) : loge;
+                    double tmp_g = 1 + std::pow(CH_PI / loge, 2);
+                    kn = tmp_k * std::pow(eff_mass * v2 / tmp_k, 1.0 / 5);
+                    kt = kn;
+                    gn = std::sqrt(4 * eff_mass * kn / tmp_g);
+                    gt = gn;
+                } else {
+                    kn = mat.kn;
+                    kt = mat.kt;
+                    gn = eff_mass * mat.gn;
+                    gt = eff_mass * mat.gt;
+                }
+
+                break;
+
+            case ChSystemSMC::Hertz:
+                if (use_mat_props) {
+                    double sqrt_Rd = std::sqrt(eff_radius * delta);
+                    double Sn = 2 * mat.E_eff * sqrt_Rd;
+                    double St = 8 * mat.G_eff * sqrt_Rd;
+                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+                    double beta = loge / std::sqrt(loge * loge + CH_PI * CH_PI);
+                    kn = (2.0 / 3) * Sn;
+                    kt = St;
+                    gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
+                    gt = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(St * eff_mass);
+                } else {
+                    double tmp = eff_radius * std::sqrt(delta);
+                    kn = tmp * mat.kn;
+                    kt = tmp * mat.kt;
+                    gn = tmp * eff_mass * mat.gn;
+                    gt = tmp * eff_mass * mat.gt;
+                }
+
+                break;
+
+            case ChSystemSMC::PlainCoulomb:
+                if (use_mat_props) {
+                    double sqrt_Rd = std::sqrt(delta);
+                    double Sn = 2 * mat.E_eff * sqrt_Rd;
+                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+                    double beta = loge / std::sqrt(loge * loge + CH_PI * CH_PI);
+                    kn = (2.0 / 3) * Sn;
+                    gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
+                } else {
+                    double tmp = std::sqrt(delta);
+                    kn = tmp * mat.kn;
+                    gn = tmp * mat.gn;
+                }
+
+                kt = 0;
+                gt = 0;
+
+                {
+                    double forceN = kn * delta - gn * relvel_n_mag;
+                    if (forceN < 0)
+                        forceN = 0;
+                    double forceT = mat.mu_eff * std::tanh(5.0 * relvel_t_mag) * forceN;
+                    switch (adhesion_model) {
+                        case ChSystemSMC::AdhesionForceModel::Perko:
+                            // Currently not implemented.  Fall through to Constant.
+                        case ChSystemSMC::AdhesionForceModel::Constant:
+                            forceN -= mat.adhesion_eff;
+                            break;
+                        case ChSystemSMC::AdhesionForceModel::DMT:
+                            forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
+                            break;
+                    }
+                    ChVector3d force = forceN * normal_dir;
+                    if (relvel_t_mag >= sys.GetSlipVelocityThreshold())
+                        force -= (forceT / relvel_t_mag) * relvel_t;
+
+                    return {force, VNULL};  // zero torque anyway
+                }
+        }
+
+        // Tangential displacement (magnitude)
+        double delta_t = 0;
+        switch (tdispl_model) {
+            case ChSystemSMC::OneStep:
+                delta_t = relvel_t_mag * dT;
+                break;
+            case ChSystemSMC::MultiStep:
+                //// TODO: implement proper MultiStep mode
+                delta_t = relvel_t_mag * dT;
+                break;
+            default:
+                break;
+        }
+
+        // Calculate the magnitudes of the normal and tangential contact forces
+        double forceN = kn * delta - gn * relvel_n_mag;
+        double forceT = kt * delta_t + gt * relvel_t_mag;
+
+        // If the resulting normal contact force is negative, the two shapes are moving
+        // away from each other so fast that no contact force is generated.
+        if (forceN < 0) {
+            forceN = 0;
+            forceT = 0;
+        }
+
+        // Include adhesion force
+        switch (adhesion_model) {
+            case ChSystemSMC::AdhesionForceModel::Perko:
+                // Currently not implemented.  Fall through to Constant.
+            case ChSystemSMC::AdhesionForceModel::Constant:
+                forceN -= mat.adhesion_eff;
+                break;
+            case ChSystemSMC::AdhesionForceModel::DMT:
+                forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
+                break;
+        }
+
+        // Coulomb law
+        forceT = std::min<double>(forceT, mat.mu_eff * std::abs(forceN));
+
+        // Accumulate normal and tangential forces
+        ChVector3d force = forceN * normal_dir;
+        if (relvel_t_mag >= sys.GetSlipVelocityThreshold())
+            force -= (forceT / relvel_t_mag) * relvel_t;
+
+        return {force, VNULL};  // zero torque anyway
+    }
+};
+
+// Create a pile of spheres above a fixed box and return the spheres.
+static std::vector<std::shared_ptr<ChBody>> CreatePile(ChSystemSMC& sys) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetYoungModulus(1e6f);
+    mat->SetFriction(0.4f);
+    mat->SetRestitution(0.2f);
+    mat->SetKn(2e6f);
+    mat->SetKt(2e6f);
+    mat->SetGn(40);
+    mat->SetGt(20);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    ground->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 4, 4, 0.2),
+                              ChFrame<>(ChVector3d(0, 0, -0.1)));
+    ground->EnableCollision(true);
+    sys.AddBody(ground);
+
+    const double radius = 0.05;
+    std::vector<std::shared_ptr<ChBody>> spheres;
+    for (int ix = 0; ix < 10; ix++) {
+        for (int iy = 0; iy < 10; iy++) {
+            for (int iz = 0; iz < 3; iz++) {
+                auto sphere = chrono_types::make_shared<ChBody>();
+                sphere->SetMass(1);
+                sphere->SetInertiaXX(ChVector3d(0.4 * radius * radius));
+                sphere->SetPos(ChVector3d(2 * radius * ix + 0.002 * iz, 2 * radius * iy, radius + 1.98 * radius * iz));
+                sphere->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat, radius));
+                sphere->EnableCollision(true);
+                sys.AddBody(sphere);
+                spheres.push_back(sphere);
+            }
+        }
+    }
+
+    return spheres;
+}
+
+static void TestPile(ChSystemSMC::ContactForceModel model, bool use_mat_props, int num_threads, double tolerance) {
+    ChSystemSMC sys1;
+    sys1.SetContactForceModel(model);
+    sys1.UseMaterialProperties(use_mat_props);
+    sys1.SetNumThreads(num_threads, 1);
+    auto spheres1 = CreatePile(sys1);
+
+    ChSystemSMC sys2;
+    sys2.SetContactForceModel(model);
+    sys2.UseMaterialProperties(use_mat_props);
+    sys2.SetContactForceTorqueAlgorithm(chrono_types::make_unique<ReferenceForceTorqueSMC>());
+    auto spheres2 = CreatePile(sys2);
+
+    const double step = 1e-4;
+    for (int i = 0; i < 200; i++) {
+        sys1.DoStepDynamics(step);
+        sys2.DoStepDynamics(step);
+    }
+
+    ASSERT_GT(sys1.GetNumContacts(), 256u);
+    ASSERT_EQ(sys1.GetNumContacts(), sys2.GetNumContacts());
+    for (size_t i = 0; i < spheres1.size(); i++) {
+        ASSERT_NEAR((spheres1[i]->GetPos() - spheres2[i]->GetPos()).Length(), 0, tolerance);
+        ASSERT_NEAR((spheres1[i]->GetPosDt() - spheres2[i]->GetPosDt()).Length(), 0, tolerance);
+    }
+}
+
+TEST(ChContactContainerSMC, batch_hooke) {
+    TestPile(ChSystemSMC::ContactForceModel::Hooke, true, 1, 1e-10);
+}
+
+TEST(ChContactContainerSMC, batch_hertz) {
+    TestPile(ChSystemSMC::ContactForceModel::Hertz, true, 1, 1e-10);
+}
+
+TEST(ChContactContainerSMC, batch_coulomb) {
+    TestPile(ChSystemSMC::ContactForceModel::PlainCoulomb, true, 1, 1e-10);
+}
+
+TEST(ChContactContainerSMC, batch_hooke_coefficients) {
+    TestPile(ChSystemSMC::ContactForceModel::Hooke, false, 1, 1e-10);
+}
+
+TEST(ChContactContainerSMC, batch_hertz_coefficients) {
+    TestPile(ChSystemSMC::ContactForceModel::Hertz, false, 1, 1e-10);
+}
+
+TEST(ChContactContainerSMC, batch_coulomb_coefficients) {
+    TestPile(ChSystemSMC::ContactForceModel::PlainCoulomb, false, 1, 1e-10);
+}
+
+TEST(ChContactContainerSMC, batch_hertz_mt) {
+    TestPile(ChSystemSMC::ContactForceModel::Hertz, true, 4, 1e-10);
+}
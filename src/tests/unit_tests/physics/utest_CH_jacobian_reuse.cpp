@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for reuse of the Newton matrix across steps in implicit integrators
+// (JacobianUpdate::AUTOMATIC). A double pendulum with a spring-damper is
+// simulated with HHT, Euler implicit, and Newmark. Results obtained when
+// reusing the Newton matrix across steps are compared against those obtained
+// when updating the matrix at each step.
+//
+// =============================================================================
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+class JacobianReuseTest : public ::testing::TestWithParam<ChTimestepper::Type> {
+  protected:
+    JacobianReuseTest() {}
+
+    std::shared_ptr<ChBody> CreateModel(ChSystemSMC& sys, ChImplicitIterativeTimestepper::JacobianUpdate method);
+};
+
+std::shared_ptr<ChBody> JacobianReuseTest::CreateModel(ChSystemSMC& sys,
+                                                       ChImplicitIterativeTimestepper::JacobianUpdate method) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto body1 = chrono_types::make_shared<ChBody>();
+    body1->SetMass(1);
+    body1->SetInertiaXX(ChVector3d(0.1, 0.1, 0.1));
+    body1->SetPos(ChVector3d(0.5, 0, 0));
+    sys.AddBody(body1);
+
+    auto body2 = chrono_types::make_shared<ChBody>();
+    body2->SetMass(1);
+    body2->SetInertiaXX(ChVector3d(0.1, 0.1, 0.1));
+    body2->SetPos(ChVector3d(1.5, 0, 0));
+    sys.AddBody(body2);
+
+    auto rev1 = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev1->Initialize(body1, ground, ChFrame<>(ChVector3d(0, 0, 0), QuatFromAngleX(CH_PI_2)));
+    sys.AddLink(rev1);
+
+    auto rev2 = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev2->Initialize(body2, body1, ChFrame<>(ChVector3d(1, 0, 0), QuatFromAngleX(CH_PI_2)));
+    sys.AddLink(rev2);
+
+    auto spring = chrono_types::make_shared<ChLinkTSDA>();
+    spring->Initialize(body2, ground, false, ChVector3d(1.5, 0, 0), ChVector3d(1.5, 0, 1));
+    spring->SetSpringCoefficient(50);
+    spring->SetDampingCoefficient(1);
+    sys.AddLink(spring);
+
+    auto solver = chrono_types::make_shared<ChSolverSparseQR>();
+    solver->LockSparsityPattern(true);
+    sys.SetSolver(solver);
+
+    sys.SetTimestepperType(GetParam());
+    auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys.GetTimestepper());
+    integrator->SetJacobianUpdateMethod(method);
+    integrator->SetMaxIters(20);
+    integrator->SetAbsTolerances(1e-8);
+    if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper()))
+        hht->SetStepControl(false);
+
+    return body2;
+}
+
+TEST_P(JacobianReuseTest, compare_every_step) {
+    using JacobianUpdate = ChImplicitIterativeTimestepper::JacobianUpdate;
+
+    ChSystemSMC sys_ref;
+    auto body_ref = CreateModel(sys_ref, JacobianUpdate::EVERY_STEP);
+    auto integrator_ref = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys_ref.GetTimestepper());
+
+    ChSystemSMC sys_auto;
+    auto body_auto = CreateModel(sys_auto, JacobianUpdate::AUTOMATIC);
+    auto integrator_auto = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys_auto.GetTimestepper());
+
+    unsigned int num_setups_ref = 0;
+    unsigned int num_setups_auto = 0;
+    unsigned int num_avoided_auto = 0;
+
+    double step = 1e-3;
+    while (sys_ref.GetChTime() < 1.0) {
+        sys_ref.DoStepDynamics(step);
+        sys_auto.DoStepDynamics(step);
+
+        num_setups_ref += integrator_ref->GetNumSetupCalls();
+        num_setups_auto += integrator_auto->GetNumSetupCalls();
+        num_avoided_auto += integrator_auto->GetNumSetupsAvoided();
+    }
+
+    // The Newton matrix must be reused across steps, but not in all steps
+    ASSERT_GT(num_setups_auto, 1u);
+    ASSERT_LT(num_setups_auto, num_setups_ref);
+    ASSERT_GT(num_avoided_auto, 0u);
+
+    ASSERT_NEAR((body_ref->GetPos() - body_auto->GetPos()).Length(), 0.0, 1e-4);
+    ASSERT_NEAR((body_ref->GetPosDt() - body_auto->GetPosDt()).Length(), 0.0, 1e-3);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoTimestepper,
+                         JacobianReuseTest,
+                         ::testing::Values(ChTimestepper::Type::HHT,
+                                           ChTimestepper::Type::EULER_IMPLICIT,
+                                           ChTimestepper::Type::NEWMARK));
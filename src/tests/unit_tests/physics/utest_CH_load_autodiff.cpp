@@ -0,0 +1,141 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for custom load Jacobians computed with automatic differentiation.
+// A nonlinear spring-damper between two bodies (plus a rotational spring acting
+// on the orientation of the first body) is implemented once as a regular
+// ChLoadCustomMultiple (finite-difference Jacobians) and once with dual numbers
+// (ChLoadCustomAD). Generalized forces and Jacobians must agree. The same
+// loads are then updated in parallel in a load container.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChLoadContainer.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const double k = 1000;    // spring stiffness
+static const double c = 10;      // damping coefficient
+static const double L0 = 0.5;    // free length
+static const double kt = 200;    // rotational stiffness
+
+// Generalized forces, for states of generic scalar type.
+// x = [pA, qA, pB, qB], w = [vA, wA, vB, wB]; Q = [FA, TA, FB, TB].
+template <typename Real, typename VecX, typename VecW, typename VecQ>
+static void Forces(const VecX& x, const VecW& w, VecQ& Q) {
+    Real d[3], v[3];
+    for (int i = 0; i < 3; i++) {
+        d[i] = x[7 + i] - x[i];
+        v[i] = w[6 + i] - w[i];
+    }
+    using std::sqrt;
+    Real L = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+    Real Ldot = (d[0] * v[0] + d[1] * v[1] + d[2] * v[2]) / L;
+    Real f = k * (L - L0) + c * Ldot;
+    for (int i = 0; i < 3; i++) {
+        Real F = f * d[i] / L;
+        Q[i] = F;
+        Q[6 + i] = -F;
+        Q[3 + i] = -kt * x[4 + i];  // torque on A, from the vector part of its quaternion
+        Q[9 + i] = Real(0);
+    }
+}
+
+class SpringFD : public ChLoadCustomMultiple {
+  public:
+    SpringFD(std::shared_ptr<ChBody> A, std::shared_ptr<ChBody> B) : ChLoadCustomMultiple(A, B) {}
+    virtual SpringFD* Clone() const override { return new SpringFD(*this); }
+    virtual bool IsStiff() override { return true; }
+    virtual void ComputeQ(ChState* x, ChStateDelta* w) override { Forces<double>(*x, *w, load_Q); }
+};
+
+class SpringAD : public ChLoadCustomAD<ChLoadCustomMultiple, 24> {
+  public:
+    SpringAD(std::shared_ptr<ChBody> A, std::shared_ptr<ChBody> B) : ChLoadCustomAD(A, B) {}
+    virtual SpringAD* Clone() const override { return new SpringAD(*this); }
+    virtual bool IsStiff() override { return true; }
+    virtual void ComputeDualQ(const std::vector<Dual>& x, const std::vector<Dual>& w, std::vector<Dual>& Q) override {
+        Forces<Dual>(x, w, Q);
+    }
+};
+
+TEST(ChLoadCustomAD, jacobians) {
+    ChSystemNSC sys;
+
+    auto bodyA = chrono_types::make_shared<ChBody>();
+    bodyA->SetPos(ChVector3d(0.1, -0.2, 0.3));
+    bodyA->SetRot(QuatFromAngleAxis(0.4, ChVector3d(1, 2, 3).GetNormalized()));
+    bodyA->SetPosDt(ChVector3d(0.5, 0.1, -0.2));
+    bodyA->SetAngVelLocal(ChVector3d(0.3, -0.1, 0.2));
+    sys.AddBody(bodyA);
+
+    auto bodyB = chrono_types::make_shared<ChBody>();
+    bodyB->SetPos(ChVector3d(0.7, 0.3, -0.1));
+    bodyB->SetPosDt(ChVector3d(-0.1, 0.4, 0.3));
+    sys.AddBody(bodyB);
+
+    auto loadFD = chrono_types::make_shared<SpringFD>(bodyA, bodyB);
+    auto loadAD = chrono_types::make_shared<SpringAD>(bodyA, bodyB);
+
+    auto container = chrono_types::make_shared<ChLoadContainer>();
+    container->Add(loadFD);
+    container->Add(loadAD);
+    sys.Add(container);
+
+    sys.SetNumThreads(2);
+    container->EnableParallelUpdate(true);
+    sys.Setup();
+    sys.Update();
+
+    auto jacFD = loadFD->GetJacobians();
+    auto jacAD = loadAD->GetJacobians();
+    ASSERT_TRUE(jacFD != nullptr);
+    ASSERT_TRUE(jacAD != nullptr);
+
+    ASSERT_NEAR((loadAD->GetQ() - loadFD->GetQ()).lpNorm<Eigen::Infinity>(), 0.0, 1e-12);
+    ASSERT_GT(jacAD->K.lpNorm<Eigen::Infinity>(), 0.0);
+    ASSERT_GT(jacAD->R.lpNorm<Eigen::Infinity>(), 0.0);
+
+    // Finite differences (forward, step 1e-8) are accurate to about 1e-6 relative to the Jacobian norms
+    double tolK = 1e-5 * jacAD->K.lpNorm<Eigen::Infinity>();
+    double tolR = 1e-5 * jacAD->R.lpNorm<Eigen::Infinity>();
+    ASSERT_NEAR((jacAD->K - jacFD->K).lpNorm<Eigen::Infinity>(), 0.0, tolK);
+    ASSERT_NEAR((jacAD->R - jacFD->R).lpNorm<Eigen::Infinity>(), 0.0, tolR);
+}
+
+TEST(ChDual, mixed_operations) {
+    typedef ad::ChDual<2> Dual;
+    Dual x = Dual::Variable(0.5, 0);
+    Dual y = Dual::Variable(-2.0, 1);
+
+    // Comparisons between dual numbers and plain values
+    ASSERT_TRUE(x > 0.0);
+    ASSERT_TRUE(0.0 > y);
+    ASSERT_TRUE(x >= 0.5 && x <= 0.5 && x == 0.5);
+    ASSERT_TRUE(y != 0.0 && y < x);
+
+    // Elementary functions, found by argument-dependent lookup
+    Dual f = sqrt(x) * abs(y) + sin(x * y);
+    double ref = std::sqrt(0.5) * 2.0 + std::sin(-1.0);
+    ASSERT_NEAR(f.value(), ref, 1e-14);
+    ASSERT_NEAR(f.grad(0), 0.5 / std::sqrt(0.5) * 2.0 + std::cos(-1.0) * (-2.0), 1e-14);
+    ASSERT_NEAR(f.grad(1), -std::sqrt(0.5) + std::cos(-1.0) * 0.5, 1e-14);
+
+    // Standard overloads are unaffected for plain arguments
+    ASSERT_EQ(abs(-3), 3);
+    ASSERT_DOUBLE_EQ(std::pow(2.0, 3.0), 8.0);
+}
@@ -0,0 +1,133 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the structure-of-arrays particle cloud.
+// Identical granular columns are simulated with a ChParticleCloud and with a
+// ChParticleCloudSoA (SMC contact, Bullet collision). Particle trajectories
+// must match.
+//
+// =============================================================================
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChParticleCloud.h"
+#include "chrono/physics/ChParticleCloudSoA.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const double radius = 0.1;
+static const double mass = 1.0;
+static const double inertia = 0.4 * mass * radius * radius;
+
+// Initial particle positions: a few staggered columns of spheres above the ground.
+static std::vector<ChVector3d> ParticlePositions() {
+    std::vector<ChVector3d> pos;
+    for (int ix = 0; ix < 3; ix++)
+        for (int iy = 0; iy < 3; iy++)
+            for (int iz = 0; iz < 4; iz++)
+                pos.push_back(ChVector3d(2.1 * radius * ix + 0.01 * iz, 2.1 * radius * iy, radius + 2.1 * radius * iz));
+    return pos;
+}
+
+static void CreateGround(ChSystemSMC& sys, std::shared_ptr<ChContactMaterialSMC> mat) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    ground->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 4, 4, 0.2),
+                              ChFrame<>(ChVector3d(0, 0, -0.1)));
+    ground->EnableCollision(true);
+    sys.AddBody(ground);
+}
+
+TEST(ChParticleCloudSoA, free_flight) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto cloud = chrono_types::make_shared<ChParticleCloudSoA>();
+    cloud->SetMass(mass);
+    cloud->SetInertiaXX(ChVector3d(inertia, inertia, inertia));
+    cloud->AddParticle(ChVector3d(0, 0, 0), QUNIT, ChVector3d(1, 0, 0));
+    cloud->AddParticle(ChVector3d(1, 0, 0));
+    cloud->SetParticleForce(1, ChVector3d(0, 0, 9.81 * mass));
+    cloud->SetParticleAngVelLocal(1, ChVector3d(0, 0, 2));
+    sys.Add(cloud);
+
+    const double step = 1e-3;
+    for (int i = 0; i < 1000; i++)
+        sys.DoStepDynamics(step);
+
+    // Particle 0 follows a ballistic trajectory, particle 1 (gravity compensated) spins in place
+    double t = sys.GetChTime();
+    ASSERT_NEAR(cloud->GetParticlePos(0).x(), t, 1e-10);
+    ASSERT_NEAR(cloud->GetParticlePos(0).z(), -0.5 * 9.81 * t * t, 1e-2);
+    ASSERT_NEAR(cloud->GetParticleVel(0).z(), -9.81 * t, 1e-8);
+    ASSERT_NEAR((cloud->GetParticlePos(1) - ChVector3d(1, 0, 0)).Length(), 0, 1e-10);
+    ASSERT_NEAR(cloud->GetParticleRot(1).GetRotVec().z(), 2 * t, 1e-8);
+}
+
+TEST(ChParticleCloudSoA, granular_column) {
+    auto positions = ParticlePositions();
+
+    // Reference system, using a ChParticleCloud
+    ChSystemSMC sys1;
+    auto mat1 = chrono_types::make_shared<ChContactMaterialSMC>();
+    CreateGround(sys1, mat1);
+    auto cloud1 = chrono_types::make_shared<ChParticleCloud>();
+    cloud1->SetMass(mass);
+    cloud1->SetInertiaXX(ChVector3d(inertia, inertia, inertia));
+    cloud1->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat1, radius));
+    for (const auto& pos : positions)
+        cloud1->AddParticle(ChCoordsys<>(pos, QUNIT));
+    cloud1->EnableCollision(true);
+    sys1.Add(cloud1);
+
+    // Same system, using a ChParticleCloudSoA
+    ChSystemSMC sys2;
+    auto mat2 = chrono_types::make_shared<ChContactMaterialSMC>();
+    CreateGround(sys2, mat2);
+    auto cloud2 = chrono_types::make_shared<ChParticleCloudSoA>();
+    cloud2->SetMass(mass);
+    cloud2->SetInertiaXX(ChVector3d(inertia, inertia, inertia));
+    cloud2->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat2, radius));
+    cloud2->Reserve(positions.size());
+    for (const auto& pos : positions)
+        cloud2->AddParticle(pos);
+    cloud2->EnableCollision(true);
+    sys2.Add(cloud2);
+
+    ASSERT_EQ(cloud2->GetNumParticles(), positions.size());
+    ASSERT_EQ(sys1.GetNumCoordsPosLevel(), sys2.GetNumCoordsPosLevel());
+
+    const double step = 1e-4;
+    for (int i = 0; i < 2000; i++) {
+        sys1.DoStepDynamics(step);
+        sys2.DoStepDynamics(step);
+    }
+
+    ASSERT_GT(sys2.GetNumContacts(), 0u);
+    ASSERT_EQ(sys1.GetNumContacts(), sys2.GetNumContacts());
+    for (unsigned int j = 0; j < (unsigned int)positions.size(); j++) {
+        ASSERT_NEAR((cloud1->GetParticlePos(j) - cloud2->GetParticlePos(j)).Length(), 0, 1e-6);
+        ASSERT_NEAR((cloud1->GetParticleVel(j) - cloud2->GetParticleVel(j)).Length(), 0, 1e-5);
+    }
+
+    // Particles added after initialization of the collision system also collide
+    unsigned int n = cloud2->AddParticle(ChVector3d(1.5, 1.5, radius - 0.01));
+    sys2.DoStepDynamics(step);
+    ASSERT_GT(cloud2->GetParticleVel(n).z(), 0);
+}
@@ -0,0 +1,131 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for incremental matrix assembly in ChDirectSolverLS.
+// A chain of pendulums is simulated with a sparse direct solver, with and
+// without incremental assembly. Results must be identical and, with a fixed
+// topology, the symbolic analysis must be performed only once. Removing a
+// joint must trigger a rebuild of the matrix pattern.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+class IncrementalAssemblyTest : public ::testing::TestWithParam<bool> {
+  protected:
+    IncrementalAssemblyTest() {}
+
+    std::vector<std::shared_ptr<ChLinkLock>> CreateModel(ChSystemNSC& sys,
+                                                         std::vector<std::shared_ptr<ChBody>>& bodies);
+};
+
+std::vector<std::shared_ptr<ChLinkLock>> IncrementalAssemblyTest::CreateModel(
+    ChSystemNSC& sys,
+    std::vector<std::shared_ptr<ChBody>>& bodies) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChLinkLock>> joints;
+
+    int num_links = 6;
+    double length = 0.5;
+    auto prev = ground;
+    for (int i = 0; i < num_links; i++) {
+        auto link = chrono_types::make_shared<ChBody>();
+        link->SetMass(1);
+        link->SetInertiaXX(ChVector3d(0.1, 0.1, 0.1));
+        link->SetPos(ChVector3d((i + 0.5) * length, 0, 0));
+        sys.AddBody(link);
+        bodies.push_back(link);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(link, prev, ChFrame<>(ChVector3d(i * length, 0, 0), QuatFromAngleX(CH_PI_2)));
+        sys.AddLink(joint);
+        joints.push_back(joint);
+
+        prev = link;
+    }
+
+    return joints;
+}
+
+TEST_P(IncrementalAssemblyTest, compare_standard) {
+    bool use_qr = GetParam();
+
+    std::shared_ptr<ChDirectSolverLS> solver_ref;
+    std::shared_ptr<ChDirectSolverLS> solver_inc;
+    if (use_qr) {
+        solver_ref = chrono_types::make_shared<ChSolverSparseQR>();
+        solver_inc = chrono_types::make_shared<ChSolverSparseQR>();
+    } else {
+        solver_ref = chrono_types::make_shared<ChSolverSparseLU>();
+        solver_inc = chrono_types::make_shared<ChSolverSparseLU>();
+    }
+    solver_inc->UseIncrementalAssembly(true);
+
+    ChSystemNSC sys_ref;
+    std::vector<std::shared_ptr<ChBody>> bodies_ref;
+    auto joints_ref = CreateModel(sys_ref, bodies_ref);
+    sys_ref.SetSolver(solver_ref);
+
+    ChSystemNSC sys_inc;
+    std::vector<std::shared_ptr<ChBody>> bodies_inc;
+    auto joints_inc = CreateModel(sys_inc, bodies_inc);
+    sys_inc.SetSolver(solver_inc);
+
+    int num_steps = 100;
+    for (int i = 0; i < num_steps; i++) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys_inc.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_EQ(solver_inc->GetNumSetupCalls(), (unsigned int)num_steps);
+    ASSERT_EQ(solver_inc->GetNumAnalyzeCalls(), 1u);
+
+    for (size_t i = 0; i < bodies_ref.size(); i++) {
+        ASSERT_NEAR((bodies_ref[i]->GetPos() - bodies_inc[i]->GetPos()).Length(), 0.0, 1e-12);
+        ASSERT_NEAR((bodies_ref[i]->GetPosDt() - bodies_inc[i]->GetPosDt()).Length(), 0.0, 1e-10);
+    }
+
+    // Remove the last joint: the matrix pattern must be rebuilt exactly once
+    sys_ref.RemoveLink(joints_ref.back());
+    sys_inc.RemoveLink(joints_inc.back());
+
+    for (int i = 0; i < num_steps; i++) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys_inc.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_EQ(solver_inc->GetNumAnalyzeCalls(), 2u);
+
+    for (size_t i = 0; i < bodies_ref.size(); i++) {
+        ASSERT_NEAR((bodies_ref[i]->GetPos() - bodies_inc[i]->GetPos()).Length(), 0.0, 1e-12);
+        ASSERT_NEAR((bodies_ref[i]->GetPosDt() - bodies_inc[i]->GetPosDt()).Length(), 0.0, 1e-10);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoSolver, IncrementalAssemblyTest, ::testing::Values(false, true));
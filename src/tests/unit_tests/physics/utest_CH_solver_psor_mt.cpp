@@ -0,0 +1,133 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the multithreaded, graph-colored PSOR solver.
+// The model consists of a chain of pendulums (bilateral constraints) and a set
+// of balls resting in a box container (frictional contacts). The results
+// obtained with ChSolverPSORmt are compared against those obtained with the
+// serial ChSolverPSOR / ChSolverPSSOR solvers.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORmt.h"
+#include "chrono/solver/ChSolverPSSOR.h"
+#include "chrono/utils/ChUtilsCreators.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+class PSORmtTest : public ::testing::TestWithParam<bool> {
+  protected:
+    PSORmtTest() {}
+
+    std::vector<std::shared_ptr<ChBody>> CreateModel(ChSystemNSC& sys);
+    void Simulate(ChSystemNSC& sys, int num_steps);
+};
+
+std::vector<std::shared_ptr<ChBody>> PSORmtTest::CreateModel(ChSystemNSC& sys) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+
+    auto material = chrono_types::make_shared<ChContactMaterialNSC>();
+    material->SetFriction(0.4f);
+    material->SetRestitution(0);
+
+    auto ground = utils::CreateBoxContainer(&sys, material, ChVector3d(4, 4, 0.2), 0.1);
+
+    // Chain of pendulums hanging from a fixed point above the container
+    int num_links = 5;
+    double length = 0.5;
+    auto prev = ground;
+    for (int i = 0; i < num_links; i++) {
+        auto link = chrono_types::make_shared<ChBody>();
+        link->SetMass(1);
+        link->SetInertiaXX(ChVector3d(0.1, 0.1, 0.1));
+        link->SetPos(ChVector3d(-1 + (i + 0.5) * length, 0, 4));
+        sys.AddBody(link);
+        bodies.push_back(link);
+
+        auto joint = chrono_types::make_shared<ChLinkLockSpherical>();
+        joint->Initialize(link, prev, ChFrame<>(ChVector3d(-1 + i * length, 0, 4)));
+        sys.AddLink(joint);
+
+        prev = link;
+    }
+
+    // Balls resting on the container floor
+    double radius = 0.1;
+    double mass = 5;
+    for (int i = 0; i < 8; i++) {
+        auto ball = chrono_types::make_shared<ChBody>();
+        ball->SetMass(mass);
+        ball->SetInertiaXX(0.4 * mass * radius * radius * ChVector3d(1, 1, 1));
+        ball->SetPos(ChVector3d(-1.5 + i * 3 * radius, 0.5, radius + 0.01));
+        ball->EnableCollision(true);
+        ball->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(material, radius));
+        sys.AddBody(ball);
+        bodies.push_back(ball);
+    }
+
+    return bodies;
+}
+
+void PSORmtTest::Simulate(ChSystemNSC& sys, int num_steps) {
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(1e-3);
+}
+
+TEST_P(PSORmtTest, compare_serial) {
+    bool symmetric = GetParam();
+
+    ChSystemNSC sys_ref;
+    auto bodies_ref = CreateModel(sys_ref);
+    std::shared_ptr<ChIterativeSolverVI> solver_ref;
+    if (symmetric)
+        solver_ref = chrono_types::make_shared<ChSolverPSSOR>();
+    else
+        solver_ref = chrono_types::make_shared<ChSolverPSOR>();
+    solver_ref->SetMaxIterations(500);
+    solver_ref->SetTolerance(1e-12);
+    sys_ref.SetSolver(solver_ref);
+
+    ChSystemNSC sys_mt;
+    auto bodies_mt = CreateModel(sys_mt);
+    auto solver_mt = chrono_types::make_shared<ChSolverPSORmt>();
+    solver_mt->SetNumThreads(4);
+    solver_mt->EnableSymmetricSweep(symmetric);
+    solver_mt->SetMaxIterations(500);
+    solver_mt->SetTolerance(1e-12);
+    sys_mt.SetSolver(solver_mt);
+
+    Simulate(sys_ref, 200);
+    Simulate(sys_mt, 200);
+
+    ASSERT_EQ(sys_ref.GetContactContainer()->GetNumContacts(), sys_mt.GetContactContainer()->GetNumContacts());
+    ASSERT_GT(solver_mt->GetNumColors(), 1u);
+
+    for (size_t i = 0; i < bodies_ref.size(); i++) {
+        ASSERT_NEAR((bodies_ref[i]->GetPos() - bodies_mt[i]->GetPos()).Length(), 0.0, 1e-6);
+        ASSERT_NEAR((bodies_ref[i]->GetPosDt() - bodies_mt[i]->GetPosDt()).Length(), 0.0, 1e-5);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoSolver, PSORmtTest, ::testing::Values(false, true));
@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for saving and restoring the SCM grid state with checkpoints.
+// A sphere is dragged over an SCM terrain patch and the grid state is saved in
+// a checkpoint file. The checkpoint is then restored in the same terrain (after
+// further deformation) and in a new terrain, and the grid nodes are compared.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <map>
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/serialization/ChStateCheckpoint.h"
+
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+typedef std::map<std::pair<int, int>, double> NodeLevels;
+
+// SCM terrain with a sphere moving over it.
+class SCMTest {
+  public:
+    SCMTest() : step(0) {
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        terrain = chrono_types::make_unique<SCMTerrain>(&sys, false);
+
+        auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+        ball = chrono_types::make_shared<ChBody>();
+        ball->SetFixed(true);
+        ball->EnableCollision(true);
+        ball->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat, 0.2));
+        sys.AddBody(ball);
+
+        terrain->SetSoilParameters(2e6, 0, 1.1, 0, 30, 0.01, 4e7, 3e4);
+        terrain->AddMovingPatch(ball, VNULL, ChVector3d(0.5, 0.5, 0.5));
+        terrain->Initialize(10.0, 2.0, 0.02);
+    }
+
+    void Simulate(int num_steps) {
+        for (int i = 0; i < num_steps; i++, step++) {
+            ball->SetPos(ChVector3d(-4 + 8e-3 * step, 0, 0.15));
+            sys.DoStepDynamics(1e-3);
+        }
+    }
+
+    NodeLevels GetLevels() const {
+        NodeLevels levels;
+        for (const auto& n : terrain->GetModifiedNodes(true))
+            levels[std::make_pair(n.first.x(), n.first.y())] = n.second;
+        return levels;
+    }
+
+    ChSystemSMC sys;
+    std::unique_ptr<SCMTerrain> terrain;
+    std::shared_ptr<ChBody> ball;
+    int step;
+};
+
+static void CompareLevels(const NodeLevels& levels, const NodeLevels& levels_ref) {
+    ASSERT_EQ(levels.size(), levels_ref.size());
+    for (const auto& l : levels_ref) {
+        auto itr = levels.find(l.first);
+        ASSERT_TRUE(itr != levels.end());
+        ASSERT_EQ(itr->second, l.second);
+    }
+}
+
+TEST(SCMTerrain, checkpoint) {
+    const std::string filename = "scm_checkpoint_test.dat";
+
+    SCMTest test;
+    test.Simulate(500);
+    auto levels_ref = test.GetLevels();
+    ASSERT_GT(levels_ref.size(), 0u);
+
+    ChStateCheckpoint checkpoint;
+    test.terrain->AddToCheckpoint(checkpoint);
+    ASSERT_TRUE(checkpoint.Write(filename));
+
+    // Deform the terrain further, then roll it back to the checkpointed state
+    test.Simulate(300);
+    ASSERT_GT(test.GetLevels().size(), levels_ref.size());
+    ASSERT_TRUE(test.terrain->RestoreFromCheckpoint(checkpoint));
+    CompareLevels(test.GetLevels(), levels_ref);
+
+    // Restore the checkpoint file (memory-mapped or read in memory) in a new terrain
+    for (bool memory_map : {true, false}) {
+        ChStateCheckpoint checkpoint_in;
+        ASSERT_TRUE(checkpoint_in.Read(filename, memory_map));
+        ASSERT_FALSE(test.terrain->RestoreFromCheckpoint(checkpoint_in, "no.such.block"));
+
+        SCMTest test_in;
+        ASSERT_TRUE(test_in.terrain->RestoreFromCheckpoint(checkpoint_in));
+        CompareLevels(test_in.GetLevels(), levels_ref);
+    }
+
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,89 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the tiled storage of SCM grid nodes with paging.
+// A sphere is dragged over an SCM terrain patch. The deformed terrain obtained
+// with paging (in memory and to a swap file) is compared against the one
+// obtained without paging.
+//
+// =============================================================================
+
+#include <map>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Simulate a sphere moving over the SCM terrain and return the levels of all modified grid nodes.
+static std::map<std::pair<int, int>, double> Simulate(int tile_size,
+                                                      bool paging,
+                                                      const std::string& swap_file,
+                                                      int& num_tiles,
+                                                      int& num_resident) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    auto ball = chrono_types::make_shared<ChBody>();
+    ball->SetFixed(true);
+    ball->EnableCollision(true);
+    ball->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat, 0.2));
+    sys.AddBody(ball);
+
+    SCMTerrain terrain(&sys, false);
+    terrain.SetSoilParameters(2e6, 0, 1.1, 0, 30, 0.01, 4e7, 3e4);
+    terrain.AddMovingPatch(ball, VNULL, ChVector3d(0.5, 0.5, 0.5));
+    terrain.SetGridTileSize(tile_size);
+    if (paging)
+        terrain.EnableGridPaging(0.3, swap_file);
+    terrain.Initialize(10.0, 2.0, 0.02);
+
+    double step = 1e-3;
+    for (int i = 0; i < 1000; i++) {
+        ball->SetPos(ChVector3d(-4 + 8e-3 * i, 0, 0.15));
+        sys.DoStepDynamics(step);
+    }
+
+    num_tiles = terrain.GetNumGridTiles();
+    num_resident = terrain.GetNumResidentGridTiles();
+
+    std::map<std::pair<int, int>, double> levels;
+    for (const auto& n : terrain.GetModifiedNodes(true))
+        levels[std::make_pair(n.first.x(), n.first.y())] = n.second;
+    return levels;
+}
+
+TEST(SCMTerrain, grid_paging) {
+    int num_tiles_ref, num_resident_ref;
+    auto levels_ref = Simulate(64, false, "", num_tiles_ref, num_resident_ref);
+    ASSERT_GT(levels_ref.size(), 0u);
+    ASSERT_EQ(num_tiles_ref, num_resident_ref);
+
+    for (const auto& swap_file : {std::string(""), std::string("scm_paging_test.swp")}) {
+        int num_tiles, num_resident;
+        auto levels = Simulate(8, true, swap_file, num_tiles, num_resident);
+        ASSERT_LT(num_resident, num_tiles);
+        ASSERT_EQ(levels.size(), levels_ref.size());
+        for (const auto& l : levels_ref) {
+            auto itr = levels.find(l.first);
+            ASSERT_TRUE(itr != levels.end());
+            ASSERT_DOUBLE_EQ(itr->second, l.second);
+        }
+    }
+}
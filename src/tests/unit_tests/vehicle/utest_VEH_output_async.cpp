@@ -0,0 +1,228 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the asynchronous vehicle output database.
+// Output generated through an asynchronous database is compared against output
+// generated synchronously with the same underlying (ASCII) database. Also checks
+// that frames are dropped (and counted) when the ring buffer is full under the
+// default policy, and that errors of the underlying database are rethrown on the
+// simulation thread.
+//
+// =============================================================================
+
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/output/ChVehicleOutputASCII.h"
+#include "chrono_vehicle/output/ChVehicleOutputAsync.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Chain of pendulums connected by revolute joints, with springs to ground.
+class PendulumChain {
+  public:
+    PendulumChain();
+
+    // Simulate the system and generate output in the given databases at each step.
+    void Simulate(const std::vector<ChVehicleOutput*>& databases, int num_frames);
+
+    ChSystemNSC m_sys;
+    std::vector<std::shared_ptr<ChBody>> m_bodies;
+    std::vector<std::shared_ptr<ChLink>> m_joints;
+    std::vector<std::shared_ptr<ChLinkTSDA>> m_springs;
+};
+
+PendulumChain::PendulumChain() {
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    m_sys.AddBody(ground);
+
+    std::shared_ptr<ChBody> prev = ground;
+    for (int i = 0; i < 4; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetName("link_" + std::to_string(i));
+        body->SetPos(ChVector3d(i + 1.0, 0, 0));
+        m_sys.AddBody(body);
+        m_bodies.push_back(body);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->SetName("revolute_" + std::to_string(i));
+        joint->Initialize(prev, body, ChFrame<>(ChVector3d(i, 0, 0), QUNIT));
+        m_sys.AddLink(joint);
+        m_joints.push_back(joint);
+
+        auto spring = chrono_types::make_shared<ChLinkTSDA>();
+        spring->SetName("spring_" + std::to_string(i));
+        spring->Initialize(ground, body, false, ChVector3d(i + 1.0, 1, 0), ChVector3d(i + 1.0, 0, 0));
+        spring->SetSpringCoefficient(100);
+        spring->SetDampingCoefficient(1);
+        m_sys.AddLink(spring);
+        m_springs.push_back(spring);
+
+        prev = body;
+    }
+}
+
+void PendulumChain::Simulate(const std::vector<ChVehicleOutput*>& databases, int num_frames) {
+    for (int frame = 0; frame < num_frames; frame++) {
+        for (auto database : databases) {
+            database->WriteTime(frame, m_sys.GetChTime());
+            database->WriteSection("bodies");
+            database->WriteBodies(m_bodies);
+            database->WriteSection("joints");
+            database->WriteJoints(m_joints);
+            database->WriteLinSprings(m_springs);
+        }
+        m_sys.DoStepDynamics(1e-3);
+    }
+}
+
+// Output database recording the written frames.
+// Writing blocks while the database is paused; writing a frame with the specified number throws.
+class TestOutput : public ChVehicleOutput {
+  public:
+    TestOutput(int fail_frame = -1) : m_fail_frame(fail_frame), m_paused(false) {}
+
+    void Pause() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_paused = true;
+    }
+
+    void Resume() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_paused = false;
+        m_cv.notify_all();
+    }
+
+    std::vector<int> GetFrames() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_frames;
+    }
+
+  private:
+    virtual void WriteTime(int frame, double time) override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return !m_paused; });
+        if (frame == m_fail_frame)
+            throw std::runtime_error("TestOutput: write failed");
+        m_frames.push_back(frame);
+    }
+    virtual void WriteSection(const std::string& name) override {}
+    virtual void WriteBodyData(const std::vector<BodyData>& bodies) override {}
+    virtual void WriteAuxRefBodyData(const std::vector<AuxRefBodyData>& bodies) override {}
+    virtual void WriteMarkerData(const std::vector<MarkerData>& markers) override {}
+    virtual void WriteShaftData(const std::vector<ShaftData>& shafts) override {}
+    virtual void WriteJointData(const std::vector<JointData>& joints) override {}
+    virtual void WriteCoupleData(const std::vector<CoupleData>& couples) override {}
+    virtual void WriteLinSpringData(const std::vector<LinSpringData>& springs) override {}
+    virtual void WriteRotSpringData(const std::vector<RotSpringData>& springs) override {}
+    virtual void WriteBodyLoadData(const std::vector<BodyLoadData>& loads) override {}
+
+    int m_fail_frame;
+    bool m_paused;
+    std::vector<int> m_frames;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+};
+
+TEST(ChVehicleOutputAsync, ascii) {
+    std::ostringstream sync_stream;
+    std::ostringstream async_stream;
+
+    // Small ring buffer, waiting on a full buffer (so that no frame is dropped)
+    {
+        PendulumChain chain;
+        ChVehicleOutputASCII sync_database(sync_stream);
+        ChVehicleOutputAsync async_database(new ChVehicleOutputASCII(async_stream), 4,
+                                            ChVehicleOutputAsync::FullBufferPolicy::WAIT);
+        chain.Simulate({&sync_database, &async_database}, 100);
+        ASSERT_EQ(async_database.GetNumDroppedFrames(), 0);
+    }
+
+    ASSERT_FALSE(sync_stream.str().empty());
+    ASSERT_EQ(sync_stream.str(), async_stream.str());
+}
+
+TEST(ChVehicleOutputAsync, flush) {
+    PendulumChain chain;
+    std::ostringstream sync_stream;
+    std::ostringstream async_stream;
+
+    ChVehicleOutputASCII ascii_database(sync_stream);
+    ChVehicleOutput& sync_database = ascii_database;
+    ChVehicleOutputAsync async_database(new ChVehicleOutputASCII(async_stream));
+
+    // Write the same frame to both databases; after a flush, the outputs must be identical
+    sync_database.WriteTime(0, 0.0);
+    sync_database.WriteSection("bodies");
+    sync_database.WriteBodies(chain.m_bodies);
+
+    async_database.WriteTime(0, 0.0);
+    async_database.WriteSection("bodies");
+    async_database.WriteBodies(chain.m_bodies);
+    async_database.Flush();
+
+    ASSERT_EQ(sync_stream.str(), async_stream.str());
+}
+
+TEST(ChVehicleOutputAsync, drop) {
+    PendulumChain chain;
+    auto test_database = new TestOutput();
+    ChVehicleOutputAsync database(test_database, 2);
+
+    // While the writer is blocked on frame 0, only frame 1 fits in the ring buffer; frames 2 to 9 are dropped
+    test_database->Pause();
+    chain.Simulate({&database}, 10);
+    ASSERT_EQ(database.GetNumDroppedFrames(), 8);
+
+    // Once the writer proceeds, new frames are written again
+    test_database->Resume();
+    database.Flush();
+    database.WriteTime(10, 0.0);
+    database.WriteSection("bodies");
+    database.WriteBodies(chain.m_bodies);
+    database.Flush();
+
+    ASSERT_EQ(database.GetNumDroppedFrames(), 8);
+    ASSERT_EQ(test_database->GetFrames(), std::vector<int>({0, 1, 10}));
+}
+
+TEST(ChVehicleOutputAsync, error) {
+    PendulumChain chain;
+    auto test_database = new TestOutput(3);
+    ChVehicleOutputAsync database(test_database, 4, ChVehicleOutputAsync::FullBufferPolicy::WAIT);
+
+    // The writer exception is rethrown on the simulation thread, at the latest when flushing
+    bool thrown = false;
+    try {
+        chain.Simulate({&database}, 10);
+        database.Flush();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    ASSERT_TRUE(thrown);
+
+    // The exception is reported only once; frames after the failure are discarded
+    ASSERT_NO_THROW(database.Flush());
+    ASSERT_EQ(test_database->GetFrames(), std::vector<int>({0, 1, 2}));
+}
@@ -0,0 +1,101 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the height-field index of RigidTerrain mesh patches.
+// Terrain heights and normals obtained with the index are compared against those
+// obtained by ray casting into the collision system, for both scalar and batch
+// terrain queries.
+//
+// =============================================================================
+
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Create a rigid terrain with a mesh patch, using or not the height-field index.
+static void CreateTerrain(ChSystemSMC& sys, RigidTerrain& terrain, bool heightmap, bool use_index) {
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    ChCoordsys<> pos(ChVector3d(1, 2, 0.5), QuatFromAngleZ(0.3));
+    if (heightmap)
+        terrain.AddPatch(mat, pos, vehicle::GetDataFile("terrain/height_maps/test64.bmp"), 64, 64, 0, 3);
+    else
+        terrain.AddPatch(mat, pos, vehicle::GetDataFile("terrain/meshes/bump.obj"));
+    terrain.UseMeshIndex(use_index);
+    terrain.Initialize();
+
+    // Take one step so that the collision system is initialized (for ray casting)
+    sys.DoStepDynamics(1e-3);
+}
+
+static void TestPatch(bool heightmap) {
+    ChSystemSMC sys1;
+    sys1.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    RigidTerrain terrain1(&sys1);
+    CreateTerrain(sys1, terrain1, heightmap, false);
+
+    ChSystemSMC sys2;
+    sys2.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    RigidTerrain terrain2(&sys2);
+    CreateTerrain(sys2, terrain2, heightmap, true);
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-40, 40);
+    std::vector<ChVector3d> locs;
+    for (int i = 0; i < 2000; i++)
+        locs.push_back(ChVector3d(dist(gen), dist(gen), 10));
+
+    int num_hits = 0;
+    for (const auto& loc : locs) {
+        double h1, h2;
+        ChVector3d n1, n2;
+        float f1, f2;
+        bool hit1 = terrain1.FindPoint(loc, h1, n1, f1);
+        bool hit2 = terrain2.FindPoint(loc, h2, n2, f2);
+        ASSERT_EQ(hit1, hit2);
+        if (!hit1)
+            continue;
+        num_hits++;
+        ASSERT_NEAR(h1, h2, 1e-5);
+        ASSERT_NEAR((n1 - n2).Length(), 0, 1e-4);
+        ASSERT_EQ(f1, f2);
+    }
+    ASSERT_GT(num_hits, 0);
+
+    // Batch queries (with index) match scalar queries (with ray casting)
+    std::vector<double> heights;
+    std::vector<ChVector3d> normals;
+    std::vector<float> frictions;
+    terrain2.GetProperties(locs, heights, normals, frictions);
+    ASSERT_EQ(heights.size(), locs.size());
+    for (size_t i = 0; i < locs.size(); i++) {
+        ASSERT_NEAR(heights[i], terrain1.GetHeight(locs[i]), 1e-5);
+        ASSERT_NEAR((normals[i] - terrain1.GetNormal(locs[i])).Length(), 0, 1e-4);
+    }
+}
+
+TEST(RigidTerrain, mesh_index_obj) {
+    TestPatch(false);
+}
+
+TEST(RigidTerrain, mesh_index_heightmap) {
+    TestPatch(true);
+}
@@ -0,0 +1,148 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for batched terrain queries.
+// Terrain heights, normals, and coefficients of friction obtained with the
+// batch versions of GetHeights and GetProperties are compared against those
+// obtained with scalar queries, for rigid terrain (multiple box and mesh
+// patches), deformed SCM terrain, and random surface terrain. Query locations
+// include points outside the terrain patches.
+//
+// =============================================================================
+
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RandomSurfaceTerrain.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Generate random query locations in the given box.
+static std::vector<ChVector3d> GenerateLocations(const ChVector3d& min, const ChVector3d& max, int num_locs) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(0, 1);
+    std::vector<ChVector3d> locs;
+    for (int i = 0; i < num_locs; i++)
+        locs.push_back(min + (max - min) * ChVector3d(dist(gen), dist(gen), dist(gen)));
+    return locs;
+}
+
+// Compare batch and scalar queries at the given locations.
+static void CompareQueries(const ChTerrain& terrain, const std::vector<ChVector3d>& locs) {
+    std::vector<double> heights;
+    std::vector<ChVector3d> normals;
+    std::vector<float> frictions;
+    terrain.GetProperties(locs, heights, normals, frictions);
+    ASSERT_EQ(heights.size(), locs.size());
+    ASSERT_EQ(normals.size(), locs.size());
+    ASSERT_EQ(frictions.size(), locs.size());
+
+    std::vector<double> heights_only;
+    terrain.GetHeights(locs, heights_only);
+    ASSERT_EQ(heights_only.size(), locs.size());
+
+    for (size_t i = 0; i < locs.size(); i++) {
+        double height;
+        ChVector3d normal;
+        float friction;
+        terrain.GetProperties(locs[i], height, normal, friction);
+        ASSERT_NEAR(heights[i], height, 1e-10);
+        ASSERT_NEAR((normals[i] - normal).Length(), 0, 1e-10);
+        ASSERT_EQ(frictions[i], friction);
+
+        ASSERT_NEAR(heights[i], terrain.GetHeight(locs[i]), 1e-10);
+        ASSERT_NEAR((normals[i] - terrain.GetNormal(locs[i])).Length(), 0, 1e-10);
+        ASSERT_EQ(frictions[i], terrain.GetCoefficientFriction(locs[i]));
+        ASSERT_NEAR(heights_only[i], heights[i], 1e-10);
+    }
+}
+
+// Rigid terrain with box patches at different heights (one of them tilted) and a mesh patch.
+static void TestRigidTerrain(bool use_index) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    RigidTerrain terrain(&sys);
+    auto mat1 = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat1->SetFriction(0.9f);
+    auto mat2 = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat2->SetFriction(0.6f);
+    terrain.AddPatch(mat1, ChCoordsys<>(ChVector3d(0, 0, 0), QUNIT), 20, 10);
+    terrain.AddPatch(mat2, ChCoordsys<>(ChVector3d(20, 0, 0.5), QuatFromAngleY(-0.1)), 20, 10);
+    terrain.AddPatch(mat1, ChCoordsys<>(ChVector3d(0, 15, -0.5), QuatFromAngleZ(0.3)), 10, 10);
+    terrain.AddPatch(mat2, ChCoordsys<>(ChVector3d(-30, 0, 0.2), QUNIT),
+                     vehicle::GetDataFile("terrain/meshes/bump.obj"));
+    terrain.UseMeshIndex(use_index);
+    terrain.Initialize();
+
+    // Take one step so that the collision system is initialized (for ray casting)
+    sys.DoStepDynamics(1e-3);
+
+    CompareQueries(terrain, GenerateLocations(ChVector3d(-60, -20, 2), ChVector3d(40, 25, 5), 2000));
+}
+
+TEST(TerrainBatch, rigid) {
+    TestRigidTerrain(false);
+}
+
+TEST(TerrainBatch, rigid_mesh_index) {
+    TestRigidTerrain(true);
+}
+
+TEST(TerrainBatch, scm) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    auto ball = chrono_types::make_shared<ChBody>();
+    ball->SetFixed(true);
+    ball->EnableCollision(true);
+    ball->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat, 0.2));
+    sys.AddBody(ball);
+
+    SCMTerrain terrain(&sys, false);
+    terrain.SetPlane(ChCoordsys<>(ChVector3d(0, 0, 0.1), QuatFromAngleZ(0.2)));
+    terrain.SetSoilParameters(2e6, 0, 1.1, 0, 30, 0.01, 4e7, 3e4);
+    terrain.AddMovingPatch(ball, VNULL, ChVector3d(0.5, 0.5, 0.5));
+    terrain.Initialize(4.0, 2.0, 0.02);
+
+    // Deform the terrain along the path of the sphere
+    for (int i = 0; i < 300; i++) {
+        ball->SetPos(ChVector3d(-1 + 8e-3 * i, 0, 0.25));
+        sys.DoStepDynamics(1e-3);
+    }
+    ASSERT_GT(terrain.GetModifiedNodes(true).size(), 0u);
+
+    // Query locations concentrated around the deformed region, and outside the terrain patch
+    auto locs = GenerateLocations(ChVector3d(-1.2, -0.3, 1), ChVector3d(1.6, 0.3, 2), 1000);
+    auto locs_out = GenerateLocations(ChVector3d(-4, -2, 1), ChVector3d(4, 2, 2), 1000);
+    locs.insert(locs.end(), locs_out.begin(), locs_out.end());
+    CompareQueries(terrain, locs);
+}
+
+TEST(TerrainBatch, random_surface) {
+    ChSystemSMC sys;
+    RandomSurfaceTerrain terrain(&sys, 100, 4, 0.1, 0.7f);
+    terrain.Initialize(RandomSurfaceTerrain::SurfaceType::ISO8608_C_NOCORR, 2.0,
+                       RandomSurfaceTerrain::VisualisationType::NONE);
+
+    CompareQueries(terrain, GenerateLocations(ChVector3d(-10, -3, 1), ChVector3d(110, 3, 2), 2000));
+}